@@ -0,0 +1,193 @@
+// Copyright (c) 2024 Betide Studio. All Rights Reserved.
+
+#include "EIKCallbackPool.h"
+#include "EOSShared.h"
+#include "Containers/LockFreeFixedSizeAllocator.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "Misc/ScopeLock.h"
+
+namespace
+{
+	/** One lock free pool per size class, sized for the callback objects seen in practice */
+	struct FEIKCallbackPools
+	{
+		TLockFreeFixedSizeAllocator<64, PLATFORM_CACHE_LINE_SIZE, FThreadSafeCounter> Pool64;
+		TLockFreeFixedSizeAllocator<128, PLATFORM_CACHE_LINE_SIZE, FThreadSafeCounter> Pool128;
+		TLockFreeFixedSizeAllocator<192, PLATFORM_CACHE_LINE_SIZE, FThreadSafeCounter> Pool192;
+		TLockFreeFixedSizeAllocator<256, PLATFORM_CACHE_LINE_SIZE, FThreadSafeCounter> Pool256;
+		TLockFreeFixedSizeAllocator<384, PLATFORM_CACHE_LINE_SIZE, FThreadSafeCounter> Pool384;
+		TLockFreeFixedSizeAllocator<512, PLATFORM_CACHE_LINE_SIZE, FThreadSafeCounter> Pool512;
+	};
+
+	FEIKCallbackPools& GetCallbackPools()
+	{
+		// Intentionally leaked, callbacks can still be freed by other modules during static destruction
+		static FEIKCallbackPools* Pools = new FEIKCallbackPools();
+		return *Pools;
+	}
+
+	struct FEIKCallbackStatsRegistry
+	{
+		FCriticalSection Lock;
+		TMap<FString, FEIKCallbackTypeStats*> StatsByTypeName;
+	};
+
+	FEIKCallbackStatsRegistry& GetCallbackStatsRegistry()
+	{
+		// Intentionally leaked along with the stats, modules hold references to them until they are unloaded
+		static FEIKCallbackStatsRegistry* Registry = new FEIKCallbackStatsRegistry();
+		return *Registry;
+	}
+
+	FAutoConsoleCommand DumpCallbackStatsCommand(
+		TEXT("EIK.DumpCallbackStats"),
+		TEXT("Logs the live, peak and total counts of every type of EOS callback object, and the callback pool usage."),
+		FConsoleCommandDelegate::CreateStatic(&FEIKCallbackStats::Dump));
+}
+
+void* FEIKCallbackAllocator::Allocate(SIZE_T Size)
+{
+	FEIKCallbackPools& Pools = GetCallbackPools();
+	if (Size <= 64)
+	{
+		return Pools.Pool64.Allocate();
+	}
+	if (Size <= 128)
+	{
+		return Pools.Pool128.Allocate();
+	}
+	if (Size <= 192)
+	{
+		return Pools.Pool192.Allocate();
+	}
+	if (Size <= 256)
+	{
+		return Pools.Pool256.Allocate();
+	}
+	if (Size <= 384)
+	{
+		return Pools.Pool384.Allocate();
+	}
+	if (Size <= 512)
+	{
+		return Pools.Pool512.Allocate();
+	}
+	return FMemory::Malloc(Size);
+}
+
+void FEIKCallbackAllocator::Free(void* Ptr, SIZE_T Size)
+{
+	if (!Ptr)
+	{
+		return;
+	}
+
+	FEIKCallbackPools& Pools = GetCallbackPools();
+	if (Size <= 64)
+	{
+		Pools.Pool64.Free(Ptr);
+	}
+	else if (Size <= 128)
+	{
+		Pools.Pool128.Free(Ptr);
+	}
+	else if (Size <= 192)
+	{
+		Pools.Pool192.Free(Ptr);
+	}
+	else if (Size <= 256)
+	{
+		Pools.Pool256.Free(Ptr);
+	}
+	else if (Size <= 384)
+	{
+		Pools.Pool384.Free(Ptr);
+	}
+	else if (Size <= 512)
+	{
+		Pools.Pool512.Free(Ptr);
+	}
+	else
+	{
+		FMemory::Free(Ptr);
+	}
+}
+
+FEIKCallbackTypeStats& FEIKCallbackStats::FindOrAdd(const FString& TypeName)
+{
+	FEIKCallbackStatsRegistry& Registry = GetCallbackStatsRegistry();
+	FScopeLock ScopeLock(&Registry.Lock);
+
+	FEIKCallbackTypeStats*& Stats = Registry.StatsByTypeName.FindOrAdd(TypeName);
+	if (!Stats)
+	{
+		Stats = new FEIKCallbackTypeStats(TypeName);
+	}
+	return *Stats;
+}
+
+FString FEIKCallbackStats::ParseTypeName(const TCHAR* FunctionSignature)
+{
+	// MSVC: "class FEIKCallbackTypeStats &__cdecl TEIKCallbackTypeStats<struct _tagEOS_Foo>::Get(void)"
+	// Clang: "static FEIKCallbackTypeStats &TEIKCallbackTypeStats<_tagEOS_Foo>::Get() [CallbackType = _tagEOS_Foo]"
+	FString Result = FunctionSignature;
+
+	static const FString Prefix = TEXT("TEIKCallbackTypeStats<");
+	static const FString Suffix = TEXT(">::Get");
+	const int32 PrefixIndex = Result.Find(Prefix, ESearchCase::CaseSensitive);
+	const int32 SuffixIndex = Result.Find(Suffix, ESearchCase::CaseSensitive, ESearchDir::FromEnd);
+	if (PrefixIndex != INDEX_NONE && SuffixIndex > PrefixIndex)
+	{
+		const int32 Start = PrefixIndex + Prefix.Len();
+		Result = Result.Mid(Start, SuffixIndex - Start);
+	}
+
+	Result.RemoveFromStart(TEXT("struct "));
+	Result.RemoveFromStart(TEXT("class "));
+	// The SDK's info structs are all typedefs of _tag prefixed structs
+	Result.RemoveFromStart(TEXT("_tag"));
+	return Result;
+}
+
+void FEIKCallbackStats::Dump()
+{
+	TArray<const FEIKCallbackTypeStats*> AllStats;
+	{
+		FEIKCallbackStatsRegistry& Registry = GetCallbackStatsRegistry();
+		FScopeLock ScopeLock(&Registry.Lock);
+		for (const TPair<FString, FEIKCallbackTypeStats*>& Pair : Registry.StatsByTypeName)
+		{
+			AllStats.Add(Pair.Value);
+		}
+	}
+	AllStats.Sort([](const FEIKCallbackTypeStats& A, const FEIKCallbackTypeStats& B) { return A.GetPeakLive() > B.GetPeakLive(); });
+
+	UE_LOG(LogEIKSDK, Log, TEXT("EOS callback objects (%d types):"), AllStats.Num());
+	for (const FEIKCallbackTypeStats* Stats : AllStats)
+	{
+		UE_LOG(LogEIKSDK, Log, TEXT("  %s: Live=%d Peak=%d Total=%llu"), *Stats->GetTypeName(), Stats->GetNumLive(), Stats->GetPeakLive(), Stats->GetNumCreated());
+	}
+
+	FEIKCallbackPools& Pools = GetCallbackPools();
+	UE_LOG(LogEIKSDK, Log, TEXT("EOS callback pools (used/free): 64=%d/%d 128=%d/%d 192=%d/%d 256=%d/%d 384=%d/%d 512=%d/%d"),
+		Pools.Pool64.GetNumUsed().GetValue(), Pools.Pool64.GetNumFree().GetValue(),
+		Pools.Pool128.GetNumUsed().GetValue(), Pools.Pool128.GetNumFree().GetValue(),
+		Pools.Pool192.GetNumUsed().GetValue(), Pools.Pool192.GetNumFree().GetValue(),
+		Pools.Pool256.GetNumUsed().GetValue(), Pools.Pool256.GetNumFree().GetValue(),
+		Pools.Pool384.GetNumUsed().GetValue(), Pools.Pool384.GetNumFree().GetValue(),
+		Pools.Pool512.GetNumUsed().GetValue(), Pools.Pool512.GetNumFree().GetValue());
+}
+
+void FEIKCallbackStats::LogLiveCallbacks()
+{
+	FEIKCallbackStatsRegistry& Registry = GetCallbackStatsRegistry();
+	FScopeLock ScopeLock(&Registry.Lock);
+	for (const TPair<FString, FEIKCallbackTypeStats*>& Pair : Registry.StatsByTypeName)
+	{
+		if (const int32 NumLive = Pair.Value->GetNumLive())
+		{
+			UE_LOG(LogEIKSDK, Warning, TEXT("%d %s callback(s) never completed or were leaked"), NumLive, *Pair.Key);
+		}
+	}
+}
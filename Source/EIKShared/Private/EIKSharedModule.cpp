@@ -8,6 +8,7 @@
 #include "Modules/ModuleManager.h"
 #include "CoreGlobals.h"
 #include "EOSShared.h"
+#include "EIKCallbackPool.h"
 
 #include COMPILED_PLATFORM_HEADER(EOSSDKManager.h)
 
@@ -52,6 +53,9 @@ void FEIKSharedModule::ShutdownModule()
 		SDKManager->Shutdown();
 		SDKManager.Reset();
 	}
+
+	// Every module using the SDK has shut down by now, anything still alive is a request that never completed
+	FEIKCallbackStats::LogLiveCallbacks();
 #endif // WITH_EOS_SDK
 }
 
@@ -520,6 +520,32 @@ IEIKPlatformHandlePtr FEIKSDKManager::CreatePlatform(EOS_Platform_Options& Platf
 	return SharedPlatform;
 }
 
+void FEIKSDKManager::RegisterSharedPlatform(const FString& DeploymentId, const IEIKPlatformHandlePtr& PlatformHandle)
+{
+	if (DeploymentId.IsEmpty() || !PlatformHandle.IsValid())
+	{
+		return;
+	}
+
+	UE_LOG(LogEIKSDK, Verbose, TEXT("Registered shared platform handle: DeploymentId=%s"), *DeploymentId);
+	SharedPlatforms.Emplace(DeploymentId, PlatformHandle);
+}
+
+IEIKPlatformHandlePtr FEIKSDKManager::FindSharedPlatform(const FString& DeploymentId)
+{
+	if (IEIKPlatformHandleWeakPtr* WeakPlatformHandle = SharedPlatforms.Find(DeploymentId))
+	{
+		if (IEIKPlatformHandlePtr Pinned = WeakPlatformHandle->Pin())
+		{
+			return Pinned;
+		}
+
+		UE_LOG(LogEIKSDK, Verbose, TEXT("Removing stale shared platform handle: DeploymentId=%s"), *DeploymentId);
+		SharedPlatforms.Remove(DeploymentId);
+	}
+	return IEIKPlatformHandlePtr();
+}
+
 void FEIKSDKManager::OnConfigSectionsChanged(const FString& IniFilename, const TSet<FString>& SectionNames)
 {
 	if (IniFilename == GEngineIni && SectionNames.Contains(TEXT("EOSSDK")))
@@ -533,6 +559,18 @@ void FEIKSDKManager::LoadConfig()
 	ConfigTickIntervalSeconds = 0.f;
 	GConfig->GetDouble(TEXT("EOSSDK"), TEXT("TickIntervalSeconds"), ConfigTickIntervalSeconds, GEngineIni);
 
+	bConfigAdaptiveTick = false;
+	GConfig->GetBool(TEXT("EOSSDK"), TEXT("bAdaptiveTick"), bConfigAdaptiveTick, GEngineIni);
+
+	ConfigAdaptiveTickActivityWindowSeconds = 2.0;
+	GConfig->GetDouble(TEXT("EOSSDK"), TEXT("AdaptiveTickActivityWindowSeconds"), ConfigAdaptiveTickActivityWindowSeconds, GEngineIni);
+
+	ConfigAdaptiveTickMaxIdleIntervalSeconds = 0.5;
+	GConfig->GetDouble(TEXT("EOSSDK"), TEXT("AdaptiveTickMaxIdleIntervalSeconds"), ConfigAdaptiveTickMaxIdleIntervalSeconds, GEngineIni);
+
+	ConfigAdaptiveTickPendingRequestTimeoutSeconds = 10.0;
+	GConfig->GetDouble(TEXT("EOSSDK"), TEXT("AdaptiveTickPendingRequestTimeoutSeconds"), ConfigAdaptiveTickPendingRequestTimeoutSeconds, GEngineIni);
+
 	SetupTicker();
 }
 
@@ -550,7 +588,9 @@ void FEIKSDKManager::SetupTicker()
 
 	if (ActivePlatforms.Num() > 0)
 	{
-		const double TickIntervalSeconds = ConfigTickIntervalSeconds > SMALL_NUMBER ? ConfigTickIntervalSeconds / ActivePlatforms.Num() : 0.f;
+		// Adaptive ticking decides per frame, so it runs every frame
+		const bool bUseTickInterval = ConfigTickIntervalSeconds > SMALL_NUMBER && !bConfigAdaptiveTick;
+		const double TickIntervalSeconds = bUseTickInterval ? ConfigTickIntervalSeconds / ActivePlatforms.Num() : 0.f;
 #if ENGINE_MAJOR_VERSION == 5
 		TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FEIKSDKManager::Tick), TickIntervalSeconds);
 #else
@@ -559,14 +599,48 @@ void FEIKSDKManager::SetupTicker()
 	}
 }
 
+bool FEIKSDKManager::FAdaptiveTickState::ShouldTick(double NowSeconds, double ActivityWindowSeconds, double MaxIdleIntervalSeconds, double PendingRequestTimeoutSeconds)
+{
+	// Starting or completing a request also notifies, so LastBusySeconds is the time of the last request change
+	const uint32 NotifyCount = FEIKSDKActivity::GetNotifyCount();
+	if (NotifyCount != LastNotifyCount || FEIKSDKActivity::GetNumHolds() > 0)
+	{
+		LastNotifyCount = NotifyCount;
+		LastBusySeconds = NowSeconds;
+	}
+
+	const double IdleSeconds = NowSeconds - LastBusySeconds;
+	const bool bWaitingForRequests = FEIKSDKActivity::GetNumPendingRequests() > 0 && IdleSeconds < PendingRequestTimeoutSeconds;
+	if (bWaitingForRequests || IdleSeconds < ActivityWindowSeconds)
+	{
+		IdleIntervalSeconds = 0.0;
+		return true;
+	}
+
+	if (NowSeconds < NextIdleTickSeconds)
+	{
+		return false;
+	}
+
+	// Start from roughly a frame and double each idle tick up to the configured floor
+	IdleIntervalSeconds = FMath::Clamp(IdleIntervalSeconds * 2.0, 1.0 / 60.0, FMath::Max(MaxIdleIntervalSeconds, 1.0 / 60.0));
+	NextIdleTickSeconds = NowSeconds + IdleIntervalSeconds;
+	return true;
+}
+
 bool FEIKSDKManager::Tick(float)
 {
 	ReleaseReleasedPlatforms();
 
 	if (ActivePlatforms.Num())
 	{
+		if (bConfigAdaptiveTick && !GameThreadAdaptiveTickState.ShouldTick(FPlatformTime::Seconds(), ConfigAdaptiveTickActivityWindowSeconds, ConfigAdaptiveTickMaxIdleIntervalSeconds, ConfigAdaptiveTickPendingRequestTimeoutSeconds))
+		{
+			return true;
+		}
+
 		TArray<EOS_HPlatform> PlatformsToTick;
-		if (ConfigTickIntervalSeconds > SMALL_NUMBER)
+		if (ConfigTickIntervalSeconds > SMALL_NUMBER && !bConfigAdaptiveTick)
 		{
 			PlatformTickIdx = (PlatformTickIdx + 1) % ActivePlatforms.Num();
 			PlatformsToTick.Emplace(ActivePlatforms[PlatformTickIdx]);
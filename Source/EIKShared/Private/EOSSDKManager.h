@@ -40,6 +40,8 @@ public:
 
 	virtual IEIKPlatformHandlePtr CreatePlatform(const FString& PlatformConfigName, FName InstanceName = NAME_None) override;
 	virtual IEIKPlatformHandlePtr CreatePlatform(EOS_Platform_Options& PlatformOptions) override;
+	virtual void RegisterSharedPlatform(const FString& DeploymentId, const IEIKPlatformHandlePtr& PlatformHandle) override;
+	virtual IEIKPlatformHandlePtr FindSharedPlatform(const FString& DeploymentId) override;
 
 	virtual FString GetProductName() const override;
 	virtual FString GetProductVersion() const override;
@@ -76,6 +78,23 @@ protected:
 
 	friend struct FEIKPlatformHandle;
 
+	/** Per-ticker state for adaptive ticking, see bConfigAdaptiveTick */
+	struct FAdaptiveTickState
+	{
+		uint32 LastNotifyCount = 0;
+		double LastBusySeconds = 0.0;
+		double IdleIntervalSeconds = 0.0;
+		double NextIdleTickSeconds = 0.0;
+
+		/**
+		 * Ticks every time while there is pending work or there was activity within ActivityWindowSeconds,
+		 * otherwise backs off exponentially up to MaxIdleIntervalSeconds between ticks. Pending requests only
+		 * count until PendingRequestTimeoutSeconds have passed without any activity, so a request that never
+		 * completes does not keep the full rate forever.
+		 */
+		bool ShouldTick(double NowSeconds, double ActivityWindowSeconds, double MaxIdleIntervalSeconds, double PendingRequestTimeoutSeconds);
+	};
+
 	void OnConfigSectionsChanged(const FString& IniFilename, const TSet<FString>& SectionName);
 	void LoadConfig();
 	void ReleasePlatform(EOS_HPlatform PlatformHandle);
@@ -109,10 +128,22 @@ protected:
 	FString DefaultPlatformConfigName;
 	/** Cache of named platform handles that have been created. */
 	TMap<FString, TMap<FName, IEIKPlatformHandleWeakPtr>> PlatformHandles;
+	/** Platforms offered to other modules, by deployment id. */
+	TMap<FString, IEIKPlatformHandleWeakPtr> SharedPlatforms;
 
 	// Config
 	/** Interval between platform ticks. 0 means we tick every frame. */
 	double ConfigTickIntervalSeconds = 0.f;
+	/** Back off ticking while there are no pending requests, RTC rooms or recent traffic */
+	bool bConfigAdaptiveTick = false;
+	/** How long after the last activity we keep ticking at full rate */
+	double ConfigAdaptiveTickActivityWindowSeconds = 2.0;
+	/** Longest interval between ticks when idle */
+	double ConfigAdaptiveTickMaxIdleIntervalSeconds = 0.5;
+	/** How long pending requests keep the full rate without any other activity */
+	double ConfigAdaptiveTickPendingRequestTimeoutSeconds = 10.0;
+	/** Adaptive state of the game thread ticker */
+	FAdaptiveTickState GameThreadAdaptiveTickState;
 };
 
 struct FEIKPlatformHandle : public IEIKPlatformHandle
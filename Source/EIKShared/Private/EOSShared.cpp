@@ -2,6 +2,7 @@
 
 #include "EOSShared.h"
 #include "EOSSharedTypes.h"
+#include <atomic>
 
 #include "eos_auth_types.h"
 #include "eos_friends_types.h"
@@ -268,3 +269,52 @@ bool EIK_LexFromString(EOS_ELoginCredentialType& OutEnum, const TCHAR* InString)
 	}
 	return true;
 }
+
+namespace
+{
+	std::atomic<int32> GNumPendingSDKRequests { 0 };
+	std::atomic<int32> GNumSDKActivityHolds { 0 };
+	std::atomic<uint32> GSDKActivityNotifyCount { 0 };
+}
+
+void FEIKSDKActivity::AddPendingRequest()
+{
+	GNumPendingSDKRequests.fetch_add(1, std::memory_order_relaxed);
+	Notify();
+}
+
+void FEIKSDKActivity::RemovePendingRequest()
+{
+	GNumPendingSDKRequests.fetch_sub(1, std::memory_order_relaxed);
+	Notify();
+}
+
+int32 FEIKSDKActivity::GetNumPendingRequests()
+{
+	return GNumPendingSDKRequests.load(std::memory_order_relaxed);
+}
+
+void FEIKSDKActivity::AddHold()
+{
+	GNumSDKActivityHolds.fetch_add(1, std::memory_order_relaxed);
+}
+
+void FEIKSDKActivity::RemoveHold()
+{
+	GNumSDKActivityHolds.fetch_sub(1, std::memory_order_relaxed);
+}
+
+int32 FEIKSDKActivity::GetNumHolds()
+{
+	return GNumSDKActivityHolds.load(std::memory_order_relaxed);
+}
+
+void FEIKSDKActivity::Notify()
+{
+	GSDKActivityNotifyCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+uint32 FEIKSDKActivity::GetNotifyCount()
+{
+	return GSDKActivityNotifyCount.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,196 @@
+// Copyright (c) 2024 Betide Studio. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+/** Captures up to this size are stored inside the callback object instead of in their own allocation */
+#ifndef EIK_CALLBACK_INLINE_SIZE
+#define EIK_CALLBACK_INLINE_SIZE 64
+#endif
+
+/**
+ * Allocator for the one-shot callback objects handed to the SDK as ClientData.
+ *
+ * Requests like a friends refresh or lobby search create hundreds of these in a burst and delete them again
+ * from inside the SDK callback, so they're carved from lock free free lists segregated by size class instead
+ * of the general allocator. Freed blocks are kept for reuse, so the pools only ever grow to the peak number
+ * of callbacks alive at once. Objects larger than the biggest size class fall back to FMemory.
+ */
+class EIKSHARED_API FEIKCallbackAllocator
+{
+public:
+	static void* Allocate(SIZE_T Size);
+	static void Free(void* Ptr, SIZE_T Size);
+};
+
+/** Live and peak counts for one type of callback, all members are thread safe */
+class EIKSHARED_API FEIKCallbackTypeStats
+{
+public:
+	explicit FEIKCallbackTypeStats(const FString& InTypeName)
+		: TypeName(InTypeName)
+	{
+	}
+
+	void OnCreated()
+	{
+		NumCreated.fetch_add(1, std::memory_order_relaxed);
+		const int32 NewNumLive = NumLive.fetch_add(1, std::memory_order_relaxed) + 1;
+		int32 CurrentPeak = PeakLive.load(std::memory_order_relaxed);
+		while (NewNumLive > CurrentPeak && !PeakLive.compare_exchange_weak(CurrentPeak, NewNumLive, std::memory_order_relaxed))
+		{
+		}
+	}
+
+	void OnDestroyed()
+	{
+		NumLive.fetch_sub(1, std::memory_order_relaxed);
+	}
+
+	const FString& GetTypeName() const { return TypeName; }
+	int32 GetNumLive() const { return NumLive.load(std::memory_order_relaxed); }
+	int32 GetPeakLive() const { return PeakLive.load(std::memory_order_relaxed); }
+	uint64 GetNumCreated() const { return NumCreated.load(std::memory_order_relaxed); }
+
+private:
+	FString TypeName;
+	std::atomic<int32> NumLive { 0 };
+	std::atomic<int32> PeakLive { 0 };
+	std::atomic<uint64> NumCreated { 0 };
+};
+
+/**
+ * Registry of the per type callback stats. A type that keeps a live count while the game is idle is a request
+ * that never completed, or a callback that was leaked. Dump them with the EIK.DumpCallbackStats console command.
+ */
+class EIKSHARED_API FEIKCallbackStats
+{
+public:
+	/** Stats are shared between modules by type name and live until exit, so references to them never dangle */
+	static FEIKCallbackTypeStats& FindOrAdd(const FString& TypeName);
+
+	/** Turns a function signature naming TEIKCallbackTypeStats<T> into the name of T */
+	static FString ParseTypeName(const TCHAR* FunctionSignature);
+
+	/** Logs the stats of every callback type, plus the pool usage */
+	static void Dump();
+
+	/** Logs a warning for every callback type that still has callbacks alive */
+	static void LogLiveCallbacks();
+};
+
+/** Per type accessor for FEIKCallbackStats, resolved once per type and module */
+template<typename CallbackType>
+struct TEIKCallbackTypeStats
+{
+	static FEIKCallbackTypeStats& Get()
+	{
+#if defined(_MSC_VER) && !defined(__clang__)
+		static FEIKCallbackTypeStats& Stats = FEIKCallbackStats::FindOrAdd(FEIKCallbackStats::ParseTypeName(ANSI_TO_TCHAR(__FUNCSIG__)));
+#else
+		static FEIKCallbackTypeStats& Stats = FEIKCallbackStats::FindOrAdd(FEIKCallbackStats::ParseTypeName(ANSI_TO_TCHAR(__PRETTY_FUNCTION__)));
+#endif
+		return Stats;
+	}
+};
+
+/**
+ * Move-only replacement for TFunction in callback objects, storing captures of up to EIK_CALLBACK_INLINE_SIZE
+ * bytes inline so assigning the usual [this, WeakThis, Delegate] style lambda doesn't allocate.
+ */
+template<typename FuncType>
+class TEIKCallbackFunction;
+
+template<typename ReturnType, typename... ParamTypes>
+class TEIKCallbackFunction<ReturnType(ParamTypes...)>
+{
+public:
+	TEIKCallbackFunction() = default;
+	TEIKCallbackFunction(const TEIKCallbackFunction&) = delete;
+	TEIKCallbackFunction& operator=(const TEIKCallbackFunction&) = delete;
+
+	~TEIKCallbackFunction()
+	{
+		Reset();
+	}
+
+	template<typename FunctorType, typename = typename TEnableIf<!TIsSame<typename TDecay<FunctorType>::Type, TEIKCallbackFunction>::Value>::Type>
+	TEIKCallbackFunction& operator=(FunctorType&& Functor)
+	{
+		using FDecayedType = typename TDecay<FunctorType>::Type;
+
+		Reset();
+		Bind<FDecayedType>(Forward<FunctorType>(Functor), TIntegralConstant<bool, sizeof(FDecayedType) <= EIK_CALLBACK_INLINE_SIZE && alignof(FDecayedType) <= 16>());
+		return *this;
+	}
+
+	TEIKCallbackFunction& operator=(TYPE_OF_NULLPTR)
+	{
+		Reset();
+		return *this;
+	}
+
+	ReturnType operator()(ParamTypes... Params) const
+	{
+		check(Invoker);
+		return Invoker(Object, Forward<ParamTypes>(Params)...);
+	}
+
+	explicit operator bool() const
+	{
+		return Invoker != nullptr;
+	}
+
+	void Reset()
+	{
+		if (Destroyer)
+		{
+			Destroyer(Object);
+		}
+		Object = nullptr;
+		Invoker = nullptr;
+		Destroyer = nullptr;
+	}
+
+private:
+	template<typename FunctorType, typename ArgType>
+	void Bind(ArgType&& Functor, TIntegralConstant<bool, true> /*bInline*/)
+	{
+		Object = new (&Storage) FunctorType(Forward<ArgType>(Functor));
+		Invoker = &Invoke<FunctorType>;
+		Destroyer = &DestroyInline<FunctorType>;
+	}
+
+	template<typename FunctorType, typename ArgType>
+	void Bind(ArgType&& Functor, TIntegralConstant<bool, false> /*bInline*/)
+	{
+		Object = new FunctorType(Forward<ArgType>(Functor));
+		Invoker = &Invoke<FunctorType>;
+		Destroyer = &DestroyHeap<FunctorType>;
+	}
+
+	template<typename FunctorType>
+	static ReturnType Invoke(void* InObject, ParamTypes... Params)
+	{
+		return (*(FunctorType*)InObject)(Forward<ParamTypes>(Params)...);
+	}
+
+	template<typename FunctorType>
+	static void DestroyInline(void* InObject)
+	{
+		((FunctorType*)InObject)->~FunctorType();
+	}
+
+	template<typename FunctorType>
+	static void DestroyHeap(void* InObject)
+	{
+		delete (FunctorType*)InObject;
+	}
+
+	void* Object = nullptr;
+	ReturnType (*Invoker)(void*, ParamTypes...) = nullptr;
+	void (*Destroyer)(void*) = nullptr;
+	TAlignedBytes<EIK_CALLBACK_INLINE_SIZE, 16> Storage;
+};
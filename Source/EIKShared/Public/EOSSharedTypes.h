@@ -5,6 +5,7 @@
 #include "CoreGlobals.h"
 #include "Runtime/Launch/Resources/Version.h"
 #include "Templates/SharedPointer.h"
+#include "EIKCallbackPool.h"
 
 #if WITH_EOS_SDK
 #if defined(EOS_PLATFORM_BASE_FILE_NAME)
@@ -18,11 +19,97 @@
 #define EOS_CONNECTION_URL_PREFIX TEXT("EOS")
 #define EOS_URL_SEPARATOR TEXT(":")
 
+/**
+ * Signals the SDK manager uses to decide whether platforms need ticking at full rate
+ * when adaptive ticking is enabled. All methods are thread safe.
+ */
+class EIKSHARED_API FEIKSDKActivity
+{
+public:
+	/**
+	 * An async SDK request was started, platforms tick at full rate until it is removed again or until
+	 * AdaptiveTickPendingRequestTimeoutSeconds pass without activity. Adding and removing also count as a Notify.
+	 */
+	static void AddPendingRequest();
+	static void RemovePendingRequest();
+	static int32 GetNumPendingRequests();
+
+	/** Something long lived (e.g. a joined RTC room) needs full rate ticking while held */
+	static void AddHold();
+	static void RemoveHold();
+	static int32 GetNumHolds();
+
+	/** Traffic or a notification happened, keeps full rate ticking for a short while afterwards */
+	static void Notify();
+	/** Incremented by Notify, compare against a previous value to see if anything happened since */
+	static uint32 GetNotifyCount();
+};
+
+/** Holds FEIKSDKActivity for as long as it is acquired, released on destruction */
+class FEIKSDKActivityHold
+{
+public:
+	FEIKSDKActivityHold() = default;
+	FEIKSDKActivityHold(FEIKSDKActivityHold&& Other)
+		: bHeld(Other.bHeld)
+	{
+		Other.bHeld = false;
+	}
+	FEIKSDKActivityHold& operator=(FEIKSDKActivityHold&& Other)
+	{
+		if (this != &Other)
+		{
+			Release();
+			bHeld = Other.bHeld;
+			Other.bHeld = false;
+		}
+		return *this;
+	}
+	FEIKSDKActivityHold(const FEIKSDKActivityHold&) = delete;
+	FEIKSDKActivityHold& operator=(const FEIKSDKActivityHold&) = delete;
+	~FEIKSDKActivityHold()
+	{
+		Release();
+	}
+
+	void Acquire()
+	{
+		if (!bHeld)
+		{
+			bHeld = true;
+			FEIKSDKActivity::AddHold();
+		}
+	}
+
+	void Release()
+	{
+		if (bHeld)
+		{
+			bHeld = false;
+			FEIKSDKActivity::RemoveHold();
+		}
+	}
+
+private:
+	bool bHeld = false;
+};
+
 /** Used to store a pointer to the EOS callback object without knowing type */
 class EIKSHARED_API FCallbackBase
 {
 public:
 	virtual ~FCallbackBase() {}
+
+	/** Callback objects are created and deleted per request, so they come from the pooled callback allocator */
+	static void* operator new(size_t Size)
+	{
+		return FEIKCallbackAllocator::Allocate(Size);
+	}
+
+	static void operator delete(void* Ptr, size_t Size)
+	{
+		FEIKCallbackAllocator::Free(Ptr, Size);
+	}
 };
 #if WITH_EOS_SDK
 
@@ -37,17 +124,28 @@ class TEIKGlobalCallback :
 {
 public:
 #if ENGINE_MAJOR_VERSION == 5
-	TFunction<CallbackReturnType(const CallbackParamType*, CallbackExtraParams... ExtraParams)> CallbackLambda;
+	TEIKCallbackFunction<CallbackReturnType(const CallbackParamType*, CallbackExtraParams... ExtraParams)> CallbackLambda;
 	TEIKGlobalCallback(TWeakPtr<OwningType> InOwner)
 		: FCallbackBase()
 		, Owner(InOwner)
 	{
+		TEIKCallbackTypeStats<CallbackParamType>::Get().OnCreated();
+	}
+	virtual ~TEIKGlobalCallback()
+	{
+		TEIKCallbackTypeStats<CallbackParamType>::Get().OnDestroyed();
 	}
 #else
-	TFunction<void(const CallbackType*)> CallbackLambda;
-	TEIKGlobalCallback() = default;
+	TEIKCallbackFunction<void(const CallbackType*)> CallbackLambda;
+	TEIKGlobalCallback()
+	{
+		TEIKCallbackTypeStats<CallbackType>::Get().OnCreated();
+	}
+	virtual ~TEIKGlobalCallback()
+	{
+		TEIKCallbackTypeStats<CallbackType>::Get().OnDestroyed();
+	}
 #endif
-	virtual ~TEIKGlobalCallback() = default;
 
 	CallbackFuncType GetCallbackPtr()
 	{
@@ -69,6 +167,8 @@ private:
 		TEIKGlobalCallback* CallbackThis = (TEIKGlobalCallback*)Data->ClientData;
 		check(CallbackThis);
 
+		FEIKSDKActivity::Notify();
+
 		if (CallbackThis->bIsGameThreadCallback)
 		{
 			check(IsInGameThread());
@@ -104,6 +204,8 @@ private:
 		TEIKGlobalCallback* CallbackThis = (TEIKGlobalCallback*)Data->ClientData;
 		check(CallbackThis);
 
+		FEIKSDKActivity::Notify();
+
 		check(CallbackThis->CallbackLambda);
 		CallbackThis->CallbackLambda(Data);
 	}
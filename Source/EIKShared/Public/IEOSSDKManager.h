@@ -107,6 +107,15 @@ public:
 	/** Create a platform handle using EOSSDK options directly. */
 	virtual IEIKPlatformHandlePtr CreatePlatform(EOS_Platform_Options& PlatformOptions) = 0;
 
+	/**
+	 * Offer a platform to other modules, so voice chat can run on the online subsystem's platform instead of creating
+	 * a second one. Only a weak reference is kept, the platform is released as usual once its owner lets go of it.
+	 */
+	virtual void RegisterSharedPlatform(const FString& DeploymentId, const IEIKPlatformHandlePtr& PlatformHandle) = 0;
+
+	/** Returns the live platform registered for DeploymentId, if any. */
+	virtual IEIKPlatformHandlePtr FindSharedPlatform(const FString& DeploymentId) = 0;
+
 	virtual FString GetProductName() const = 0;
 	virtual FString GetProductVersion() const = 0;
 	virtual FString GetCacheDirBase() const = 0;
@@ -0,0 +1,337 @@
+// Copyright 2023 Betide Studio. All rights reserved.
+
+#include "EIKVoiceTokenService.h"
+
+#include "EIKSettings.h"
+#include "GenericPlatform/GenericPlatformHttp.h"
+#include "HttpModule.h"
+#include "Interfaces/IHttpResponse.h"
+#include "Misc/Base64.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogEIKVoiceTokenService, Log, All);
+
+FEIKVoiceTokenService& FEIKVoiceTokenService::Get()
+{
+	static FEIKVoiceTokenService Instance;
+	return Instance;
+}
+
+FEIKVoiceTokenService::FEIKVoiceTokenService()
+{
+	const FEOSSettings Settings = UEIKSettings::GetSettings();
+	BaseUrl = Settings.VoiceTokenServiceBaseUrl.IsEmpty() ? TEXT("https://api.epicgames.dev") : Settings.VoiceTokenServiceBaseUrl;
+	BaseUrl.RemoveFromEnd(TEXT("/"));
+	MaxParticipantsPerRequest = FMath::Max(Settings.VoiceRoomTokenMaxParticipantsPerRequest, 1);
+	RefreshMarginSeconds = Settings.VoiceAccessTokenRefreshMarginSeconds;
+	BatchWindowSeconds = FMath::Max(Settings.VoiceRoomTokenBatchWindowSeconds, 0.f);
+}
+
+bool FEIKVoiceTokenService::GetCredentials(FCredentials& OutCredentials)
+{
+	const UEIKSettings* EIKSettings = GetDefault<UEIKSettings>();
+	if (!EIKSettings || EIKSettings->VoiceArtifactName.IsEmpty())
+	{
+		UE_LOG(LogEIKVoiceTokenService, Error, TEXT("No voice artifact set in EIK Settings"));
+		return false;
+	}
+
+	FEOSArtifactSettings ArtifactSettingsForVoice;
+	if (!EIKSettings->GetSettingsForArtifact(EIKSettings->VoiceArtifactName, ArtifactSettingsForVoice))
+	{
+		UE_LOG(LogEIKVoiceTokenService, Error, TEXT("No artifact settings found for voice artifact %s"), *EIKSettings->VoiceArtifactName);
+		return false;
+	}
+
+	OutCredentials.DeploymentId = ArtifactSettingsForVoice.DeploymentId;
+	OutCredentials.ClientId = ArtifactSettingsForVoice.ClientId;
+	OutCredentials.ClientSecret = ArtifactSettingsForVoice.ClientSecret;
+	if (OutCredentials.DeploymentId.IsEmpty() || OutCredentials.ClientId.IsEmpty() || OutCredentials.ClientSecret.IsEmpty())
+	{
+		UE_LOG(LogEIKVoiceTokenService, Error, TEXT("Missing DeploymentId, ClientId or ClientSecret for voice artifact %s"), *EIKSettings->VoiceArtifactName);
+		return false;
+	}
+	return true;
+}
+
+void FEIKVoiceTokenService::InvalidateAccessToken()
+{
+	CachedAccessToken.Empty();
+	CachedAccessTokenRefreshTime = 0.0;
+}
+
+void FEIKVoiceTokenService::GetAccessToken(const FCredentials& Credentials, FOnAccessToken&& OnAccessToken)
+{
+	if (Credentials != CachedCredentials)
+	{
+		InvalidateAccessToken();
+		CachedCredentials = Credentials;
+	}
+
+	if (!CachedAccessToken.IsEmpty() && FPlatformTime::Seconds() < CachedAccessTokenRefreshTime)
+	{
+		OnAccessToken(CachedAccessToken);
+		return;
+	}
+
+	// Only callers with the same credentials share a request, so nobody receives a token issued for other credentials
+	if (TArray<FOnAccessToken>* Waiters = AccessTokenWaiters.Find(Credentials))
+	{
+		Waiters->Emplace(MoveTemp(OnAccessToken));
+		return;
+	}
+	AccessTokenWaiters.Add(Credentials).Emplace(MoveTemp(OnAccessToken));
+
+	const TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FHttpModule::Get().CreateRequest();
+	const FString Base64Credentials = FBase64::Encode(FString::Printf(TEXT("%s:%s"), *Credentials.ClientId, *Credentials.ClientSecret));
+	const FString ContentString = FString::Printf(TEXT("grant_type=client_credentials&deployment_id=%s"), *FGenericPlatformHttp::UrlEncode(Credentials.DeploymentId));
+
+	HttpRequest->SetHeader(TEXT("Content-Type"), TEXT("application/x-www-form-urlencoded"));
+	HttpRequest->SetHeader(TEXT("Accept"), TEXT("application/json"));
+	HttpRequest->SetHeader(TEXT("Authorization"), FString::Printf(TEXT("Basic %s"), *Base64Credentials));
+	HttpRequest->SetContentAsString(ContentString);
+	HttpRequest->SetURL(BaseUrl + TEXT("/auth/v1/oauth/token"));
+	HttpRequest->SetVerb(TEXT("POST"));
+	HttpRequest->OnProcessRequestComplete().BindRaw(this, &FEIKVoiceTokenService::OnAccessTokenResponse, Credentials);
+	HttpRequest->ProcessRequest();
+}
+
+void FEIKVoiceTokenService::OnAccessTokenResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully, FCredentials Credentials)
+{
+	FString AccessToken;
+	double ExpiresInSeconds = 0.0;
+	if (bConnectedSuccessfully && Response.IsValid() && EHttpResponseCodes::IsOk(Response->GetResponseCode()))
+	{
+		TSharedPtr<FJsonObject> JsonObject;
+		if (FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Response->GetContentAsString()), JsonObject) && JsonObject.IsValid())
+		{
+			JsonObject->TryGetStringField(TEXT("access_token"), AccessToken);
+			JsonObject->TryGetNumberField(TEXT("expires_in"), ExpiresInSeconds);
+		}
+	}
+
+	if (AccessToken.IsEmpty())
+	{
+		UE_LOG(LogEIKVoiceTokenService, Error, TEXT("Failed to retrieve voice access token, response code %d"), Response.IsValid() ? Response->GetResponseCode() : 0);
+	}
+	else if (Credentials == CachedCredentials)
+	{
+		// Without expires_in the refresh time is now, so the token is only handed to the current waiters
+		CachedAccessToken = AccessToken;
+		CachedAccessTokenRefreshTime = FPlatformTime::Seconds() + FMath::Max(ExpiresInSeconds - RefreshMarginSeconds, 0.0);
+		UE_LOG(LogEIKVoiceTokenService, Verbose, TEXT("Cached voice access token, expires in %.0f seconds"), ExpiresInSeconds);
+	}
+
+	TArray<FOnAccessToken> Waiters;
+	AccessTokenWaiters.RemoveAndCopyValue(Credentials, Waiters);
+	for (FOnAccessToken& Waiter : Waiters)
+	{
+		Waiter(AccessToken);
+	}
+}
+
+void FEIKVoiceTokenService::RequestRoomTokens(const FString& RoomName, const TArray<FEIKVoiceRoomParticipant>& Participants, const FOnEIKVoiceRoomTokensComplete& OnComplete)
+{
+	FCredentials Credentials;
+	if (RoomName.IsEmpty() || Participants.Num() == 0 || !GetCredentials(Credentials))
+	{
+		OnComplete.ExecuteIfBound(false, FString(), TArray<FEIKVoiceRoomToken>());
+		return;
+	}
+
+	if (Participants.Num() <= MaxParticipantsPerRequest)
+	{
+		SendRoomTokenRequest(Credentials, RoomName, Participants, OnComplete, true);
+		return;
+	}
+
+	struct FBatchResult
+	{
+		int32 NumRemaining = 0;
+		bool bWasSuccessful = true;
+		FString ClientBaseUrl;
+		TArray<FEIKVoiceRoomToken> Tokens;
+		FOnEIKVoiceRoomTokensComplete OnComplete;
+	};
+	const TSharedRef<FBatchResult> BatchResult = MakeShared<FBatchResult>();
+	BatchResult->NumRemaining = FMath::DivideAndRoundUp(Participants.Num(), MaxParticipantsPerRequest);
+	BatchResult->OnComplete = OnComplete;
+
+	for (int32 Index = 0; Index < Participants.Num(); Index += MaxParticipantsPerRequest)
+	{
+		const int32 NumInRequest = FMath::Min(MaxParticipantsPerRequest, Participants.Num() - Index);
+		TArray<FEIKVoiceRoomParticipant> RequestParticipants(Participants.GetData() + Index, NumInRequest);
+		SendRoomTokenRequest(Credentials, RoomName, RequestParticipants, FOnEIKVoiceRoomTokensComplete::CreateLambda([BatchResult](bool bWasSuccessful, const FString& ClientBaseUrl, const TArray<FEIKVoiceRoomToken>& Tokens)
+		{
+			BatchResult->bWasSuccessful &= bWasSuccessful;
+			if (!ClientBaseUrl.IsEmpty())
+			{
+				BatchResult->ClientBaseUrl = ClientBaseUrl;
+			}
+			BatchResult->Tokens.Append(Tokens);
+			if (--BatchResult->NumRemaining == 0)
+			{
+				BatchResult->OnComplete.ExecuteIfBound(BatchResult->bWasSuccessful, BatchResult->ClientBaseUrl, BatchResult->Tokens);
+			}
+		}), true);
+	}
+}
+
+void FEIKVoiceTokenService::SendRoomTokenRequest(const FCredentials& Credentials, const FString& RoomName, const TArray<FEIKVoiceRoomParticipant>& Participants, const FOnEIKVoiceRoomTokensComplete& OnComplete, bool bRetryOnDenied)
+{
+	GetAccessToken(Credentials, [this, Credentials, RoomName, Participants, OnComplete, bRetryOnDenied](const FString& AccessToken)
+	{
+		if (AccessToken.IsEmpty())
+		{
+			OnComplete.ExecuteIfBound(false, FString(), TArray<FEIKVoiceRoomToken>());
+			return;
+		}
+
+		FString JsonRequestString;
+		const TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> JsonWriter = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&JsonRequestString);
+		JsonWriter->WriteObjectStart();
+		JsonWriter->WriteArrayStart(TEXT("participants"));
+		for (const FEIKVoiceRoomParticipant& Participant : Participants)
+		{
+			JsonWriter->WriteObjectStart();
+			JsonWriter->WriteValue(TEXT("puid"), Participant.ProductUserId);
+			JsonWriter->WriteValue(TEXT("clientIp"), Participant.ClientIp);
+			JsonWriter->WriteValue(TEXT("hardMuted"), Participant.bHardMuted);
+			JsonWriter->WriteObjectEnd();
+		}
+		JsonWriter->WriteArrayEnd();
+		JsonWriter->WriteObjectEnd();
+		JsonWriter->Close();
+
+		const TSharedRef<IHttpRequest, ESPMode::ThreadSafe> RoomTokenRequest = FHttpModule::Get().CreateRequest();
+		RoomTokenRequest->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
+		RoomTokenRequest->SetHeader(TEXT("Accept"), TEXT("application/json"));
+		RoomTokenRequest->SetHeader(TEXT("Authorization"), FString::Printf(TEXT("Bearer %s"), *AccessToken));
+		RoomTokenRequest->SetContentAsString(JsonRequestString);
+		RoomTokenRequest->SetURL(FString::Printf(TEXT("%s/rtc/v1/%s/room/%s"), *BaseUrl, *FGenericPlatformHttp::UrlEncode(Credentials.DeploymentId), *FGenericPlatformHttp::UrlEncode(RoomName)));
+		RoomTokenRequest->SetVerb(TEXT("POST"));
+		RoomTokenRequest->OnProcessRequestComplete().BindLambda([this, Credentials, RoomName, Participants, OnComplete, bRetryOnDenied, AccessToken](FHttpRequestPtr HttpRequestPtr, FHttpResponsePtr HttpResponsePtr, bool bConnectedSuccessfully)
+		{
+			const int32 ResponseCode = HttpResponsePtr.IsValid() ? HttpResponsePtr->GetResponseCode() : 0;
+			if (bConnectedSuccessfully && ResponseCode == EHttpResponseCodes::Denied && bRetryOnDenied)
+			{
+				// The cached token was revoked or expired early, fetch a new one and try once more
+				if (CachedAccessToken == AccessToken)
+				{
+					InvalidateAccessToken();
+				}
+				SendRoomTokenRequest(Credentials, RoomName, Participants, OnComplete, false);
+				return;
+			}
+
+			FString ClientBaseUrl;
+			TArray<FEIKVoiceRoomToken> Tokens;
+			if (bConnectedSuccessfully && EHttpResponseCodes::IsOk(ResponseCode))
+			{
+				TSharedPtr<FJsonObject> JsonObject;
+				if (FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(HttpResponsePtr->GetContentAsString()), JsonObject) && JsonObject.IsValid())
+				{
+					JsonObject->TryGetStringField(TEXT("clientBaseUrl"), ClientBaseUrl);
+					const TArray<TSharedPtr<FJsonValue>>* ParticipantsArray = nullptr;
+					if (JsonObject->TryGetArrayField(TEXT("participants"), ParticipantsArray))
+					{
+						for (const TSharedPtr<FJsonValue>& Element : *ParticipantsArray)
+						{
+							const TSharedPtr<FJsonObject>* ParticipantObject = nullptr;
+							if (!Element.IsValid() || !Element->TryGetObject(ParticipantObject))
+							{
+								continue;
+							}
+
+							FEIKVoiceRoomToken RoomToken;
+							(*ParticipantObject)->TryGetStringField(TEXT("puid"), RoomToken.ProductUserId);
+							(*ParticipantObject)->TryGetStringField(TEXT("token"), RoomToken.Token);
+							if (!RoomToken.Token.IsEmpty())
+							{
+								Tokens.Emplace(MoveTemp(RoomToken));
+							}
+						}
+					}
+				}
+			}
+
+			const bool bWasSuccessful = !ClientBaseUrl.IsEmpty() && Tokens.Num() == Participants.Num();
+			UE_CLOG(!bWasSuccessful, LogEIKVoiceTokenService, Error, TEXT("Room token request for %s failed, response code %d, %d/%d tokens received"), *RoomName, ResponseCode, Tokens.Num(), Participants.Num());
+			UE_CLOG(bWasSuccessful, LogEIKVoiceTokenService, Verbose, TEXT("Received %d room tokens for %s"), Tokens.Num(), *RoomName);
+			OnComplete.ExecuteIfBound(bWasSuccessful, ClientBaseUrl, Tokens);
+		});
+		RoomTokenRequest->ProcessRequest();
+	});
+}
+
+void FEIKVoiceTokenService::QueueRoomToken(const FString& RoomName, const FEIKVoiceRoomParticipant& Participant, const FOnEIKVoiceRoomTokenComplete& OnComplete)
+{
+	TArray<FPendingParticipant>& Pending = PendingRooms.FindOrAdd(RoomName);
+	Pending.Add({ Participant, OnComplete });
+	if (Pending.Num() >= MaxParticipantsPerRequest)
+	{
+		TArray<FPendingParticipant> Full = MoveTemp(Pending);
+		PendingRooms.Remove(RoomName);
+		FlushRoom(RoomName, MoveTemp(Full));
+		return;
+	}
+
+	if (!FlushTickerHandle.IsValid())
+	{
+#if ENGINE_MAJOR_VERSION == 5
+		FlushTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FEIKVoiceTokenService::FlushPendingRooms), BatchWindowSeconds);
+#else
+		FlushTickerHandle = FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FEIKVoiceTokenService::FlushPendingRooms), BatchWindowSeconds);
+#endif
+	}
+}
+
+bool FEIKVoiceTokenService::FlushPendingRooms(float DeltaTime)
+{
+	FlushTickerHandle.Reset();
+
+	TMap<FString, TArray<FPendingParticipant>> RoomsToFlush = MoveTemp(PendingRooms);
+	PendingRooms.Reset();
+	for (TPair<FString, TArray<FPendingParticipant>>& Room : RoomsToFlush)
+	{
+		FlushRoom(Room.Key, MoveTemp(Room.Value));
+	}
+	return false;
+}
+
+void FEIKVoiceTokenService::FlushRoom(const FString& RoomName, TArray<FPendingParticipant>&& Pending)
+{
+	// The same player may be queued more than once, e.g. when re-requesting after a reconnect. Request them once and
+	// hand the token to every caller.
+	TArray<FEIKVoiceRoomParticipant> Participants;
+	Participants.Reserve(Pending.Num());
+	for (const FPendingParticipant& Entry : Pending)
+	{
+		if (FEIKVoiceRoomParticipant* Existing = Participants.FindByPredicate([&Entry](const FEIKVoiceRoomParticipant& Participant) { return Participant.ProductUserId == Entry.Participant.ProductUserId; }))
+		{
+			*Existing = Entry.Participant;
+		}
+		else
+		{
+			Participants.Add(Entry.Participant);
+		}
+	}
+
+	RequestRoomTokens(RoomName, Participants, FOnEIKVoiceRoomTokensComplete::CreateLambda([Pending = MoveTemp(Pending)](bool bWasSuccessful, const FString& ClientBaseUrl, const TArray<FEIKVoiceRoomToken>& Tokens)
+	{
+		for (const FPendingParticipant& Entry : Pending)
+		{
+			const FEIKVoiceRoomToken* RoomToken = Tokens.FindByPredicate([&Entry](const FEIKVoiceRoomToken& Token) { return Token.ProductUserId == Entry.Participant.ProductUserId; });
+			if (RoomToken && !ClientBaseUrl.IsEmpty())
+			{
+				Entry.OnComplete.ExecuteIfBound(true, ClientBaseUrl, RoomToken->Token);
+			}
+			else
+			{
+				Entry.OnComplete.ExecuteIfBound(false, FString(), FString());
+			}
+		}
+	}));
+}
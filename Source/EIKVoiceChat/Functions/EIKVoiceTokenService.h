@@ -0,0 +1,115 @@
+// Copyright 2023 Betide Studio. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Interfaces/IHttpRequest.h"
+#include "Runtime/Launch/Resources/Version.h"
+
+struct FEIKVoiceRoomParticipant
+{
+	FString ProductUserId;
+	FString ClientIp;
+	bool bHardMuted = false;
+};
+
+struct FEIKVoiceRoomToken
+{
+	FString ProductUserId;
+	FString Token;
+};
+
+DECLARE_DELEGATE_ThreeParams(FOnEIKVoiceRoomTokensComplete, bool /*bWasSuccessful*/, const FString& /*ClientBaseUrl*/, const TArray<FEIKVoiceRoomToken>& /*Tokens*/);
+DECLARE_DELEGATE_ThreeParams(FOnEIKVoiceRoomTokenComplete, bool /*bWasSuccessful*/, const FString& /*ClientBaseUrl*/, const FString& /*Token*/);
+
+/**
+ * Issues EOS RTC room tokens from a trusted server using the voice artifact's client credentials.
+ *
+ * The client-credentials access token is cached until shortly before it expires, and concurrent callers share a
+ * single token request. Participants for the same room are sent in as few room-token requests as the configured
+ * batch size allows. Configured in the EIK settings, read once when the service is first used:
+ *   VoiceTokenServiceBaseUrl - Web API base url, defaults to https://api.epicgames.dev
+ *   VoiceRoomTokenBatchWindowSeconds - How long QueueRoomToken waits for more participants of the same room, 0 waits for the next tick
+ *   VoiceRoomTokenMaxParticipantsPerRequest - Participants per room-token request
+ *   VoiceAccessTokenRefreshMarginSeconds - How long before expiry a cached access token is refreshed
+ */
+class FEIKVoiceTokenService
+{
+public:
+	static FEIKVoiceTokenService& Get();
+
+	/**
+	 * Requests tokens for all participants of a room. Tokens are reported for every participant that received one,
+	 * bWasSuccessful is only true if all of them did.
+	 */
+	void RequestRoomTokens(const FString& RoomName, const TArray<FEIKVoiceRoomParticipant>& Participants, const FOnEIKVoiceRoomTokensComplete& OnComplete);
+
+	/** Queues a single participant, batching it with other participants queued for the same room within the batch window */
+	void QueueRoomToken(const FString& RoomName, const FEIKVoiceRoomParticipant& Participant, const FOnEIKVoiceRoomTokenComplete& OnComplete);
+
+	/** Drops the cached access token, the next request fetches a new one */
+	void InvalidateAccessToken();
+
+private:
+	FEIKVoiceTokenService();
+
+	struct FCredentials
+	{
+		FString DeploymentId;
+		FString ClientId;
+		FString ClientSecret;
+
+		bool operator==(const FCredentials& Other) const
+		{
+			return DeploymentId.Equals(Other.DeploymentId, ESearchCase::CaseSensitive)
+				&& ClientId.Equals(Other.ClientId, ESearchCase::CaseSensitive)
+				&& ClientSecret.Equals(Other.ClientSecret, ESearchCase::CaseSensitive);
+		}
+		bool operator!=(const FCredentials& Other) const { return !(*this == Other); }
+
+		friend uint32 GetTypeHash(const FCredentials& Credentials)
+		{
+			return HashCombine(HashCombine(GetTypeHash(Credentials.DeploymentId), GetTypeHash(Credentials.ClientId)), GetTypeHash(Credentials.ClientSecret));
+		}
+	};
+
+	struct FPendingParticipant
+	{
+		FEIKVoiceRoomParticipant Participant;
+		FOnEIKVoiceRoomTokenComplete OnComplete;
+	};
+
+	/** Called with the access token, or an empty string if it could not be retrieved */
+	using FOnAccessToken = TFunction<void(const FString& AccessToken)>;
+
+	static bool GetCredentials(FCredentials& OutCredentials);
+
+	void GetAccessToken(const FCredentials& Credentials, FOnAccessToken&& OnAccessToken);
+	void OnAccessTokenResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully, FCredentials Credentials);
+	void SendRoomTokenRequest(const FCredentials& Credentials, const FString& RoomName, const TArray<FEIKVoiceRoomParticipant>& Participants, const FOnEIKVoiceRoomTokensComplete& OnComplete, bool bRetryOnDenied);
+
+	bool FlushPendingRooms(float DeltaTime);
+	void FlushRoom(const FString& RoomName, TArray<FPendingParticipant>&& Pending);
+
+	FString BaseUrl;
+	int32 MaxParticipantsPerRequest = 16;
+	float RefreshMarginSeconds = 60.f;
+	float BatchWindowSeconds = 0.f;
+
+	/** Credentials the cached access token was issued for */
+	FCredentials CachedCredentials;
+	FString CachedAccessToken;
+	/** Platform time after which the cached access token is refreshed */
+	double CachedAccessTokenRefreshTime = 0.0;
+	/** Callers waiting for an in-flight access token request, by the credentials the request was sent with */
+	TMap<FCredentials, TArray<FOnAccessToken>> AccessTokenWaiters;
+
+	/** Participants queued by QueueRoomToken, by room name */
+	TMap<FString, TArray<FPendingParticipant>> PendingRooms;
+#if ENGINE_MAJOR_VERSION == 5
+	FTSTicker::FDelegateHandle FlushTickerHandle;
+#else
+	FDelegateHandle FlushTickerHandle;
+#endif
+};
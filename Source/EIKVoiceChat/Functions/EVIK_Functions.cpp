@@ -219,161 +219,29 @@ FString UEVIK_Functions::LoggedInUser(const UObject* WorldContextObject)
 	return FString();
 }
 
-#include "Misc/ConfigCacheIni.h"
-#include "Http.h"
+#include "EIKVoiceTokenService.h"
 
 void UEVIK_Functions::EOSRoomToken(FString VoiceRoomName, FString PlayerName, FString ClientIP, const FEIKRoomTokenResultDelegate& Result)
 {
-    FString ProductId, SandboxId, DeploymentId, ClientId, ClientSecret, EncryptionKey;
-	const UEIKSettings* EIKSettings = GetMutableDefault<UEIKSettings>();
-	if(!EIKSettings || EIKSettings->VoiceArtifactName.IsEmpty())
+	// Requests made in the same frame, e.g. a server moving every player to a new room, are batched into one
+	// room-token request, and the server access token is reused until shortly before it expires.
+	FEIKVoiceRoomParticipant Participant;
+	Participant.ProductUserId = PlayerName;
+	Participant.ClientIp = ClientIP;
+	FEIKVoiceTokenService::Get().QueueRoomToken(VoiceRoomName, Participant, FOnEIKVoiceRoomTokenComplete::CreateLambda([Result, PlayerName](bool bWasSuccessful, const FString& ClientBaseUrl, const FString& Token)
 	{
-		UE_LOG(LogTemp, Error, TEXT("Missing values in EIK Settings"));
-		Result.ExecuteIfBound(false, "Error");
-		return;
-	}
-
-    bool bSuccess = true;
-    if (EIKSettings && EIKSettings->VoiceArtifactName.Len() > 0)
-	{
-		FEOSArtifactSettings ArtifactSettingsForVoice;
-    	EIKSettings->GetSettingsForArtifact(EIKSettings->VoiceArtifactName, ArtifactSettingsForVoice);
-    	ProductId = ArtifactSettingsForVoice.ProductId;
-    	SandboxId = ArtifactSettingsForVoice.SandboxId;
-    	DeploymentId = ArtifactSettingsForVoice.DeploymentId;
-    	ClientId = ArtifactSettingsForVoice.ClientId;
-    	ClientSecret = ArtifactSettingsForVoice.ClientSecret;
-    	EncryptionKey = ArtifactSettingsForVoice.EncryptionKey;
-	}
-	else
-	{
-		UE_LOG(LogTemp, Error, TEXT("Missing values in EIK Settings"));
-		Result.ExecuteIfBound(false, "Error");
-		return;
-	}
-	if(ProductId.IsEmpty() || SandboxId.IsEmpty() || DeploymentId.IsEmpty() || ClientId.IsEmpty() || ClientSecret.IsEmpty() || EncryptionKey.IsEmpty())
-	{
-		bSuccess = false;
-	}
-
-    if (!bSuccess)
-    {
-        UE_LOG(LogTemp, Error, TEXT("Missing values for Artifact Settings"));
-    	Result.ExecuteIfBound(false, "Error");
-        return;
-    }
-
-    auto HttpRequest = FHttpModule::Get().CreateRequest();
-    const FString Base64Credentials = FBase64::Encode(FString::Printf(TEXT("%s:%s"), *ClientId, *ClientSecret));
-    const FString ContentString = FString::Printf(TEXT("grant_type=client_credentials&deployment_id=%s"), *DeploymentId);
-
-    HttpRequest->SetHeader(TEXT("Content-Type"), TEXT("application/x-www-form-urlencoded"));
-    HttpRequest->AppendToHeader(TEXT("Accept"), TEXT("application/json"));
-    HttpRequest->AppendToHeader(TEXT("Authorization"), *FString::Printf(TEXT("Basic %s"), *Base64Credentials));
-    HttpRequest->SetContentAsString(ContentString);
-    HttpRequest->SetURL("https://api.epicgames.dev/auth/v1/oauth/token");
-    HttpRequest->SetVerb("POST");
-
-    HttpRequest->OnProcessRequestComplete().BindLambda([=](FHttpRequestPtr RequestPtr, FHttpResponsePtr ResponsePtr, bool bConnectedSuccessfully)
-    {
-    	UE_LOG(LogTemp, Warning, TEXT("Response -> %s"), *ResponsePtr->GetContentAsString());
-        FString AccessTokenString;
-        TSharedPtr<FJsonObject> JsonObject;
-
-        if (bConnectedSuccessfully && FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(ResponsePtr->GetContentAsString()), JsonObject) && JsonObject.IsValid())
-        {
-            TSharedPtr<FJsonValue> AccessTokenObject = JsonObject->TryGetField(TEXT("access_token"));
-            AccessTokenString = AccessTokenObject ? AccessTokenObject->AsString() : FString();
-        }
-        else
-        {
-        	Result.ExecuteIfBound(false, "Error");
-        	return;
-        }
-
-		if (!AccessTokenString.IsEmpty())
-		{
-			auto RoomTokenRequest = FHttpModule::Get().CreateRequest();
-
-			RoomTokenRequest->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
-			RoomTokenRequest->AppendToHeader(TEXT("Accept"), TEXT("application/json"));
-			RoomTokenRequest->AppendToHeader(TEXT("Authorization"), *FString::Printf(TEXT("Bearer %s"), *AccessTokenString));
-
-			const FString ProductUserId = PlayerName;
-			bool bHardMuted = false; 
-
-			const FString JsonRequestString = FString::Printf(TEXT("{\"participants\":[{\"puid\":\"%s\",\"clientIp\":\"%s\",\"hardMuted\":%s}] }"), *ProductUserId, *ClientIP, bHardMuted ? TEXT("true") : TEXT("false"));
-			RoomTokenRequest->SetContentAsString(JsonRequestString);
-			RoomTokenRequest->SetURL(FString::Printf(TEXT("https://api.epicgames.dev/rtc/v1/%s/room/%s"), *DeploymentId, *VoiceRoomName));
-			RoomTokenRequest->SetVerb("POST");
-
-			RoomTokenRequest->OnProcessRequestComplete().BindLambda([=](FHttpRequestPtr HttpRequestPtr, FHttpResponsePtr HttpResponsePtr, bool bConnectedSuccessfully)
-			{
-				UE_LOG(LogTemp, Warning, TEXT("Response -> %s"), *HttpResponsePtr->GetContentAsString());
-				FString TokenString, ClientBaseUrlString;
-
-				if (bConnectedSuccessfully)
-				{
-					TSharedPtr<FJsonObject> JsonObject;
-					const TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(HttpResponsePtr->GetContentAsString());
-					if (FJsonSerializer::Deserialize(JsonReader, JsonObject) && JsonObject.IsValid())
-					{
-						const TSharedPtr<FJsonValue> ClientBaseUrlObject = JsonObject->TryGetField(TEXT("clientBaseUrl"));
-						const TSharedPtr<FJsonValue> ParticipantsObject = JsonObject->TryGetField(TEXT("participants"));
-
-						if (ParticipantsObject)
-						{
-							ClientBaseUrlString = ClientBaseUrlObject->AsString();
-							UE_LOG(LogTemp, Warning, TEXT("ClientUrl -> %s"), *ClientBaseUrlString);
-							TArray<TSharedPtr<FJsonValue>> ParticipantsArray = ParticipantsObject->AsArray();
-
-							for (const auto& Element : ParticipantsArray)
-							{
-								if (Element->Type != EJson::Object)
-									continue;
-
-								auto& Object = Element->AsObject();
-								TokenString = Object->TryGetField(TEXT("token"))->AsString();
-								UE_LOG(LogTemp, Warning, TEXT("Token -> %s"), *TokenString);
-							}
-						}
-					}
-					else
-					{
-						Result.ExecuteIfBound(false, "Error");
-						return;
-					}
-				}
-				else
-				{
-					Result.ExecuteIfBound(false, "Error");
-					return;
-				}
-
-				if (!TokenString.IsEmpty())
-				{
-					FEVIKChannelCredentials ChannelCredentials;
-					ChannelCredentials.OverrideUserId = PlayerName;
-					ChannelCredentials.ClientBaseUrl = ClientBaseUrlString;
-					ChannelCredentials.ParticipantToken = TokenString;
-					Result.ExecuteIfBound(true, ChannelCredentials.ToJson(false));
-					return;
-				}
-				else
-				{
-					Result.ExecuteIfBound(false, "Error");
-				}
-			});
-
-			RoomTokenRequest->ProcessRequest();
-		}
-		else
+		if (!bWasSuccessful)
 		{
 			Result.ExecuteIfBound(false, "Error");
+			return;
 		}
-    });
 
-    HttpRequest->ProcessRequest();
+		FEVIKChannelCredentials ChannelCredentials;
+		ChannelCredentials.OverrideUserId = PlayerName;
+		ChannelCredentials.ClientBaseUrl = ClientBaseUrl;
+		ChannelCredentials.ParticipantToken = Token;
+		Result.ExecuteIfBound(true, ChannelCredentials.ToJson(false));
+	}));
 }
 
 void UEVIK_Functions::JoinEOSRoom(const UObject* WorldContextObject, FString VoiceRoomName, FString ChannelCredentialsJson,bool bEnableEcho, const FEIKResultDelegate& Result)
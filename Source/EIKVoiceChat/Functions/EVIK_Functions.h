@@ -51,7 +51,7 @@ public:
 	UFUNCTION(BlueprintPure, DisplayName="Get Logged in EOS Voice Chat User", Category="EOS Integration Kit|Voice Chat", meta=(WorldContext="WorldContextObject"))
 	static FString LoggedInUser(const UObject* WorldContextObject);
 	
-    // Requests a room token for the specified voice room.
+    // Requests a room token for the specified voice room. Requests for the same room are batched until the next tick.
 	UFUNCTION(BlueprintCallable, DisplayName="Get EOS Voice Room Token", Category="EOS Integration Kit|Voice Chat", meta = (AutoCreateRefTerm = "Result", WorldContext="WorldContextObject"))
 	static void EOSRoomToken(FString VoiceRoomName, FString PlayerName, FString ClientIP, const FEIKRoomTokenResultDelegate& Result);
 	
@@ -0,0 +1,112 @@
+// Copyright (c) 2024 Betide Studio. All Rights Reserved.
+
+#include "EIKVoiceActivityDetector.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<float> CVarVoiceActivityThresholdDb(
+	TEXT("EOSVoiceChat.VoiceActivityThresholdDb"),
+	-50.0f,
+	TEXT("Captured audio quieter than this (dBFS) is always treated as silence."));
+
+static TAutoConsoleVariable<float> CVarVoiceActivityNoiseMarginDb(
+	TEXT("EOSVoiceChat.VoiceActivityNoiseMarginDb"),
+	9.0f,
+	TEXT("How far above the tracked noise floor (dB) captured audio has to be to count as speech."));
+
+static TAutoConsoleVariable<float> CVarVoiceActivitySpeechBandRatio(
+	TEXT("EOSVoiceChat.VoiceActivitySpeechBandRatio"),
+	0.4f,
+	TEXT("Fraction of the energy of captured audio that has to be in the speech band to count as speech."));
+
+static TAutoConsoleVariable<int32> CVarVoiceActivityHangoverMs(
+	TEXT("EOSVoiceChat.VoiceActivityHangoverMs"),
+	300,
+	TEXT("How long (ms) voice activity detection keeps sending after the last speech frame."));
+
+/** Speech band edges */
+#define VAD_HIGH_PASS_HZ 300.0f
+#define VAD_LOW_PASS_HZ 3400.0f
+/** Fraction of the gap to a quieter frame the noise floor closes every 100 ms, and how fast it creeps up to louder ones */
+#define VAD_NOISE_FLOOR_FALL_RATE 0.5f
+#define VAD_NOISE_FLOOR_RISE_DB_PER_SECOND 2.0f
+#define VAD_MIN_DB -100.0f
+
+FEIKVoiceActivityDetector::FSettings FEIKVoiceActivityDetector::GetSettingsFromConsole()
+{
+	FSettings Result;
+	Result.ThresholdDb = CVarVoiceActivityThresholdDb.GetValueOnAnyThread();
+	Result.NoiseMarginDb = CVarVoiceActivityNoiseMarginDb.GetValueOnAnyThread();
+	Result.SpeechBandRatio = CVarVoiceActivitySpeechBandRatio.GetValueOnAnyThread();
+	Result.HangoverMs = CVarVoiceActivityHangoverMs.GetValueOnAnyThread();
+	return Result;
+}
+
+FEIKVoiceActivityDetector::FEIKVoiceActivityDetector(const FSettings& InSettings)
+	: Settings(InSettings)
+{
+}
+
+bool FEIKVoiceActivityDetector::ProcessFrame(TArrayView<const int16> Samples, uint32 SampleRate, uint32 NumChannels)
+{
+	if (SampleRate == 0 || NumChannels == 0 || Samples.Num() < (int32)NumChannels)
+	{
+		return bSpeaking;
+	}
+
+	const int32 NumFrames = Samples.Num() / NumChannels;
+	const float FrameMs = 1000.0f * NumFrames / SampleRate;
+	const float Dt = 1.0f / SampleRate;
+	const float HighPassAlpha = 1.0f / (1.0f + 2.0f * PI * VAD_HIGH_PASS_HZ * Dt);
+	const float LowPassAlpha = (2.0f * PI * VAD_LOW_PASS_HZ * Dt) / (1.0f + 2.0f * PI * VAD_LOW_PASS_HZ * Dt);
+
+	// Mix down to mono and measure the total and speech band energy in one pass
+	double TotalEnergy = 0.0;
+	double BandEnergy = 0.0;
+	for (int32 FrameIndex = 0; FrameIndex < NumFrames; FrameIndex++)
+	{
+		float Sample = 0.0f;
+		for (uint32 ChannelIndex = 0; ChannelIndex < NumChannels; ChannelIndex++)
+		{
+			Sample += Samples[FrameIndex * NumChannels + ChannelIndex];
+		}
+		Sample /= (32768.0f * NumChannels);
+
+		HighPassState = HighPassAlpha * (HighPassState + Sample - HighPassPrevInput);
+		HighPassPrevInput = Sample;
+		LowPassState += LowPassAlpha * (HighPassState - LowPassState);
+
+		TotalEnergy += Sample * Sample;
+		BandEnergy += LowPassState * LowPassState;
+	}
+
+	const float MeanEnergy = (float)(TotalEnergy / NumFrames);
+	const float LevelDb = MeanEnergy > 0.0f ? FMath::Max(10.0f * FMath::LogX(10.0f, MeanEnergy), VAD_MIN_DB) : VAD_MIN_DB;
+	const float BandRatio = TotalEnergy > 0.0 ? (float)(BandEnergy / TotalEnergy) : 0.0f;
+
+	const bool bFrameIsSpeech = LevelDb > Settings.ThresholdDb
+		&& LevelDb > NoiseFloorDb + Settings.NoiseMarginDb
+		&& BandRatio >= Settings.SpeechBandRatio;
+
+	// Follow the noise floor down quickly and up slowly. Pauses between words pull it back down, so it only
+	// settles higher when the background itself gets louder, e.g. a fan turning on.
+	if (LevelDb < NoiseFloorDb)
+	{
+		NoiseFloorDb += (LevelDb - NoiseFloorDb) * FMath::Min(VAD_NOISE_FLOOR_FALL_RATE * FrameMs / 100.0f, 1.0f);
+	}
+	else
+	{
+		NoiseFloorDb = FMath::Min(NoiseFloorDb + VAD_NOISE_FLOOR_RISE_DB_PER_SECOND * FrameMs / 1000.0f, LevelDb);
+	}
+
+	if (bFrameIsSpeech)
+	{
+		HangoverRemainingMs = (float)Settings.HangoverMs;
+		bSpeaking = true;
+	}
+	else if (bSpeaking)
+	{
+		HangoverRemainingMs -= FrameMs;
+		bSpeaking = HangoverRemainingMs > 0.0f;
+	}
+	return bSpeaking;
+}
@@ -0,0 +1,53 @@
+// Copyright (c) 2024 Betide Studio. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Lightweight voice activity detector for captured int16 audio.
+ *
+ * A frame counts as speech when its level is above both an absolute threshold and the tracked noise floor by
+ * a margin, and enough of its energy sits in the speech band (roughly 300 Hz - 3.4 kHz) to rule out rumble and
+ * hiss. Speech keeps the detector open for a hangover period so word endings and short pauses aren't clipped.
+ * Not thread safe, each capture stream should use its own detector.
+ */
+class FEIKVoiceActivityDetector
+{
+public:
+	struct FSettings
+	{
+		/** Frames quieter than this are always silence */
+		float ThresholdDb = -50.0f;
+		/** How far above the noise floor a frame has to be to count as speech */
+		float NoiseMarginDb = 9.0f;
+		/** Fraction of a frame's energy that has to be in the speech band */
+		float SpeechBandRatio = 0.4f;
+		/** How long the detector stays open after the last speech frame */
+		int32 HangoverMs = 300;
+	};
+
+	/** Reads the settings from the EOSVoiceChat.VoiceActivity* console variables */
+	static FSettings GetSettingsFromConsole();
+
+	explicit FEIKVoiceActivityDetector(const FSettings& InSettings = FSettings());
+
+	/** Analyzes one interleaved buffer and returns whether it should be treated as speech */
+	bool ProcessFrame(TArrayView<const int16> Samples, uint32 SampleRate, uint32 NumChannels);
+
+	bool IsSpeaking() const { return bSpeaking; }
+
+private:
+	FSettings Settings;
+
+	/** Tracked level of the background noise */
+	float NoiseFloorDb = -70.0f;
+	/** Time left before the detector closes after the last speech frame */
+	float HangoverRemainingMs = 0.0f;
+	bool bSpeaking = false;
+
+	/** One pole filter states isolating the speech band, kept across frames to avoid clicks at frame edges */
+	float HighPassState = 0.0f;
+	float HighPassPrevInput = 0.0f;
+	float LowPassState = 0.0f;
+};
@@ -0,0 +1,294 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "EIKVoiceChatRouting.h"
+#include "GameFramework/PlayerState.h"
+#include "Runtime/Launch/Resources/Version.h"
+
+namespace
+{
+	// Input frames converted per chunk, 10ms at 48kHz which is what the RTC delivers
+	constexpr int32 SinkChunkFrames = 480;
+	// Largest upsampling ratio we leave room for in the resample scratch
+	constexpr int32 SinkMaxUpsampleRatio = 8;
+	// Length of the fade used to conceal an underrun
+	constexpr int32 SinkConcealFadeSamples = 64;
+}
+
+void FEIKVoiceChatSynthSink::Init(int32 InSampleRate, int32 InTargetLatencySamples)
+{
+	SampleRate = FMath::Max(InSampleRate, 1);
+	TargetLatencySamples = FMath::Clamp(InTargetLatencySamples, 1, SampleRate / 2);
+	MaxLatencySamples = TargetLatencySamples * 3;
+
+	// One second of audio is plenty of headroom over the latency we let build up
+#if ENGINE_MAJOR_VERSION >= 5
+	AudioBuffer = Audio::TCircularAudioBuffer<float>(FMath::Max<uint32>(SampleRate, MaxLatencySamples * 2));
+#else
+	AudioBuffer.Reset(FMath::Max<uint32>(SampleRate, MaxLatencySamples * 2));
+#endif
+
+	MonoScratch.SetNumUninitialized(SinkChunkFrames);
+	ResampledScratch.SetNumUninitialized(SinkChunkFrames * SinkMaxUpsampleRatio + 2);
+	ResamplePhase = 0.0;
+	LastInputSample = 0.f;
+	bBuffering = true;
+	LastOutputSample = 0.f;
+}
+
+void FEIKVoiceChatSynthSink::WriteSamples(TArrayView<int16> Samples, int32 InSampleRate, int32 InNumChannels)
+{
+	if (MonoScratch.Num() == 0 || InSampleRate <= 0 || InNumChannels <= 0)
+	{
+		return;
+	}
+
+	// Keep each chunk's resampled output within the preallocated scratch
+	const int32 MaxChunkFrames = FMath::Clamp(int32(int64(ResampledScratch.Num() - 2) * InSampleRate / SampleRate), 1, MonoScratch.Num());
+
+	const int32 NumFrames = Samples.Num() / InNumChannels;
+	for (int32 FrameIndex = 0; FrameIndex < NumFrames; FrameIndex += MaxChunkFrames)
+	{
+		const int32 ChunkFrames = FMath::Min(MaxChunkFrames, NumFrames - FrameIndex);
+		WriteChunk(Samples.GetData() + FrameIndex * InNumChannels, ChunkFrames, InSampleRate, InNumChannels);
+	}
+}
+
+void FEIKVoiceChatSynthSink::WriteChunk(const int16* Samples, int32 NumFrames, int32 InSampleRate, int32 InNumChannels)
+{
+	// Downmix to mono float
+	float* Mono = MonoScratch.GetData();
+	const float Scale = 1.f / (32768.f * InNumChannels);
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		int32 Sum = 0;
+		for (int32 Channel = 0; Channel < InNumChannels; ++Channel)
+		{
+			Sum += Samples[Frame * InNumChannels + Channel];
+		}
+		Mono[Frame] = Sum * Scale;
+	}
+
+	const float* Output = Mono;
+	int32 NumOutput = NumFrames;
+	if (InSampleRate != SampleRate)
+	{
+		// Linear interpolation, position -1 is the last sample of the previous chunk so chunks join up seamlessly
+		const double Step = double(InSampleRate) / SampleRate;
+		float* Resampled = ResampledScratch.GetData();
+		NumOutput = 0;
+		double Position = ResamplePhase - 1.0;
+		while (Position < NumFrames - 1 && NumOutput < ResampledScratch.Num())
+		{
+			const int32 Index = FMath::FloorToInt(Position);
+			const float Alpha = float(Position - Index);
+			const float A = Index < 0 ? LastInputSample : Mono[Index];
+			const float B = Mono[Index + 1];
+			Resampled[NumOutput++] = A + (B - A) * Alpha;
+			Position += Step;
+		}
+		ResamplePhase = Position - (NumFrames - 1);
+		Output = Resampled;
+	}
+	LastInputSample = Mono[NumFrames - 1];
+
+	if (AudioBuffer.Push(Output, NumOutput) < uint32(NumOutput))
+	{
+		NumOverruns.fetch_add(1, std::memory_order_relaxed);
+	}
+}
+
+int32 FEIKVoiceChatSynthSink::ReadSamples(float* OutAudio, int32 NumSamples)
+{
+	if (NumSamples <= 0)
+	{
+		return 0;
+	}
+
+	uint32 NumAvailable = AudioBuffer.Num();
+	if (bBuffering)
+	{
+		// Accumulate the target latency before streaming so we don't starve again straight away
+		if (NumAvailable < TargetLatencySamples)
+		{
+			Conceal(OutAudio, NumSamples);
+			return NumSamples;
+		}
+		bBuffering = false;
+	}
+
+	if (NumAvailable > MaxLatencySamples)
+	{
+		// The producer got ahead of us, drop the oldest audio to get back to the target latency
+		AudioBuffer.Pop(NumAvailable - TargetLatencySamples);
+		NumOverruns.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	const int32 NumRead = AudioBuffer.Pop(OutAudio, NumSamples);
+	if (NumRead > 0)
+	{
+		LastOutputSample = OutAudio[NumRead - 1];
+	}
+	if (NumRead < NumSamples)
+	{
+		NumUnderruns.fetch_add(1, std::memory_order_relaxed);
+		Conceal(OutAudio + NumRead, NumSamples - NumRead);
+		bBuffering = true;
+	}
+	return NumSamples;
+}
+
+void FEIKVoiceChatSynthSink::Conceal(float* OutAudio, int32 NumSamples)
+{
+	const int32 NumFade = FMath::Min(NumSamples, SinkConcealFadeSamples);
+	for (int32 Index = 0; Index < NumFade; ++Index)
+	{
+		OutAudio[Index] = LastOutputSample * (1.f - float(Index + 1) / NumFade);
+	}
+	if (NumSamples > NumFade)
+	{
+		FMemory::Memzero(OutAudio + NumFade, (NumSamples - NumFade) * sizeof(float));
+	}
+	LastOutputSample = 0.f;
+}
+
+#if WITH_EOS_RTC
+
+namespace
+{
+	// How long a replaced snapshot is kept alive, far longer than any render callback can hold on to it
+	constexpr double RetiredSnapshotGraceSeconds = 5.0;
+}
+
+FEIKVoiceChatRoutingTable& FEIKVoiceChatRoutingTable::Get()
+{
+	static FEIKVoiceChatRoutingTable Instance;
+	return Instance;
+}
+
+FEIKVoiceChatRoutingTable::~FEIKVoiceChatRoutingTable()
+{
+	delete CurrentSnapshot.exchange(nullptr);
+}
+
+bool FEIKVoiceChatRoutingTable::FRoute::AcceptsRoom(const char* RoomName) const
+{
+	if (bUseGlobalRoom)
+	{
+		return true;
+	}
+	if (RoomName)
+	{
+		for (const TArray<ANSICHAR>& SupportedRoom : SupportedRooms)
+		{
+			if (FCStringAnsi::Strcmp(SupportedRoom.GetData(), RoomName) == 0)
+			{
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+void FEIKVoiceChatRoutingTable::SetRoute(const UEIKVoiceChatSynthComponent* Owner, EOS_ProductUserId ProductUserId, const FEIKVoiceChatSynthSinkRef& Sink, const TArray<FString>& SupportedRooms, bool bUseGlobalRoom)
+{
+	check(IsInGameThread());
+
+	FRoute Route { Sink };
+	Route.bUseGlobalRoom = bUseGlobalRoom;
+	Route.SupportedRooms.Reserve(SupportedRooms.Num());
+	for (const FString& SupportedRoom : SupportedRooms)
+	{
+		const FTCHARToUTF8 Utf8Room(*SupportedRoom);
+		TArray<ANSICHAR>& Room = Route.SupportedRooms.AddDefaulted_GetRef();
+		Room.Append(Utf8Room.Get(), Utf8Room.Length());
+		Room.Add('\0');
+	}
+
+	Routes.Emplace(Owner, TPair<EOS_ProductUserId, FRoute>(ProductUserId, MoveTemp(Route)));
+	Publish();
+}
+
+void FEIKVoiceChatRoutingTable::RemoveRoute(const UEIKVoiceChatSynthComponent* Owner)
+{
+	check(IsInGameThread());
+
+	if (Routes.Remove(Owner) > 0)
+	{
+		Publish();
+	}
+}
+
+bool FEIKVoiceChatRoutingTable::WriteSamples(EOS_ProductUserId ProductUserId, const char* RoomName, TArrayView<int16> Samples, int32 SampleRate, int32 NumChannels) const
+{
+	const FSnapshot* Snapshot = CurrentSnapshot.load(std::memory_order_acquire);
+	if (!Snapshot)
+	{
+		return false;
+	}
+
+	const TArray<FRoute>* ParticipantRoutes = Snapshot->Find(ProductUserId);
+	if (!ParticipantRoutes)
+	{
+		return false;
+	}
+
+	for (const FRoute& Route : *ParticipantRoutes)
+	{
+		if (Route.Sink->IsActive() && Route.AcceptsRoom(RoomName))
+		{
+			Route.Sink->WriteSamples(Samples, SampleRate, NumChannels);
+		}
+	}
+	return true;
+}
+
+EOS_ProductUserId FEIKVoiceChatRoutingTable::GetProductUserId(const APlayerState* PlayerState)
+{
+	if (!PlayerState)
+	{
+		return nullptr;
+	}
+
+	const TSharedPtr<const FUniqueNetId> NetId = PlayerState->GetUniqueId().GetUniqueNetId();
+	if (!NetId.IsValid())
+	{
+		return nullptr;
+	}
+
+	// EOS net ids are "EpicAccountId|ProductUserId"
+	FString ProductId = NetId->ToString();
+	int32 SeparatorIndex = INDEX_NONE;
+	if (ProductId.FindChar(TEXT('|'), SeparatorIndex))
+	{
+		ProductId.RightChopInline(SeparatorIndex + 1);
+	}
+	if (ProductId.IsEmpty())
+	{
+		return nullptr;
+	}
+
+	EOS_ProductUserId ProductUserId = EOS_ProductUserId_FromString(TCHAR_TO_UTF8(*ProductId));
+	return EOS_ProductUserId_IsValid(ProductUserId) == EOS_TRUE ? ProductUserId : nullptr;
+}
+
+void FEIKVoiceChatRoutingTable::Publish()
+{
+	FSnapshot* NewSnapshot = new FSnapshot();
+	for (const TPair<const UEIKVoiceChatSynthComponent*, TPair<EOS_ProductUserId, FRoute>>& Entry : Routes)
+	{
+		NewSnapshot->FindOrAdd(Entry.Value.Key).Add(Entry.Value.Value);
+	}
+
+	const double NowSeconds = FPlatformTime::Seconds();
+	RetiredSnapshots.RemoveAll([NowSeconds](const TPair<double, TUniquePtr<const FSnapshot>>& Retired)
+	{
+		return NowSeconds - Retired.Key > RetiredSnapshotGraceSeconds;
+	});
+
+	if (const FSnapshot* OldSnapshot = CurrentSnapshot.exchange(NewSnapshot, std::memory_order_acq_rel))
+	{
+		RetiredSnapshots.Emplace(NowSeconds, TUniquePtr<const FSnapshot>(OldSnapshot));
+	}
+}
+
+#endif // WITH_EOS_RTC
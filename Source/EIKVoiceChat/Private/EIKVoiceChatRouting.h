@@ -0,0 +1,126 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/CircularBuffer.h"
+#include "DSP/Dsp.h"
+#include "EOSShared.h"
+
+#include <atomic>
+
+class APlayerState;
+class UEIKVoiceChatSynthComponent;
+
+/**
+ * Audio shared between the RTC render callback (producer) and a UEIKVoiceChatSynthComponent (consumer).
+ * Owned by the component and referenced by the routing table, so the render callback never touches the UObject.
+ *
+ * Works as a single producer / single consumer jitter buffer: the producer downmixes and resamples into the synth's
+ * mono format, the consumer waits until TargetLatencySamples are buffered before playing, conceals underruns with a
+ * short fade and drops the oldest audio when latency builds up past MaxLatencySamples.
+ */
+class FEIKVoiceChatSynthSink
+{
+public:
+	void Init(int32 InSampleRate, int32 InTargetLatencySamples);
+
+	// Called from the RTC render callback with interleaved PCM16
+	void WriteSamples(TArrayView<int16> Samples, int32 InSampleRate, int32 InNumChannels);
+
+	// Called from the synth component's audio render thread, always fills NumSamples
+	int32 ReadSamples(float* OutAudio, int32 NumSamples);
+
+	void SetActive(bool bInActive) { bActive.store(bInActive, std::memory_order_relaxed); }
+	bool IsActive() const { return bActive.load(std::memory_order_relaxed); }
+
+	/** Number of times the consumer ran dry and had to conceal */
+	int32 GetNumUnderruns() const { return NumUnderruns.load(std::memory_order_relaxed); }
+	/** Number of times audio was dropped because the buffer was full or too far behind */
+	int32 GetNumOverruns() const { return NumOverruns.load(std::memory_order_relaxed); }
+
+private:
+	/** Producer: pushes one chunk of interleaved input, NumFrames must fit MonoScratch */
+	void WriteChunk(const int16* Samples, int32 NumFrames, int32 InSampleRate, int32 InNumChannels);
+	/** Consumer: fade from the last played sample to silence */
+	void Conceal(float* OutAudio, int32 NumSamples);
+
+	Audio::TCircularAudioBuffer<float> AudioBuffer;
+	int32 SampleRate = 48000;
+	uint32 TargetLatencySamples = 0;
+	uint32 MaxLatencySamples = 0;
+
+	// Producer state, preallocated in Init so the render callback never allocates
+	TArray<float> MonoScratch;
+	TArray<float> ResampledScratch;
+	double ResamplePhase = 0.0;
+	float LastInputSample = 0.f;
+
+	// Consumer state
+	bool bBuffering = true;
+	float LastOutputSample = 0.f;
+
+	std::atomic<bool> bActive { false };
+	std::atomic<int32> NumUnderruns { 0 };
+	std::atomic<int32> NumOverruns { 0 };
+};
+
+typedef TSharedPtr<FEIKVoiceChatSynthSink, ESPMode::ThreadSafe> FEIKVoiceChatSynthSinkPtr;
+typedef TSharedRef<FEIKVoiceChatSynthSink, ESPMode::ThreadSafe> FEIKVoiceChatSynthSinkRef;
+
+#if WITH_EOS_RTC
+
+#include "eos_common.h"
+
+/**
+ * Maps RTC participants to the synth components that play their audio.
+ *
+ * Routes are added and removed on the game thread by the synth components as their owning pawn gains or loses a
+ * PlayerState. Each change publishes a new immutable snapshot, so the render callback only does an atomic load and
+ * a map lookup. Replaced snapshots are kept alive for a grace period before being freed.
+ */
+class FEIKVoiceChatRoutingTable
+{
+public:
+	static FEIKVoiceChatRoutingTable& Get();
+
+	~FEIKVoiceChatRoutingTable();
+
+	/** Game thread: route audio from ProductUserId to Sink, replacing any route previously set for Owner */
+	void SetRoute(const UEIKVoiceChatSynthComponent* Owner, EOS_ProductUserId ProductUserId, const FEIKVoiceChatSynthSinkRef& Sink, const TArray<FString>& SupportedRooms, bool bUseGlobalRoom);
+	/** Game thread: remove the route set for Owner, if any */
+	void RemoveRoute(const UEIKVoiceChatSynthComponent* Owner);
+
+	/**
+	 * Any thread: hand the samples of ProductUserId in RoomName to every active sink routed for them.
+	 * @return true if the participant has at least one sink, in which case the RTC should not play the samples itself
+	 */
+	bool WriteSamples(EOS_ProductUserId ProductUserId, const char* RoomName, TArrayView<int16> Samples, int32 SampleRate, int32 NumChannels) const;
+
+	/** Game thread: resolve the product user id of the player, or nullptr if it is not known yet */
+	static EOS_ProductUserId GetProductUserId(const APlayerState* PlayerState);
+
+private:
+	struct FRoute
+	{
+		FEIKVoiceChatSynthSinkRef Sink;
+		// UTF8 room names, compared against the room name the SDK hands us without converting it
+		TArray<TArray<ANSICHAR>> SupportedRooms;
+		bool bUseGlobalRoom = false;
+
+		bool AcceptsRoom(const char* RoomName) const;
+	};
+
+	typedef TMap<EOS_ProductUserId, TArray<FRoute>> FSnapshot;
+
+	void Publish();
+
+	/** Game thread view of every route, keyed by the component that set it */
+	TMap<const UEIKVoiceChatSynthComponent*, TPair<EOS_ProductUserId, FRoute>> Routes;
+	/** Snapshot read by the render callback */
+	std::atomic<const FSnapshot*> CurrentSnapshot { nullptr };
+	/** Replaced snapshots and the time they were replaced */
+	TArray<TPair<double, TUniquePtr<const FSnapshot>>> RetiredSnapshots;
+};
+
+#endif // WITH_EOS_RTC
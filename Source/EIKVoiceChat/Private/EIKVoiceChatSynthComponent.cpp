@@ -2,37 +2,123 @@
 
 
 #include "EIKVoiceChatSynthComponent.h"
+#include "EIKVoiceChatRouting.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerState.h"
+
+UEIKVoiceChatSynthComponent::UEIKVoiceChatSynthComponent(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+	, Sink(MakeShared<FEIKVoiceChatSynthSink, ESPMode::ThreadSafe>())
+{
+	// Only used to notice PlayerState and possession changes of the owning pawn, so it does not need to run every frame
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = true;
+	PrimaryComponentTick.TickInterval = 0.25f;
+}
 
 bool UEIKVoiceChatSynthComponent::Init(int32& SampleRate)
 {
 	NumChannels = 1;
-#if ENGINE_MAJOR_VERSION >= 5
-	AudioBuffer = Audio::TCircularAudioBuffer<float>(SampleRate * NumChannels);
-#else
-	// Reset the buffer with the new size
-	AudioBuffer.Reset(SampleRate * NumChannels);
-
-	OutArray.Reserve(SampleRate / 10);
-	OutArrayView = TArrayView<float>(OutArray.GetData(), SampleRate / 10);
-#endif
-	OutArray.Reserve(SampleRate / 10);
-	OutArrayView = TArrayView<float>(OutArray.GetData(), SampleRate / 10);
+
+	// Start from a fresh sink so the render callback never sees the buffer being resized
+	TSharedPtr<FEIKVoiceChatSynthSink, ESPMode::ThreadSafe> NewSink = MakeShared<FEIKVoiceChatSynthSink, ESPMode::ThreadSafe>();
+	NewSink->Init(SampleRate, FMath::RoundToInt(SampleRate * TargetLatencyMs / 1000.f));
+	NewSink->SetActive(IsActive());
+	{
+		FScopeLock ScopeLock(&SinkCriticalSection);
+		Sink = MoveTemp(NewSink);
+	}
+	if (bHasRoute && IsInGameThread())
+	{
+		UpdateRoute(true);
+	}
 
 	return true;
 }
 
+TSharedPtr<FEIKVoiceChatSynthSink, ESPMode::ThreadSafe> UEIKVoiceChatSynthComponent::GetSink() const
+{
+	FScopeLock ScopeLock(&SinkCriticalSection);
+	return Sink;
+}
+
 int32 UEIKVoiceChatSynthComponent::OnGenerateAudio(float* OutAudio, int32 NumSamples)
 {
-	//we perform some basic checks to ensure we have enough samples to stream, if not we return 0
-	if (AudioBuffer.Num() >= uint32(NumSamples))
+	return GetSink()->ReadSamples(OutAudio, NumSamples);
+}
+
+int32 UEIKVoiceChatSynthComponent::GetNumUnderruns() const
+{
+	return GetSink()->GetNumUnderruns();
+}
+
+int32 UEIKVoiceChatSynthComponent::GetNumOverruns() const
+{
+	return GetSink()->GetNumOverruns();
+}
+
+void UEIKVoiceChatSynthComponent::BeginPlay()
+{
+	Super::BeginPlay();
+	UpdateRoute(true);
+}
+
+void UEIKVoiceChatSynthComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	RemoveRoute();
+	Super::EndPlay(EndPlayReason);
+}
+
+void UEIKVoiceChatSynthComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	UpdateRoute(false);
+}
+
+void UEIKVoiceChatSynthComponent::Activate(bool bReset)
+{
+	Super::Activate(bReset);
+	GetSink()->SetActive(IsActive());
+}
+
+void UEIKVoiceChatSynthComponent::Deactivate()
+{
+	Super::Deactivate();
+	GetSink()->SetActive(IsActive());
+}
+
+void UEIKVoiceChatSynthComponent::UpdateRoute(bool bForce)
+{
+#if WITH_EOS_RTC
+	const APawn* OwningPawn = Cast<APawn>(GetOwner());
+	APlayerState* PlayerState = OwningPawn ? OwningPawn->GetPlayerState() : nullptr;
+
+	// The unique id can replicate after the PlayerState, so keep resolving until it is known
+	if (!bForce && PlayerState == RoutedPlayerState.Get() && (bHasRoute || !PlayerState))
+	{
+		return;
+	}
+
+	RoutedPlayerState = PlayerState;
+	if (EOS_ProductUserId ProductUserId = FEIKVoiceChatRoutingTable::GetProductUserId(PlayerState))
 	{
-		AudioBuffer.Pop(OutAudio, NumSamples);
-		return NumSamples;
-		
+		FEIKVoiceChatRoutingTable::Get().SetRoute(this, ProductUserId, GetSink().ToSharedRef(), SupportedRooms, bUseGlobalRoom);
+		bHasRoute = true;
 	}
 	else
 	{
-		return 0;
+		RemoveRoute();
 	}
+#endif
 }
 
+void UEIKVoiceChatSynthComponent::RemoveRoute()
+{
+#if WITH_EOS_RTC
+	if (bHasRoute)
+	{
+		FEIKVoiceChatRoutingTable::Get().RemoveRoute(this);
+		bHasRoute = false;
+	}
+#endif
+}
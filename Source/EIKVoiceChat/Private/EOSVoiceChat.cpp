@@ -75,17 +75,41 @@ bool FEOSVoiceChat::Initialize()
 
 bool FEOSVoiceChat::Uninitialize()
 {
-	bool bIsDone = false;
-	Uninitialize(FOnVoiceChatUninitializeCompleteDelegate::CreateLambda([&bIsDone](const FVoiceChatResult& Result)
+	// The online subsystem ticks a shared platform, ticking it from here could run its callbacks at a point it doesn't expect
+	const bool bTickPlatform = !bUsingSharedPlatform;
+
+	// Shared so a completion that arrives after we gave up doesn't write to a dead stack frame
+	TSharedRef<bool, ESPMode::ThreadSafe> bIsDone = MakeShared<bool, ESPMode::ThreadSafe>(false);
+	Uninitialize(FOnVoiceChatUninitializeCompleteDelegate::CreateLambda([bIsDone](const FVoiceChatResult& Result)
 	{
-		bIsDone = true;
+		*bIsDone = true;
 	}));
 
-	while (!bIsDone)
+	// Pump the platform ourselves since the core ticker may not run from here (e.g. during module shutdown), but
+	// sleep between ticks and give up after the timeout rather than pegging a core until the SDK answers
+	const double TimeoutSeconds = FPlatformTime::Seconds() + UninitializeTimeoutSeconds;
+	while (bTickPlatform && !*bIsDone && EosPlatformHandle && FPlatformTime::Seconds() < TimeoutSeconds)
 	{
 		EosPlatformHandle->Tick();
+		if (!*bIsDone)
+		{
+			FPlatformProcess::Sleep(0.001f);
+		}
+	}
+
+	if (!*bIsDone && InitSession.State == EInitializationState::Uninitializing)
+	{
+		if (bTickPlatform)
+		{
+			UE_LOG(LogEOSVoiceChat, Warning, TEXT("FEOSVoiceChat::Uninitialize timed out waiting to disconnect, completing anyway"));
+		}
+		else
+		{
+			UE_LOG(LogEOSVoiceChat, Log, TEXT("FEOSVoiceChat::Uninitialize not waiting to disconnect on the online subsystem's platform"));
+		}
+		CompleteUninitialize();
 	}
-	
+
 	return !IsInitialized();
 }
 
@@ -106,6 +130,7 @@ void FEOSVoiceChat::Initialize(const FOnVoiceChatInitializeCompleteDelegate& Ini
 		if (bEnabled)
 		{
 			InitSession.State = EInitializationState::Initializing;
+			UninitializeTimeoutSeconds = FMath::Max(EIKSettings->VoiceChatUninitializeTimeoutSeconds, 0.0f);
 
 			if (!EosPlatformHandle)
 			{
@@ -143,44 +168,66 @@ void FEOSVoiceChat::Initialize(const FOnVoiceChatInitializeCompleteDelegate& Ini
 						GConfig->GetString(TEXT("EOSVoiceChat"), TEXT("OverrideLocaleCode"), ConfigOverrideLocaleCode, GEngineIni);
 						
 					}
-					const FTCHARToUTF8 Utf8ProductId(*ConfigProductId);
-					const FTCHARToUTF8 Utf8SandboxId(*ConfigSandboxId);
-					const FTCHARToUTF8 Utf8DeploymentId(*ConfigDeploymentId);
-					const FTCHARToUTF8 Utf8ClientId(*ConfigClientId);
-					const FTCHARToUTF8 Utf8ClientSecret(*ConfigClientSecret);
-					const FTCHARToUTF8 Utf8EncryptionKey(*ConfigEncryptionKey);
-					const FTCHARToUTF8 Utf8OverrideCountryCode(*ConfigOverrideCountryCode);
-					const FTCHARToUTF8 Utf8OverrideLocaleCode(*ConfigOverrideLocaleCode);
-
-					EOS_Platform_Options PlatformOptions = {};
-					PlatformOptions.ApiVersion = EOS_PLATFORM_OPTIONS_API_LATEST;
-					PlatformOptions.Reserved = nullptr;
-					PlatformOptions.ProductId = ConfigProductId.IsEmpty() ? nullptr : Utf8ProductId.Get();
-					PlatformOptions.SandboxId = ConfigSandboxId.IsEmpty() ? nullptr : Utf8SandboxId.Get();
-					PlatformOptions.ClientCredentials.ClientId = ConfigClientId.IsEmpty() ? nullptr : Utf8ClientId.Get();
-					PlatformOptions.ClientCredentials.ClientSecret = ConfigClientSecret.IsEmpty() ? nullptr : Utf8ClientSecret.Get();
-					PlatformOptions.bIsServer = false;
-					PlatformOptions.EncryptionKey = ConfigEncryptionKey.IsEmpty() ? nullptr : Utf8EncryptionKey.Get();
-					PlatformOptions.OverrideCountryCode = ConfigOverrideCountryCode.IsEmpty() ? nullptr : Utf8OverrideCountryCode.Get();
-					PlatformOptions.OverrideLocaleCode = ConfigOverrideLocaleCode.IsEmpty() ? nullptr : Utf8OverrideLocaleCode.Get();
-					PlatformOptions.DeploymentId = ConfigDeploymentId.IsEmpty() ? nullptr : Utf8DeploymentId.Get();
-					PlatformOptions.Flags = EOS_PF_DISABLE_OVERLAY;
-					PlatformOptions.CacheDirectory = nullptr;
-					PlatformOptions.TickBudgetInMilliseconds = 1;
-					PlatformOptions.IntegratedPlatformOptionsContainerHandle = nullptr;
+
+					if (!EIKSettings->bUseDedicatedVoiceChatPlatform)
+					{
+						// Run on the online subsystem's platform, a second platform for the same deployment doubles the
+						// SDK's connections, threads and tick work for nothing
+						EosPlatformHandle = SDKManager.FindSharedPlatform(ConfigDeploymentId);
+						if (EosPlatformHandle)
+						{
+							bUsingSharedPlatform = true;
+						}
+						else
+						{
+							UE_LOG(LogEOSVoiceChat, Warning, TEXT("FEOSVoiceChat::Initialize no online subsystem platform for DeploymentId=%s. Initialize the online subsystem first, or set bUseDedicatedVoiceChatPlatform=true in [/Script/EOSIntegrationKit.EIKSettings] to give voice chat its own platform"), *ConfigDeploymentId);
+							Result = FVoiceChatResult(EVoiceChatResult::ImplementationError);
+						}
+					}
+					else
+					{
+						const FTCHARToUTF8 Utf8ProductId(*ConfigProductId);
+						const FTCHARToUTF8 Utf8SandboxId(*ConfigSandboxId);
+						const FTCHARToUTF8 Utf8DeploymentId(*ConfigDeploymentId);
+						const FTCHARToUTF8 Utf8ClientId(*ConfigClientId);
+						const FTCHARToUTF8 Utf8ClientSecret(*ConfigClientSecret);
+						const FTCHARToUTF8 Utf8EncryptionKey(*ConfigEncryptionKey);
+						const FTCHARToUTF8 Utf8OverrideCountryCode(*ConfigOverrideCountryCode);
+						const FTCHARToUTF8 Utf8OverrideLocaleCode(*ConfigOverrideLocaleCode);
+						// Kept apart from the online subsystem's cache, the SDK doesn't support two platforms sharing one
+						const FString CacheDirectory = SDKManager.GetCacheDirBase() / TEXT("VoiceChat") / EIKSettings->VoiceArtifactName;
+						const FTCHARToUTF8 Utf8CacheDirectory(*CacheDirectory);
+
+						EOS_Platform_Options PlatformOptions = {};
+						PlatformOptions.ApiVersion = EOS_PLATFORM_OPTIONS_API_LATEST;
+						PlatformOptions.Reserved = nullptr;
+						PlatformOptions.ProductId = ConfigProductId.IsEmpty() ? nullptr : Utf8ProductId.Get();
+						PlatformOptions.SandboxId = ConfigSandboxId.IsEmpty() ? nullptr : Utf8SandboxId.Get();
+						PlatformOptions.ClientCredentials.ClientId = ConfigClientId.IsEmpty() ? nullptr : Utf8ClientId.Get();
+						PlatformOptions.ClientCredentials.ClientSecret = ConfigClientSecret.IsEmpty() ? nullptr : Utf8ClientSecret.Get();
+						PlatformOptions.bIsServer = false;
+						PlatformOptions.EncryptionKey = ConfigEncryptionKey.IsEmpty() ? nullptr : Utf8EncryptionKey.Get();
+						PlatformOptions.OverrideCountryCode = ConfigOverrideCountryCode.IsEmpty() ? nullptr : Utf8OverrideCountryCode.Get();
+						PlatformOptions.OverrideLocaleCode = ConfigOverrideLocaleCode.IsEmpty() ? nullptr : Utf8OverrideLocaleCode.Get();
+						PlatformOptions.DeploymentId = ConfigDeploymentId.IsEmpty() ? nullptr : Utf8DeploymentId.Get();
+						PlatformOptions.Flags = EOS_PF_DISABLE_OVERLAY;
+						PlatformOptions.CacheDirectory = Utf8CacheDirectory.Get();
+						PlatformOptions.TickBudgetInMilliseconds = UEIKSettings::GetSettings().TickBudgetInMilliseconds;
+						PlatformOptions.IntegratedPlatformOptionsContainerHandle = nullptr;
 #if UE_EDITOR
-					//PlatformCreateOptions.Flags |= EOS_PF_LOADING_IN_EDITOR;
+						//PlatformCreateOptions.Flags |= EOS_PF_LOADING_IN_EDITOR;
 #endif
 
-					EOS_Platform_RTCOptions PlatformRTCOptions = {};
-					PlatformRTCOptions.ApiVersion = EOS_PLATFORM_RTCOPTIONS_API_LATEST;
-					PlatformOptions.RTCOptions = &PlatformRTCOptions;
+						EOS_Platform_RTCOptions PlatformRTCOptions = {};
+						PlatformRTCOptions.ApiVersion = EOS_PLATFORM_RTCOPTIONS_API_LATEST;
+						PlatformOptions.RTCOptions = &PlatformRTCOptions;
 
-					EosPlatformHandle = EOSPlatformCreate(PlatformOptions);
-					if (!EosPlatformHandle)
-					{
-						UE_LOG(LogEOSVoiceChat, Warning, TEXT("FEOSVoiceChat::Initialize CreatePlatform failed"));
-						Result = FVoiceChatResult(EVoiceChatResult::ImplementationError);
+						EosPlatformHandle = EOSPlatformCreate(PlatformOptions);
+						if (!EosPlatformHandle)
+						{
+							UE_LOG(LogEOSVoiceChat, Warning, TEXT("FEOSVoiceChat::Initialize CreatePlatform failed"));
+							Result = FVoiceChatResult(EVoiceChatResult::ImplementationError);
+						}
 					}
 				}
 				else
@@ -255,34 +302,52 @@ void FEOSVoiceChat::Uninitialize(const FOnVoiceChatUninitializeCompleteDelegate&
 		InitSession.State = EInitializationState::Uninitializing;
 		InitSession.UninitializeCompleteDelegates.Emplace(UninitCompleteDelegate);
 
-		auto CompleteUninitialize = [this]()
+		if (IsConnected())
 		{
-			PreUninitialize();
-			UnbindInitCallbacks();
-
-			const TArray<FOnVoiceChatUninitializeCompleteDelegate> UninitializeCompleteDelegates = MoveTemp(InitSession.UninitializeCompleteDelegates);
-			InitSession.Reset();
-			for (const FOnVoiceChatUninitializeCompleteDelegate& UninitializeCompleteDelegate : UninitializeCompleteDelegates)
+			// Don't let an SDK that never answers keep the platform and everyone waiting on us alive
+#if ENGINE_MAJOR_VERSION == 5
+			UninitializeTimeoutHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([WeakThis = AsWeak()](float DeltaTime)
+#else
+			UninitializeTimeoutHandle = FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([WeakThis = CreateWeakThis()](float DeltaTime)
+#endif
 			{
-				UninitializeCompleteDelegate.ExecuteIfBound(FVoiceChatResult::CreateSuccess());
-			}
-		};
+				if (FEOSVoiceChatPtr StrongThis = WeakThis.Pin())
+				{
+					StrongThis->UninitializeTimeoutHandle.Reset();
+					if (StrongThis->InitSession.State == EInitializationState::Uninitializing)
+					{
+						UE_LOG(LogEOSVoiceChat, Warning, TEXT("FEOSVoiceChat::Uninitialize timed out waiting to disconnect, completing anyway"));
+						StrongThis->CompleteUninitialize();
+					}
+				}
+				return false;
+			}), UninitializeTimeoutSeconds);
 
-		if (IsConnected())
-		{
-			Disconnect(FOnVoiceChatDisconnectCompleteDelegate::CreateLambda([this, CompleteUninitialize](const FVoiceChatResult& Result)
+#if ENGINE_MAJOR_VERSION == 5
+			Disconnect(FOnVoiceChatDisconnectCompleteDelegate::CreateLambda([WeakThis = AsWeak()](const FVoiceChatResult& Result)
+#else
+			Disconnect(FOnVoiceChatDisconnectCompleteDelegate::CreateLambda([WeakThis = CreateWeakThis()](const FVoiceChatResult& Result)
+#endif
 			{
+				FEOSVoiceChatPtr StrongThis = WeakThis.Pin();
+				if (!StrongThis.IsValid() || StrongThis->InitSession.State != EInitializationState::Uninitializing)
+				{
+					// Already completed by the timeout, or destroyed since
+					return;
+				}
+
 				if (Result.IsSuccess())
 				{
-					CompleteUninitialize();
+					StrongThis->CompleteUninitialize();
 				}
 				else
 				{
 					UE_LOG(LogEOSVoiceChat, Warning, TEXT("FEOSVoiceChat::Uninitialize failed %s"), *LexToString(Result));
 
-					InitSession.State = EInitializationState::Initialized;
+					StrongThis->ClearUninitializeTimeout();
+					StrongThis->InitSession.State = EInitializationState::Initialized;
 
-					const TArray<FOnVoiceChatUninitializeCompleteDelegate> Delegates = MoveTemp(InitSession.UninitializeCompleteDelegates);
+					const TArray<FOnVoiceChatUninitializeCompleteDelegate> Delegates = MoveTemp(StrongThis->InitSession.UninitializeCompleteDelegates);
 					for (const FOnVoiceChatUninitializeCompleteDelegate& Delegate : Delegates)
 					{
 						Delegate.ExecuteIfBound(Result);
@@ -298,6 +363,39 @@ void FEOSVoiceChat::Uninitialize(const FOnVoiceChatUninitializeCompleteDelegate&
 	}
 }
 
+void FEOSVoiceChat::CompleteUninitialize()
+{
+	ClearUninitializeTimeout();
+	PreUninitialize();
+	UnbindInitCallbacks();
+
+	const TArray<FOnVoiceChatUninitializeCompleteDelegate> UninitializeCompleteDelegates = MoveTemp(InitSession.UninitializeCompleteDelegates);
+	InitSession.Reset();
+	if (bUsingSharedPlatform)
+	{
+		// Don't keep the online subsystem's platform alive, Initialize looks it up again
+		EosPlatformHandle.Reset();
+		bUsingSharedPlatform = false;
+	}
+	for (const FOnVoiceChatUninitializeCompleteDelegate& UninitializeCompleteDelegate : UninitializeCompleteDelegates)
+	{
+		UninitializeCompleteDelegate.ExecuteIfBound(FVoiceChatResult::CreateSuccess());
+	}
+}
+
+void FEOSVoiceChat::ClearUninitializeTimeout()
+{
+	if (UninitializeTimeoutHandle.IsValid())
+	{
+#if ENGINE_MAJOR_VERSION == 5
+		FTSTicker::GetCoreTicker().RemoveTicker(UninitializeTimeoutHandle);
+#else
+		FTicker::GetCoreTicker().RemoveTicker(UninitializeTimeoutHandle);
+#endif
+		UninitializeTimeoutHandle.Reset();
+	}
+}
+
 bool FEOSVoiceChat::IsInitialized() const
 {
 	return InitSession.State == EInitializationState::Initialized;
@@ -3,8 +3,6 @@
 #include "EOSVoiceChatUser.h"
 #include "UObject/UObjectIterator.h"
 #include "EIKVoiceChat/Subsystem/EIK_Voice_Subsystem.h"
-#include "GameFramework/GameStateBase.h"
-#include "GameFramework/PlayerState.h"
 #if WITH_EOS_RTC
 #include "HAL/IConsoleManager.h"
 #include "Stats/Stats.h"
@@ -28,7 +26,8 @@
 #include "eos_rtc.h"
 #include "eos_rtc_audio.h"
 #include "eos_sdk.h"
-#include "EIKVoiceChatSynthComponent.h"
+#include "EIKVoiceChatRouting.h"
+#include "EIKVoiceActivityDetector.h"
 
 
 #define EOS_VOICE_TODO 0
@@ -99,6 +98,16 @@ static TAutoConsoleVariable<bool> CVarFakeAudioInputEnabled(
 	false,
 	TEXT("Whether Fake Audio input is enabled or not."));
 
+static TAutoConsoleVariable<bool> CVarVoiceActivityDetectionEnabled(
+	TEXT("EOSVoiceChat.VoiceActivityDetection"),
+	true,
+	TEXT("Whether captured audio is run through voice activity detection to report if the local user is speaking (default true). Only reported, audio is sent unchanged unless EOSVoiceChat.SuppressSilentFrames is set."));
+
+static TAutoConsoleVariable<bool> CVarSuppressSilentFrames(
+	TEXT("EOSVoiceChat.SuppressSilentFrames"),
+	false,
+	TEXT("Whether captured audio detected as silence is zeroed before it's sent, so it encodes to next to nothing (default false). Requires EOSVoiceChat.VoiceActivityDetection, and can clip quiet speech the detector misses."));
+
 #if !UE_BUILD_SHIPPING
 static TAutoConsoleVariable<bool> CVarChannelEchoEnabled(
 	TEXT("EOSVoiceChat.ChannelEchoEnabled"),
@@ -896,6 +905,7 @@ FDelegateHandle FEOSVoiceChatUser::RegisterOnVoiceChatAfterCaptureAudioReadDeleg
 {
 	FScopeLock Lock(&BeforeCaptureAudioSentLock);
 
+	NumCaptureAudioDelegates++;
 	return OnVoiceChatAfterCaptureAudioReadDelegate.Add(Delegate);
 }
 
@@ -903,13 +913,17 @@ void FEOSVoiceChatUser::UnregisterOnVoiceChatAfterCaptureAudioReadDelegate(FDele
 {
 	FScopeLock Lock(&BeforeCaptureAudioSentLock);
 
-	OnVoiceChatAfterCaptureAudioReadDelegate.Remove(Handle);
+	if (OnVoiceChatAfterCaptureAudioReadDelegate.Remove(Handle))
+	{
+		NumCaptureAudioDelegates--;
+	}
 }
 
 FDelegateHandle FEOSVoiceChatUser::RegisterOnVoiceChatBeforeCaptureAudioSentDelegate(const FOnVoiceChatBeforeCaptureAudioSentDelegate2::FDelegate& Delegate)
 {
 	FScopeLock Lock(&BeforeCaptureAudioSentLock);
 
+	NumCaptureAudioDelegates++;
 	return OnVoiceChatBeforeCaptureAudioSentDelegate.Add(Delegate);
 }
 
@@ -920,6 +934,7 @@ FDelegateHandle FEOSVoiceChatUser::RegisterOnVoiceChatAfterCaptureAudioReadDeleg
 {
 	FScopeLock Lock(&BeforeCaptureAudioSentLock);
 
+	NumCaptureAudioDelegates++;
 	return OnVoiceChatAfterCaptureAudioReadDelegate.Add(Delegate);
 }
 
@@ -927,13 +942,17 @@ void FEOSVoiceChatUser::UnregisterOnVoiceChatAfterCaptureAudioReadDelegate(FDele
 {
 	FScopeLock Lock(&BeforeCaptureAudioSentLock);
 
-	OnVoiceChatAfterCaptureAudioReadDelegate.Remove(Handle);
+	if (OnVoiceChatAfterCaptureAudioReadDelegate.Remove(Handle))
+	{
+		NumCaptureAudioDelegates--;
+	}
 }
 
 FDelegateHandle FEOSVoiceChatUser::RegisterOnVoiceChatBeforeCaptureAudioSentDelegate(const FOnVoiceChatBeforeCaptureAudioSentDelegate::FDelegate& Delegate)
 {
 	FScopeLock Lock(&BeforeCaptureAudioSentLock);
 
+	NumCaptureAudioDelegates++;
 	return OnVoiceChatBeforeCaptureAudioSentDelegate.Add(Delegate);
 }
 
@@ -942,7 +961,10 @@ void FEOSVoiceChatUser::UnregisterOnVoiceChatBeforeCaptureAudioSentDelegate(FDel
 #endif
 	FScopeLock Lock(&BeforeCaptureAudioSentLock);
 
-	OnVoiceChatBeforeCaptureAudioSentDelegate.Remove(Handle);
+	if (OnVoiceChatBeforeCaptureAudioSentDelegate.Remove(Handle))
+	{
+		NumCaptureAudioDelegates--;
+	}
 }
 
 FDelegateHandle FEOSVoiceChatUser::RegisterOnVoiceChatBeforeRecvAudioRenderedDelegate(const FOnVoiceChatBeforeRecvAudioRenderedDelegate::FDelegate& Delegate)
@@ -1198,6 +1220,7 @@ FEOSVoiceChatUser::FChannelSession& FEOSVoiceChatUser::GetChannelSession(const F
 	FChannelSession& NewSession = LoginSession.ChannelSessions.Add(ChannelName);
 	NewSession.ChannelName = ChannelName;
 	NewSession.ChannelType = EVoiceChatChannelType::NonPositional;
+	NewSession.ActivityHold.Acquire();
 	return NewSession;
 }
 
@@ -1443,7 +1466,7 @@ void FEOSVoiceChatUser::OnChannelAudioBeforeSendStatic(const EOS_RTCAudio_AudioB
 	{
 		if (FEOSVoiceChatUser* EosVoiceChatPtr = static_cast<FEOSVoiceChatUser*>(Data->ClientData))
 		{
-			EosVoiceChatPtr->OnChannelAudioBeforeSend(Data);
+			EosVoiceChatPtr->OnChannelAudioBeforeSend(Data, EosVoiceChatPtr->CaptureVoiceActivityDetector.Get());
 		}
 		else
 		{
@@ -1516,11 +1539,18 @@ void FEOSVoiceChatUser::BindChannelCallbacks(FChannelSession& ChannelSession)
 #if ENGINE_MAJOR_VERSION == 5
 		// Protect against callbacks occurring after this object is destroyed, by wrapping in a TEIKGlobalCallback. This can occur when LeaveRoom during Logout fails.
 		TUniquePtr<FAudioBeforeSendCallback> Callback = MakeUnique<FAudioBeforeSendCallback>(AsWeak());
-		Callback->CallbackLambda = [this](const EOS_RTCAudio_AudioBeforeSendCallbackInfo* Data) { OnChannelAudioBeforeSend(Data); };
+		// The callback keeps its own reference to the detector, as it can outlive the channel session
+		TSharedPtr<FEIKVoiceActivityDetector, ESPMode::ThreadSafe> VoiceActivityDetector = MakeShared<FEIKVoiceActivityDetector, ESPMode::ThreadSafe>(FEIKVoiceActivityDetector::GetSettingsFromConsole());
+		ChannelSession.VoiceActivityDetector = VoiceActivityDetector;
+		Callback->CallbackLambda = [this, VoiceActivityDetector](const EOS_RTCAudio_AudioBeforeSendCallbackInfo* Data) { OnChannelAudioBeforeSend(Data, VoiceActivityDetector.Get()); };
 		Callback->bIsGameThreadCallback = false;
 
 		ChannelSession.OnAudioBeforeSendNotificationId = EOS_RTCAudio_AddNotifyAudioBeforeSend(EOS_RTC_GetAudioInterface(GetRtcInterface()), &AudioBeforeSendOptions, Callback.Get(), Callback->GetCallbackPtr());
 #else
+		if (!CaptureVoiceActivityDetector.IsValid())
+		{
+			CaptureVoiceActivityDetector = MakeShared<FEIKVoiceActivityDetector, ESPMode::ThreadSafe>(FEIKVoiceActivityDetector::GetSettingsFromConsole());
+		}
 		ChannelSession.OnAudioBeforeSendNotificationId = EOS_RTCAudio_AddNotifyAudioBeforeSend(EOS_RTC_GetAudioInterface(GetRtcInterface()), &AudioBeforeSendOptions, this, &FEOSVoiceChatUser::OnChannelAudioBeforeSendStatic);
 #endif
 		if (ChannelSession.OnAudioBeforeSendNotificationId == EOS_INVALID_NOTIFICATIONID)
@@ -2385,7 +2415,7 @@ void FEOSVoiceChatUser::OnChannelParticipantAudioUpdated(const EOS_RTCAudio_Part
 	}
 }
 
-void FEOSVoiceChatUser::OnChannelAudioBeforeSend(const EOS_RTCAudio_AudioBeforeSendCallbackInfo* CallbackInfo)
+void FEOSVoiceChatUser::OnChannelAudioBeforeSend(const EOS_RTCAudio_AudioBeforeSendCallbackInfo* CallbackInfo, FEIKVoiceActivityDetector* VoiceActivityDetector)
 {
 	if (EOS_RTCAudio_AudioBuffer* Buffer = CallbackInfo->Buffer)
 	{
@@ -2394,10 +2424,6 @@ void FEOSVoiceChatUser::OnChannelAudioBeforeSend(const EOS_RTCAudio_AudioBeforeS
 			TArrayView<const int16> Samples = MakeArrayView(Buffer->Frames, Buffer->FramesCount * Buffer->Channels);
 			TArrayView<int16> WriteableSamples = MakeArrayView(Buffer->Frames, Buffer->FramesCount * Buffer->Channels);
 
-			// TODO EOS doesn't tell us if it's silence or not, maybe need to compare all the samples to some threshold?
-			const bool bSpeaking = true;
-			const FString ChannelName = UTF8_TO_TCHAR(CallbackInfo->RoomName);
-
 			if (bFakeAudioInput)
 			{
 				static float Envelope = 0x7fff;  // int16 samples
@@ -2412,16 +2438,34 @@ void FEOSVoiceChatUser::OnChannelAudioBeforeSend(const EOS_RTCAudio_AudioBeforeS
 				}
 			}
 
-			FScopeLock Lock(&BeforeCaptureAudioSentLock);
+			// EOS doesn't tell us if it's silence or not, so run the captured audio through our own detector
+			bool bSpeaking = true;
+			if (VoiceActivityDetector && CVarVoiceActivityDetectionEnabled.GetValueOnAnyThread())
+			{
+				bSpeaking = VoiceActivityDetector->ProcessFrame(Samples, Buffer->SampleRate, Buffer->Channels);
+			}
 
-			// Allow any processes to modify audio through DSP effects processing
+			// Skip the lock entirely in the common case of nobody listening
+			if (NumCaptureAudioDelegates.load(std::memory_order_relaxed) > 0)
+			{
+				FScopeLock Lock(&BeforeCaptureAudioSentLock);
+
+				// Allow any processes to modify audio through DSP effects processing
 #if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 6
-			OnVoiceChatAfterCaptureAudioReadDelegate.Broadcast(ChannelName, WriteableSamples, Buffer->SampleRate, Buffer->Channels);
-			OnVoiceChatBeforeCaptureAudioSentDelegate.Broadcast(ChannelName, Samples, Buffer->SampleRate, Buffer->Channels, bSpeaking);
+				const FString ChannelName = UTF8_TO_TCHAR(CallbackInfo->RoomName);
+				OnVoiceChatAfterCaptureAudioReadDelegate.Broadcast(ChannelName, WriteableSamples, Buffer->SampleRate, Buffer->Channels);
+				OnVoiceChatBeforeCaptureAudioSentDelegate.Broadcast(ChannelName, Samples, Buffer->SampleRate, Buffer->Channels, bSpeaking);
 #else
-			OnVoiceChatAfterCaptureAudioReadDelegate.Broadcast(WriteableSamples, Buffer->SampleRate, Buffer->Channels);
-			OnVoiceChatBeforeCaptureAudioSentDelegate.Broadcast(Samples, Buffer->SampleRate, Buffer->Channels, bSpeaking);
+				OnVoiceChatAfterCaptureAudioReadDelegate.Broadcast(WriteableSamples, Buffer->SampleRate, Buffer->Channels);
+				OnVoiceChatBeforeCaptureAudioSentDelegate.Broadcast(Samples, Buffer->SampleRate, Buffer->Channels, bSpeaking);
 #endif
+			}
+
+			// The SDK can't drop a captured buffer, but digital silence costs next to nothing once encoded
+			if (!bSpeaking && CVarSuppressSilentFrames.GetValueOnAnyThread())
+			{
+				FMemory::Memzero(WriteableSamples.GetData(), WriteableSamples.Num() * sizeof(int16));
+			}
 		}
 		else
 		{
@@ -2461,93 +2505,24 @@ void FEOSVoiceChatUser::OnChannelAudioBeforeRender(const EOS_RTCAudio_AudioBefor
 		{
 			TArrayView<int16> Samples = MakeArrayView(Buffer->Frames, Buffer->FramesCount * Buffer->Channels);
 			const bool bIsSilence = false;
-			const FString PlayerName = EIK_LexToString(CallbackInfo->ParticipantId);
-			const FString ChannelName = UTF8_TO_TCHAR(CallbackInfo->RoomName);
-			if(IsValid(GEngine))
+			// Participants with a synth component get their audio played through it instead of the RTC output
+			if (FEIKVoiceChatRoutingTable::Get().WriteSamples(CallbackInfo->ParticipantId, CallbackInfo->RoomName, Samples, Buffer->SampleRate, Buffer->Channels))
 			{
-				if (const UWorld* World = GEngine->GetWorldContexts().Last().World())
-				{
-					AActor* SpeakerActor = nullptr;
-					TArray<APlayerState*> PlayerArray;
-					if(AGameStateBase* GameState = World->GetGameState())
-					{
-						PlayerArray = GameState->PlayerArray;
-					}
-					if(PlayerArray.Num() > 0)
-					{
-						for(int i=0; i<PlayerArray.Num(); i++)
-						{
-							if(APlayerState* PlayerState = PlayerArray[i])
-							{
-								if(PlayerState->GetPawn())
-								{
-									const TSharedPtr<const FUniqueNetId> EIK_NetID = PlayerState->GetUniqueId().GetUniqueNetId();
-									if(EIK_NetID.IsValid())
-									{
-										FString ProductId = EIK_NetID->ToString();
-										if(ProductId.Contains("|"))
-										{
-											TArray<FString> ProductIdArray;
-											ProductId.ParseIntoArray(ProductIdArray, TEXT("|"), true);
-											ProductId = ProductIdArray[1];
-										}
-										EOS_ProductUserId ProductUserId = EOS_ProductUserId_FromString(TCHAR_TO_UTF8(*ProductId));
-										if(ProductUserId == CallbackInfo->ParticipantId)
-										{
-											SpeakerActor = PlayerState->GetPawn();
-										}
-									}
-								}
-							}
-						}								
-					}
-					if(SpeakerActor)
-					{
-						TArray<UEIKVoiceChatSynthComponent*> VoiceChatSynthComponents;
-						SpeakerActor->GetComponents<UEIKVoiceChatSynthComponent>(VoiceChatSynthComponents);
-						if(VoiceChatSynthComponents.Num() > 0)
-						{
-							bool bFoundValidVoiceChatSynthComponent = false;
-							for(auto VoiceChatSynthComponent : VoiceChatSynthComponents)
-							{
-								if (IsValid(VoiceChatSynthComponent))
-								{
-									if(VoiceChatSynthComponent->SupportedRooms.Contains(ChannelName) || VoiceChatSynthComponent->bUseGlobalRoom)
-									{
-										if (VoiceChatSynthComponent->IsActive())
-										{
-											VoiceChatSynthComponent->WriteSamples(Samples);
-											bFoundValidVoiceChatSynthComponent = true;
-										}
-									}
-								}
-							}
-							if (!bFoundValidVoiceChatSynthComponent)
-							{
-								UE_LOG(LogEOSVoiceChat,Warning,TEXT("no valid or active VoiceChatSynthComponent found"));
-							}
-							//if we're here, it means that we passed audio to all valid components, so we need to clear the buffer so that it isn't played by the RTC.
-							FMemory::Memset(Samples.GetData(), 0, Samples.Num() * sizeof(int16));
-						}
-						else
-						{
-							UE_LOG(LogEOSVoiceChat,Warning,TEXT("no VoiceChatSynthComponent found"));
-						}
-					}
-				}
+				FMemory::Memset(Samples.GetData(), 0, Samples.Num() * sizeof(int16));
 			}
 
 			FScopeLock Lock(&BeforeRecvAudioRenderedLock);
+			if (OnVoiceChatBeforeRecvAudioRenderedDelegate.IsBound())
+			{
 #if ENGINE_MAJOR_VERSION == 4
-			OnVoiceChatBeforeRecvAudioRenderedDelegate.Broadcast(Samples, Buffer->SampleRate, Buffer->Channels, bIsSilence);
+				OnVoiceChatBeforeRecvAudioRenderedDelegate.Broadcast(Samples, Buffer->SampleRate, Buffer->Channels, bIsSilence);
 #else
-			//presumably, we still want to call the callback, passing the empty buffer
-			OnVoiceChatBeforeRecvAudioRenderedDelegate.Broadcast(Samples, Buffer->SampleRate, Buffer->Channels, bIsSilence, ChannelName, PlayerName);
+				const FString PlayerName = EIK_LexToString(CallbackInfo->ParticipantId);
+				const FString ChannelName = UTF8_TO_TCHAR(CallbackInfo->RoomName);
+				//presumably, we still want to call the callback, passing the empty buffer
+				OnVoiceChatBeforeRecvAudioRenderedDelegate.Broadcast(Samples, Buffer->SampleRate, Buffer->Channels, bIsSilence, ChannelName, PlayerName);
 #endif
-		}
-		else
-		{
-			UE_LOG(LogEOSVoiceChat,Warning,TEXT("GEngine is not found"));
+			}
 		}
 	}
 }
@@ -21,14 +21,16 @@ class EIKVOICECHAT_API UEIKVoiceChatSynthComponent : public USynthComponent
 	GENERATED_BODY()
 
 
-	//the minimum amount of samples we accumulate before we start streaming, to ensure there is no starvation on the audio thread, if there's too much latency this can be reduced
-	constexpr static int32 MinLatencySamples = 2048;
+	// Audio written by the RTC render callback and consumed by OnGenerateAudio, replaced by Init under SinkCriticalSection
+	TSharedPtr<class FEIKVoiceChatSynthSink, ESPMode::ThreadSafe> Sink;
+	mutable FCriticalSection SinkCriticalSection;
 
-	Audio::TCircularAudioBuffer<float> AudioBuffer;
+	// Copies Sink under SinkCriticalSection, so the caller keeps it alive while Init replaces it
+	TSharedPtr<class FEIKVoiceChatSynthSink, ESPMode::ThreadSafe> GetSink() const;
 
-	bool bIsOutArrayInitialized = false;
-	TArray<float> OutArray;
-	TArrayView<float> OutArrayView;
+	// The PlayerState our route was last resolved from, and whether it had a product user id at the time
+	TWeakObjectPtr<class APlayerState> RoutedPlayerState;
+	bool bHasRoute = false;
 
 
 	// Called when synth is created
@@ -37,36 +39,22 @@ class EIKVOICECHAT_API UEIKVoiceChatSynthComponent : public USynthComponent
 	// Called to generate more audio
 	virtual int32 OnGenerateAudio(float* OutAudio, int32 NumSamples) override;
 
-
-protected:
-
-	friend class FEOSVoiceChatUser;
-
-	// called by EOSVoiceChatUser to fill the buffer, as long as these are samples available these should be consumed via OnGenerateAudio
-	void WriteSamples(TArrayView<int16> Samples)
-	{
-		// Ensure the OutArray has enough space to hold the converted float data
-		if (OutArray.Num() < Samples.Num())
-		{
-			OutArray.SetNum(Samples.Num());  // Resize OutArray to match the size of Samples
-			OutArrayView = TArrayView<float>(OutArray.GetData(), Samples.Num());  // Recreate OutArrayView with the new size
-		}
-#if ENGINE_MAJOR_VERSION >= 5
-		// Convert PCM16 to float and write to OutArrayView
-		Audio::ArrayPcm16ToFloat(Samples, OutArrayView);
-#else
-		// Convert each PCM16 sample to a float in the range [-1.0, 1.0]
-		for (int32 Index = 0; Index < Samples.Num(); ++Index)
-		{
-			OutArrayView[Index] = static_cast<float>(Samples[Index]) / 32768.0f;
-		}
-#endif
-		// Push the float data to the circular buffer
-		AudioBuffer.Push(OutArrayView.GetData(), Samples.Num());
-	}
+	// Re-resolves the route when the owning pawn's PlayerState changes
+	void UpdateRoute(bool bForce);
+	void RemoveRoute();
 
 public:
 
+	UEIKVoiceChatSynthComponent(const FObjectInitializer& ObjectInitializer);
+
+	//~ Begin UActorComponent Interface
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+	virtual void Activate(bool bReset = false) override;
+	virtual void Deactivate() override;
+	//~ End UActorComponent Interface
+
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "EOS Integration Kit|Voice Settings")
 	TArray<FString> SupportedRooms;
 
@@ -74,4 +62,16 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "EOS Integration Kit|Voice Settings")
 	bool bUseGlobalRoom = false;
 
+	// The amount of audio we accumulate before we start streaming, to ensure there is no starvation on the audio thread, if there's too much latency this can be reduced
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "EOS Integration Kit|Voice Settings", meta = (ClampMin = "10.0", ClampMax = "500.0"))
+	float TargetLatencyMs = 40.f;
+
+	// Number of times playback ran out of voice data and had to be concealed
+	UFUNCTION(BlueprintPure, Category = "EOS Integration Kit|Voice Settings")
+	int32 GetNumUnderruns() const;
+
+	// Number of times voice data was dropped because playback fell too far behind
+	UFUNCTION(BlueprintPure, Category = "EOS Integration Kit|Voice Settings")
+	int32 GetNumOverruns() const;
+
 };
\ No newline at end of file
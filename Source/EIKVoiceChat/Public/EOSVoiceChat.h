@@ -6,6 +6,7 @@
 
 #if WITH_EOS_RTC
 
+#include "Containers/Ticker.h"
 #include "Misc/CoreMisc.h"
 #include "VoiceChat.h"
 #include "Runtime/Launch/Resources/Version.h"
@@ -215,6 +216,16 @@ protected:
 
 	void BindInitCallbacks();
 	void UnbindInitCallbacks();
+	// Finishes an Uninitialize, either once disconnected or when the disconnect timed out
+	void CompleteUninitialize();
+	void ClearUninitializeTimeout();
+	// How long an Uninitialize waits for the SDK before giving up, read from the EIK settings on Initialize
+	float UninitializeTimeoutSeconds = 2.0f;
+#if ENGINE_MAJOR_VERSION == 5
+	FTSTicker::FDelegateHandle UninitializeTimeoutHandle;
+#else
+	FDelegateHandle UninitializeTimeoutHandle;
+#endif
 	static void EOS_CALL OnAudioDevicesChangedStatic(const EOS_RTCAudio_AudioDevicesChangedCallbackInfo* CallbackInfo);
 	void OnAudioDevicesChanged();
 
@@ -248,6 +259,8 @@ protected:
 
 	IEOSSDKManager& SDKManager;
 	IEIKPlatformHandlePtr EosPlatformHandle = nullptr;
+	// True when EosPlatformHandle is the online subsystem's platform rather than one we created
+	bool bUsingSharedPlatform = false;
 	virtual IEIKPlatformHandlePtr EOSPlatformCreate(EOS_Platform_Options& PlatformOptions);
 
 	static int64 StaticInstanceIdCount;
@@ -11,6 +11,10 @@
 #include "eos_rtc_types.h"
 #include "eos_rtc_audio_types.h"
 #include "eos_types.h"
+#include "EOSSharedTypes.h"
+#include <atomic>
+
+class FEIKVoiceActivityDetector;
 
 class EIKVOICECHAT_API FEOSVoiceChatUser : public TSharedFromThis<FEOSVoiceChatUser, ESPMode::ThreadSafe>, public IVoiceChatUser
 {
@@ -221,6 +225,11 @@ protected:
 		EOS_NotificationId OnAudioInputStateNotificationId = EOS_INVALID_NOTIFICATIONID;
 
 		TUniquePtr<class FCallbackBase> AudioBeforeSendCallback;
+		// Voice activity detection state for audio captured into this channel, only touched by the capture callback
+		TSharedPtr<FEIKVoiceActivityDetector, ESPMode::ThreadSafe> VoiceActivityDetector;
+
+		// Keeps the adaptive SDK ticker at full rate while the channel exists
+		FEIKSDKActivityHold ActivityHold;
 	};
 
 	enum class ELoginState
@@ -334,6 +343,8 @@ protected:
 
 	bool bFakeAudioInput = true;
 	bool bInDestructor = false;
+	// Number of bound capture audio delegates, so the capture path only takes BeforeCaptureAudioSentLock when someone listens
+	std::atomic<int32> NumCaptureAudioDelegates { 0 };
 
 	// Helper methods
 	bool IsInitialized();
@@ -358,6 +369,8 @@ protected:
 #if ENGINE_MAJOR_VERSION != 5
 	static void OnChannelAudioBeforeSendStatic(const EOS_RTCAudio_AudioBeforeSendCallbackInfo* Data);
 	FEOSVoiceChatUserWeakPtr CreateWeakThis();
+	// The static capture callback can't tell channels apart, so all of them share one detector
+	TSharedPtr<FEIKVoiceActivityDetector, ESPMode::ThreadSafe> CaptureVoiceActivityDetector;
 #endif
 	void BindChannelCallbacks(FChannelSession& ChannelSession);
 	void UnbindChannelCallbacks(FChannelSession& ChannelSession);
@@ -393,7 +406,7 @@ protected:
 	void OnChannelParticipantStatusChanged(const EOS_RTC_ParticipantStatusChangedCallbackInfo* CallbackInfo);
 	static void EOS_CALL OnChannelParticipantAudioUpdatedStatic(const EOS_RTCAudio_ParticipantUpdatedCallbackInfo* CallbackInfo);
 	void OnChannelParticipantAudioUpdated(const EOS_RTCAudio_ParticipantUpdatedCallbackInfo* CallbackInfo);
-	void OnChannelAudioBeforeSend(const EOS_RTCAudio_AudioBeforeSendCallbackInfo* CallbackInfo);
+	void OnChannelAudioBeforeSend(const EOS_RTCAudio_AudioBeforeSendCallbackInfo* CallbackInfo, FEIKVoiceActivityDetector* VoiceActivityDetector);
 	static void EOS_CALL OnChannelAudioBeforeRenderStatic(const EOS_RTCAudio_AudioBeforeRenderCallbackInfo* CallbackInfo);
 	void OnChannelAudioBeforeRender(const EOS_RTCAudio_AudioBeforeRenderCallbackInfo* CallbackInfo);
 	static void EOS_CALL OnChannelAudioInputStateStatic(const EOS_RTCAudio_AudioInputStateCallbackInfo* CallbackInfo);
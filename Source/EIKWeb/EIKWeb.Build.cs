@@ -21,6 +21,7 @@ public class EIKWeb : ModuleRules
             {
                 "CoreUObject",
                 "Engine",
+                "EOSIntegrationKit",
                 "Slate",
                 "SlateCore"
             }
@@ -28,6 +28,5 @@ void UEIK_API_QueryAntiCheatServiceStatus::Activate()
 	{
 		HttpRequest->SetHeader(TEXT("Authorization"), FString::Printf(TEXT("Bearer %s"), *Var_Authorization));
 	}
-	HttpRequest->OnProcessRequestComplete().BindUObject(this, &UEIK_API_QueryAntiCheatServiceStatus::OnResponseReceived);
-	HttpRequest->ProcessRequest();
+	ProcessRequest(HttpRequest);
 }
@@ -17,37 +17,37 @@ UEIK_API_QueryExternalAccounts* UEIK_API_QueryExternalAccounts::QueryExternalAcc
 void UEIK_API_QueryExternalAccounts::Activate()
 {
 	Super::Activate();
-	FString URL = FString::Printf(TEXT("%s/user/v1/accounts"), *APIEndpoint);
-	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FHttpModule::Get().CreateRequest();
-	HttpRequest->SetVerb(TEXT("GET"));
-	HttpRequest->SetURL(URL);
-	HttpRequest->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
-	if (Var_Authorization.Contains("Bearer"))
+	const FString URL = FString::Printf(TEXT("%s/user/v1/accounts"), *APIEndpoint);
+	FString FilterString;
+	if (!Var_IdentityProviderId.IsEmpty())
 	{
-		HttpRequest->SetHeader(TEXT("Authorization"), Var_Authorization);
+		FilterString += FString::Printf(TEXT("&identityProviderId=%s"), *Var_IdentityProviderId);
 	}
-	else
+	if (!Var_Environment.IsEmpty())
 	{
-		HttpRequest->SetHeader(TEXT("Authorization"), FString::Printf(TEXT("Bearer %s"), *Var_Authorization));
+		FilterString += FString::Printf(TEXT("&environment=%s"), *Var_Environment);
 	}
-	FString QueryString = TEXT("?");
-	if (Var_AccountId.Num() > 0)
+
+	// Long lists of accounts are split across several requests so each URL stays under the server's length limit
+	TArray<TSharedRef<IHttpRequest, ESPMode::ThreadSafe>> HttpRequests;
+	for (const FString& AccountIdString : FEIKWebClient::Get().SplitQueryParameters(TEXT("accountId"), Var_AccountId, URL.Len() + FilterString.Len() + 1))
 	{
-		for (auto AccountId : Var_AccountId)
+		FString QueryString = AccountIdString + FilterString;
+		QueryString.RemoveFromStart(TEXT("&"));
+		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FHttpModule::Get().CreateRequest();
+		HttpRequest->SetVerb(TEXT("GET"));
+		HttpRequest->SetURL(QueryString.IsEmpty() ? URL : FString::Printf(TEXT("%s?%s"), *URL, *QueryString));
+		HttpRequest->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
+		if (Var_Authorization.Contains("Bearer"))
 		{
-			QueryString += FString::Printf(TEXT("accountId=%s&"), *AccountId);
+			HttpRequest->SetHeader(TEXT("Authorization"), Var_Authorization);
 		}
+		else
+		{
+			HttpRequest->SetHeader(TEXT("Authorization"), FString::Printf(TEXT("Bearer %s"), *Var_Authorization));
+		}
+		HttpRequests.Add(HttpRequest);
 	}
-	if (!Var_IdentityProviderId.IsEmpty())
-	{
-		QueryString += FString::Printf(TEXT("identityProviderId=%s&"), *Var_IdentityProviderId);
-	}
-	if (!Var_Environment.IsEmpty())
-	{
-		QueryString += FString::Printf(TEXT("environment=%s"), *Var_Environment);
-	}
-	URL += QueryString;
-	HttpRequest->OnProcessRequestComplete().BindUObject(this, &UEIK_API_QueryExternalAccounts::OnResponseReceived);
-	HttpRequest->ProcessRequest();
+	ProcessRequests(HttpRequests);
 }
 
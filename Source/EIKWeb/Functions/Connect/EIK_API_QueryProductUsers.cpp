@@ -15,28 +15,25 @@ UEIK_API_QueryProductUsers* UEIK_API_QueryProductUsers::QueryProductUsers(FStrin
 void UEIK_API_QueryProductUsers::Activate()
 {
 	Super::Activate();
-	FString URL = FString::Printf(TEXT("%s/user/v1/product-users"), *APIEndpoint);
-	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FHttpModule::Get().CreateRequest();
-	HttpRequest->SetVerb(TEXT("GET"));
-	HttpRequest->SetURL(URL);
-	HttpRequest->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
-	if (Var_Authorization.Contains("Bearer"))
-	{
-		HttpRequest->SetHeader(TEXT("Authorization"), Var_Authorization);
-	}
-	else
-	{
-		HttpRequest->SetHeader(TEXT("Authorization"), FString::Printf(TEXT("Bearer %s"), *Var_Authorization));
-	}
-	FString QueryString = TEXT("?");
-	if (Var_ProductUserIds.Num() > 0)
+	const FString URL = FString::Printf(TEXT("%s/user/v1/product-users"), *APIEndpoint);
+
+	// Long lists of users are split across several requests so each URL stays under the server's length limit
+	TArray<TSharedRef<IHttpRequest, ESPMode::ThreadSafe>> HttpRequests;
+	for (const FString& QueryString : FEIKWebClient::Get().SplitQueryParameters(TEXT("productUserId"), Var_ProductUserIds, URL.Len() + 1))
 	{
-		for (auto ProductUserId : Var_ProductUserIds)
+		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FHttpModule::Get().CreateRequest();
+		HttpRequest->SetVerb(TEXT("GET"));
+		HttpRequest->SetURL(QueryString.IsEmpty() ? URL : FString::Printf(TEXT("%s?%s"), *URL, *QueryString));
+		HttpRequest->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
+		if (Var_Authorization.Contains("Bearer"))
+		{
+			HttpRequest->SetHeader(TEXT("Authorization"), Var_Authorization);
+		}
+		else
 		{
-			QueryString += FString::Printf(TEXT("productUserId=%s&"), *ProductUserId);
+			HttpRequest->SetHeader(TEXT("Authorization"), FString::Printf(TEXT("Bearer %s"), *Var_Authorization));
 		}
+		HttpRequests.Add(HttpRequest);
 	}
-	URL += QueryString;
-	HttpRequest->OnProcessRequestComplete().BindUObject(this, &UEIK_API_QueryProductUsers::OnResponseReceived);
-	HttpRequest->ProcessRequest();
+	ProcessRequests(HttpRequests);
 }	
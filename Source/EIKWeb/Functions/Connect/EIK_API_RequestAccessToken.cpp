@@ -43,6 +43,5 @@ void UEIK_API_RequestAccessToken::Activate()
 		RequestBody += FString::Printf(TEXT("&external_auth_token=%s&external_auth_type=%s"), *Var_ExternalAuthToken, *Var_ExternalAuthType);
 	}
 	HttpRequest->SetContentAsString(RequestBody);
-	HttpRequest->OnProcessRequestComplete().BindUObject(this, &UEIK_API_RequestAccessToken::OnResponseReceived);
-	HttpRequest->ProcessRequest();
+	ProcessRequest(HttpRequest);
 }
@@ -43,6 +43,5 @@ void UEIK_API_DirectEntitlementEnumeration::Activate()
 	{
 		HttpRequest->SetHeader(TEXT("Authorization"), FString::Printf(TEXT("Bearer %s"), *Var_Authorization));
 	}
-	HttpRequest->OnProcessRequestComplete().BindUObject(this, &UEIK_API_DirectEntitlementEnumeration::OnResponseReceived);
-	HttpRequest->ProcessRequest();
+	ProcessRequest(HttpRequest);
 }
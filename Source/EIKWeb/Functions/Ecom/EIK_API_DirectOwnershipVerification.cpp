@@ -43,8 +43,7 @@ void UEIK_API_DirectOwnershipVerification::Activate()
 	{
 		HttpRequest->SetHeader(TEXT("Authorization"), FString::Printf(TEXT("Bearer %s"), *Var_Authorization));
 	}
-	HttpRequest->OnProcessRequestComplete().BindUObject(this, &UEIK_API_DirectOwnershipVerification::OnResponseReceived);
-	HttpRequest->ProcessRequest();
+	ProcessRequest(HttpRequest);
 	
 	
 	
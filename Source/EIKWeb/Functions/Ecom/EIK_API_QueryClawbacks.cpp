@@ -30,6 +30,5 @@ void UEIK_API_QueryClawbacks::Activate()
 	{
 		HttpRequest->SetHeader(TEXT("Authorization"), FString::Printf(TEXT("Bearer %s"), *Var_Authorization));
 	}
-	HttpRequest->OnProcessRequestComplete().BindUObject(this, &UEIK_API_QueryClawbacks::OnResponseReceived);
-	HttpRequest->ProcessRequest();
+	ProcessRequest(HttpRequest);
 }
@@ -50,6 +50,5 @@ void UEIK_API_RedeemEntitlements::Activate()
 	TSharedRef<TJsonWriter<TCHAR>> JsonWriter = TJsonWriterFactory<>::Create(&RequestBodyString);
 	FJsonSerializer::Serialize(RequestBodyJson.ToSharedRef(), JsonWriter);
 	HttpRequest->SetContentAsString(RequestBodyString);
-	HttpRequest->OnProcessRequestComplete().BindUObject(this, &UEIK_API_RedeemEntitlements::OnResponseReceived);
-	HttpRequest->ProcessRequest();
+	ProcessRequest(HttpRequest);
 }
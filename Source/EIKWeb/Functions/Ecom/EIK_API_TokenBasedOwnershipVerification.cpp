@@ -35,7 +35,6 @@ void UEIK_API_TokenBasedOwnershipVerification::Activate()
 		PostParameters.Append(FString::Printf(TEXT("%s=%s&"), *Elem.Key, *Elem.Value));
 	}
 	HttpRequest->SetContentAsString(PostParameters);
-	HttpRequest->OnProcessRequestComplete().BindUObject(this, &UEIK_API_TokenBasedOwnershipVerification::OnResponseReceived);
-	HttpRequest->ProcessRequest();
+	ProcessRequest(HttpRequest);
 }
 	
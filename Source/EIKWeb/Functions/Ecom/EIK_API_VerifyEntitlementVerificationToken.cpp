@@ -19,6 +19,5 @@ void UEIK_API_VerifyEntitlementVerificationToken::Activate()
 	HttpRequest->SetVerb(TEXT("GET"));
 	HttpRequest->SetURL(URL);
 	HttpRequest->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
-	HttpRequest->OnProcessRequestComplete().BindUObject(this, &UEIK_API_VerifyEntitlementVerificationToken::OnResponseReceived);
-	HttpRequest->ProcessRequest();
+	ProcessRequest(HttpRequest);
 }
@@ -19,6 +19,5 @@ void UEIK_API_VerifyOwnershipVerificationToken::Activate()
 	HttpRequest->SetVerb(TEXT("GET"));
 	HttpRequest->SetURL(URL);
 	HttpRequest->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
-	HttpRequest->OnProcessRequestComplete().BindUObject(this, &UEIK_API_VerifyOwnershipVerificationToken::OnResponseReceived);
-	HttpRequest->ProcessRequest();
+	ProcessRequest(HttpRequest);
 }
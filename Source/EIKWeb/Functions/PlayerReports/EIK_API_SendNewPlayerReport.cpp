@@ -42,7 +42,6 @@ void UEIK_API_SendNewPlayerReport::Activate()
 	TSharedRef<TJsonWriter<TCHAR>> JsonWriter = TJsonWriterFactory<>::Create(&RequestBodyString);
 	FJsonSerializer::Serialize(RequestBodyJson.ToSharedRef(), JsonWriter);
 	HttpRequest->SetContentAsString(RequestBodyString);
-	HttpRequest->OnProcessRequestComplete().BindUObject(this, &UEIK_API_SendNewPlayerReport::OnResponseReceived);
-	HttpRequest->ProcessRequest();
+	ProcessRequest(HttpRequest);
 	
 }
@@ -51,6 +51,5 @@ void UEIK_API_ApprovePendingSanctions::Activate()
 	TSharedRef<TJsonWriter<TCHAR>> JsonWriter = TJsonWriterFactory<>::Create(&RequestBodyString);
 	FJsonSerializer::Serialize(RequestBodyJson.ToSharedRef(), JsonWriter);
 	HttpRequest->SetContentAsString(RequestBodyString);
-	HttpRequest->OnProcessRequestComplete().BindUObject(this, &UEIK_API_ApprovePendingSanctions::OnResponseReceived);
-	HttpRequest->ProcessRequest();
+	ProcessRequest(HttpRequest);
 }
\ No newline at end of file
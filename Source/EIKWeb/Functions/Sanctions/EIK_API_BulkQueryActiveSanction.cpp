@@ -17,44 +17,31 @@ UEIK_API_BulkQueryActiveSanction* UEIK_API_BulkQueryActiveSanction::BulkQueryAct
 void UEIK_API_BulkQueryActiveSanction::Activate()
 {
 	Super::Activate();
-	FString URL = FString::Printf(TEXT("%s/sanctions/v1/%s/active-sanctions"), *APIEndpoint, *Var_DeploymentId);
-	if (Var_ProductUserId.Num() > 0)
+	const FString URL = FString::Printf(TEXT("%s/sanctions/v1/%s/active-sanctions"), *APIEndpoint, *Var_DeploymentId);
+	FString ActionString;
+	for (const FString& Action : Var_Action)
 	{
-		FString ProductUserIdString = TEXT("productUserId=");
-		for (int i = 0; i < Var_ProductUserId.Num(); i++)
-		{
-			ProductUserIdString += Var_ProductUserId[i];
-			if (i < Var_ProductUserId.Num() - 1)
-			{
-				ProductUserIdString += TEXT("&productUserId=");
-			}
-		}
-		URL += FString::Printf(TEXT("?%s"), *ProductUserIdString);
+		ActionString += FString::Printf(TEXT("&action=%s"), *Action);
 	}
-	if (Var_Action.Num() > 0)
+
+	// Long lists of users are split across several requests so each URL stays under the server's length limit
+	TArray<TSharedRef<IHttpRequest, ESPMode::ThreadSafe>> HttpRequests;
+	for (const FString& ProductUserIdString : FEIKWebClient::Get().SplitQueryParameters(TEXT("productUserId"), Var_ProductUserId, URL.Len() + ActionString.Len() + 1))
 	{
-		FString ActionString = TEXT("action=");
-		for (int i = 0; i < Var_Action.Num(); i++)
+		FString QueryString = ProductUserIdString + ActionString;
+		QueryString.RemoveFromStart(TEXT("&"));
+		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FHttpModule::Get().CreateRequest();
+		HttpRequest->SetVerb(TEXT("GET"));
+		HttpRequest->SetURL(QueryString.IsEmpty() ? URL : FString::Printf(TEXT("%s?%s"), *URL, *QueryString));
+		if (Var_Authorization.Contains("Bearer"))
 		{
-			ActionString += Var_Action[i];
-			if (i < Var_Action.Num() - 1)
-			{
-				ActionString += TEXT("&action=");
-			}
+			HttpRequest->SetHeader(TEXT("Authorization"), Var_Authorization);
 		}
-		URL += FString::Printf(TEXT("&%s"), *ActionString);
-	}
-	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FHttpModule::Get().CreateRequest();
-	HttpRequest->SetVerb(TEXT("GET"));
-	HttpRequest->SetURL(URL);
-	if (Var_Authorization.Contains("Bearer"))
-	{
-		HttpRequest->SetHeader(TEXT("Authorization"), Var_Authorization);
-	}
-	else
-	{
-		HttpRequest->SetHeader(TEXT("Authorization"), FString::Printf(TEXT("Bearer %s"), *Var_Authorization));
+		else
+		{
+			HttpRequest->SetHeader(TEXT("Authorization"), FString::Printf(TEXT("Bearer %s"), *Var_Authorization));
+		}
+		HttpRequests.Add(HttpRequest);
 	}
-	HttpRequest->OnProcessRequestComplete().BindUObject(this, &UEIK_API_BulkQueryActiveSanction::OnResponseReceived);
-	HttpRequest->ProcessRequest();
+	ProcessRequests(HttpRequests);
 }
@@ -44,6 +44,5 @@ void UEIK_API_CreateSanctionAppealForLocalUser::Activate()
 	TSharedRef<TJsonWriter<TCHAR>> JsonWriter = TJsonWriterFactory<>::Create(&RequestBodyString);
 	FJsonSerializer::Serialize(RequestBodyJson.ToSharedRef(), JsonWriter);
 	HttpRequest->SetContentAsString(RequestBodyString);
-	HttpRequest->OnProcessRequestComplete().BindUObject(this, &UEIK_API_CreateSanctionAppealForLocalUser::OnResponseReceived);
-	HttpRequest->ProcessRequest();
+	ProcessRequest(HttpRequest);
 }
\ No newline at end of file
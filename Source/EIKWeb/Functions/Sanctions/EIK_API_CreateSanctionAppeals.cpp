@@ -43,6 +43,5 @@ void UEIK_API_CreateSanctionAppeals::Activate()
 	TSharedRef<TJsonWriter<TCHAR>> JsonWriter = TJsonWriterFactory<>::Create(&RequestBodyString);
 	FJsonSerializer::Serialize(RequestBodyJson.ToSharedRef(), JsonWriter);
 	HttpRequest->SetContentAsString(RequestBodyString);
-	HttpRequest->OnProcessRequestComplete().BindUObject(this, &UEIK_API_CreateSanctionAppeals::OnResponseReceived);
-	HttpRequest->ProcessRequest();
+	ProcessRequest(HttpRequest);
 }
\ No newline at end of file
@@ -29,6 +29,5 @@ void UEIK_API_QueryAllSanctions::Activate()
 	{
 		HttpRequest->SetHeader(TEXT("Authorization"), FString::Printf(TEXT("Bearer %s"), *Var_Authorization));
 	}
-	HttpRequest->OnProcessRequestComplete().BindUObject(this, &UEIK_API_QueryAllSanctions::OnResponseReceived);
-	HttpRequest->ProcessRequest();	
+	ProcessRequest(HttpRequest);	
 }
@@ -1,7 +1,10 @@
 ﻿#include "EIKWeb.h"
+#include "EIKWebClient.h"
 
 #define LOCTEXT_NAMESPACE "FEIKWebModule"
 
+DEFINE_LOG_CATEGORY(LogEIKWeb);
+
 void FEIKWebModule::StartupModule()
 {
     
@@ -9,7 +12,7 @@ void FEIKWebModule::StartupModule()
 
 void FEIKWebModule::ShutdownModule()
 {
-    
+    FEIKWebClient::Get().Shutdown();
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -0,0 +1,374 @@
+﻿// Copyright (c) 2024 Betide Studio. All Rights Reserved.
+
+#include "EIKWebClient.h"
+#include "EIKWeb.h"
+#include "EIKSettings.h"
+#include "HttpModule.h"
+#include "Containers/Ticker.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Runtime/Launch/Resources/Version.h"
+
+FEIKWebClient& FEIKWebClient::Get()
+{
+	static FEIKWebClient Client;
+	return Client;
+}
+
+FEIKWebClient::FEIKWebClient()
+	: BaseUrl(TEXT("https://api.epicgames.dev"))
+{
+	const FEOSSettings Settings = UEIKSettings::GetSettings();
+	if (!Settings.WebApiBaseUrl.IsEmpty())
+	{
+		BaseUrl = Settings.WebApiBaseUrl;
+	}
+	MaxConcurrentRequests = Settings.WebApiMaxConcurrentRequests;
+	MaxRetries = Settings.WebApiMaxRetries;
+	RetryBaseDelaySeconds = Settings.WebApiRetryBaseDelaySeconds;
+	RetryMaxDelaySeconds = Settings.WebApiRetryMaxDelaySeconds;
+	CacheSeconds = Settings.WebApiCacheSeconds;
+	MaxCachedResponses = Settings.WebApiMaxCachedResponses;
+	MaxUrlLength = Settings.WebApiMaxUrlLength;
+	FParse::Value(FCommandLine::Get(), TEXT("EIKWebApiBaseUrl="), BaseUrl);
+	BaseUrl.RemoveFromEnd(TEXT("/"));
+	MaxConcurrentRequests = FMath::Max(MaxConcurrentRequests, 1);
+}
+
+void FEIKWebClient::Shutdown()
+{
+	for (const auto& PendingTicker : PendingTickers)
+	{
+#if ENGINE_MAJOR_VERSION == 5
+		FTSTicker::GetCoreTicker().RemoveTicker(PendingTicker.Value);
+#else
+		FTicker::GetCoreTicker().RemoveTicker(PendingTicker.Value);
+#endif
+	}
+	PendingTickers.Empty();
+
+	QueuedRequests.Empty();
+	PendingRequestsByKey.Empty();
+	CachedResponses.Empty();
+}
+
+void FEIKWebClient::ClearCache()
+{
+	CachedResponses.Empty();
+}
+
+void FEIKWebClient::ExecuteAfter(float Delay, TFunction<void()>&& Callback)
+{
+	const uint32 TickerId = ++LastTickerId;
+	auto TickerCallback = [this, TickerId, Callback = MoveTemp(Callback)](float)
+	{
+		PendingTickers.Remove(TickerId);
+		Callback();
+		return false;
+	};
+#if ENGINE_MAJOR_VERSION == 5
+	PendingTickers.Add(TickerId, FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda(MoveTemp(TickerCallback)), Delay));
+#else
+	PendingTickers.Add(TickerId, FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda(MoveTemp(TickerCallback)), Delay));
+#endif
+}
+
+void FEIKWebClient::ProcessRequest(const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& Request, const FEIKWebResponseDelegate& OnComplete)
+{
+	const FString Verb = Request->GetVerb();
+	const bool bIsGet = Verb.IsEmpty() || Verb.Equals(TEXT("GET"), ESearchCase::IgnoreCase);
+
+	FString CacheKey;
+	if (bIsGet)
+	{
+		// The authorization is part of the key, so responses are never shared between callers with different rights
+		CacheKey = Request->GetURL() + TEXT("|") + Request->GetHeader(TEXT("Authorization"));
+
+		if (const FCachedResponse* CachedResponse = CachedResponses.Find(CacheKey))
+		{
+			if (FPlatformTime::Seconds() < CachedResponse->ExpiryTime)
+			{
+				FEIKWebResponse Response;
+				Response.bWasSuccessful = true;
+				Response.StatusCode = CachedResponse->StatusCode;
+				Response.Content = CachedResponse->Content;
+				Response.bFromCache = true;
+				ExecuteAfter(0.0f, [OnComplete, Response]()
+				{
+					OnComplete.ExecuteIfBound(Response);
+				});
+				return;
+			}
+			if (!CachedResponse->ETag.IsEmpty())
+			{
+				Request->SetHeader(TEXT("If-None-Match"), CachedResponse->ETag);
+			}
+		}
+
+		if (TSharedRef<FPendingRequest>* PendingRequest = PendingRequestsByKey.Find(CacheKey))
+		{
+			(*PendingRequest)->Delegates.Add(OnComplete);
+			return;
+		}
+	}
+
+	TSharedRef<FPendingRequest> PendingRequest = MakeShared<FPendingRequest>(Request);
+	PendingRequest->CacheKey = CacheKey;
+	PendingRequest->Delegates.Add(OnComplete);
+	if (!CacheKey.IsEmpty())
+	{
+		PendingRequestsByKey.Add(CacheKey, PendingRequest);
+	}
+
+	QueuedRequests.Add(PendingRequest);
+	PumpQueue();
+}
+
+void FEIKWebClient::PumpQueue()
+{
+	while (NumRequestsInFlight < MaxConcurrentRequests && QueuedRequests.Num() > 0)
+	{
+		TSharedRef<FPendingRequest> PendingRequest = QueuedRequests[0];
+		QueuedRequests.RemoveAt(0);
+		SendRequest(PendingRequest);
+	}
+}
+
+void FEIKWebClient::SendRequest(const TSharedRef<FPendingRequest>& PendingRequest)
+{
+	NumRequestsInFlight++;
+
+	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = PendingRequest->Request;
+	Request->SetHeader(TEXT("Connection"), TEXT("keep-alive"));
+	Request->OnProcessRequestComplete().BindRaw(this, &FEIKWebClient::OnRequestComplete, PendingRequest);
+	if (!Request->ProcessRequest())
+	{
+		Request->OnProcessRequestComplete().Unbind();
+		ExecuteAfter(0.0f, [this, PendingRequest]()
+		{
+			OnRequestComplete(PendingRequest->Request, nullptr, false, PendingRequest);
+		});
+	}
+}
+
+void FEIKWebClient::OnRequestComplete(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful, TSharedRef<FPendingRequest> PendingRequest)
+{
+	NumRequestsInFlight--;
+
+	const int32 StatusCode = Response.IsValid() ? Response->GetResponseCode() : -1;
+
+	// A request that may have reached the server is only sent again when doing so twice has the same effect,
+	// e.g. a retried POST could create a second sanction or redeem an entitlement twice. A 429 was never processed.
+	const FString Verb = PendingRequest->Request->GetVerb();
+	const bool bIsIdempotent = Verb.IsEmpty() || Verb.Equals(TEXT("GET"), ESearchCase::IgnoreCase) || Verb.Equals(TEXT("HEAD"), ESearchCase::IgnoreCase)
+		|| Verb.Equals(TEXT("PUT"), ESearchCase::IgnoreCase) || Verb.Equals(TEXT("DELETE"), ESearchCase::IgnoreCase) || Verb.Equals(TEXT("OPTIONS"), ESearchCase::IgnoreCase);
+	const bool bShouldRetry = StatusCode == 429 || (bIsIdempotent && (!bWasSuccessful || !Response.IsValid() || StatusCode >= 500));
+	if (bShouldRetry && PendingRequest->NumRetries < MaxRetries)
+	{
+		// Honour Retry-After when the server asks for a specific delay, otherwise back off exponentially with jitter
+		float Delay = FMath::Min(RetryBaseDelaySeconds * FMath::Pow(2.0f, (float)PendingRequest->NumRetries), RetryMaxDelaySeconds);
+		Delay *= FMath::FRandRange(0.5f, 1.5f);
+		if (Response.IsValid())
+		{
+			const FString RetryAfter = Response->GetHeader(TEXT("Retry-After"));
+			if (!RetryAfter.IsEmpty() && RetryAfter.IsNumeric())
+			{
+				Delay = FMath::Min(FCString::Atof(*RetryAfter), RetryMaxDelaySeconds);
+			}
+		}
+		PendingRequest->NumRetries++;
+
+		UE_LOG(LogEIKWeb, Verbose, TEXT("%s returned %d, retrying in %.2fs (%d/%d)"), *PendingRequest->Request->GetURL(), StatusCode, Delay, PendingRequest->NumRetries, MaxRetries);
+
+		// Only revalidate against a cached response that is still there when the retry goes out
+		ResetRequest(*PendingRequest, !PendingRequest->bIsUnconditional && CachedResponses.Contains(PendingRequest->CacheKey));
+
+		ExecuteAfter(Delay, [this, PendingRequest]()
+		{
+			QueuedRequests.Add(PendingRequest);
+			PumpQueue();
+		});
+		PumpQueue();
+		return;
+	}
+
+	FEIKWebResponse Result;
+	Result.bWasSuccessful = bWasSuccessful && Response.IsValid();
+	Result.StatusCode = StatusCode;
+	if (Result.bWasSuccessful)
+	{
+		Result.Content = Response->GetContentAsString();
+	}
+
+	if (!PendingRequest->CacheKey.IsEmpty() && Result.bWasSuccessful)
+	{
+		const double ExpiryTime = FPlatformTime::Seconds() + CacheSeconds;
+		if (StatusCode == 304)
+		{
+			if (FCachedResponse* CachedResponse = CachedResponses.Find(PendingRequest->CacheKey))
+			{
+				CachedResponse->ExpiryTime = ExpiryTime;
+				Result.StatusCode = CachedResponse->StatusCode;
+				Result.Content = CachedResponse->Content;
+				Result.bFromCache = true;
+			}
+			else if (!PendingRequest->bIsUnconditional)
+			{
+				// The response it revalidated was evicted in the meantime, so ask for the full content instead
+				UE_LOG(LogEIKWeb, Verbose, TEXT("%s returned 304 for an evicted response, reissuing it unconditionally"), *PendingRequest->Request->GetURL());
+				PendingRequest->bIsUnconditional = true;
+				ResetRequest(*PendingRequest, false);
+				QueuedRequests.Insert(PendingRequest, 0);
+				PumpQueue();
+				return;
+			}
+		}
+		else if (StatusCode == 200)
+		{
+			const FString ETag = Response->GetHeader(TEXT("ETag"));
+			if (!ETag.IsEmpty() || CacheSeconds > 0.0)
+			{
+				if (CachedResponses.Num() >= MaxCachedResponses && !CachedResponses.Contains(PendingRequest->CacheKey))
+				{
+					// Evict whatever expires first
+					FString OldestKey;
+					double OldestExpiryTime = MAX_dbl;
+					for (const TPair<FString, FCachedResponse>& CachedResponse : CachedResponses)
+					{
+						if (CachedResponse.Value.ExpiryTime < OldestExpiryTime)
+						{
+							OldestKey = CachedResponse.Key;
+							OldestExpiryTime = CachedResponse.Value.ExpiryTime;
+						}
+					}
+					CachedResponses.Remove(OldestKey);
+				}
+
+				FCachedResponse& CachedResponse = CachedResponses.FindOrAdd(PendingRequest->CacheKey);
+				CachedResponse.ETag = ETag;
+				CachedResponse.StatusCode = StatusCode;
+				CachedResponse.Content = Result.Content;
+				CachedResponse.ExpiryTime = ExpiryTime;
+			}
+		}
+	}
+
+	CompleteRequest(PendingRequest, Result);
+	PumpQueue();
+}
+
+void FEIKWebClient::ResetRequest(FPendingRequest& PendingRequest, bool bKeepIfNoneMatch)
+{
+	// A completed request can't be sent again, so it goes out as a copy
+	const TSharedRef<IHttpRequest, ESPMode::ThreadSafe> OldRequest = PendingRequest.Request;
+	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> NewRequest = FHttpModule::Get().CreateRequest();
+	NewRequest->SetVerb(OldRequest->GetVerb());
+	NewRequest->SetURL(OldRequest->GetURL());
+	for (const FString& Header : OldRequest->GetAllHeaders())
+	{
+		FString HeaderName;
+		FString HeaderValue;
+		if (Header.Split(TEXT(":"), &HeaderName, &HeaderValue))
+		{
+			HeaderName.TrimStartAndEndInline();
+			if (bKeepIfNoneMatch || !HeaderName.Equals(TEXT("If-None-Match"), ESearchCase::IgnoreCase))
+			{
+				NewRequest->SetHeader(HeaderName, HeaderValue.TrimStartAndEnd());
+			}
+		}
+	}
+	if (OldRequest->GetContentLength() > 0)
+	{
+		NewRequest->SetContent(OldRequest->GetContent());
+	}
+	PendingRequest.Request = NewRequest;
+}
+
+void FEIKWebClient::CompleteRequest(const TSharedRef<FPendingRequest>& PendingRequest, const FEIKWebResponse& Response)
+{
+	if (!PendingRequest->CacheKey.IsEmpty())
+	{
+		PendingRequestsByKey.Remove(PendingRequest->CacheKey);
+	}
+	for (const FEIKWebResponseDelegate& Delegate : PendingRequest->Delegates)
+	{
+		Delegate.ExecuteIfBound(Response);
+	}
+}
+
+TArray<FString> FEIKWebClient::SplitQueryParameters(const FString& Name, const TArray<FString>& Values, int32 UrlLength) const
+{
+	TArray<FString> QueryStrings;
+	FString QueryString;
+	for (const FString& Value : Values)
+	{
+		const FString Parameter = Name + TEXT("=") + Value;
+		if (!QueryString.IsEmpty() && UrlLength + QueryString.Len() + Parameter.Len() + 1 > MaxUrlLength)
+		{
+			QueryStrings.Add(MoveTemp(QueryString));
+			QueryString.Reset();
+		}
+		if (!QueryString.IsEmpty())
+		{
+			QueryString += TEXT("&");
+		}
+		QueryString += Parameter;
+	}
+	if (!QueryString.IsEmpty() || QueryStrings.Num() == 0)
+	{
+		QueryStrings.Add(MoveTemp(QueryString));
+	}
+	return QueryStrings;
+}
+
+static void MergeJsonObjects(const TSharedRef<FJsonObject>& Target, const TSharedRef<FJsonObject>& Source)
+{
+	for (const TPair<FString, TSharedPtr<FJsonValue>>& Field : Source->Values)
+	{
+		const TSharedPtr<FJsonValue>* TargetField = Target->Values.Find(Field.Key);
+		if (TargetField != nullptr && TargetField->IsValid() && Field.Value.IsValid() && (*TargetField)->Type == Field.Value->Type)
+		{
+			if (Field.Value->Type == EJson::Array)
+			{
+				TArray<TSharedPtr<FJsonValue>> Values = (*TargetField)->AsArray();
+				Values.Append(Field.Value->AsArray());
+				Target->SetArrayField(Field.Key, Values);
+				continue;
+			}
+			if (Field.Value->Type == EJson::Object)
+			{
+				MergeJsonObjects((*TargetField)->AsObject().ToSharedRef(), Field.Value->AsObject().ToSharedRef());
+				continue;
+			}
+		}
+		Target->SetField(Field.Key, Field.Value);
+	}
+}
+
+FString FEIKWebClient::MergeJsonResponses(const TArray<FString>& Responses)
+{
+	if (Responses.Num() == 1)
+	{
+		return Responses[0];
+	}
+
+	TSharedRef<FJsonObject> MergedObject = MakeShared<FJsonObject>();
+	for (const FString& Response : Responses)
+	{
+		TSharedPtr<FJsonObject> ResponseObject;
+		TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(Response);
+		if (!FJsonSerializer::Deserialize(JsonReader, ResponseObject) || !ResponseObject.IsValid())
+		{
+			return Response;
+		}
+		MergeJsonObjects(MergedObject, ResponseObject.ToSharedRef());
+	}
+
+	FString MergedResponse;
+	TSharedRef<TJsonWriter<>> JsonWriter = TJsonWriterFactory<>::Create(&MergedResponse);
+	FJsonSerializer::Serialize(MergedObject, JsonWriter);
+	return MergedResponse;
+}
@@ -5,21 +5,66 @@
 #include "Runtime/Launch/Resources/Version.h"
 
 
-void UEIK_BaseWebApi::OnResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
+void UEIK_BaseWebApi::ProcessRequest(const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& HttpRequest)
 {
-	if(!bWasSuccessful)
+	FEIKWebClient::Get().ProcessRequest(HttpRequest, FEIKWebResponseDelegate::CreateUObject(this, &UEIK_BaseWebApi::OnResponseReceived));
+}
+
+void UEIK_BaseWebApi::ProcessRequests(const TArray<TSharedRef<IHttpRequest, ESPMode::ThreadSafe>>& HttpRequests)
+{
+	if (HttpRequests.Num() == 1)
 	{
-		OnResponse.Broadcast(false, FEIK_BaseWebApiResponse(-1, "Request failed"));
-		DestroyAsyncTask();
+		ProcessRequest(HttpRequests[0]);
 		return;
 	}
-	if(!Response.IsValid())
+
+	struct FSplitResponses
+	{
+		TArray<FEIKWebResponse> Responses;
+		int32 NumPending = 0;
+	};
+	TSharedRef<FSplitResponses> SplitResponses = MakeShared<FSplitResponses>();
+	SplitResponses->Responses.SetNum(HttpRequests.Num());
+	SplitResponses->NumPending = HttpRequests.Num();
+
+	for (int32 Index = 0; Index < HttpRequests.Num(); Index++)
+	{
+		FEIKWebClient::Get().ProcessRequest(HttpRequests[Index], FEIKWebResponseDelegate::CreateWeakLambda(this, [this, SplitResponses, Index](const FEIKWebResponse& Response)
+		{
+			SplitResponses->Responses[Index] = Response;
+			if (--SplitResponses->NumPending > 0)
+			{
+				return;
+			}
+
+			// Any part that failed fails the whole query, otherwise the parts are merged into a single response
+			TArray<FString> Contents;
+			for (const FEIKWebResponse& PartResponse : SplitResponses->Responses)
+			{
+				if (!PartResponse.bWasSuccessful || PartResponse.StatusCode < 200 || PartResponse.StatusCode >= 300)
+				{
+					OnResponseReceived(PartResponse);
+					return;
+				}
+				Contents.Add(PartResponse.Content);
+			}
+
+			FEIKWebResponse MergedResponse = SplitResponses->Responses[0];
+			MergedResponse.Content = FEIKWebClient::MergeJsonResponses(Contents);
+			OnResponseReceived(MergedResponse);
+		}));
+	}
+}
+
+void UEIK_BaseWebApi::OnResponseReceived(const FEIKWebResponse& Response)
+{
+	if(!Response.bWasSuccessful)
 	{
-		OnResponse.Broadcast(false, FEIK_BaseWebApiResponse(-1, "Response is invalid"));
+		OnResponse.Broadcast(false, FEIK_BaseWebApiResponse(-1, "Request failed"));
 		DestroyAsyncTask();
 		return;
 	}
-	OnResponse.Broadcast(true, FEIK_BaseWebApiResponse(Response->GetResponseCode(), Response->GetContentAsString()));
+	OnResponse.Broadcast(true, FEIK_BaseWebApiResponse(Response.StatusCode, Response.Content));
 	DestroyAsyncTask();
 }
 
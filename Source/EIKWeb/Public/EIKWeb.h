@@ -3,6 +3,8 @@
 #include "CoreMinimal.h"
 #include "Modules/ModuleManager.h"
 
+EIKWEB_API DECLARE_LOG_CATEGORY_EXTERN(LogEIKWeb, Log, All);
+
 class FEIKWebModule : public IModuleInterface
 {
 public:
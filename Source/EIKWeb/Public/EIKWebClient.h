@@ -0,0 +1,119 @@
+﻿// Copyright (c) 2024 Betide Studio. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Runtime/Launch/Resources/Version.h"
+#include "Interfaces/IHttpRequest.h"
+#include "Interfaces/IHttpResponse.h"
+
+/** Result of a request made through FEIKWebClient */
+struct FEIKWebResponse
+{
+	/** Whether a response was received at all, regardless of its status code */
+	bool bWasSuccessful = false;
+	int32 StatusCode = -1;
+	FString Content;
+	/** Whether the content was served from the response cache */
+	bool bFromCache = false;
+};
+
+DECLARE_DELEGATE_OneParam(FEIKWebResponseDelegate, const FEIKWebResponse&);
+
+/**
+ * Shared HTTP client used by all EOS Web API nodes.
+ *
+ * Requests are queued and sent a few at a time over kept alive connections. Identical GET requests in flight
+ * are coalesced, and GET responses are cached by ETag and optionally for a fixed time. Requests with idempotent
+ * verbs that fail to connect or come back with 5xx are retried with jittered exponential backoff. Any request
+ * that comes back with 429 is retried, as the server did not process it.
+ *
+ * Configured from the [/Script/EOSIntegrationKit.EIKSettings] section of the engine ini. The base URL can also
+ * be overridden with -EIKWebApiBaseUrl= on the command line, e.g. to run against a local mock server.
+ */
+class EIKWEB_API FEIKWebClient
+{
+public:
+	static FEIKWebClient& Get();
+
+	/** Drops all queued requests, pending retries and cached responses */
+	void Shutdown();
+
+	/** Base URL of the EOS Web API, without a trailing slash */
+	const FString& GetBaseUrl() const { return BaseUrl; }
+
+	/** Queues a request. Its completion delegate is replaced, OnComplete is called instead once a final response arrives. */
+	void ProcessRequest(const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& Request, const FEIKWebResponseDelegate& OnComplete);
+
+	/**
+	 * Splits repeated query parameters, e.g. productUserId=a&productUserId=b, into as few query strings as possible
+	 * that keep a URL of UrlLength characters under the configured maximum length
+	 */
+	TArray<FString> SplitQueryParameters(const FString& Name, const TArray<FString>& Values, int32 UrlLength) const;
+
+	/** Merges the JSON object responses of a split request, concatenating arrays and merging nested objects */
+	static FString MergeJsonResponses(const TArray<FString>& Responses);
+
+	void ClearCache();
+
+private:
+	FEIKWebClient();
+
+	struct FPendingRequest
+	{
+		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request;
+		/** Cache and coalescing key, empty for requests that are neither */
+		FString CacheKey;
+		int32 NumRetries = 0;
+		/** Set once the request was reissued without If-None-Match because the cached response it revalidated is gone */
+		bool bIsUnconditional = false;
+		TArray<FEIKWebResponseDelegate> Delegates;
+
+		FPendingRequest(const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& InRequest)
+			: Request(InRequest)
+		{
+		}
+	};
+
+	struct FCachedResponse
+	{
+		FString ETag;
+		int32 StatusCode = 0;
+		FString Content;
+		double ExpiryTime = 0.0;
+	};
+
+	void PumpQueue();
+	void SendRequest(const TSharedRef<FPendingRequest>& PendingRequest);
+	void OnRequestComplete(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful, TSharedRef<FPendingRequest> PendingRequest);
+	void CompleteRequest(const TSharedRef<FPendingRequest>& PendingRequest, const FEIKWebResponse& Response);
+	/** Replaces a completed request with a copy that can be sent again, optionally without its If-None-Match header */
+	static void ResetRequest(FPendingRequest& PendingRequest, bool bKeepIfNoneMatch);
+	/** Runs a callback after a delay, or on the next tick with no delay */
+	void ExecuteAfter(float Delay, TFunction<void()>&& Callback);
+
+	FString BaseUrl;
+	int32 MaxConcurrentRequests = 8;
+	int32 MaxRetries = 3;
+	float RetryBaseDelaySeconds = 0.5f;
+	float RetryMaxDelaySeconds = 10.0f;
+	/** How long GET responses are served without asking the server again, zero to always revalidate them by ETag */
+	double CacheSeconds = 0.0;
+	int32 MaxCachedResponses = 128;
+	int32 MaxUrlLength = 2000;
+
+	TArray<TSharedRef<FPendingRequest>> QueuedRequests;
+	int32 NumRequestsInFlight = 0;
+	/** GET requests queued or in flight, so identical ones can wait for the same response */
+	TMap<FString, TSharedRef<FPendingRequest>> PendingRequestsByKey;
+	TMap<FString, FCachedResponse> CachedResponses;
+
+	/** Callbacks scheduled by ExecuteAfter that have not run yet, removed on shutdown */
+#if ENGINE_MAJOR_VERSION == 5
+	TMap<uint32, FTSTicker::FDelegateHandle> PendingTickers;
+#else
+	TMap<uint32, FDelegateHandle> PendingTickers;
+#endif
+	uint32 LastTickerId = 0;
+};
@@ -9,6 +9,7 @@
 #include "Runtime/Json/Public/Serialization/JsonSerializer.h"
 #include "Runtime/Json/Public/Dom/JsonObject.h"
 #include "Kismet/BlueprintAsyncActionBase.h"
+#include "EIKWebClient.h"
 #include "EIK_BaseWebApi.generated.h"
 
 USTRUCT(BlueprintType)
@@ -47,7 +48,11 @@ public:
 	FEIK_BaseWebApiDelegate OnResponse;
 
 protected:
-	void OnResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful);
+	/** Sends the request through the shared web client and broadcasts its response */
+	void ProcessRequest(const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& HttpRequest);
+	/** Sends the requests of a query split across several URLs and broadcasts their merged response */
+	void ProcessRequests(const TArray<TSharedRef<IHttpRequest, ESPMode::ThreadSafe>>& HttpRequests);
+	void OnResponseReceived(const FEIKWebResponse& Response);
 	void DestroyAsyncTask();
-	FString APIEndpoint = "https://api.epicgames.dev";
+	FString APIEndpoint = FEIKWebClient::Get().GetBaseUrl();
 };
@@ -167,6 +167,42 @@ const FEOSSettings& UEIKSettings::ManualGetSettings()
 		GConfig->GetBool(INI_SECTION, TEXT("bMirrorPresenceToEAS"), CachedSettings->bMirrorPresenceToEAS, GEngineIni);
 		// Artifacts explicitly skipped
 		GConfig->GetArray(INI_SECTION, TEXT("TitleStorageTags"), CachedSettings->TitleStorageTags, GEngineIni);
+		GConfig->GetInt(INI_SECTION, TEXT("TitleStorageMaxConcurrentPrefetches"), CachedSettings->TitleStorageMaxConcurrentPrefetches, GEngineIni);
+		GConfig->GetInt(INI_SECTION, TEXT("UserCloudDeltaBlockSize"), CachedSettings->UserCloudDeltaBlockSize, GEngineIni);
+		GConfig->GetBool(INI_SECTION, TEXT("bCompressPlayerData"), CachedSettings->bCompressPlayerData, GEngineIni);
+		GConfig->GetFloat(INI_SECTION, TEXT("StatsFlushIntervalSeconds"), CachedSettings->StatsFlushIntervalSeconds, GEngineIni);
+		GConfig->GetFloat(INI_SECTION, TEXT("StatsQueryCacheSeconds"), CachedSettings->StatsQueryCacheSeconds, GEngineIni);
+		GConfig->GetInt(INI_SECTION, TEXT("MaxCachedAttributeResults"), CachedSettings->MaxCachedAttributeResults, GEngineIni);
+		GConfig->GetFloat(INI_SECTION, TEXT("PlayerRegistrationBatchWindowSeconds"), CachedSettings->PlayerRegistrationBatchWindowSeconds, GEngineIni);
+		GConfig->GetInt(INI_SECTION, TEXT("MaxPlayersPerRegistrationRequest"), CachedSettings->MaxPlayersPerRegistrationRequest, GEngineIni);
+		GConfig->GetFloat(INI_SECTION, TEXT("LobbyAttributeWriteCoalesceSeconds"), CachedSettings->LobbyAttributeWriteCoalesceSeconds, GEngineIni);
+		GConfig->GetFloat(INI_SECTION, TEXT("MinLobbyUpdateIntervalSeconds"), CachedSettings->MinLobbyUpdateIntervalSeconds, GEngineIni);
+		GConfig->GetFloat(INI_SECTION, TEXT("UserLookupBatchWindowSeconds"), CachedSettings->UserLookupBatchWindowSeconds, GEngineIni);
+		GConfig->GetFloat(INI_SECTION, TEXT("UserLookupCacheSeconds"), CachedSettings->UserLookupCacheSeconds, GEngineIni);
+		GConfig->GetInt(INI_SECTION, TEXT("MaxUserInfoLookupsInFlight"), CachedSettings->MaxUserInfoLookupsInFlight, GEngineIni);
+		GConfig->GetBool(INI_SECTION, TEXT("bEnablePingService"), CachedSettings->bEnablePingService, GEngineIni);
+		GConfig->GetString(INI_SECTION, TEXT("PingSocketName"), CachedSettings->PingSocketName, GEngineIni);
+		GConfig->GetInt(INI_SECTION, TEXT("PingChannel"), CachedSettings->PingChannel, GEngineIni);
+		GConfig->GetInt(INI_SECTION, TEXT("PingSamplesPerProbe"), CachedSettings->PingSamplesPerProbe, GEngineIni);
+		GConfig->GetFloat(INI_SECTION, TEXT("PingProbeIntervalSeconds"), CachedSettings->PingProbeIntervalSeconds, GEngineIni);
+		GConfig->GetFloat(INI_SECTION, TEXT("PingProbeTimeoutSeconds"), CachedSettings->PingProbeTimeoutSeconds, GEngineIni);
+		GConfig->GetInt(INI_SECTION, TEXT("PingLossWindow"), CachedSettings->PingLossWindow, GEngineIni);
+		GConfig->GetFloat(INI_SECTION, TEXT("PingStatsRetentionSeconds"), CachedSettings->PingStatsRetentionSeconds, GEngineIni);
+		GConfig->GetInt(INI_SECTION, TEXT("BeaconPingSamples"), CachedSettings->BeaconPingSamples, GEngineIni);
+		GConfig->GetBool(INI_SECTION, TEXT("bUseDedicatedVoiceChatPlatform"), CachedSettings->bUseDedicatedVoiceChatPlatform, GEngineIni);
+		GConfig->GetFloat(INI_SECTION, TEXT("VoiceChatUninitializeTimeoutSeconds"), CachedSettings->VoiceChatUninitializeTimeoutSeconds, GEngineIni);
+		GConfig->GetString(INI_SECTION, TEXT("VoiceTokenServiceBaseUrl"), CachedSettings->VoiceTokenServiceBaseUrl, GEngineIni);
+		GConfig->GetFloat(INI_SECTION, TEXT("VoiceRoomTokenBatchWindowSeconds"), CachedSettings->VoiceRoomTokenBatchWindowSeconds, GEngineIni);
+		GConfig->GetInt(INI_SECTION, TEXT("VoiceRoomTokenMaxParticipantsPerRequest"), CachedSettings->VoiceRoomTokenMaxParticipantsPerRequest, GEngineIni);
+		GConfig->GetFloat(INI_SECTION, TEXT("VoiceAccessTokenRefreshMarginSeconds"), CachedSettings->VoiceAccessTokenRefreshMarginSeconds, GEngineIni);
+		GConfig->GetString(INI_SECTION, TEXT("WebApiBaseUrl"), CachedSettings->WebApiBaseUrl, GEngineIni);
+		GConfig->GetInt(INI_SECTION, TEXT("WebApiMaxConcurrentRequests"), CachedSettings->WebApiMaxConcurrentRequests, GEngineIni);
+		GConfig->GetInt(INI_SECTION, TEXT("WebApiMaxRetries"), CachedSettings->WebApiMaxRetries, GEngineIni);
+		GConfig->GetFloat(INI_SECTION, TEXT("WebApiRetryBaseDelaySeconds"), CachedSettings->WebApiRetryBaseDelaySeconds, GEngineIni);
+		GConfig->GetFloat(INI_SECTION, TEXT("WebApiRetryMaxDelaySeconds"), CachedSettings->WebApiRetryMaxDelaySeconds, GEngineIni);
+		GConfig->GetFloat(INI_SECTION, TEXT("WebApiCacheSeconds"), CachedSettings->WebApiCacheSeconds, GEngineIni);
+		GConfig->GetInt(INI_SECTION, TEXT("WebApiMaxCachedResponses"), CachedSettings->WebApiMaxCachedResponses, GEngineIni);
+		GConfig->GetInt(INI_SECTION, TEXT("WebApiMaxUrlLength"), CachedSettings->WebApiMaxUrlLength, GEngineIni);
 	}
 
 	return *CachedSettings;
@@ -196,6 +232,42 @@ FEOSSettings UEIKSettings::ToNative() const
 	Native.bMirrorPresenceToEAS = bMirrorPresenceToEAS;
 	Algo::Transform(Artifacts, Native.Artifacts, &FEArtifactSettings::ToNative);
 	Native.TitleStorageTags = TitleStorageTags;
+	Native.TitleStorageMaxConcurrentPrefetches = TitleStorageMaxConcurrentPrefetches;
+	Native.UserCloudDeltaBlockSize = UserCloudDeltaBlockSize;
+	Native.bCompressPlayerData = bCompressPlayerData;
+	Native.StatsFlushIntervalSeconds = StatsFlushIntervalSeconds;
+	Native.StatsQueryCacheSeconds = StatsQueryCacheSeconds;
+	Native.MaxCachedAttributeResults = MaxCachedAttributeResults;
+	Native.PlayerRegistrationBatchWindowSeconds = PlayerRegistrationBatchWindowSeconds;
+	Native.MaxPlayersPerRegistrationRequest = MaxPlayersPerRegistrationRequest;
+	Native.LobbyAttributeWriteCoalesceSeconds = LobbyAttributeWriteCoalesceSeconds;
+	Native.MinLobbyUpdateIntervalSeconds = MinLobbyUpdateIntervalSeconds;
+	Native.UserLookupBatchWindowSeconds = UserLookupBatchWindowSeconds;
+	Native.UserLookupCacheSeconds = UserLookupCacheSeconds;
+	Native.MaxUserInfoLookupsInFlight = MaxUserInfoLookupsInFlight;
+	Native.bEnablePingService = bEnablePingService;
+	Native.PingSocketName = PingSocketName;
+	Native.PingChannel = PingChannel;
+	Native.PingSamplesPerProbe = PingSamplesPerProbe;
+	Native.PingProbeIntervalSeconds = PingProbeIntervalSeconds;
+	Native.PingProbeTimeoutSeconds = PingProbeTimeoutSeconds;
+	Native.PingLossWindow = PingLossWindow;
+	Native.PingStatsRetentionSeconds = PingStatsRetentionSeconds;
+	Native.BeaconPingSamples = BeaconPingSamples;
+	Native.bUseDedicatedVoiceChatPlatform = bUseDedicatedVoiceChatPlatform;
+	Native.VoiceChatUninitializeTimeoutSeconds = VoiceChatUninitializeTimeoutSeconds;
+	Native.VoiceTokenServiceBaseUrl = VoiceTokenServiceBaseUrl;
+	Native.VoiceRoomTokenBatchWindowSeconds = VoiceRoomTokenBatchWindowSeconds;
+	Native.VoiceRoomTokenMaxParticipantsPerRequest = VoiceRoomTokenMaxParticipantsPerRequest;
+	Native.VoiceAccessTokenRefreshMarginSeconds = VoiceAccessTokenRefreshMarginSeconds;
+	Native.WebApiBaseUrl = WebApiBaseUrl;
+	Native.WebApiMaxConcurrentRequests = WebApiMaxConcurrentRequests;
+	Native.WebApiMaxRetries = WebApiMaxRetries;
+	Native.WebApiRetryBaseDelaySeconds = WebApiRetryBaseDelaySeconds;
+	Native.WebApiRetryMaxDelaySeconds = WebApiRetryMaxDelaySeconds;
+	Native.WebApiCacheSeconds = WebApiCacheSeconds;
+	Native.WebApiMaxCachedResponses = WebApiMaxCachedResponses;
+	Native.WebApiMaxUrlLength = WebApiMaxUrlLength;
 
 	return Native;
 }
@@ -90,6 +90,42 @@ struct FEOSSettings
 	bool bMirrorPresenceToEAS;
 	TArray<FEOSArtifactSettings> Artifacts;
 	TArray<FString> TitleStorageTags;
+	int32 TitleStorageMaxConcurrentPrefetches = 4;
+	int32 UserCloudDeltaBlockSize = 0;
+	bool bCompressPlayerData = false;
+	float StatsFlushIntervalSeconds = 0.f;
+	float StatsQueryCacheSeconds = 30.f;
+	int32 MaxCachedAttributeResults = 256;
+	float PlayerRegistrationBatchWindowSeconds = 0.f;
+	int32 MaxPlayersPerRegistrationRequest = 1000;
+	float LobbyAttributeWriteCoalesceSeconds = 0.1f;
+	float MinLobbyUpdateIntervalSeconds = 1.f;
+	float UserLookupBatchWindowSeconds = 0.05f;
+	float UserLookupCacheSeconds = 60.f;
+	int32 MaxUserInfoLookupsInFlight = 32;
+	bool bEnablePingService = false;
+	FString PingSocketName = TEXT("EIKPing");
+	int32 PingChannel = 250;
+	int32 PingSamplesPerProbe = 5;
+	float PingProbeIntervalSeconds = 0.1f;
+	float PingProbeTimeoutSeconds = 2.f;
+	int32 PingLossWindow = 32;
+	float PingStatsRetentionSeconds = 300.f;
+	int32 BeaconPingSamples = 5;
+	bool bUseDedicatedVoiceChatPlatform = false;
+	float VoiceChatUninitializeTimeoutSeconds = 2.f;
+	FString VoiceTokenServiceBaseUrl;
+	float VoiceRoomTokenBatchWindowSeconds = 0.f;
+	int32 VoiceRoomTokenMaxParticipantsPerRequest = 16;
+	float VoiceAccessTokenRefreshMarginSeconds = 60.f;
+	FString WebApiBaseUrl = TEXT("https://api.epicgames.dev");
+	int32 WebApiMaxConcurrentRequests = 8;
+	int32 WebApiMaxRetries = 3;
+	float WebApiRetryBaseDelaySeconds = 0.5f;
+	float WebApiRetryMaxDelaySeconds = 10.f;
+	float WebApiCacheSeconds = 0.f;
+	int32 WebApiMaxCachedResponses = 128;
+	int32 WebApiMaxUrlLength = 2000;
 };
 
 UENUM(BlueprintType)
@@ -269,6 +305,150 @@ public:
 	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="EOS Settings|Title Storage Settings")
 	int32 TitleStorageReadChunkLength = 0;
 
+	/** How many title files PrefetchFiles reads at the same time */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="EOS Settings|Title Storage Settings", meta=(ClampMin="1"))
+	int32 TitleStorageMaxConcurrentPrefetches = 4;
+
+	/** Player data files larger than this many bytes are split into blocks, of which only the changed ones are uploaded. 0 disables it */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="EOS Settings|Player Data Storage Settings", meta=(ClampMin="0"))
+	int32 UserCloudDeltaBlockSize = 0;
+
+	/** Compress player data written through the EIK player data functions before it is uploaded */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="EOS Settings|Player Data Storage Settings")
+	bool bCompressPlayerData = false;
+
+	/** How long stat updates are accumulated before they are ingested, 0 ingests on the next tick */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="EOS Settings|Stats Settings", meta=(ClampMin="0"))
+	float StatsFlushIntervalSeconds = 0.f;
+
+	/** How long queried stats of remote users are served from the cache */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="EOS Settings|Stats Settings", meta=(ClampMin="0"))
+	float StatsQueryCacheSeconds = 30.f;
+
+	/** How many sessions and lobbies keep their decoded attributes, each for sessions and lobbies */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="EOS Settings|Session Settings", meta=(ClampMin="1"))
+	int32 MaxCachedAttributeResults = 256;
+
+	/** How long player registrations are collected before being sent together, 0 sends them on the next tick */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="EOS Settings|Session Settings", meta=(ClampMin="0"))
+	float PlayerRegistrationBatchWindowSeconds = 0.f;
+
+	/** Players per register or unregister request, capped at the SDK limit */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="EOS Settings|Session Settings", meta=(ClampMin="1", ClampMax="1000"))
+	int32 MaxPlayersPerRegistrationRequest = 1000;
+
+	/** How long queued lobby attribute writes wait for more writes to the same lobby before being sent */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="EOS Settings|Lobby Settings", meta=(ClampMin="0"))
+	float LobbyAttributeWriteCoalesceSeconds = 0.1f;
+
+	/** Minimum time between two updates of the same lobby, keeps us under the lobby update rate limit */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="EOS Settings|Lobby Settings", meta=(ClampMin="0"))
+	float MinLobbyUpdateIntervalSeconds = 1.f;
+
+	/** How long user info lookups are collected before being sent, 0 sends them on the next tick */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="EOS Settings|User Info Settings", meta=(ClampMin="0"))
+	float UserLookupBatchWindowSeconds = 0.05f;
+
+	/** How long a looked up user is not looked up again */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="EOS Settings|User Info Settings", meta=(ClampMin="0"))
+	float UserLookupCacheSeconds = 60.f;
+
+	/** How many user info lookups can be in flight at the same time */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="EOS Settings|User Info Settings", meta=(ClampMin="1"))
+	int32 MaxUserInfoLookupsInFlight = 32;
+
+	/** Answer and send P2P ping probes used to measure the latency to other users */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="EOS Settings|Ping Settings")
+	bool bEnablePingService = false;
+
+	/** P2P socket name used by ping probes */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="EOS Settings|Ping Settings")
+	FString PingSocketName = TEXT("EIKPing");
+
+	/** P2P channel used by ping probes */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="EOS Settings|Ping Settings", meta=(ClampMin="0", ClampMax="255"))
+	int32 PingChannel = 250;
+
+	/** Probes sent per measurement when none is given */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="EOS Settings|Ping Settings", meta=(ClampMin="1"))
+	int32 PingSamplesPerProbe = 5;
+
+	/** Time between two probes to the same user */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="EOS Settings|Ping Settings", meta=(ClampMin="0"))
+	float PingProbeIntervalSeconds = 0.1f;
+
+	/** How long a probe waits for its reply before it counts as lost */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="EOS Settings|Ping Settings", meta=(ClampMin="0"))
+	float PingProbeTimeoutSeconds = 2.f;
+
+	/** Number of recent probes the loss rate is computed over */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="EOS Settings|Ping Settings", meta=(ClampMin="1"))
+	int32 PingLossWindow = 32;
+
+	/** How long the latency to a user is kept after it was last probed */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="EOS Settings|Ping Settings", meta=(ClampMin="0"))
+	float PingStatsRetentionSeconds = 300.f;
+
+	/** Round trips measured by a ping beacon, the reported ping is their median */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="EOS Settings|Ping Settings", meta=(ClampMin="1"))
+	int32 BeaconPingSamples = 5;
+
+	/** Create a separate EOS platform for voice chat instead of sharing the online subsystem's one */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="EOS Settings|Voice Settings")
+	bool bUseDedicatedVoiceChatPlatform = false;
+
+	/** How long uninitializing voice chat waits for the SDK to disconnect */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="EOS Settings|Voice Settings", meta=(ClampMin="0"))
+	float VoiceChatUninitializeTimeoutSeconds = 2.f;
+
+	/** Web API base url used to issue voice room tokens, empty uses https://api.epicgames.dev */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="EOS Settings|Voice Settings")
+	FString VoiceTokenServiceBaseUrl;
+
+	/** How long queued voice room token requests wait for more participants of the same room, 0 waits for the next tick */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="EOS Settings|Voice Settings", meta=(ClampMin="0"))
+	float VoiceRoomTokenBatchWindowSeconds = 0.f;
+
+	/** Participants per voice room token request */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="EOS Settings|Voice Settings", meta=(ClampMin="1"))
+	int32 VoiceRoomTokenMaxParticipantsPerRequest = 16;
+
+	/** How long before it expires a cached voice access token is refreshed */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="EOS Settings|Voice Settings", meta=(ClampMin="0"))
+	float VoiceAccessTokenRefreshMarginSeconds = 60.f;
+
+	/** Base url of the EOS Web API */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="EOS Settings|Web API Settings")
+	FString WebApiBaseUrl = TEXT("https://api.epicgames.dev");
+
+	/** How many Web API requests can be in flight at the same time */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="EOS Settings|Web API Settings", meta=(ClampMin="1"))
+	int32 WebApiMaxConcurrentRequests = 8;
+
+	/** How often a failed Web API request is retried */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="EOS Settings|Web API Settings", meta=(ClampMin="0"))
+	int32 WebApiMaxRetries = 3;
+
+	/** Delay before the first retry, doubled for every following one */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="EOS Settings|Web API Settings", meta=(ClampMin="0"))
+	float WebApiRetryBaseDelaySeconds = 0.5f;
+
+	/** Longest delay between two retries */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="EOS Settings|Web API Settings", meta=(ClampMin="0"))
+	float WebApiRetryMaxDelaySeconds = 10.f;
+
+	/** How long cached responses are reused without asking the server again, 0 only reuses them through their ETag */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="EOS Settings|Web API Settings", meta=(ClampMin="0"))
+	float WebApiCacheSeconds = 0.f;
+
+	/** How many responses the cache keeps */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="EOS Settings|Web API Settings", meta=(ClampMin="0"))
+	int32 WebApiMaxCachedResponses = 128;
+
+	/** Longest url a Web API request can have */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="EOS Settings|Web API Settings", meta=(ClampMin="1"))
+	int32 WebApiMaxUrlLength = 2000;
+
 	/** Used when launched from a store other than EGS or when the specified artifact name was not present */
 	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="EOS Settings|Artifact Settings")
 	FString DefaultArtifactName = TEXT("DefaultArtifact");
@@ -8,7 +8,7 @@
 
 bool UAntiCheatClient::IsAntiCheatClientAvailable(const UObject* WorldContextObject)
 {
-	if(	IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if(	IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -23,7 +23,7 @@ bool UAntiCheatClient::IsAntiCheatClientAvailable(const UObject* WorldContextObj
 
 bool UAntiCheatClient::RegisterAntiCheatClient(FString ClientProductID)
 {
-	if(	IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if(	IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -61,7 +61,7 @@ bool UAntiCheatClient::RegisterAntiCheatClient(FString ClientProductID)
 
 bool UAntiCheatClient::RecievedMessageFromServer(const TArray<uint8>& Message)
 {
-	if(	IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if(	IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -91,7 +91,7 @@ bool UAntiCheatClient::RecievedMessageFromServer(const TArray<uint8>& Message)
 
 bool UAntiCheatClient::UnregisterAntiCheatClient()
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
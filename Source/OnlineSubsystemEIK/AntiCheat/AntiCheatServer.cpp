@@ -10,7 +10,7 @@
 
 bool UAntiCheatServer::IsAntiCheatServerAvailable(const UObject* WorldContextObject)
 {
-	if(	IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if(	IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -25,7 +25,7 @@ bool UAntiCheatServer::IsAntiCheatServerAvailable(const UObject* WorldContextObj
 
 bool UAntiCheatServer::RegisterAntiCheatServer(FString ServerName, FString ClientProductID)
 {
-	if(	IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if(	IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -75,7 +75,7 @@ bool UAntiCheatServer::RegisterAntiCheatServer(FString ServerName, FString Clien
 
 bool UAntiCheatServer::UnregisterAntiCheatServer()
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -110,7 +110,7 @@ bool UAntiCheatServer::UnregisterAntiCheatServer()
 
 bool UAntiCheatServer::RegisterClientForAntiCheat(FString ClientProductID, APlayerController* ControllerRef, TEnumAsByte<EUserPlatform> UserPlatform, TEnumAsByte<EEOS_ClientType> ClientType)
 {
-	if(	IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if(	IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -143,7 +143,7 @@ bool UAntiCheatServer::RegisterClientForAntiCheat(FString ClientProductID, APlay
 
 bool UAntiCheatServer::UnregisterClientFromAntiCheat(APlayerController* ControllerRef)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -175,7 +175,7 @@ bool UAntiCheatServer::UnregisterClientFromAntiCheat(APlayerController* Controll
 
 bool UAntiCheatServer::RecievedMessageFromClient(APlayerController* Controller,const TArray<uint8>& Message)
 {
-	if(	IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if(	IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -2,6 +2,7 @@
 
 
 #include "EIK_GetAchievementDetails_AsyncFunction.h"
+#include "OnlineSubsystemEOS.h"
 
 #include "OnlineSubsystem.h"
 #include "Interfaces/OnlineAchievementsInterface.h"
@@ -22,7 +23,7 @@ void UEIK_GetAchievementDetails_AsyncFunction::Activate()
 
 void UEIK_GetAchievementDetails_AsyncFunction::GetAchievementDescription()
 {
-	if(const IOnlineSubsystem *SubsystemRef = IOnlineSubsystem::Get("EIK"))
+	if(const IOnlineSubsystem *SubsystemRef = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if(const IOnlineAchievementsPtr AchievementsPtrRef = SubsystemRef->GetAchievementsInterface())
 		{
@@ -79,7 +80,7 @@ void UEIK_GetAchievementDetails_AsyncFunction::OnAchievementDescriptionCompleted
 {
 	if(bWasSuccess)
 	{
-		if(const IOnlineSubsystem *SubsystemRef = IOnlineSubsystem::Get("EIK"))
+		if(const IOnlineSubsystem *SubsystemRef = FOnlineSubsystemEOS::GetDefaultInstance())
 		{
 			if(const IOnlineAchievementsPtr AchievementsPtrRef = SubsystemRef->GetAchievementsInterface())
 			{
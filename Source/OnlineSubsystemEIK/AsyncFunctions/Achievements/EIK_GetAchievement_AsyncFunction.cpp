@@ -2,6 +2,7 @@
 
 
 #include "EIK_GetAchievement_AsyncFunction.h"
+#include "OnlineSubsystemEOS.h"
 #include "OnlineSubsystem.h"
 #include "Interfaces/OnlineAchievementsInterface.h"
 #include "Interfaces/OnlineIdentityInterface.h"
@@ -20,7 +21,7 @@ void UEIK_GetAchievement_AsyncFunction::Activate()
 
 void UEIK_GetAchievement_AsyncFunction::GetAchievements()
 {
-	if(const IOnlineSubsystem *SubsystemRef = IOnlineSubsystem::Get("EIK"))
+	if(const IOnlineSubsystem *SubsystemRef = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if(const IOnlineAchievementsPtr AchievementsPtrRef = SubsystemRef->GetAchievementsInterface())
 		{
@@ -78,7 +79,7 @@ void UEIK_GetAchievement_AsyncFunction::OnAchievementsCompleted(const FUniqueNet
 {
 	if(bWasSuccess)
 	{
-		if(const IOnlineSubsystem *SubsystemRef = IOnlineSubsystem::Get("EIK"))
+		if(const IOnlineSubsystem *SubsystemRef = FOnlineSubsystemEOS::GetDefaultInstance())
 		{
 			if(const IOnlineAchievementsPtr AchievementsPtrRef = SubsystemRef->GetAchievementsInterface())
 			{
@@ -0,0 +1,86 @@
+﻿// Copyright (c) 2024 Betide Studio. All Rights Reserved.
+
+
+#include "EIK_CalculatePingForSessions_AsyncFunction.h"
+#include "OnlineSubsystemEOS.h"
+#include "PingServiceEOS.h"
+#include "UserManagerEOS.h"
+#include "OnlineSubsystemEIK/SdkFunctions/EIK_SharedFunctionFile.h"
+
+UEIK_CalculatePingForSessions_AsyncFunction* UEIK_CalculatePingForSessions_AsyncFunction::CalculatePingForSessions(
+	TArray<FSessionFindStruct> Sessions, UObject* WorldContextObject, int32 NumSamples)
+{
+	UEIK_CalculatePingForSessions_AsyncFunction* BlueprintNode = NewObject<UEIK_CalculatePingForSessions_AsyncFunction>();
+	BlueprintNode->Var_Sessions = Sessions;
+	BlueprintNode->Var_NumSamples = NumSamples;
+	BlueprintNode->WorldContextObject = WorldContextObject;
+	return BlueprintNode;
+}
+
+void UEIK_CalculatePingForSessions_AsyncFunction::Activate()
+{
+	Super::Activate();
+	if (FOnlineSubsystemEOS* EOSRef = FOnlineSubsystemEOS::GetDefaultInstance())
+	{
+		if (EOSRef->PingServicePtr.IsValid())
+		{
+			TArray<EOS_ProductUserId> Owners;
+			for (const FSessionFindStruct& Session : Var_Sessions)
+			{
+				if (EOS_ProductUserId Owner = FPingServiceEOS::GetSearchResultOwner(Session.SessionResult.OnlineResult))
+				{
+					Owners.Add(Owner);
+				}
+			}
+
+			TWeakObjectPtr<UEIK_CalculatePingForSessions_AsyncFunction> WeakThis = this;
+			const bool bStarted = EOSRef->PingServicePtr->Probe(EOSRef->UserManager->GetDefaultLocalUser(), Owners, FMath::Max(Var_NumSamples, 1), FOnPingProbeComplete::CreateLambda([WeakThis](const TMap<FString, FEOSPingStats>& Results)
+			{
+				if (WeakThis.IsValid())
+				{
+					WeakThis->OnProbeComplete(Results);
+				}
+			}));
+			if (bStarted)
+			{
+				return;
+			}
+			UE_LOG(LogEIK, Error, TEXT("UEIK_CalculatePingForSessions_AsyncFunction::Activate: Ping service is disabled or the local user isn't logged in"));
+		}
+	}
+	Finish(false);
+}
+
+void UEIK_CalculatePingForSessions_AsyncFunction::OnProbeComplete(const TMap<FString, FEOSPingStats>& Results)
+{
+	for (FSessionFindStruct& Session : Var_Sessions)
+	{
+		FOnlineSessionSearchResult& SearchResult = Session.SessionResult.OnlineResult;
+		const EOS_ProductUserId Owner = FPingServiceEOS::GetSearchResultOwner(SearchResult);
+		const FEOSPingStats* Stats = Owner ? Results.Find(EIK_LexToString(Owner)) : nullptr;
+		SearchResult.PingInMs = Stats && Stats->NumSamples > 0 ? FMath::RoundToInt(Stats->RttMs) : MAX_QUERY_PING;
+	}
+	Var_Sessions.StableSort([](const FSessionFindStruct& A, const FSessionFindStruct& B)
+	{
+		return A.SessionResult.OnlineResult.PingInMs < B.SessionResult.OnlineResult.PingInMs;
+	});
+	Finish(true);
+}
+
+void UEIK_CalculatePingForSessions_AsyncFunction::Finish(bool bSuccess)
+{
+	if (bSuccess)
+	{
+		OnSuccess.Broadcast(Var_Sessions);
+	}
+	else
+	{
+		OnFailure.Broadcast(Var_Sessions);
+	}
+	SetReadyToDestroy();
+#if ENGINE_MAJOR_VERSION == 5
+	MarkAsGarbage();
+#else
+	MarkPendingKill();
+#endif
+}
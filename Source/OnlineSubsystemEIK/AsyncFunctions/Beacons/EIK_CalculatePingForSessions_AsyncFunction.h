@@ -0,0 +1,44 @@
+﻿// Copyright (c) 2024 Betide Studio. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintAsyncActionBase.h"
+#include "Runtime/Launch/Resources/Version.h"
+#include "Engine/World.h"
+#include "OnlineSubsystemEIK/Subsystem/EIK_Subsystem.h"
+#include "EIK_CalculatePingForSessions_AsyncFunction.generated.h"
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FEIK_OnCalculatePingForSessionsComplete, const TArray<FSessionFindStruct>&, Sessions);
+
+/**
+ * Measures the latency to the hosts of many sessions at once over EOS P2P, without a beacon connection per host.
+ * Returns the sessions sorted by ping, with hosts that couldn't be measured (e.g. dedicated servers) at the end.
+ */
+UCLASS()
+class ONLINESUBSYSTEMEIK_API UEIK_CalculatePingForSessions_AsyncFunction : public UBlueprintAsyncActionBase
+{
+	GENERATED_BODY()
+
+public:
+
+	UFUNCTION(BlueprintCallable, Category = "EOS Integration Kit | Beacons | Ping", meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject", AdvancedDisplay = "NumSamples"), DisplayName = "Calculate Ping For Sessions")
+	static UEIK_CalculatePingForSessions_AsyncFunction* CalculatePingForSessions(TArray<FSessionFindStruct> Sessions, UObject* WorldContextObject, int32 NumSamples = 5);
+
+	UPROPERTY(BlueprintAssignable, Category = "EOS Integration Kit | Beacons | Ping")
+	FEIK_OnCalculatePingForSessionsComplete OnSuccess;
+
+	UPROPERTY(BlueprintAssignable, Category = "EOS Integration Kit | Beacons | Ping")
+	FEIK_OnCalculatePingForSessionsComplete OnFailure;
+
+private:
+	virtual void Activate() override;
+	void OnProbeComplete(const TMap<FString, struct FEOSPingStats>& Results);
+	void Finish(bool bSuccess);
+
+	TArray<FSessionFindStruct> Var_Sessions;
+	int32 Var_NumSamples;
+
+	UPROPERTY()
+	UObject* WorldContextObject;
+};
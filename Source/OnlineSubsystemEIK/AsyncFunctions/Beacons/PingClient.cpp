@@ -2,6 +2,7 @@
 
 #include "PingClient.h"
 
+#include "EIKSettings.h"
 #include "OnlineSubsystemUtils.h"
 #include "Interfaces/OnlineSessionInterface.h"
 #include "Online/OnlineSessionNames.h"
@@ -24,7 +25,9 @@ void APingClient::OnFailure()
 void APingClient::ClientPingBegin_Implementation()
 {
 	UE_LOG(LogPingClient, Log, TEXT("APingClient::ClientPingBegin_Implementation"));
-	PingBeginTime = FDateTime::Now().GetTicks();
+	NumPingSamples = FMath::Max(UEIKSettings::GetSettings().BeaconPingSamples, 1);
+	PingSamples.Reset();
+	PingBeginCycles = FPlatformTime::Cycles64();
 	ServerPong();
 }
 
@@ -42,8 +45,16 @@ void APingClient::ServerPong_Implementation()
 void APingClient::ClientPingEnd_Implementation()
 {
 	UE_LOG(LogPingClient, Log, TEXT("APingClient::ClientPingEnd_Implementation"));
-	int64 PingTime = FDateTime::Now().GetTicks() - PingBeginTime;
-	PingMS = (int32)(PingTime / 10000);
+	PingSamples.Add(FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - PingBeginCycles));
+	if (PingSamples.Num() < NumPingSamples)
+	{
+		// Keep sampling over the connection we already have instead of reconnecting per ping
+		PingBeginCycles = FPlatformTime::Cycles64();
+		ServerPong();
+		return;
+	}
+	PingSamples.Sort();
+	PingMS = FMath::RoundToInt(PingSamples[PingSamples.Num() / 2]);
 	UE_LOG(LogPingClient, Log, TEXT("Ping Complete: %d ms"), PingMS);
 	OnPingComplete.ExecuteIfBound(PingMS, true);
 	DestroyBeacon();
@@ -42,7 +42,11 @@ public:
 	void Disconnect();
 
 	FEIK_PingComplete OnPingComplete;
+
+	/** Round trips measured over the one connection, the reported ping is their median. Set from BeaconPingSamples in the EIK settings */
+	int32 NumPingSamples = 5;
 protected:
-	int64 PingBeginTime;
+	uint64 PingBeginCycles;
 	int32 PingMS;
+	TArray<double> PingSamples;
 };
\ No newline at end of file
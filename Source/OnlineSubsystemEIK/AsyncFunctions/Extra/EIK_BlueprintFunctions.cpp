@@ -27,7 +27,7 @@ FString UEIK_BlueprintFunctions::GetEpicAccountId(UObject* Context)
 		{
 			return FString();
 		}
-		if(const IOnlineSubsystem *SubsystemRef = IOnlineSubsystem::Get("EIK"))
+		if(const IOnlineSubsystem *SubsystemRef = FOnlineSubsystemEOS::GetDefaultInstance())
 		{
 			if(const IOnlineIdentityPtr IdentityPointerRef = SubsystemRef->GetIdentityInterface())
 			{
@@ -104,7 +104,7 @@ TArray<FName> UEIK_BlueprintFunctions::GetAllCurrentSessionNames(UObject* Contex
 		{
 			return TArray<FName>();
 		}
-		if(	IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+		if(	IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 		{
 			if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 			{
@@ -128,7 +128,7 @@ FString UEIK_BlueprintFunctions::GetProductUserID(UObject* Context)
 		{
 			return FString();
 		}
-		if(const IOnlineSubsystem *SubsystemRef = IOnlineSubsystem::Get("EIK"))
+		if(const IOnlineSubsystem *SubsystemRef = FOnlineSubsystemEOS::GetDefaultInstance())
 		{
 			if(const IOnlineIdentityPtr IdentityPointerRef = SubsystemRef->GetIdentityInterface())
 			{
@@ -184,7 +184,7 @@ IVoiceChatUser* UEIK_BlueprintFunctions::GetLobbyVoiceChat(UObject* Context)
 			return nullptr;
 		}
 
-		IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK");
+		IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance();
 		if (!OnlineSub)
 		{
 			UE_LOG(LogEIK, Error, TEXT("UEIK_BlueprintFunctions::GetLobbyVoiceChat: OnlineSubsystem is null"));
@@ -220,7 +220,7 @@ bool UEIK_BlueprintFunctions::MuteLobbyVoiceChat(UObject* Context, bool bMute)
 {
 	if(GetLobbyVoiceChat(Context))
 	{
-		IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK");
+		IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance();
 		if (!OnlineSub)
 		{
 			UE_LOG(LogEIK, Error, TEXT("UEIK_BlueprintFunctions::MuteLobbyVoiceChat: OnlineSubsystem is null"));
@@ -244,7 +244,7 @@ bool UEIK_BlueprintFunctions::IsLobbyVoiceChatMuted(UObject* Context)
 {
 	if(GetLobbyVoiceChat(Context))
 	{
-		IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK");
+		IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance();
 		if (!OnlineSub)
 		{
 			UE_LOG(LogEIK, Error, TEXT("UEIK_BlueprintFunctions::IsLobbyVoiceChatMuted: OnlineSubsystem is null"));
@@ -326,7 +326,7 @@ bool UEIK_BlueprintFunctions::SetLobbyVoiceChatInputVolume(UObject* Context, flo
 {
 	if(GetLobbyVoiceChat(Context))
 	{
-		IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK");
+		IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance();
 		if (!OnlineSub)
 		{
 			UE_LOG(LogEIK, Error, TEXT("UEIK_BlueprintFunctions::IsLobbyVoiceChatMuted: OnlineSubsystem is null"));
@@ -376,7 +376,7 @@ float UEIK_BlueprintFunctions::GetLobbyPlayerVoiceChatVolume(UObject* Context, F
 
 bool UEIK_BlueprintFunctions::ShowFriendsList()
 {
-	const IOnlineSubsystem* OnlineSubsystem = IOnlineSubsystem::Get("EIK"); // Get the Online Subsystem
+	const IOnlineSubsystem* OnlineSubsystem = FOnlineSubsystemEOS::GetDefaultInstance(); // Get the Online Subsystem
 	if (OnlineSubsystem != nullptr)
 	{
 		const IOnlineExternalUIPtr ExternalUI = OnlineSubsystem->GetExternalUIInterface();        
@@ -401,7 +401,7 @@ FEIKUniqueNetId UEIK_BlueprintFunctions::MakeEIKUniqueNetId(FString EpicAccountI
 	{
 		return FEIKUniqueNetId();
 	}
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (IOnlineIdentityPtr IdentityInterface = OnlineSub->GetIdentityInterface())
 		{
@@ -421,7 +421,7 @@ FEIKUniqueNetId UEIK_BlueprintFunctions::MakeEIKUniqueNetId(FString EpicAccountI
 
 bool UEIK_BlueprintFunctions::AcceptSessionInvite(FString InviteId, FString LocalUserId, FString InviterUserId)
 {
-	if(	IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if(	IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -436,7 +436,7 @@ bool UEIK_BlueprintFunctions::AcceptSessionInvite(FString InviteId, FString Loca
 
 bool UEIK_BlueprintFunctions::RejectSessionInvite(FString InviteId, FString LocalUserId)
 {
-	if(	IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if(	IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -454,7 +454,7 @@ bool UEIK_BlueprintFunctions::RejectSessionInvite(FString InviteId, FString Loca
 
 bool UEIK_BlueprintFunctions::StartSession(FName SessionName)
 {
-	if(const IOnlineSubsystem *SubsystemRef = IOnlineSubsystem::Get("EIK"))
+	if(const IOnlineSubsystem *SubsystemRef = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if(const IOnlineSessionPtr SessionPtrRef = SubsystemRef->GetSessionInterface())
 		{
@@ -476,7 +476,7 @@ bool UEIK_BlueprintFunctions::RegisterPlayer(FName SessionName,FEIKUniqueNetId P
 		UE_LOG(LogEIK, Error, TEXT("UEIK_BlueprintFunctions::RegisterPlayer: PlayerId.UniqueNetId is not valid"));
 		return false;
 	}
-	if(const IOnlineSubsystem *SubsystemRef = IOnlineSubsystem::Get("EIK"))
+	if(const IOnlineSubsystem *SubsystemRef = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if(const IOnlineSessionPtr SessionPtrRef = SubsystemRef->GetSessionInterface())
 		{
@@ -502,7 +502,7 @@ bool UEIK_BlueprintFunctions::UnRegisterPlayer(FName SessionName, FEIKUniqueNetI
 		return false;
 	}
 	
-	if(const IOnlineSubsystem *SubsystemRef = IOnlineSubsystem::Get("EIK"))
+	if(const IOnlineSubsystem *SubsystemRef = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if(const IOnlineSessionPtr SessionPtrRef = SubsystemRef->GetSessionInterface())
 		{
@@ -517,7 +517,7 @@ bool UEIK_BlueprintFunctions::UnRegisterPlayer(FName SessionName, FEIKUniqueNetI
 
 bool UEIK_BlueprintFunctions::EndSession(FName SessionName)
 {
-	if(const IOnlineSubsystem *SubsystemRef = IOnlineSubsystem::Get("EIK"))
+	if(const IOnlineSubsystem *SubsystemRef = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if(const IOnlineSessionPtr SessionPtrRef = SubsystemRef->GetSessionInterface())
 		{
@@ -546,7 +546,7 @@ bool UEIK_BlueprintFunctions::IsInSession(FName SessionName,FEIKUniqueNetId Play
 		UE_LOG(LogEIK, Error, TEXT("UEIK_BlueprintFunctions::IsInSession: PlayerId.UniqueNetId is not valid"));
 		return false;
 	}
-	if(const IOnlineSubsystem *SubsystemRef = IOnlineSubsystem::Get("EIK"))
+	if(const IOnlineSubsystem *SubsystemRef = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if(const IOnlineSessionPtr SessionPtrRef = SubsystemRef->GetSessionInterface())
 		{
@@ -559,7 +559,7 @@ bool UEIK_BlueprintFunctions::IsInSession(FName SessionName,FEIKUniqueNetId Play
 FString UEIK_BlueprintFunctions::GetPlayerNickname(const int32 LocalUserNum)
 {
 	FString Nickname;
-	if(const IOnlineSubsystem *SubsystemRef = IOnlineSubsystem::Get("EIK"))
+	if(const IOnlineSubsystem *SubsystemRef = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if(const IOnlineIdentityPtr IdentityPointerRef = SubsystemRef->GetIdentityInterface())
 		{
@@ -581,7 +581,7 @@ FString UEIK_BlueprintFunctions::GetPlayerNickname(const int32 LocalUserNum)
 
 EEIK_LoginStatus UEIK_BlueprintFunctions::GetLoginStatus(const int32 LocalUserNum)
 {
-	if(const IOnlineSubsystem *SubsystemRef = IOnlineSubsystem::Get("EIK"))
+	if(const IOnlineSubsystem *SubsystemRef = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if(const IOnlineIdentityPtr IdentityPointerRef = SubsystemRef->GetIdentityInterface())
 		{
@@ -625,7 +625,7 @@ FString UEIK_BlueprintFunctions::GenerateSessionCode(int32 CodeLength)
 
 bool UEIK_BlueprintFunctions::IsEIKActive()
 {
-	if (const IOnlineSubsystem* OnlineSubsystem = IOnlineSubsystem::Get("EIK"))
+	if (const IOnlineSubsystem* OnlineSubsystem = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		return true;
 	}
@@ -910,7 +910,7 @@ FDateTime UEIK_BlueprintFunctions::ConvertPosixTimeToDateTime(int64 PosixTime)
 
 FString UEIK_BlueprintFunctions::GetResolvedConnectString(FName SessionName)
 {
-	if (const IOnlineSubsystem* SubsystemRef = IOnlineSubsystem::Get("EIK"))
+	if (const IOnlineSubsystem* SubsystemRef = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if(const IOnlineSessionPtr SessionPtrRef = SubsystemRef->GetSessionInterface())
 		{
@@ -928,7 +928,7 @@ FString UEIK_BlueprintFunctions::GetResolvedConnectString(FName SessionName)
 
 bool UEIK_BlueprintFunctions::GetAutoLoginAttemptedStatus()
 {
-	if(	IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if(	IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -944,7 +944,7 @@ bool UEIK_BlueprintFunctions::GetAutoLoginAttemptedStatus()
 
 bool UEIK_BlueprintFunctions::GetAutoLoginInProgressStatus()
 {
-	if(	IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if(	IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
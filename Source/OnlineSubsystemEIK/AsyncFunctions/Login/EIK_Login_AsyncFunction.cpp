@@ -2,6 +2,7 @@
 
 
 #include "EIK_Login_AsyncFunction.h"
+#include "OnlineSubsystemEOS.h"
 
 #include "EIKSettings.h"
 #include "Online.h"
@@ -24,7 +25,7 @@ UEIK_Login_AsyncFunction* UEIK_Login_AsyncFunction::LoginUsingConnectInterface(T
 void UEIK_Login_AsyncFunction::Activate()
 {
 	Super::Activate();
-	if(const IOnlineSubsystem *SubsystemRef = IOnlineSubsystem::Get("EIK"))
+	if(const IOnlineSubsystem *SubsystemRef = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if(const IOnlineIdentityPtr IdentityPointerRef = SubsystemRef->GetIdentityInterface())
 		{
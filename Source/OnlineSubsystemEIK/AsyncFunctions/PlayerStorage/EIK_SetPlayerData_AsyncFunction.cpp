@@ -2,6 +2,8 @@
 
 
 #include "EIK_SetPlayerData_AsyncFunction.h"
+#include "OnlineSubsystemEOS.h"
+#include "EIKSettings.h"
 
 #include "OnlineSubsystem.h"
 #include "Interfaces/OnlineIdentityInterface.h"
@@ -26,7 +28,7 @@ void UEIK_SetPlayerData_AsyncFunction::SetPlayerData()
 {
 	if(DataToSave.Num() > 0)
 	{
-		if(const IOnlineSubsystem *SubsystemRef = IOnlineSubsystem::Get("EIK"))
+		if(const IOnlineSubsystem *SubsystemRef = FOnlineSubsystemEOS::GetDefaultInstance())
 		{
 			if(const IOnlineIdentityPtr IdentityPointerRef = SubsystemRef->GetIdentityInterface())
 			{
@@ -44,7 +46,7 @@ void UEIK_SetPlayerData_AsyncFunction::SetPlayerData()
 					}
 					const TSharedPtr<const FUniqueNetId> UserIDRef = IdentityPointerRef->GetUniquePlayerId(0).ToSharedRef();
 					CloudPointerRef->OnWriteUserFileCompleteDelegates.AddUObject(this, &UEIK_SetPlayerData_AsyncFunction::OnWriteFileComplete);
-					CloudPointerRef->WriteUserFile(*UserIDRef,FileName,DataToSave);
+					CloudPointerRef->WriteUserFile(*UserIDRef,FileName,DataToSave,GetDefault<UEIKSettings>()->bCompressPlayerData);
 				}
 				else
 				{
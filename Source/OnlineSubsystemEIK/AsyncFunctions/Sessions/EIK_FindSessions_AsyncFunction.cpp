@@ -2,6 +2,7 @@
 
 
 #include "EIK_FindSessions_AsyncFunction.h"
+#include "OnlineSubsystemEOS.h"
 #include "OnlineSubsystemEIK/Subsystem/EIK_Subsystem.h"
 #if ENGINE_MAJOR_VERSION == 5
 #include "Online/OnlineSessionNames.h"
@@ -29,7 +30,7 @@ void UEIK_FindSessions_AsyncFunction::Activate()
 
 void UEIK_FindSessions_AsyncFunction::FindSession()
 {
-	if(const IOnlineSubsystem *SubsystemRef = IOnlineSubsystem::Get("EIK"))
+	if(const IOnlineSubsystem *SubsystemRef = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if(const IOnlineSessionPtr SessionPtrRef = SubsystemRef->GetSessionInterface())
 		{
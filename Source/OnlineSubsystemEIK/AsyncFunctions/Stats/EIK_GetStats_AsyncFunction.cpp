@@ -2,6 +2,7 @@
 
 
 #include "EIK_GetStats_AsyncFunction.h"
+#include "OnlineSubsystemEOS.h"
 
 #include "OnlineError.h"
 #include "OnlineStatsEOS.h"
@@ -22,7 +23,7 @@ void UEIK_GetStats_AsyncFunction::Activate()
 
 void UEIK_GetStats_AsyncFunction::GetStats()
 {
-	if(const IOnlineSubsystem *SubsystemRef = IOnlineSubsystem::Get("EIK"))
+	if(const IOnlineSubsystem *SubsystemRef = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if(const IOnlineIdentityPtr IdentityPointerRef = SubsystemRef->GetIdentityInterface())
 		{
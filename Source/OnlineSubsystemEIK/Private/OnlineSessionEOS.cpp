@@ -7,6 +7,8 @@
 #include "OnlineSubsystemEOSPrivate.h"
 #include "OnlineSubsystemEOSTypes.h"
 #include "UserManagerEOS.h"
+#include "OnlineStatsEOS.h"
+#include "PingServiceEOS.h"
 #include "OnlineSubsystemUtils.h"
 #include "OnlineAsyncTaskManager.h"
 #include "SocketSubsystemEIK.h"
@@ -556,6 +558,12 @@ void FOnlineSessionEOS::Init(const FString& InBucketId)
 			GConfig->GetBool(TEXT("/Script/SocketSubsystemEOS.NetDriverEOSBase"), TEXT("bIsUsingP2PSockets"), bIsUsingP2PSockets, GEngineIni);
 		}
 	}
+
+	const FEOSSettings Settings = UEIKSettings::GetSettings();
+	SessionAttributeCache.SetMaxEntries(Settings.MaxCachedAttributeResults);
+	LobbyAttributeCache.SetMaxEntries(Settings.MaxCachedAttributeResults);
+	PlayerRegistrationBatchWindowSeconds = FMath::Max(Settings.PlayerRegistrationBatchWindowSeconds, 0.f);
+	MaxPlayersPerRegistrationRequest = FMath::Clamp(Settings.MaxPlayersPerRegistrationRequest, 1, EOS_SESSIONS_MAXREGISTEREDPLAYERS);
 }
 
 /**
@@ -1818,6 +1826,9 @@ bool FOnlineSessionEOS::EndSession(FName SessionName)
 		// Can't end a match that isn't in progress
 		if (Session->SessionState == EOnlineSessionState::InProgress)
 		{
+			// Stats accumulated during the match are ingested now rather than on the next flush interval
+			EOSSubsystem->StatsInterfacePtr->FlushStats();
+
 			if (!Session->SessionSettings.bIsLANMatch)
 			{
 				if (Session->SessionSettings.bUseLobbiesIfAvailable)
@@ -1943,6 +1954,9 @@ bool FOnlineSessionEOS::DestroySession(FName SessionName, const FOnDestroySessio
 		{
 			if (!Session->SessionSettings.bIsLANMatch)
 			{
+				// Players queued for this session still go out before it is destroyed
+				FlushPlayerRegistrations(SessionName);
+
 				if (Session->SessionState == EOnlineSessionState::InProgress)
 				{
 					if (Session->SessionSettings.bUseLobbiesIfAvailable)
@@ -2258,6 +2272,258 @@ void FOnlineSessionEOS::AddLobbySearchAttribute(EOS_HLobbySearch LobbySearchHand
 	}
 }
 
+void FEOSDecodedAttributes::ApplyTo(FOnlineSession& OutSession) const
+{
+	if (NumPublicConnections.IsSet())
+	{
+		OutSession.SessionSettings.NumPublicConnections = NumPublicConnections.GetValue();
+	}
+	if (NumPrivateConnections.IsSet())
+	{
+		OutSession.SessionSettings.NumPrivateConnections = NumPrivateConnections.GetValue();
+	}
+	if (OwningUserId.IsValid())
+	{
+		OutSession.OwningUserId = OwningUserId;
+	}
+	if (OwningUserName.IsSet())
+	{
+		OutSession.OwningUserName = OwningUserName.GetValue();
+	}
+	if (bAntiCheatProtected.IsSet())
+	{
+		OutSession.SessionSettings.bAntiCheatProtected = bAntiCheatProtected.GetValue();
+	}
+	if (bUsesStats.IsSet())
+	{
+		OutSession.SessionSettings.bUsesStats = bUsesStats.GetValue();
+	}
+	if (bIsDedicated.IsSet())
+	{
+		OutSession.SessionSettings.bIsDedicated = bIsDedicated.GetValue();
+	}
+	if (BuildUniqueId.IsSet())
+	{
+		OutSession.SessionSettings.BuildUniqueId = BuildUniqueId.GetValue();
+	}
+	ApplyTo(OutSession.SessionSettings.Settings);
+}
+
+void FEOSDecodedAttributes::ApplyTo(FSessionSettings& OutSettings) const
+{
+	for (const TPair<FName, FOnlineSessionSetting>& Setting : Settings)
+	{
+		OutSettings.Add(Setting.Key, Setting.Value);
+	}
+}
+
+FEOSAttributeSchema::FEOSAttributeSchema(bool bWithSessionFields)
+{
+	if (bWithSessionFields)
+	{
+		Register("NumPublicConnections", EField::NumPublicConnections);
+		Register("NumPrivateConnections", EField::NumPrivateConnections);
+		Register("OwningUserId", EField::OwningUserId);
+		Register("OwningUserName", EField::OwningUserName);
+		Register("bAntiCheatProtected", EField::bAntiCheatProtected);
+		Register("bUsesStats", EField::bUsesStats);
+		Register("bIsDedicated", EField::bIsDedicated);
+		Register("BuildUniqueId", EField::BuildUniqueId);
+	}
+}
+
+uint32 FEOSAttributeSchema::FKeyFuncs::GetKeyHash(const char* Key)
+{
+	// Hashes the upper cased key so it agrees with the case insensitive Matches
+	uint32 Hash = 0;
+	for (const char* Char = Key; *Char; ++Char)
+	{
+		Hash = Hash * 31 + (uint8)FCharAnsi::ToUpper(*Char);
+	}
+	return Hash;
+}
+
+void FEOSAttributeSchema::Register(const char* Key, EField Field)
+{
+	const int32 Length = FCStringAnsi::Strlen(Key);
+	TUniquePtr<char[]> OwnedKey = MakeUnique<char[]>(Length + 1);
+	FMemory::Memcpy(OwnedKey.Get(), Key, Length + 1);
+
+	FEntry Entry;
+	Entry.Field = Field;
+	Entry.SettingName = FName(UTF8_TO_TCHAR(Key));
+	Entries.Add(OwnedKey.Get(), Entry);
+	KeyStorage.Add(MoveTemp(OwnedKey));
+}
+
+const FEOSAttributeSchema::FEntry& FEOSAttributeSchema::FindOrAdd(const char* Key)
+{
+	if (const FEntry* Entry = Entries.Find(Key))
+	{
+		return *Entry;
+	}
+
+	Register(Key, EField::Setting);
+	return Entries.FindChecked(Key);
+}
+
+template<typename AttributeDataType>
+void FEOSAttributeSchema::Decode(const AttributeDataType& Data, FEOSDecodedAttributes& OutDecoded)
+{
+	const FEntry& Entry = FindOrAdd(Data.Key);
+	switch (Entry.Field)
+	{
+		case EField::NumPublicConnections:
+		{
+			OutDecoded.NumPublicConnections = (int32)Data.Value.AsInt64;
+			break;
+		}
+		case EField::NumPrivateConnections:
+		{
+			OutDecoded.NumPrivateConnections = (int32)Data.Value.AsInt64;
+			break;
+		}
+		case EField::OwningUserId:
+		{
+			OutDecoded.OwningUserId = FUniqueNetIdEOSRegistry::FindOrAdd(UTF8_TO_TCHAR(Data.Value.AsUtf8));
+			break;
+		}
+		case EField::OwningUserName:
+		{
+			OutDecoded.OwningUserName = FString(UTF8_TO_TCHAR(Data.Value.AsUtf8));
+			break;
+		}
+		case EField::bAntiCheatProtected:
+		{
+			OutDecoded.bAntiCheatProtected = Data.Value.AsBool == EOS_TRUE;
+			break;
+		}
+		case EField::bUsesStats:
+		{
+			OutDecoded.bUsesStats = Data.Value.AsBool == EOS_TRUE;
+			break;
+		}
+		case EField::bIsDedicated:
+		{
+			OutDecoded.bIsDedicated = Data.Value.AsBool == EOS_TRUE;
+			break;
+		}
+		case EField::BuildUniqueId:
+		{
+			OutDecoded.BuildUniqueId = (int32)Data.Value.AsInt64;
+			break;
+		}
+		// Handle FOnlineSessionSetting settings
+		case EField::Setting:
+		{
+			FOnlineSessionSetting Setting;
+			switch (Data.ValueType)
+			{
+				case EOS_ESessionAttributeType::EOS_SAT_Boolean:
+				{
+					Setting.Data.SetValue(Data.Value.AsBool == EOS_TRUE);
+					break;
+				}
+				case EOS_ESessionAttributeType::EOS_SAT_Int64:
+				{
+					Setting.Data.SetValue(int64(Data.Value.AsInt64));
+					break;
+				}
+				case EOS_ESessionAttributeType::EOS_SAT_Double:
+				{
+					Setting.Data.SetValue(Data.Value.AsDouble);
+					break;
+				}
+				case EOS_ESessionAttributeType::EOS_SAT_String:
+				{
+					Setting.Data.SetValue(UTF8_TO_TCHAR(Data.Value.AsUtf8));
+					break;
+				}
+			}
+			OutDecoded.Settings.Emplace(Entry.SettingName, MoveTemp(Setting));
+			break;
+		}
+	}
+}
+
+template<typename AttributeDataType>
+uint32 FEOSAttributeSchema::Fingerprint(const AttributeDataType& Data, uint32 Crc)
+{
+	Crc = FCrc::MemCrc32(Data.Key, FCStringAnsi::Strlen(Data.Key), Crc);
+	const uint8 ValueType = (uint8)Data.ValueType;
+	Crc = FCrc::MemCrc32(&ValueType, sizeof(ValueType), Crc);
+	switch (Data.ValueType)
+	{
+		case EOS_ESessionAttributeType::EOS_SAT_Boolean:
+		{
+			return FCrc::MemCrc32(&Data.Value.AsBool, sizeof(Data.Value.AsBool), Crc);
+		}
+		case EOS_ESessionAttributeType::EOS_SAT_Int64:
+		{
+			return FCrc::MemCrc32(&Data.Value.AsInt64, sizeof(Data.Value.AsInt64), Crc);
+		}
+		case EOS_ESessionAttributeType::EOS_SAT_Double:
+		{
+			return FCrc::MemCrc32(&Data.Value.AsDouble, sizeof(Data.Value.AsDouble), Crc);
+		}
+		case EOS_ESessionAttributeType::EOS_SAT_String:
+		{
+			// Terminator included so "ab" + "c" and "a" + "bc" don't collide across attributes
+			return Data.Value.AsUtf8 != nullptr ? FCrc::MemCrc32(Data.Value.AsUtf8, FCStringAnsi::Strlen(Data.Value.AsUtf8) + 1, Crc) : Crc;
+		}
+	}
+	return Crc;
+}
+
+const FEOSDecodedAttributes* FEOSAttributeCache::Find(const FString& Id, uint32 Fingerprint)
+{
+	FEntry* Entry = Entries.Find(Id);
+	if (Entry == nullptr || Entry->Fingerprint != Fingerprint)
+	{
+		return nullptr;
+	}
+
+	Entry->LastUsed = ++UseCounter;
+	return &Entry->Decoded;
+}
+
+const FEOSDecodedAttributes& FEOSAttributeCache::Add(const FString& Id, uint32 Fingerprint, FEOSDecodedAttributes&& Decoded)
+{
+	FEntry& Entry = Entries.FindOrAdd(Id);
+	Entry.Fingerprint = Fingerprint;
+	Entry.LastUsed = ++UseCounter;
+	Entry.Decoded = MoveTemp(Decoded);
+
+	// The entry we just used is the newest, so it is never the one evicted
+	Trim();
+	return Entries.FindChecked(Id).Decoded;
+}
+
+void FEOSAttributeCache::SetMaxEntries(int32 InMaxEntries)
+{
+	MaxEntries = FMath::Max(InMaxEntries, 1);
+	Trim();
+}
+
+void FEOSAttributeCache::Trim()
+{
+	while (Entries.Num() > MaxEntries)
+	{
+		const FString* OldestId = nullptr;
+		uint64 OldestUsed = MAX_uint64;
+		for (const TPair<FString, FEntry>& Pair : Entries)
+		{
+			if (Pair.Value.LastUsed < OldestUsed)
+			{
+				OldestId = &Pair.Key;
+				OldestUsed = Pair.Value.LastUsed;
+			}
+		}
+		// Copied, the key can't be passed by reference into the entry being removed
+		Entries.Remove(FString(*OldestId));
+	}
+}
+
 void FOnlineSessionEOS::CopySearchResult(EOS_HSessionDetails SessionHandle, EOS_SessionDetails_Info* SessionInfo, FOnlineSession& OutSession)
 {
 	OutSession.NumOpenPrivateConnections = SessionInfo->NumOpenPublicConnections;
@@ -2281,15 +2547,18 @@ void FOnlineSessionEOS::CopySearchResult(EOS_HSessionDetails SessionHandle, EOS_
 		}
 	}
 
-	CopyAttributes(SessionHandle, OutSession);
+	CopyAttributes(SessionHandle, SessionInfo->SessionId, OutSession);
 }
 
-void FOnlineSessionEOS::CopyAttributes(EOS_HSessionDetails SessionHandle, FOnlineSession& OutSession)
+void FOnlineSessionEOS::CopyAttributes(EOS_HSessionDetails SessionHandle, const char* SessionId, FOnlineSession& OutSession)
 {
 	EOS_SessionDetails_GetSessionAttributeCountOptions CountOptions = { };
 	CountOptions.ApiVersion = EOS_SESSIONDETAILS_GETSESSIONATTRIBUTECOUNT_API_LATEST;
 	int32 Count = EOS_SessionDetails_GetSessionAttributeCount(SessionHandle, &CountOptions);
 
+	TArray<EOS_SessionDetails_Attribute*, TInlineAllocator<32>> Attributes;
+	Attributes.Reserve(Count);
+	uint32 Fingerprint = 0;
 	for (int32 Index = 0; Index < Count; Index++)
 	{
 		EOS_SessionDetails_CopySessionAttributeByIndexOptions AttrOptions = { };
@@ -2300,72 +2569,27 @@ void FOnlineSessionEOS::CopyAttributes(EOS_HSessionDetails SessionHandle, FOnlin
 		EOS_EResult ResultCode = EOS_SessionDetails_CopySessionAttributeByIndex(SessionHandle, &AttrOptions, &Attribute);
 		if (ResultCode == EOS_EResult::EOS_Success)
 		{
-			FString Key = Attribute->Data->Key;
-			if (Key == TEXT("NumPublicConnections"))
-			{
-				// Adjust the public connections based upon this
-				OutSession.SessionSettings.NumPublicConnections = Attribute->Data->Value.AsInt64;
-			}
-			else if (Key == TEXT("NumPrivateConnections"))
-			{
-				// Adjust the private connections based upon this
-				OutSession.SessionSettings.NumPrivateConnections = Attribute->Data->Value.AsInt64;
-			}
-			else if (Key == TEXT("OwningUserId"))
-			{
-				OutSession.OwningUserId = FUniqueNetIdEOSRegistry::FindOrAdd(UTF8_TO_TCHAR(Attribute->Data->Value.AsUtf8));
-			}
-			else if (Key == TEXT("OwningUserName"))
-			{
-				OutSession.OwningUserName = UTF8_TO_TCHAR(Attribute->Data->Value.AsUtf8);
-			}
-			else if (Key == TEXT("bAntiCheatProtected"))
-			{
-				OutSession.SessionSettings.bAntiCheatProtected = Attribute->Data->Value.AsBool == EOS_TRUE;
-			}
-			else if (Key == TEXT("bUsesStats"))
-			{
-				OutSession.SessionSettings.bUsesStats = Attribute->Data->Value.AsBool == EOS_TRUE;
-			}
-			else if (Key == TEXT("bIsDedicated"))
-			{
-				OutSession.SessionSettings.bIsDedicated = Attribute->Data->Value.AsBool == EOS_TRUE;
-			}
-			else if (Key == TEXT("BuildUniqueId"))
-			{
-				OutSession.SessionSettings.BuildUniqueId = Attribute->Data->Value.AsInt64;
-			}
-			// Handle FOnlineSessionSetting settings
-			else
-			{
-				FOnlineSessionSetting Setting;
-				switch (Attribute->Data->ValueType)
-				{
-					case EOS_ESessionAttributeType::EOS_SAT_Boolean:
-					{
-						Setting.Data.SetValue(Attribute->Data->Value.AsBool == EOS_TRUE);
-						break;
-					}
-					case EOS_ESessionAttributeType::EOS_SAT_Int64:
-					{
-						Setting.Data.SetValue(int64(Attribute->Data->Value.AsInt64));
-						break;
-					}
-					case EOS_ESessionAttributeType::EOS_SAT_Double:
-					{
-						Setting.Data.SetValue(Attribute->Data->Value.AsDouble);
-						break;
-					}
-					case EOS_ESessionAttributeType::EOS_SAT_String:
-					{
-						Setting.Data.SetValue(UTF8_TO_TCHAR(Attribute->Data->Value.AsUtf8));
-						break;
-					}
-				}
-				OutSession.SessionSettings.Settings.Add(FName(Key), Setting);
-			}
+			Fingerprint = FEOSAttributeSchema::Fingerprint(*Attribute->Data, Fingerprint);
+			Attributes.Add(Attribute);
+		}
+	}
+
+	// Repeated searches mostly return the same sessions, only decode the ones whose attributes changed
+	const FString SessionIdStr = UTF8_TO_TCHAR(SessionId);
+	const FEOSDecodedAttributes* Decoded = SessionAttributeCache.Find(SessionIdStr, Fingerprint);
+	if (Decoded == nullptr)
+	{
+		FEOSDecodedAttributes NewDecoded;
+		for (EOS_SessionDetails_Attribute* Attribute : Attributes)
+		{
+			SessionAttributeSchema.Decode(*Attribute->Data, NewDecoded);
 		}
+		Decoded = &SessionAttributeCache.Add(SessionIdStr, Fingerprint, MoveTemp(NewDecoded));
+	}
+	Decoded->ApplyTo(OutSession);
 
+	for (EOS_SessionDetails_Attribute* Attribute : Attributes)
+	{
 		EOS_SessionDetails_Attribute_Release(Attribute);
 	}
 }
@@ -2384,6 +2608,8 @@ void FOnlineSessionEOS::AddSearchResult(EOS_HSessionDetails SessionHandle, const
 		SearchResult.Session.SessionInfo = MakeShareable(new FOnlineSessionInfoEOS(SessionInfo->HostAddress, FUniqueNetIdEOSSession::Create(SessionInfo->SessionId), SessionHandle));
 
 		CopySearchResult(SessionHandle, SessionInfo, SearchResult.Session);
+		// Hosts we've already probed get their measured latency, PingSearchResults measures the rest
+		SearchResult.PingInMs = EOSSubsystem->PingServicePtr->GetPingInMs(SearchResult, SearchResult.PingInMs);
 
 		EOS_SessionDetails_Info_Release(SessionInfo);
 	}
@@ -3080,7 +3306,13 @@ bool FOnlineSessionEOS::GetConnectStringFromSessionInfoForBeacon(TSharedPtr<FOnl
 
 bool FOnlineSessionEOS::PingSearchResults(const FOnlineSessionSearchResult& SearchResult)
 {
-	return false;
+	// Probes the host in the background, the result is picked up by later searches and by GetPingStats
+	const EOS_ProductUserId Owner = FPingServiceEOS::GetSearchResultOwner(SearchResult);
+	if (Owner == nullptr)
+	{
+		return false;
+	}
+	return EOSSubsystem->PingServicePtr->Probe(EOSSubsystem->UserManager->GetDefaultLocalUser(), { Owner }, EOSSubsystem->PingServicePtr->GetDefaultNumSamples(), FOnPingProbeComplete());
 }
 
 /** Get a resolved connection string from a session info */
@@ -3311,136 +3543,55 @@ bool FOnlineSessionEOS::RegisterPlayer(FName SessionName, const FUniqueNetId& Pl
 	return RegisterPlayers(SessionName, Players, bWasInvited);
 }
 
-#if ENGINE_MAJOR_VERSION == 5
-typedef TEOSCallback<EOS_Sessions_OnRegisterPlayersCallback, EOS_Sessions_RegisterPlayersCallbackInfo, FOnlineSessionEOS> FRegisterPlayersCallback;
-#else
-typedef TEOSCallback<EOS_Sessions_OnRegisterPlayersCallback, EOS_Sessions_RegisterPlayersCallbackInfo> FRegisterPlayersCallback;
-#endif
 bool FOnlineSessionEOS::RegisterPlayers(FName SessionName, const TArray< FUniqueNetIdRef >& Players, bool bWasInvited)
 {
-	bool bSuccess = false;
 	FNamedOnlineSession* Session = GetNamedSession(SessionName);
-	if (Session)
+	if (!Session)
 	{
-		if(bIsDedicatedServer || Session->bHosting)
-		{
-			TArray<EOS_ProductUserId> EOSIds;
-			EOSIds.Empty();
-			bSuccess = true;
-			bool bRegisterEOS = !Session->SessionSettings.bUseLobbiesIfAvailable;
-			const FUniqueNetIdRef& PlayerId = Players[0];
-			const FUniqueNetIdEOS& PlayerEOSId = FUniqueNetIdEOS::Cast(*PlayerId);
-			EOSIds.Add(PlayerEOSId.GetProductUserId());
-			Session->RegisteredPlayers.Add(PlayerId);
-			if (bRegisterEOS && EOSIds.Num() > 0)
-			{
-				EOSIds.Empty();
-				EOSIds.Add(PlayerEOSId.GetProductUserId());
-				EOS_Sessions_RegisterPlayersOptions Options;
-				Options.ApiVersion = EOS_SESSIONS_REGISTERPLAYERS_API_LATEST;
-				EOS_ProductUserId SinglePlayerId;
-				SinglePlayerId = PlayerEOSId.GetProductUserId();
-				if(!PlayerEOSId.ToString().Contains(EOS_ID_SEPARATOR))
-				{
-					SinglePlayerId = EOS_ProductUserId_FromString(TCHAR_TO_UTF8(*PlayerEOSId.ToString()));
-				}
-				Options.PlayersToRegister = &SinglePlayerId; 
-				Options.PlayersToRegisterCount = EOSIds.Num();
-				const FTCHARToUTF8 Utf8SessionName(*SessionName.ToString());
-				Options.SessionName = Utf8SessionName.Get();
-#if ENGINE_MAJOR_VERSION == 5
-				FRegisterPlayersCallback* CallbackObj = new FRegisterPlayersCallback(FOnlineSessionEOSWeakPtr(AsShared()));
-#else
-				FRegisterPlayersCallback* CallbackObj = new FRegisterPlayersCallback();
-#endif
-				CallbackObj->CallbackLambda = [this, SessionName, RegisteredPlayers = TArray<FUniqueNetIdRef>(Players)](const EOS_Sessions_RegisterPlayersCallbackInfo* Data)
-				{
-					bool bWasSuccessful = Data->ResultCode == EOS_EResult::EOS_Success || Data->ResultCode == EOS_EResult::EOS_NoChange;
-					TriggerOnRegisterPlayersCompleteDelegates(SessionName, RegisteredPlayers, bWasSuccessful);
-				};
-				EOS_Sessions_RegisterPlayers(EOSSubsystem->SessionsHandle, &Options, CallbackObj, CallbackObj->GetCallbackPtr());
-				for(int32 i=0; i<EOSIds.Num(); i++)
-				{
-					char PuidBuffer[256];
-					int32 BufferLen = 256;
-					EOS_ProductUserId_ToString(SinglePlayerId, PuidBuffer, &BufferLen );
-				}
-				return true;
-			}
-		}
-		else
-		{
-			UE_LOG_ONLINE_SESSION(Warning, TEXT("RegisterPlayers: Not the owner of the session (%s)"), *SessionName.ToString());
-		}
-
-		EOSSubsystem->ExecuteNextTick([this, SessionName, RegisteredPlayers = TArray<FUniqueNetIdRef>(Players), bSuccess]()
-		{
-			TriggerOnRegisterPlayersCompleteDelegates(SessionName, RegisteredPlayers, bSuccess);
-			UE_LOG_ONLINE_SESSION(Warning, TEXT("RegisterPlayers: Triggering completion delegates for session (%s) with success (%d)"), *SessionName.ToString(), bSuccess);
-		});
-
-		return true;
+		UE_LOG_ONLINE_SESSION(Warning, TEXT("RegisterPlayers: No game present to join for session (%s)"), *SessionName.ToString());
+		return false;
 	}
-	UE_LOG_ONLINE_SESSION(Warning, TEXT("RegisterPlayers: No game present to join for session (%s)"), *SessionName.ToString());
-	return false;
-}
 
-/*bool FOnlineSessionEOS::RegisterPlayers(FName SessionName, const TArray< FUniqueNetIdRef >& Players, bool bWasInvited)
-{
 	bool bSuccess = false;
-	FNamedOnlineSession* Session = GetNamedSession(SessionName);
-	if (Session)
+	TArray<FUniqueNetIdRef> CompletedPlayers(Players);
+	if (bIsDedicatedServer || Session->bHosting)
 	{
-		TArray<EOS_ProductUserId> EOSIds;
-		bSuccess = true;
-		bool bRegisterEOS = !Session->SessionSettings.bUseLobbiesIfAvailable;
-
-		for (int32 PlayerIdx=0; PlayerIdx<Players.Num(); PlayerIdx++)
+		// Players that are already registered are not sent to EOS again, their callers complete straight away
+		TArray<FUniqueNetIdRef> NewPlayers;
+		for (const FUniqueNetIdRef& PlayerId : Players)
 		{
-			const FUniqueNetIdRef& PlayerId = Players[PlayerIdx];
-			const FUniqueNetIdEOS& PlayerEOSId = FUniqueNetIdEOS::Cast(*PlayerId);
-
 			FUniqueNetIdMatcher PlayerMatch(*PlayerId);
-			Session->RegisteredPlayers.Add(PlayerId);
-			if (bRegisterEOS)
+			if (Session->RegisteredPlayers.IndexOfByPredicate(PlayerMatch) == INDEX_NONE)
 			{
-				EOSIds.Add(PlayerEOSId.GetProductUserId());
+				Session->RegisteredPlayers.Add(PlayerId);
+				NewPlayers.Add(PlayerId);
 			}
-			AddOnlineSessionMember(SessionName, PlayerId);
-			
 		}
 
-		if (bRegisterEOS && EOSIds.Num() > 0)
+		if (!Session->SessionSettings.bUseLobbiesIfAvailable && NewPlayers.Num() > 0)
 		{
-			EOS_Sessions_RegisterPlayersOptions Options = { };
-			Options.ApiVersion = EOS_SESSIONS_REGISTERPLAYERS_API_LATEST;
-			Options.PlayersToRegister = EOSIds.GetData();
-			Options.PlayersToRegisterCount = EOSIds.Num();
-			const FTCHARToUTF8 Utf8SessionName(*SessionName.ToString());
-			Options.SessionName = Utf8SessionName.Get();
-
-			FRegisterPlayersCallback* CallbackObj = new FRegisterPlayersCallback(FOnlineSessionEOSWeakPtr(AsShared()));
-			CallbackObj->CallbackLambda = [this, SessionName, RegisteredPlayers = TArray<FUniqueNetIdRef>(Players)](const EOS_Sessions_RegisterPlayersCallbackInfo* Data)
+			QueuePlayerRegistrations(SessionName, NewPlayers, true);
+			CompletedPlayers.RemoveAll([&NewPlayers](const FUniqueNetIdRef& PlayerId) { return NewPlayers.Contains(PlayerId); });
+			if (CompletedPlayers.Num() == 0)
 			{
-				bool bWasSuccessful = Data->ResultCode == EOS_EResult::EOS_Success || Data->ResultCode == EOS_EResult::EOS_NoChange;
-				TriggerOnRegisterPlayersCompleteDelegates(SessionName, RegisteredPlayers, bWasSuccessful);
-			};
-			EOS_Sessions_RegisterPlayers(EOSSubsystem->SessionsHandle, &Options, CallbackObj, CallbackObj->GetCallbackPtr());
-			return true;
+				return true;
+			}
 		}
+		bSuccess = true;
 	}
 	else
 	{
-		UE_LOG_ONLINE_SESSION(Warning, TEXT("No game present to join for session (%s)"), *SessionName.ToString());
+		UE_LOG_ONLINE_SESSION(Warning, TEXT("RegisterPlayers: Not the owner of the session (%s)"), *SessionName.ToString());
 	}
 
-	EOSSubsystem->ExecuteNextTick([this, SessionName, RegisteredPlayers = TArray<FUniqueNetIdRef>(Players), bSuccess]()
+	EOSSubsystem->ExecuteNextTick([this, SessionName, RegisteredPlayers = MoveTemp(CompletedPlayers), bSuccess]()
 	{
 		TriggerOnRegisterPlayersCompleteDelegates(SessionName, RegisteredPlayers, bSuccess);
+		UE_LOG_ONLINE_SESSION(Warning, TEXT("RegisterPlayers: Triggering completion delegates for session (%s) with success (%d)"), *SessionName.ToString(), bSuccess);
 	});
 
 	return true;
-}*/
+}
 
 bool FOnlineSessionEOS::UnregisterPlayer(FName SessionName, const FUniqueNetId& PlayerId)
 {
@@ -3448,58 +3599,28 @@ bool FOnlineSessionEOS::UnregisterPlayer(FName SessionName, const FUniqueNetId&
 	Players.Add(PlayerId.AsShared());
 	return UnregisterPlayers(SessionName, Players);
 }
-#if ENGINE_MAJOR_VERSION == 5
-typedef TEOSCallback<EOS_Sessions_OnUnregisterPlayersCallback, EOS_Sessions_UnregisterPlayersCallbackInfo, FOnlineSessionEOS> FUnregisterPlayersCallback;
-#else
-typedef TEOSCallback<EOS_Sessions_OnUnregisterPlayersCallback, EOS_Sessions_UnregisterPlayersCallbackInfo> FUnregisterPlayersCallback;
-#endif
+
 bool FOnlineSessionEOS::UnregisterPlayers(FName SessionName, const TArray< FUniqueNetIdRef >& Players)
 {
 	bool bSuccess = true;
 	FNamedOnlineSession* Session = GetNamedSession(SessionName);
 	if (Session)
 	{
-		TArray<EOS_ProductUserId> EOSIds;
-		bool bUnregisterEOS = !Session->SessionSettings.bUseLobbiesIfAvailable;
-		for (int32 PlayerIdx=0; PlayerIdx < Players.Num(); PlayerIdx++)
+		const bool bUnregisterEOS = !Session->SessionSettings.bUseLobbiesIfAvailable;
+		for (const FUniqueNetIdRef& PlayerId : Players)
 		{
-			const FUniqueNetIdRef& PlayerId = Players[PlayerIdx];
-			const FUniqueNetIdEOS& PlayerEOSId = FUniqueNetIdEOS::Cast(*PlayerId);
-			Session->RegisteredPlayers.Remove(PlayerId);
 			FUniqueNetIdMatcher PlayerMatch(*PlayerId);
-			int32 RegistrantIndex = Session->RegisteredPlayers.IndexOfByPredicate(PlayerMatch);
-			if (bUnregisterEOS)
+			const int32 RegistrantIndex = Session->RegisteredPlayers.IndexOfByPredicate(PlayerMatch);
+			if (RegistrantIndex != INDEX_NONE)
 			{
-				if(!PlayerEOSId.ToString().Contains(EOS_ID_SEPARATOR))
-				{
-					EOSIds.Add(EOS_ProductUserId_FromString(TCHAR_TO_UTF8(*PlayerEOSId.ToString())));
-				}
-				else
-				{
-					EOSIds.Add(PlayerEOSId.GetProductUserId());
-				}
+				Session->RegisteredPlayers.RemoveAtSwap(RegistrantIndex);
 			}
 			RemoveOnlineSessionMember(SessionName, PlayerId);
 		}
-		if (bUnregisterEOS && EOSIds.Num() > 0)
+
+		if (bUnregisterEOS && Players.Num() > 0)
 		{
-			EOS_Sessions_UnregisterPlayersOptions Options = { };
-			Options.ApiVersion = EOS_SESSIONS_UNREGISTERPLAYERS_API_LATEST;
-			Options.PlayersToUnregister = EOSIds.GetData();
-			Options.PlayersToUnregisterCount = EOSIds.Num();
-			const FTCHARToUTF8 Utf8SessionName(*SessionName.ToString());
-			Options.SessionName = Utf8SessionName.Get();
-#if ENGINE_MAJOR_VERSION == 5
-			FUnregisterPlayersCallback* CallbackObj = new FUnregisterPlayersCallback(FOnlineSessionEOSWeakPtr(AsShared()));
-#else
-			FUnregisterPlayersCallback* CallbackObj = new FUnregisterPlayersCallback();
-#endif
-			CallbackObj->CallbackLambda = [this, SessionName, UnregisteredPlayers = TArray<FUniqueNetIdRef>(Players)](const EOS_Sessions_UnregisterPlayersCallbackInfo* Data)
-			{
-				bool bWasSuccessful = Data->ResultCode == EOS_EResult::EOS_Success || Data->ResultCode == EOS_EResult::EOS_NoChange;
-				TriggerOnUnregisterPlayersCompleteDelegates(SessionName, UnregisteredPlayers, bWasSuccessful);
-			};
-			EOS_Sessions_UnregisterPlayers(EOSSubsystem->SessionsHandle, &Options, CallbackObj, CallbackObj->GetCallbackPtr());
+			QueuePlayerRegistrations(SessionName, Players, false);
 			return true;
 		}
 	}
@@ -3516,10 +3637,237 @@ bool FOnlineSessionEOS::UnregisterPlayers(FName SessionName, const TArray< FUniq
 	return true;
 }
 
+void FOnlineSessionEOS::QueuePlayerRegistrations(FName SessionName, const TArray<FUniqueNetIdRef>& Players, bool bRegister)
+{
+	FPendingPlayerRegistrations& Pending = PendingPlayerRegistrations.FindOrAdd(SessionName);
+	if (Pending.PlayersToRegister.Num() == 0 && Pending.PlayersToUnregister.Num() == 0)
+	{
+		Pending.FlushTime = FPlatformTime::Seconds() + PlayerRegistrationBatchWindowSeconds;
+	}
+
+	TArray<FUniqueNetIdRef>& Queue = bRegister ? Pending.PlayersToRegister : Pending.PlayersToUnregister;
+	TArray<FUniqueNetIdRef>& OppositeQueue = bRegister ? Pending.PlayersToUnregister : Pending.PlayersToRegister;
+	for (const FUniqueNetIdRef& PlayerId : Players)
+	{
+		FUniqueNetIdMatcher PlayerMatch(*PlayerId);
+		const int32 OppositeIndex = OppositeQueue.IndexOfByPredicate(PlayerMatch);
+		if (OppositeIndex != INDEX_NONE)
+		{
+			// A player that joins and leaves (or leaves and rejoins) within the window ends up where they started,
+			// so neither request is sent. Both callers still get their completion.
+			const FUniqueNetIdRef CancelledPlayerId = OppositeQueue[OppositeIndex];
+			OppositeQueue.RemoveAt(OppositeIndex);
+			EOSSubsystem->ExecuteNextTick([this, SessionName, CancelledPlayerId, PlayerId, bRegister]()
+			{
+				const TArray<FUniqueNetIdRef> RegisteredPlayers = { bRegister ? PlayerId : CancelledPlayerId };
+				const TArray<FUniqueNetIdRef> UnregisteredPlayers = { bRegister ? CancelledPlayerId : PlayerId };
+				TriggerOnRegisterPlayersCompleteDelegates(SessionName, RegisteredPlayers, true);
+				TriggerOnUnregisterPlayersCompleteDelegates(SessionName, UnregisteredPlayers, true);
+			});
+		}
+		else if (Queue.IndexOfByPredicate(PlayerMatch) == INDEX_NONE)
+		{
+			Queue.Add(PlayerId);
+		}
+		else
+		{
+			// Already queued by an earlier caller, the request is sent once but this caller still gets its completion
+			EOSSubsystem->ExecuteNextTick([this, SessionName, PlayerId, bRegister]()
+			{
+				const TArray<FUniqueNetIdRef> CompletedPlayers = { PlayerId };
+				if (bRegister)
+				{
+					TriggerOnRegisterPlayersCompleteDelegates(SessionName, CompletedPlayers, true);
+				}
+				else
+				{
+					TriggerOnUnregisterPlayersCompleteDelegates(SessionName, CompletedPlayers, true);
+				}
+			});
+		}
+	}
+
+	if (Queue.Num() >= MaxPlayersPerRegistrationRequest)
+	{
+		FlushPlayerRegistrations(SessionName);
+	}
+}
+
+void FOnlineSessionEOS::TickPlayerRegistrations()
+{
+	if (PendingPlayerRegistrations.Num() == 0)
+	{
+		return;
+	}
+
+	const double NowSeconds = FPlatformTime::Seconds();
+	TArray<FName, TInlineAllocator<4>> SessionsToFlush;
+	for (const TPair<FName, FPendingPlayerRegistrations>& Pending : PendingPlayerRegistrations)
+	{
+		if (NowSeconds >= Pending.Value.FlushTime)
+		{
+			SessionsToFlush.Add(Pending.Key);
+		}
+	}
+	for (const FName& SessionName : SessionsToFlush)
+	{
+		FlushPlayerRegistrations(SessionName);
+	}
+}
+
+void FOnlineSessionEOS::FlushPlayerRegistrations(FName SessionName)
+{
+	FPendingPlayerRegistrations Pending;
+	if (!PendingPlayerRegistrations.RemoveAndCopyValue(SessionName, Pending))
+	{
+		return;
+	}
+
+	// Unregister first so players leaving free their slots before backfill is registered
+	SendUnregisterPlayers(SessionName, Pending.PlayersToUnregister);
+	SendRegisterPlayers(SessionName, Pending.PlayersToRegister);
+}
+
+void FOnlineSessionEOS::DiscardPlayerRegistrations(FName SessionName)
+{
+	FPendingPlayerRegistrations Pending;
+	if (!PendingPlayerRegistrations.RemoveAndCopyValue(SessionName, Pending))
+	{
+		return;
+	}
+
+	UE_LOG_ONLINE_SESSION(Verbose, TEXT("Dropping %d queued register and %d queued unregister requests for removed session (%s)"), Pending.PlayersToRegister.Num(), Pending.PlayersToUnregister.Num(), *SessionName.ToString());
+	EOSSubsystem->ExecuteNextTick([this, SessionName, Pending = MoveTemp(Pending)]()
+	{
+		if (Pending.PlayersToUnregister.Num() > 0)
+		{
+			TriggerOnUnregisterPlayersCompleteDelegates(SessionName, Pending.PlayersToUnregister, false);
+		}
+		if (Pending.PlayersToRegister.Num() > 0)
+		{
+			TriggerOnRegisterPlayersCompleteDelegates(SessionName, Pending.PlayersToRegister, false);
+		}
+	});
+}
+
+/** Net ids created from a bare product user id string may not have the id resolved yet, those are parsed through the SDK */
+static EOS_ProductUserId GetProductUserIdForRegistration(const FUniqueNetIdRef& PlayerId)
+{
+	const FUniqueNetIdEOS& PlayerEOSId = FUniqueNetIdEOS::Cast(*PlayerId);
+	if (const EOS_ProductUserId ProductUserId = PlayerEOSId.GetProductUserId())
+	{
+		return ProductUserId;
+	}
+
+	const FString PlayerIdStr = PlayerEOSId.ToString();
+	if (!PlayerIdStr.Contains(EOS_ID_SEPARATOR))
+	{
+		return EOS_ProductUserId_FromString(TCHAR_TO_UTF8(*PlayerIdStr));
+	}
+	return nullptr;
+}
+
+#if ENGINE_MAJOR_VERSION == 5
+typedef TEOSCallback<EOS_Sessions_OnRegisterPlayersCallback, EOS_Sessions_RegisterPlayersCallbackInfo, FOnlineSessionEOS> FRegisterPlayersCallback;
+#else
+typedef TEOSCallback<EOS_Sessions_OnRegisterPlayersCallback, EOS_Sessions_RegisterPlayersCallbackInfo> FRegisterPlayersCallback;
+#endif
+void FOnlineSessionEOS::SendRegisterPlayers(FName SessionName, const TArray<FUniqueNetIdRef>& Players)
+{
+	const FTCHARToUTF8 Utf8SessionName(*SessionName.ToString());
+	for (int32 FirstIndex = 0; FirstIndex < Players.Num(); FirstIndex += MaxPlayersPerRegistrationRequest)
+	{
+		const int32 NumPlayers = FMath::Min(MaxPlayersPerRegistrationRequest, Players.Num() - FirstIndex);
+		TArray<FUniqueNetIdRef> BatchPlayers(Players.GetData() + FirstIndex, NumPlayers);
+		TArray<EOS_ProductUserId> EOSIds;
+		EOSIds.Reserve(NumPlayers);
+		for (const FUniqueNetIdRef& PlayerId : BatchPlayers)
+		{
+			EOSIds.Add(GetProductUserIdForRegistration(PlayerId));
+		}
+
+		EOS_Sessions_RegisterPlayersOptions Options = { };
+		Options.ApiVersion = EOS_SESSIONS_REGISTERPLAYERS_API_LATEST;
+		Options.PlayersToRegister = EOSIds.GetData();
+		Options.PlayersToRegisterCount = EOSIds.Num();
+		Options.SessionName = Utf8SessionName.Get();
+
+#if ENGINE_MAJOR_VERSION == 5
+		FRegisterPlayersCallback* CallbackObj = new FRegisterPlayersCallback(FOnlineSessionEOSWeakPtr(AsShared()));
+#else
+		FRegisterPlayersCallback* CallbackObj = new FRegisterPlayersCallback();
+#endif
+		CallbackObj->CallbackLambda = [this, SessionName, RegisteredPlayers = MoveTemp(BatchPlayers), EOSIds](const EOS_Sessions_RegisterPlayersCallbackInfo* Data)
+		{
+			const bool bWasSuccessful = Data->ResultCode == EOS_EResult::EOS_Success || Data->ResultCode == EOS_EResult::EOS_NoChange;
+			if (!bWasSuccessful)
+			{
+				UE_LOG_ONLINE_SESSION(Warning, TEXT("RegisterPlayers: Failed to register %d players with session (%s) error (%s)"), RegisteredPlayers.Num(), *SessionName.ToString(), *EIK_LexToString(Data->ResultCode));
+			}
+
+			const TArrayView<const EOS_ProductUserId> SanctionedPlayers(Data->SanctionedPlayers, Data->SanctionedPlayers ? Data->SanctionedPlayersCount : 0);
+			for (int32 PlayerIdx = 0; PlayerIdx < RegisteredPlayers.Num(); PlayerIdx++)
+			{
+				const bool bPlayerSuccessful = bWasSuccessful && !SanctionedPlayers.Contains(EOSIds[PlayerIdx]);
+				TriggerOnRegisterPlayersCompleteDelegates(SessionName, TArray<FUniqueNetIdRef>{ RegisteredPlayers[PlayerIdx] }, bPlayerSuccessful);
+			}
+		};
+		EOS_Sessions_RegisterPlayers(EOSSubsystem->SessionsHandle, &Options, CallbackObj, CallbackObj->GetCallbackPtr());
+	}
+}
+
+#if ENGINE_MAJOR_VERSION == 5
+typedef TEOSCallback<EOS_Sessions_OnUnregisterPlayersCallback, EOS_Sessions_UnregisterPlayersCallbackInfo, FOnlineSessionEOS> FUnregisterPlayersCallback;
+#else
+typedef TEOSCallback<EOS_Sessions_OnUnregisterPlayersCallback, EOS_Sessions_UnregisterPlayersCallbackInfo> FUnregisterPlayersCallback;
+#endif
+void FOnlineSessionEOS::SendUnregisterPlayers(FName SessionName, const TArray<FUniqueNetIdRef>& Players)
+{
+	const FTCHARToUTF8 Utf8SessionName(*SessionName.ToString());
+	for (int32 FirstIndex = 0; FirstIndex < Players.Num(); FirstIndex += MaxPlayersPerRegistrationRequest)
+	{
+		const int32 NumPlayers = FMath::Min(MaxPlayersPerRegistrationRequest, Players.Num() - FirstIndex);
+		TArray<FUniqueNetIdRef> BatchPlayers(Players.GetData() + FirstIndex, NumPlayers);
+		TArray<EOS_ProductUserId> EOSIds;
+		EOSIds.Reserve(NumPlayers);
+		for (const FUniqueNetIdRef& PlayerId : BatchPlayers)
+		{
+			EOSIds.Add(GetProductUserIdForRegistration(PlayerId));
+		}
+
+		EOS_Sessions_UnregisterPlayersOptions Options = { };
+		Options.ApiVersion = EOS_SESSIONS_UNREGISTERPLAYERS_API_LATEST;
+		Options.PlayersToUnregister = EOSIds.GetData();
+		Options.PlayersToUnregisterCount = EOSIds.Num();
+		Options.SessionName = Utf8SessionName.Get();
+
+#if ENGINE_MAJOR_VERSION == 5
+		FUnregisterPlayersCallback* CallbackObj = new FUnregisterPlayersCallback(FOnlineSessionEOSWeakPtr(AsShared()));
+#else
+		FUnregisterPlayersCallback* CallbackObj = new FUnregisterPlayersCallback();
+#endif
+		CallbackObj->CallbackLambda = [this, SessionName, UnregisteredPlayers = MoveTemp(BatchPlayers)](const EOS_Sessions_UnregisterPlayersCallbackInfo* Data)
+		{
+			const bool bWasSuccessful = Data->ResultCode == EOS_EResult::EOS_Success || Data->ResultCode == EOS_EResult::EOS_NoChange;
+			if (!bWasSuccessful)
+			{
+				UE_LOG_ONLINE_SESSION(Warning, TEXT("UnregisterPlayers: Failed to unregister %d players from session (%s) error (%s)"), UnregisteredPlayers.Num(), *SessionName.ToString(), *EIK_LexToString(Data->ResultCode));
+			}
+
+			for (const FUniqueNetIdRef& PlayerId : UnregisteredPlayers)
+			{
+				TriggerOnUnregisterPlayersCompleteDelegates(SessionName, TArray<FUniqueNetIdRef>{ PlayerId }, bWasSuccessful);
+			}
+		};
+		EOS_Sessions_UnregisterPlayers(EOSSubsystem->SessionsHandle, &Options, CallbackObj, CallbackObj->GetCallbackPtr());
+	}
+}
+
 void FOnlineSessionEOS::Tick(float DeltaTime)
 {
 	SCOPE_CYCLE_COUNTER(STAT_Session_Interface);
 	TickLanTasks(DeltaTime);
+	TickPlayerRegistrations();
 }
 
 void FOnlineSessionEOS::TickLanTasks(float DeltaTime)
@@ -4640,6 +4988,7 @@ void FOnlineSessionEOS::AddLobbySearchResult(const TSharedRef<FLobbyDetailsEOS>&
 		// We copy the lobby data and settings
 		LobbySearchResultsCache.Add(FString(LobbyDetailsInfo->LobbyId), LobbyDetails);
 		CopyLobbyData(LobbyDetails, LobbyDetailsInfo, SearchResult.Session, Callback);
+		SearchResult.PingInMs = EOSSubsystem->PingServicePtr->GetPingInMs(SearchResult, SearchResult.PingInMs);
 
 		EOS_LobbyDetails_Info_Release(LobbyDetailsInfo);
 
@@ -4690,7 +5039,7 @@ void FOnlineSessionEOS::CopyLobbyData(const TSharedRef<FLobbyDetailsEOS>& LobbyD
 	OutSession.SessionSettings.bAllowInvites = (bool)LobbyDetailsInfo->bAllowInvites;
 
 	// We copy the settings related to lobby attributes
-	CopyLobbyAttributes(LobbyDetails, OutSession);
+	CopyLobbyAttributes(LobbyDetails, LobbyDetailsInfo->LobbyId, OutSession);
 
 	// Then we copy the settings for all lobby members
 	EOS_LobbyDetails_GetMemberCountOptions CountOptions = { };
@@ -4743,7 +5092,7 @@ void FOnlineSessionEOS::CopyLobbyData(const TSharedRef<FLobbyDetailsEOS>& LobbyD
 	}
 }
 
-void FOnlineSessionEOS::CopyLobbyAttributes(const TSharedRef<FLobbyDetailsEOS>& LobbyDetails, FOnlineSession& OutSession)
+void FOnlineSessionEOS::CopyLobbyAttributes(const TSharedRef<FLobbyDetailsEOS>& LobbyDetails, const char* LobbyId, FOnlineSession& OutSession)
 {
 	// In this method we are updating/adding attributes, but not removing
 
@@ -4751,6 +5100,9 @@ void FOnlineSessionEOS::CopyLobbyAttributes(const TSharedRef<FLobbyDetailsEOS>&
 	CountOptions.ApiVersion = EOS_LOBBYDETAILS_GETATTRIBUTECOUNT_API_LATEST;
 	int32 Count = EOS_LobbyDetails_GetAttributeCount(LobbyDetails->LobbyDetailsHandle, &CountOptions);
 
+	TArray<EOS_Lobby_Attribute*, TInlineAllocator<32>> Attributes;
+	Attributes.Reserve(Count);
+	uint32 Fingerprint = 0;
 	for (int32 Index = 0; Index < Count; Index++)
 	{
 		EOS_LobbyDetails_CopyAttributeByIndexOptions AttrOptions = { };
@@ -4761,71 +5113,26 @@ void FOnlineSessionEOS::CopyLobbyAttributes(const TSharedRef<FLobbyDetailsEOS>&
 		EOS_EResult ResultCode = EOS_LobbyDetails_CopyAttributeByIndex(LobbyDetails->LobbyDetailsHandle, &AttrOptions, &Attribute);
 		if (ResultCode == EOS_EResult::EOS_Success)
 		{
-			FString Key = UTF8_TO_TCHAR(Attribute->Data->Key);
-			if (Key == TEXT("OwningUserId"))
-			{
-				OutSession.OwningUserId = FUniqueNetIdEOSRegistry::FindOrAdd(UTF8_TO_TCHAR(Attribute->Data->Value.AsUtf8));
-			}
-			else if (Key == TEXT("OwningUserName"))
-			{
-				OutSession.OwningUserName = UTF8_TO_TCHAR(Attribute->Data->Value.AsUtf8);
-			}
-			else if (Key == TEXT("NumPublicConnections"))
-			{
-				OutSession.SessionSettings.NumPublicConnections = Attribute->Data->Value.AsInt64;
-			}
-			else if (Key == TEXT("NumPrivateConnections"))
-			{
-				OutSession.SessionSettings.NumPrivateConnections = Attribute->Data->Value.AsInt64;
-			}
-			else if (Key == TEXT("bAntiCheatProtected"))
-			{
-				OutSession.SessionSettings.bAntiCheatProtected = Attribute->Data->Value.AsBool == EOS_TRUE;
-			}
-			else if (Key == TEXT("bUsesStats"))
-			{
-				OutSession.SessionSettings.bUsesStats = Attribute->Data->Value.AsBool == EOS_TRUE;
-			}
-			else if (Key == TEXT("bIsDedicated"))
-			{
-				OutSession.SessionSettings.bIsDedicated = Attribute->Data->Value.AsBool == EOS_TRUE;
-			}
-			else if (Key == TEXT("BuildUniqueId"))
-			{
-				OutSession.SessionSettings.BuildUniqueId = Attribute->Data->Value.AsInt64;
-			}
-			// Handle FSessionSettings
-			else
-			{
-				FOnlineSessionSetting Setting;
-				switch (Attribute->Data->ValueType)
-				{
-				case EOS_ESessionAttributeType::EOS_SAT_Boolean:
-				{
-					Setting.Data.SetValue(Attribute->Data->Value.AsBool == EOS_TRUE);
-					break;
-				}
-				case EOS_ESessionAttributeType::EOS_SAT_Int64:
-				{
-					Setting.Data.SetValue(int64(Attribute->Data->Value.AsInt64));
-					break;
-				}
-				case EOS_ESessionAttributeType::EOS_SAT_Double:
-				{
-					Setting.Data.SetValue(Attribute->Data->Value.AsDouble);
-					break;
-				}
-				case EOS_ESessionAttributeType::EOS_SAT_String:
-				{
-					Setting.Data.SetValue(UTF8_TO_TCHAR(Attribute->Data->Value.AsUtf8));
-					break;
-				}
-				}
+			Fingerprint = FEOSAttributeSchema::Fingerprint(*Attribute->Data, Fingerprint);
+			Attributes.Add(Attribute);
+		}
+	}
 
-				OutSession.SessionSettings.Settings.FindOrAdd(FName(Key), Setting);
-			}
+	const FString LobbyIdStr = UTF8_TO_TCHAR(LobbyId);
+	const FEOSDecodedAttributes* Decoded = LobbyAttributeCache.Find(LobbyIdStr, Fingerprint);
+	if (Decoded == nullptr)
+	{
+		FEOSDecodedAttributes NewDecoded;
+		for (EOS_Lobby_Attribute* Attribute : Attributes)
+		{
+			SessionAttributeSchema.Decode(*Attribute->Data, NewDecoded);
 		}
+		Decoded = &LobbyAttributeCache.Add(LobbyIdStr, Fingerprint, MoveTemp(NewDecoded));
+	}
+	Decoded->ApplyTo(OutSession);
 
+	for (EOS_Lobby_Attribute* Attribute : Attributes)
+	{
 		EOS_Lobby_Attribute_Release(Attribute);
 	}
 }
@@ -4838,54 +5145,26 @@ void FOnlineSessionEOS::CopyLobbyMemberAttributes(const FLobbyDetailsEOS& LobbyD
 	GetMemberAttributeCountOptions.ApiVersion = EOS_LOBBYDETAILS_GETMEMBERATTRIBUTECOUNT_API_LATEST;
 	GetMemberAttributeCountOptions.TargetUserId = TargetUserId;
 
+	FEOSDecodedAttributes Decoded;
 	uint32_t MemberAttributeCount = EOS_LobbyDetails_GetMemberAttributeCount(LobbyDetails.LobbyDetailsHandle, &GetMemberAttributeCountOptions);
 	for (uint32_t MemberAttributeIndex = 0; MemberAttributeIndex < MemberAttributeCount; MemberAttributeIndex++)
 	{
 		EOS_LobbyDetails_CopyMemberAttributeByIndexOptions AttrOptions = { };
 		AttrOptions.ApiVersion = EOS_LOBBYDETAILS_COPYMEMBERATTRIBUTEBYINDEX_API_LATEST;
+		AttrOptions.TargetUserId = TargetUserId;
 		AttrOptions.AttrIndex = MemberAttributeIndex;
 
 		EOS_Lobby_Attribute* Attribute = NULL;
 		EOS_EResult ResultCode = EOS_LobbyDetails_CopyMemberAttributeByIndex(LobbyDetails.LobbyDetailsHandle, &AttrOptions, &Attribute);
 		if (ResultCode == EOS_EResult::EOS_Success)
 		{
-			FString Key = Attribute->Data->Key;
-
-			FOnlineSessionSetting Setting;
-			switch (Attribute->Data->ValueType)
-			{
-			case EOS_ESessionAttributeType::EOS_SAT_Boolean:
-			{
-				Setting.Data.SetValue(Attribute->Data->Value.AsBool == EOS_TRUE);
-				break;
-			}
-			case EOS_ESessionAttributeType::EOS_SAT_Int64:
-			{
-				Setting.Data.SetValue(int64(Attribute->Data->Value.AsInt64));
-				break;
-			}
-			case EOS_ESessionAttributeType::EOS_SAT_Double:
-			{
-				Setting.Data.SetValue(Attribute->Data->Value.AsDouble);
-				break;
-			}
-			case EOS_ESessionAttributeType::EOS_SAT_String:
-			{
-				Setting.Data.SetValue(UTF8_TO_TCHAR(Attribute->Data->Value.AsUtf8));
-				break;
-			}
-			}
-
-			if (OutSessionSettings.Contains(FName(Key)))
-			{
-				OutSessionSettings[FName(Key)] = Setting;
-			}
-			else
-			{
-				OutSessionSettings.Add(FName(Key), Setting);
-			}
+			LobbyMemberAttributeSchema.Decode(*Attribute->Data, Decoded);
 		}
+
+		EOS_Lobby_Attribute_Release(Attribute);
 	}
+
+	Decoded.ApplyTo(OutSessionSettings);
 }
 
 #endif
@@ -55,6 +55,120 @@ struct FLobbyDetailsEOS : FNoncopyable
 	}
 };
 
+/**
+ * Session or lobby attributes decoded into their OSS form. Built in fields are only set if the attribute was
+ * present, every other attribute is kept as a session setting
+ */
+struct FEOSDecodedAttributes
+{
+	TOptional<int32> NumPublicConnections;
+	TOptional<int32> NumPrivateConnections;
+	FUniqueNetIdEOSPtr OwningUserId;
+	TOptional<FString> OwningUserName;
+	TOptional<bool> bAntiCheatProtected;
+	TOptional<bool> bUsesStats;
+	TOptional<bool> bIsDedicated;
+	TOptional<int32> BuildUniqueId;
+	TArray<TPair<FName, FOnlineSessionSetting>> Settings;
+
+	/** Updates or adds the decoded values on the session, settings that were not decoded are left alone */
+	void ApplyTo(FOnlineSession& OutSession) const;
+	void ApplyTo(FSessionSettings& OutSettings) const;
+};
+
+/**
+ * Resolves the attribute keys the SDK hands back to the session field or setting name they decode into. Keys are
+ * matched case insensitively, as the backend upper cases them, and interned the first time they are seen so a
+ * result can be decoded without building an FString and FName per attribute.
+ */
+class FEOSAttributeSchema
+{
+public:
+	enum class EField : uint8
+	{
+		Setting,
+		NumPublicConnections,
+		NumPrivateConnections,
+		OwningUserId,
+		OwningUserName,
+		bAntiCheatProtected,
+		bUsesStats,
+		bIsDedicated,
+		BuildUniqueId
+	};
+
+	struct FEntry
+	{
+		EField Field;
+		FName SettingName;
+	};
+
+	/** @param bWithSessionFields whether the built in session fields are decoded, otherwise every key is a setting */
+	explicit FEOSAttributeSchema(bool bWithSessionFields);
+
+	const FEntry& FindOrAdd(const char* Key);
+
+	/** Decodes one EOS_Sessions_AttributeData or EOS_Lobby_AttributeData */
+	template<typename AttributeDataType>
+	void Decode(const AttributeDataType& Data, FEOSDecodedAttributes& OutDecoded);
+
+	/** Folds the key, type and value of an attribute into a running CRC */
+	template<typename AttributeDataType>
+	static uint32 Fingerprint(const AttributeDataType& Data, uint32 Crc);
+
+private:
+	struct FKeyFuncs : BaseKeyFuncs<TPair<const char*, FEntry>, const char*, false>
+	{
+		static const char* GetSetKey(const TPair<const char*, FEntry>& Element)
+		{
+			return Element.Key;
+		}
+		static bool Matches(const char* A, const char* B)
+		{
+			return FCStringAnsi::Stricmp(A, B) == 0;
+		}
+		static uint32 GetKeyHash(const char* Key);
+	};
+
+	void Register(const char* Key, EField Field);
+
+	TMap<const char*, FEntry, FDefaultSetAllocator, FKeyFuncs> Entries;
+	/** Owns the keys in Entries, the SDK's strings only live until the attribute is released */
+	TArray<TUniquePtr<char[]>> KeyStorage;
+};
+
+/**
+ * Decoded attributes of recently seen sessions or lobbies, keyed by their id. The SDK has no attribute revision to
+ * key on, so an entry is only reused while the fingerprint of the raw attributes still matches.
+ */
+class FEOSAttributeCache
+{
+public:
+	explicit FEOSAttributeCache(int32 InMaxEntries)
+		: MaxEntries(InMaxEntries)
+	{
+	}
+
+	const FEOSDecodedAttributes* Find(const FString& Id, uint32 Fingerprint);
+	const FEOSDecodedAttributes& Add(const FString& Id, uint32 Fingerprint, FEOSDecodedAttributes&& Decoded);
+	void SetMaxEntries(int32 InMaxEntries);
+
+private:
+	struct FEntry
+	{
+		uint32 Fingerprint;
+		uint64 LastUsed;
+		FEOSDecodedAttributes Decoded;
+	};
+
+	/** Evicts the least recently used entries until the cache is within MaxEntries */
+	void Trim();
+
+	TMap<FString, FEntry> Entries;
+	uint64 UseCounter = 0;
+	int32 MaxEntries;
+};
+
 /**
  * Interface for interacting with EOS sessions
  */
@@ -88,6 +202,8 @@ public:
 
 	virtual void RemoveNamedSession(FName SessionName) override
 	{
+		DiscardPlayerRegistrations(SessionName);
+
 		FScopeLock ScopeLock(&SessionLock);
 		for (int32 SearchIndex = 0; SearchIndex < Sessions.Num(); SearchIndex++)
 		{
@@ -113,6 +229,21 @@ public:
 		return EOnlineSessionState::NoSession;
 	}
 
+	/** Whether the local user hosts a named session, lobbies included */
+	bool IsHostingSession(EOS_ProductUserId LocalUserId) const
+	{
+		FScopeLock ScopeLock(&SessionLock);
+		for (const FNamedOnlineSession& Session : Sessions)
+		{
+			if (Session.bHosting && Session.OwningUserId.IsValid() && Session.OwningUserId->GetType() == FUniqueNetIdEOS::GetTypeStatic()
+				&& FUniqueNetIdEOS::Cast(*Session.OwningUserId).GetProductUserId() == LocalUserId)
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
 	virtual bool HasPresenceSession() override
 	{
 		FScopeLock ScopeLock(&SessionLock);
@@ -182,6 +313,10 @@ public:
 	FOnlineSessionEOS(FOnlineSubsystemEOS* InSubsystem)
 		: CurrentSessionSearch(nullptr)
 		, SessionSearchStartInSeconds(0)
+		, SessionAttributeSchema(true)
+		, LobbyMemberAttributeSchema(false)
+		, SessionAttributeCache(DefaultMaxCachedAttributeResults)
+		, LobbyAttributeCache(DefaultMaxCachedAttributeResults)
 		, EOSSubsystem(InSubsystem)
 	{
 	}
@@ -224,6 +359,14 @@ private:
 	TArray<TSharedRef<FLobbyDetailsEOS>> PendingLobbySearchResults;
 	TMap<FString, TSharedRef<FLobbyDetailsEOS>> LobbySearchResultsCache;
 
+	// Attribute decoding for search results and lobby updates
+	static constexpr int32 DefaultMaxCachedAttributeResults = 256;
+	/** Shared by sessions and lobbies, which decode the same built in fields */
+	FEOSAttributeSchema SessionAttributeSchema;
+	FEOSAttributeSchema LobbyMemberAttributeSchema;
+	FEOSAttributeCache SessionAttributeCache;
+	FEOSAttributeCache LobbyAttributeCache;
+
 	// Lobby session callbacks and methods
 	FCallbackBase* LobbyCreatedCallback;
 	FCallbackBase* LobbySearchFindCallback;
@@ -275,7 +418,7 @@ private:
 	// Methods to update an OSS Lobby from an API Lobby
 	typedef TFunction<void(bool bWasSuccessful)> FOnCopyLobbyDataCompleteCallback;
 	void CopyLobbyData(const TSharedRef<FLobbyDetailsEOS>& LobbyDetails, EOS_LobbyDetails_Info* LobbyDetailsInfo, FOnlineSession& OutSession, const FOnCopyLobbyDataCompleteCallback& Callback);
-	void CopyLobbyAttributes(const TSharedRef<FLobbyDetailsEOS>& LobbyDetails, FOnlineSession& OutSession);
+	void CopyLobbyAttributes(const TSharedRef<FLobbyDetailsEOS>& LobbyDetails, const char* LobbyId, FOnlineSession& OutSession);
 	void CopyLobbyMemberAttributes(const FLobbyDetailsEOS& LobbyDetails, const EOS_ProductUserId& TargetUserId, FSessionSettings& OutSessionSettings);
 
 	// Lobby search
@@ -313,7 +456,7 @@ private:
 	void AddSearchResult(EOS_HSessionDetails SessionHandle, const TSharedRef<FOnlineSessionSearch>& SearchSettings);
 	void AddSearchAttribute(EOS_HSessionSearch SearchHandle, const EOS_Sessions_AttributeData* Attribute, EOS_EOnlineComparisonOp ComparisonOp);
 	void CopySearchResult(EOS_HSessionDetails SessionHandle, EOS_SessionDetails_Info* SessionInfo, FOnlineSession& SessionSettings);
-	void CopyAttributes(EOS_HSessionDetails SessionHandle, FOnlineSession& OutSession);
+	void CopyAttributes(EOS_HSessionDetails SessionHandle, const char* SessionId, FOnlineSession& OutSession);
 
 	void SetPermissionLevel(EOS_HSessionModification SessionModHandle, FNamedOnlineSession* Session);
 	void SetMaxPlayers(EOS_HSessionModification SessionModHandle, FNamedOnlineSession* Session);
@@ -329,6 +472,23 @@ private:
 	uint32 SharedSessionUpdate(EOS_HSessionModification SessionModHandle, FNamedOnlineSession* Session, FUpdateSessionCallback* Callback);
 
 	void TickLanTasks(float DeltaTime);
+
+	/** Register and unregister requests for one session waiting to be sent as batched EOS calls */
+	struct FPendingPlayerRegistrations
+	{
+		TArray<FUniqueNetIdRef> PlayersToRegister;
+		TArray<FUniqueNetIdRef> PlayersToUnregister;
+		/** Platform time at which the requests are sent */
+		double FlushTime = 0.0;
+	};
+	/** Queues players to register or unregister, cancelling out opposite requests for the same player */
+	void QueuePlayerRegistrations(FName SessionName, const TArray<FUniqueNetIdRef>& Players, bool bRegister);
+	void TickPlayerRegistrations();
+	void FlushPlayerRegistrations(FName SessionName);
+	/** Drops the requests queued for a session that is going away, failing their completion delegates */
+	void DiscardPlayerRegistrations(FName SessionName);
+	void SendRegisterPlayers(FName SessionName, const TArray<FUniqueNetIdRef>& Players);
+	void SendUnregisterPlayers(FName SessionName, const TArray<FUniqueNetIdRef>& Players);
 	uint32 CreateLANSession(int32 HostingPlayerNum, FNamedOnlineSession* Session);
 	uint32 JoinLANSession(int32 PlayerNum, class FNamedOnlineSession* Session, const class FOnlineSession* SearchSession);
 	uint32 FindLANSession();
@@ -360,6 +520,13 @@ private:
 
 	bool bIsDedicatedServer;
 	bool bIsUsingP2PSockets;
+
+	/** Pending player registrations by session name, see TickPlayerRegistrations */
+	TMap<FName, FPendingPlayerRegistrations> PendingPlayerRegistrations;
+	/** How long register and unregister requests are collected before being sent, 0 sends them on the next tick */
+	double PlayerRegistrationBatchWindowSeconds = 0.0;
+	/** Most players sent in one EOS_Sessions_RegisterPlayers or EOS_Sessions_UnregisterPlayers call */
+	int32 MaxPlayersPerRegistrationRequest = EOS_SESSIONS_MAXREGISTEREDPLAYERS;
 };
 
 typedef TSharedPtr<FOnlineSessionEOS, ESPMode::ThreadSafe> FOnlineSessionEOSPtr;
@@ -6,6 +6,7 @@
 #include "OnlineSubsystemEOSPrivate.h"
 #include "OnlineSubsystemEOSTypes.h"
 #include "UserManagerEOS.h"
+#include "EIKSettings.h"
 
 #if WITH_EOS_SDK
 #include "eos_stats.h"
@@ -22,11 +23,26 @@ inline float IntStatToFloatStat(int32 Value)
 	return (float)Value / FLOAT_STAT_SCALER;
 }
 
-struct FStatNameBuffer
+FOnlineStatsEOS::FOnlineStatsEOS(FOnlineSubsystemEOS* InSubsystem)
+	: EOSSubsystem(InSubsystem)
 {
-	char StatName[EOS_OSS_STRING_BUFFER_LENGTH];
-};
+	const FEOSSettings Settings = UEIKSettings::GetSettings();
+	StatsFlushIntervalSeconds = FMath::Max(Settings.StatsFlushIntervalSeconds, 0.f);
+	StatsQueryCacheSeconds = FMath::Max(Settings.StatsQueryCacheSeconds, 0.f);
+}
 
+const char* FOnlineStatsEOS::GetStatNameUtf8(const FString& StatName)
+{
+	TArray<char>* StatNameUtf8 = StatNameCache.Find(StatName);
+	if (StatNameUtf8 == nullptr)
+	{
+		FTCHARToUTF8 Converter(*StatName.ToUpper());
+		StatNameUtf8 = &StatNameCache.Add(StatName);
+		StatNameUtf8->Append(Converter.Get(), Converter.Length());
+		StatNameUtf8->Add('\0');
+	}
+	return StatNameUtf8->GetData();
+}
 
 void FOnlineStatsEOS::QueryStats(const FUniqueNetIdRef LocalUserId, const FUniqueNetIdRef StatsUser, const FOnlineStatsQueryUserStatsComplete& Delegate)
 {
@@ -38,31 +54,19 @@ void FOnlineStatsEOS::QueryStats(const FUniqueNetIdRef LocalUserId, const FUniqu
 struct FQueryStatsOptions :
 	public EOS_Stats_QueryStatsOptions
 {
-	TArray<char*> PointerArray;
+	TArray<const char*> PointerArray;
 
-	FQueryStatsOptions(const uint32 InNumStatIds) :
-		EOS_Stats_QueryStatsOptions()
+	FQueryStatsOptions(TArray<const char*>&& InStatNames) :
+		EOS_Stats_QueryStatsOptions(),
+		PointerArray(MoveTemp(InStatNames))
 	{
 		ApiVersion = EOS_STATS_QUERYSTATS_API_LATEST;
 
 		StartTime = EOS_STATS_TIME_UNDEFINED;
 		EndTime = EOS_STATS_TIME_UNDEFINED;
 
-		PointerArray.AddZeroed(InNumStatIds);
-		for (int32 Index = 0; Index < PointerArray.Num(); Index++)
-		{
-			PointerArray[Index] = new char[EOS_OSS_STRING_BUFFER_LENGTH];
-		}
-		StatNames = (const char**)PointerArray.GetData();
-		StatNamesCount = InNumStatIds;
-	}
-
-	~FQueryStatsOptions()
-	{
-		for (int32 Index = 0; Index < PointerArray.Num(); Index++)
-		{
-			delete [] PointerArray[Index];
-		}
+		StatNames = PointerArray.GetData();
+		StatNamesCount = PointerArray.Num();
 	}
 };
 
@@ -76,8 +80,8 @@ struct FStatsQueryContext
 	int32 NumPlayerReads;
 	TArray<FString> StatNames;
 	FOnlineStatsQueryUsersStatsComplete Delegate;
-	/** Stats are added here as they come in from the service. They are added to the global cache at the end */
-	TUniqueNetIdMap<TSharedRef<FOnlineStatsUserStats>> StatsCache;
+	/** Users whose stats are returned, including the ones served from the cache */
+	TArray<FUniqueNetIdRef> StatUsers;
 
 	FStatsQueryContext(int32 InNumPlayerReads, const TArray<FString>& InStatNames, const FOnlineStatsQueryUsersStatsComplete& InDelegate)
 		: NumPlayerReads(InNumPlayerReads)
@@ -108,6 +112,29 @@ void AppendStats(TUniqueNetIdMap<TSharedRef<FOnlineStatsUserStats>>& StatsCache,
 	}
 }
 
+bool FOnlineStatsEOS::IsStatsCacheValid(const FUniqueNetIdRef& StatsUserId, const TArray<FString>& StatNames, double Now) const
+{
+	const double* CacheTime = StatsCacheTimes.Find(StatsUserId);
+	if (CacheTime == nullptr || Now - *CacheTime >= StatsQueryCacheSeconds)
+	{
+		return false;
+	}
+
+	const TSharedRef<FOnlineStatsUserStats>* UserStats = StatsCache.Find(StatsUserId);
+	if (UserStats == nullptr)
+	{
+		return false;
+	}
+	for (const FString& StatName : StatNames)
+	{
+		if (!(*UserStats)->Stats.Contains(StatName))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
 void FOnlineStatsEOS::QueryStats(const FUniqueNetIdRef LocalUserId, const TArray<FUniqueNetIdRef>& StatUsers, const TArray<FString>& StatNames, const FOnlineStatsQueryUsersStatsComplete& Delegate)
 {
 	const FUniqueNetIdEOS& LocalEOSId = FUniqueNetIdEOS::Cast(*LocalUserId);
@@ -126,14 +153,20 @@ void FOnlineStatsEOS::QueryStats(const FUniqueNetIdRef LocalUserId, const TArray
 	}
 
 	// Do the stat name building once rather than for each person
-	FQueryStatsOptions Options(StatNames.Num());
-	for (int32 Index = 0; Index < StatNames.Num(); Index++)
+	TArray<const char*> StatNamesUtf8;
+	StatNamesUtf8.Reserve(StatNames.Num());
+	for (const FString& StatName : StatNames)
 	{
-		FCStringAnsi::Strncpy(Options.PointerArray[Index], TCHAR_TO_UTF8(*StatNames[Index].ToUpper()), EOS_OSS_STRING_BUFFER_LENGTH);
+		StatNamesUtf8.Add(GetStatNameUtf8(StatName));
 	}
+	FQueryStatsOptions Options(MoveTemp(StatNamesUtf8));
+
+	// This object will live across all calls and be freed at the end
+	FStatsQueryContextPtr StatsQueryContext = MakeShareable(new FStatsQueryContext(0, StatNames, Delegate));
 
-	int32 NumKnownUsers = 0;
-	// Validate the number of known users
+	// Local users are always queried, remote ones only when their stats are missing from the cache or were cached too long ago
+	const double Now = FPlatformTime::Seconds();
+	TArray<EOS_ProductUserId> UsersToQuery;
 	for (const FUniqueNetIdRef& StatUserId : StatUsers)
 	{
 		const FUniqueNetIdEOS& EOSId = FUniqueNetIdEOS::Cast(*StatUserId);
@@ -142,21 +175,38 @@ void FOnlineStatsEOS::QueryStats(const FUniqueNetIdRef LocalUserId, const TArray
 		{
 			continue;
 		}
-		NumKnownUsers++;
+
+		StatsQueryContext->StatUsers.Add(StatUserId);
+		if (EOSSubsystem->UserManager->IsLocalUser(*StatUserId) || !IsStatsCacheValid(StatUserId, StatNames, Now))
+		{
+			UsersToQuery.AddUnique(UserId);
+		}
 	}
+	StatsQueryContext->NumPlayerReads = UsersToQuery.Num();
 
-	// This object will live across all calls and be freed at the end
-	FStatsQueryContextPtr StatsQueryContext = MakeShareable(new FStatsQueryContext(NumKnownUsers, StatNames, Delegate));
-	// Kick off a read for each user
-	for (const FUniqueNetIdRef& StatUserId : StatUsers)
+	TFunction<void()> CompleteQuery = [this, StatsQueryContext]()
 	{
-		const FUniqueNetIdEOS& EOSId = FUniqueNetIdEOS::Cast(*StatUserId);
-		const EOS_ProductUserId TargetEOSUserId = EOSId.GetProductUserId();
-		if (TargetEOSUserId == nullptr)
+		TArray<TSharedRef<const FOnlineStatsUserStats>> OutArray;
+		for (const FUniqueNetIdRef& StatUserId : StatsQueryContext->StatUsers)
 		{
-			continue;
+			if (const TSharedRef<FOnlineStatsUserStats>* UserStats = StatsCache.Find(StatUserId))
+			{
+				OutArray.Add(*UserStats);
+			}
 		}
+		StatsQueryContext->Delegate.ExecuteIfBound(FOnlineError(OutArray.Num() > 0), OutArray);
+	};
+
+	if (UsersToQuery.Num() == 0)
+	{
+		UE_LOG_ONLINE_STATS(VeryVerbose, TEXT("QueryStats() served %d users from the cache"), StatsQueryContext->StatUsers.Num());
+		EOSSubsystem->ExecuteNextTick(MoveTemp(CompleteQuery));
+		return;
+	}
 
+	// Kick off a read for each user
+	for (const EOS_ProductUserId TargetEOSUserId : UsersToQuery)
+	{
 		Options.LocalUserId = LocalEOSUserId;
 		Options.TargetUserId = TargetEOSUserId;
 
@@ -165,33 +215,38 @@ void FOnlineStatsEOS::QueryStats(const FUniqueNetIdRef LocalUserId, const TArray
 #else
 		FReadStatsCallback* CallbackObj = new FReadStatsCallback();
 #endif
-		CallbackObj->CallbackLambda = [this, StatsQueryContext](const EOS_Stats_OnQueryStatsCompleteCallbackInfo* Data)
+		CallbackObj->CallbackLambda = [this, StatsQueryContext, CompleteQuery](const EOS_Stats_OnQueryStatsCompleteCallbackInfo* Data)
 		{
 			StatsQueryContext->NumPlayerReads--;
 			bool bWasSuccessful = Data->ResultCode == EOS_EResult::EOS_Success;
 			if (bWasSuccessful)
 			{
-				FUniqueNetIdEOSPtr StatUserId = EOSSubsystem->UserManager->GetLocalUniqueNetIdEOS(Data->TargetUserId);
+				// Remote users are cached as well as local ones
+				FUniqueNetIdEOSPtr StatUserId = FUniqueNetIdEOSRegistry::FindOrAdd(nullptr, Data->TargetUserId);
 				if (StatUserId.IsValid())
 				{
-					char StatNameANSI[EOS_OSS_STRING_BUFFER_LENGTH];
 					EOS_Stats_CopyStatByNameOptions Options = { };
 					Options.ApiVersion = EOS_STATS_COPYSTATBYNAME_API_LATEST;
 					Options.TargetUserId = Data->TargetUserId;
-					Options.Name = StatNameANSI;
 
-					TSharedPtr<FOnlineStatsUserStats> UserStats = StatsCache.Emplace(StatUserId.ToSharedRef(), MakeShared<FOnlineStatsUserStats>(StatUserId.ToSharedRef()));
+					TSharedRef<FOnlineStatsUserStats>* UserStats = StatsCache.Find(StatUserId.ToSharedRef());
+					if (UserStats == nullptr)
+					{
+						UserStats = &StatsCache.Emplace(StatUserId.ToSharedRef(), MakeShared<FOnlineStatsUserStats>(StatUserId.ToSharedRef()));
+					}
+					StatsCacheTimes.Add(StatUserId.ToSharedRef(), FPlatformTime::Seconds());
+
 					// Read each stat that we were looking for so we can mark missing ones as "empty"
 					for (const FString& StatName : StatsQueryContext->StatNames)
 					{
-						FCStringAnsi::Strncpy(StatNameANSI, TCHAR_TO_UTF8(*StatName.ToUpper()), EOS_OSS_STRING_BUFFER_LENGTH);
+						Options.Name = GetStatNameUtf8(StatName);
 
 						EOS_Stats_Stat* ReadStat = nullptr;
 						if (EOS_Stats_CopyStatByName(EOSSubsystem->StatsHandle, &Options, &ReadStat) == EOS_EResult::EOS_Success)
 						{
 							UE_LOG_ONLINE_STATS(VeryVerbose, TEXT("Found value for stat %s"), *StatName);
 
-							UserStats->Stats.Add(StatName, FOnlineStatValue(ReadStat->Value));
+							(*UserStats)->Stats.Add(StatName, FOnlineStatValue(ReadStat->Value));
 
 							EOS_Stats_Stat_Release(ReadStat);
 						}
@@ -199,7 +254,7 @@ void FOnlineStatsEOS::QueryStats(const FUniqueNetIdRef LocalUserId, const TArray
 						{
 							// Put an empty stat in
 							UE_LOG_ONLINE_STATS(VeryVerbose, TEXT("Value not found for stat %s, adding empty value"), *StatName);
-							UserStats->Stats.Add(StatName, FOnlineStatValue());
+							(*UserStats)->Stats.Add(StatName, FOnlineStatValue());
 						}
 					}
 				}
@@ -210,12 +265,7 @@ void FOnlineStatsEOS::QueryStats(const FUniqueNetIdRef LocalUserId, const TArray
 			}
 			if (StatsQueryContext->NumPlayerReads <= 0)
 			{
-				TArray<TSharedRef<const FOnlineStatsUserStats>> OutArray;
-				for (const TPair<FUniqueNetIdRef, TSharedRef<FOnlineStatsUserStats>>& StatsUser : StatsCache)
-				{
-					OutArray.Add(StatsUser.Value);
-				}
-				StatsQueryContext->Delegate.ExecuteIfBound(FOnlineError(StatsCache.Num() > 0), OutArray);
+				CompleteQuery();
 			}
 		};
 		EOS_Stats_QueryStats(EOSSubsystem->StatsHandle, &Options, CallbackObj, CallbackObj->GetCallbackPtr());
@@ -293,25 +343,26 @@ typedef TEOSCallback<EOS_Stats_OnIngestStatCompleteCallback, EOS_Stats_IngestSta
 typedef TEOSCallback<EOS_Stats_OnIngestStatCompleteCallback, EOS_Stats_IngestStatCompleteCallbackInfo> FWriteStatsCallback;
 #endif
 
-void FOnlineStatsEOS::WriteStats(EOS_ProductUserId LocalUserId, EOS_ProductUserId UserId, const FOnlineStatsUserUpdatedStats& PlayerStats)
+struct FStatsFlushContext
+{
+	int32 NumPendingIngests = 0;
+	bool bWasSuccessful = true;
+	/** Completion delegates of all updates ingested by this flush */
+	TArray<FOnlineStatsUpdateStatsComplete> Delegates;
+};
+
+void FOnlineStatsEOS::WriteStats(EOS_ProductUserId LocalUserId, EOS_ProductUserId UserId, const FPendingStatIngest* Ingests, int32 NumIngests, const TSharedRef<FStatsFlushContext>& FlushContext)
 {
 	TArray<EOS_Stats_IngestData> EOSData;
-	TArray<FStatNameBuffer> EOSStatNames;
 	// Preallocate all of the memory
-	EOSData.AddZeroed(PlayerStats.Stats.Num());
-	EOSStatNames.AddZeroed(PlayerStats.Stats.Num());
-	uint32 Index = 0;
+	EOSData.AddZeroed(NumIngests);
 	// Convert the stats to the EOS format
-	for (const TPair<FString, FOnlineStatUpdate>& Stat : PlayerStats.Stats)
+	for (int32 Index = 0; Index < NumIngests; Index++)
 	{
 		EOS_Stats_IngestData& EOSStat = EOSData[Index];
 		EOSStat.ApiVersion = EOS_STATS_INGESTDATA_API_LATEST;
-
-		EOSStat.IngestAmount = GetVariantValue(Stat.Value.GetValue());
-		FCStringAnsi::Strncpy(EOSStatNames[Index].StatName, TCHAR_TO_UTF8(*Stat.Key.ToUpper()), EOS_OSS_STRING_BUFFER_LENGTH);
-		EOSStat.StatName = EOSStatNames[Index].StatName;
-
-		Index++;
+		EOSStat.StatName = Ingests[Index].StatName;
+		EOSStat.IngestAmount = Ingests[Index].Amount;
 	}
 
 	EOS_Stats_IngestStatOptions Options = { };
@@ -321,17 +372,31 @@ void FOnlineStatsEOS::WriteStats(EOS_ProductUserId LocalUserId, EOS_ProductUserI
 	Options.Stats = EOSData.GetData();
 	Options.StatsCount = EOSData.Num();
 
+	FlushContext->NumPendingIngests++;
+
 #if ENGINE_MAJOR_VERSION == 5
 	FWriteStatsCallback* CallbackObj = new FWriteStatsCallback(FOnlineStatsEOSWeakPtr(AsShared()));
 #else
 	FWriteStatsCallback* CallbackObj = new FWriteStatsCallback();
 #endif
-	CallbackObj->CallbackLambda = [this](const EOS_Stats_IngestStatCompleteCallbackInfo* Data)
+	CallbackObj->CallbackLambda = [this, FlushContext](const EOS_Stats_IngestStatCompleteCallbackInfo* Data)
 	{
 		bool bWasSuccessful = Data->ResultCode == EOS_EResult::EOS_Success;
 		if (!bWasSuccessful)
 		{
 			UE_LOG_ONLINE_STATS(Error, TEXT("EOS_Stats_IngestStat() failed with EOS result code (%s)"), ANSI_TO_TCHAR(EOS_EResult_ToString(Data->ResultCode)));
+			FlushContext->bWasSuccessful = false;
+		}
+
+		if (--FlushContext->NumPendingIngests == 0)
+		{
+			InFlightFlushes.Remove(FlushContext);
+
+			const FOnlineError Result(FlushContext->bWasSuccessful ? EOnlineErrorResult::Success : EOnlineErrorResult::RequestFailure);
+			for (const FOnlineStatsUpdateStatsComplete& Delegate : FlushContext->Delegates)
+			{
+				Delegate.ExecuteIfBound(Result);
+			}
 		}
 	};
 	EOS_Stats_IngestStat(EOSSubsystem->StatsHandle, &Options, CallbackObj, CallbackObj->GetCallbackPtr());
@@ -354,22 +419,103 @@ void FOnlineStatsEOS::UpdateStats(const FUniqueNetIdRef LocalUserId, const TArra
 		return;
 	}
 
-	// Trigger one write for each user
+	// Accumulate the updates per user, they are ingested together on the next flush
 	for (const FOnlineStatsUserUpdatedStats& StatsUpdate : UpdatedUserStats)
 	{
 		const FUniqueNetIdEOS& AccountEOSId = FUniqueNetIdEOS::Cast(*StatsUpdate.Account);
 		const EOS_ProductUserId StatsUser = AccountEOSId.GetProductUserId();
-		if (StatsUser != nullptr)
+		if (StatsUser == nullptr)
 		{
-			WriteStats(UserId, StatsUser, StatsUpdate);
+			UE_LOG_ONLINE_STATS(Error, TEXT("UpdateStats() failed for unknown player (%s)"), *StatsUpdate.Account->ToDebugString());
+			continue;
 		}
-		else
+
+		FPendingStatsUpdate* PendingUpdate = PendingStatsUpdates.FindByPredicate([UserId, StatsUser](const FPendingStatsUpdate& Update)
 		{
-			UE_LOG_ONLINE_STATS(Error, TEXT("UpdateStats() failed for unknown player (%s)"), *StatsUpdate.Account->ToDebugString());
+			return Update.LocalUserId == UserId && Update.TargetUserId == StatsUser;
+		});
+		if (PendingUpdate == nullptr)
+		{
+			PendingUpdate = &PendingStatsUpdates.Emplace_GetRef(UserId, StatsUser, StatsUpdate.Account);
 		}
+
+		for (const TPair<FString, FOnlineStatUpdate>& Stat : StatsUpdate.Stats)
+		{
+			PendingUpdate->Ingests.Add({ GetStatNameUtf8(Stat.Key), GetVariantValue(Stat.Value.GetValue()) });
+		}
+	}
+	PendingUpdateDelegates.Add(Delegate);
+
+	if (NextStatsFlushTime == 0.0)
+	{
+		NextStatsFlushTime = FPlatformTime::Seconds() + StatsFlushIntervalSeconds;
+	}
+}
+
+void FOnlineStatsEOS::Tick(float DeltaTime)
+{
+	if (NextStatsFlushTime != 0.0 && FPlatformTime::Seconds() >= NextStatsFlushTime)
+	{
+		FlushStats();
+	}
+}
+
+void FOnlineStatsEOS::FlushStats()
+{
+	NextStatsFlushTime = 0.0;
+
+	TSharedRef<FStatsFlushContext> FlushContext = MakeShared<FStatsFlushContext>();
+	FlushContext->Delegates = MoveTemp(PendingUpdateDelegates);
+
+	TArray<FPendingStatsUpdate> StatsUpdates = MoveTemp(PendingStatsUpdates);
+	for (const FPendingStatsUpdate& StatsUpdate : StatsUpdates)
+	{
+		UE_LOG_ONLINE_STATS(Verbose, TEXT("FlushStats() ingesting %d stats for player (%s)"), StatsUpdate.Ingests.Num(), *StatsUpdate.TargetNetId->ToDebugString());
+
+		// Cached query results for this user are out of date once the ingest goes through
+		StatsCacheTimes.Remove(StatsUpdate.TargetNetId);
+
+		for (int32 Offset = 0; Offset < StatsUpdate.Ingests.Num(); Offset += EOS_STATS_MAX_INGEST_STATS)
+		{
+			WriteStats(StatsUpdate.LocalUserId, StatsUpdate.TargetUserId, StatsUpdate.Ingests.GetData() + Offset, FMath::Min(StatsUpdate.Ingests.Num() - Offset, EOS_STATS_MAX_INGEST_STATS), FlushContext);
+		}
+	}
+
+	// Nothing left to ingest, e.g. all of the updates were for unknown players
+	if (FlushContext->NumPendingIngests == 0)
+	{
+		for (const FOnlineStatsUpdateStatsComplete& Delegate : FlushContext->Delegates)
+		{
+			Delegate.ExecuteIfBound(FOnlineError(EOnlineErrorResult::Success));
+		}
+	}
+	else
+	{
+		InFlightFlushes.Add(FlushContext);
+	}
+}
+
+void FOnlineStatsEOS::Shutdown()
+{
+	NextStatsFlushTime = 0.0;
+	PendingStatsUpdates.Empty();
+
+	// The platform goes away with the subsystem, so neither these nor the in flight ingests will complete
+	TArray<FOnlineStatsUpdateStatsComplete> FailedDelegates = MoveTemp(PendingUpdateDelegates);
+	for (const TSharedRef<FStatsFlushContext>& FlushContext : InFlightFlushes)
+	{
+		FailedDelegates.Append(MoveTemp(FlushContext->Delegates));
+	}
+	InFlightFlushes.Empty();
+
+	if (FailedDelegates.Num() > 0)
+	{
+		UE_LOG_ONLINE_STATS(Warning, TEXT("Shutdown() failing %d stat updates that were not ingested"), FailedDelegates.Num());
+	}
+	for (const FOnlineStatsUpdateStatsComplete& Delegate : FailedDelegates)
+	{
+		Delegate.ExecuteIfBound(FOnlineError(EOnlineErrorResult::RequestFailure));
 	}
-	// Mabye these wrote correctly...
-	Delegate.ExecuteIfBound(FOnlineError(EOnlineErrorResult::Success));
 }
 
 #if !UE_BUILD_SHIPPING
@@ -7,6 +7,7 @@
 #include "OnlineSubsystemEOSTypes.h"
 
 class FOnlineSubsystemEOS;
+struct FStatsFlushContext;
 
 #if WITH_EOS_SDK
 #include "eos_stats_types.h"
@@ -32,18 +33,72 @@ public:
 #endif
 // ~IOnlineStats Interface
 
-	FOnlineStatsEOS(FOnlineSubsystemEOS* InSubsystem)
-		: EOSSubsystem(InSubsystem)
-	{
-	}
+	FOnlineStatsEOS(FOnlineSubsystemEOS* InSubsystem);
+
+	void Tick(float DeltaTime);
+
+	/** Ingests all accumulated stat updates now instead of waiting for the flush interval, e.g. at the end of a match */
+	void FlushStats();
+
+	/** Fails the completion delegates of updates that can no longer be ingested */
+	void Shutdown();
 
 private:
-	void WriteStats(EOS_ProductUserId LocalUserId, EOS_ProductUserId UserId, const FOnlineStatsUserUpdatedStats& PlayerStats);
+	/**
+	 * A stat update waiting to be ingested. Updates are never merged, as the aggregation that applies is configured on
+	 * the backend and may not match the modification type the game passed in.
+	 */
+	struct FPendingStatIngest
+	{
+		/** Upper case UTF-8 name, owned by StatNameCache */
+		const char* StatName;
+		int32 Amount;
+	};
+
+	/** All stat updates waiting to be ingested for one user */
+	struct FPendingStatsUpdate
+	{
+		EOS_ProductUserId LocalUserId;
+		EOS_ProductUserId TargetUserId;
+		FUniqueNetIdRef TargetNetId;
+		TArray<FPendingStatIngest> Ingests;
+
+		FPendingStatsUpdate(EOS_ProductUserId InLocalUserId, EOS_ProductUserId InTargetUserId, const FUniqueNetIdRef& InTargetNetId)
+			: LocalUserId(InLocalUserId)
+			, TargetUserId(InTargetUserId)
+			, TargetNetId(InTargetNetId)
+		{
+		}
+	};
+
+	void WriteStats(EOS_ProductUserId LocalUserId, EOS_ProductUserId UserId, const FPendingStatIngest* Ingests, int32 NumIngests, const TSharedRef<FStatsFlushContext>& FlushContext);
+	/** Returns the upper case UTF-8 name of a stat, converted once and kept for the lifetime of the interface */
+	const char* GetStatNameUtf8(const FString& StatName);
+	/** Whether all of the named stats of a user were queried recently enough to be served from the cache */
+	bool IsStatsCacheValid(const FUniqueNetIdRef& StatsUserId, const TArray<FString>& StatNames, double Now) const;
 
 	/** Reference to the main EOS subsystem */
 	FOnlineSubsystemEOS* EOSSubsystem;
 	/** Cached list of stats for users as they arrive */
 	TUniqueNetIdMap<TSharedRef<FOnlineStatsUserStats>> StatsCache;
+	/** When each user's stats were last queried, cleared when new stats are ingested for them */
+	TUniqueNetIdMap<double> StatsCacheTimes;
+
+	/** Stat names converted for the SDK. The converted buffers don't move when the map grows. */
+	TMap<FString, TArray<char>> StatNameCache;
+
+	TArray<FPendingStatsUpdate> PendingStatsUpdates;
+	/** Completion delegates of the updates accumulated since the last flush */
+	TArray<FOnlineStatsUpdateStatsComplete> PendingUpdateDelegates;
+	/** Flushes whose ingests have not all completed yet */
+	TArray<TSharedRef<FStatsFlushContext>> InFlightFlushes;
+	/** When the accumulated updates are due to be ingested, zero if nothing is pending */
+	double NextStatsFlushTime = 0.0;
+
+	/** How long updates are accumulated before they are ingested, zero to ingest on the next tick */
+	double StatsFlushIntervalSeconds = 0.0;
+	/** How long queried stats of remote users are served from the cache, local users are always queried */
+	double StatsQueryCacheSeconds = 30.0;
 };
 
 typedef TSharedPtr<FOnlineStatsEOS, ESPMode::ThreadSafe> FOnlineStatsEOSPtr;
@@ -10,6 +10,7 @@
 #include "OnlineAchievementsEOS.h"
 #include "OnlineTitleFileEOS.h"
 #include "OnlineUserCloudEOS.h"
+#include "PingServiceEOS.h"
 #include "OnlineStoreEOS.h"
 #include "EIKSettings.h"
 #include "EOSShared.h"
@@ -173,6 +174,17 @@ struct FEOSPlatformOptions :
 };
 
 FPlatformEOSHelpersPtr FOnlineSubsystemEOS::EOSHelpersPtr;
+FOnlineSubsystemEOS* FOnlineSubsystemEOS::DefaultInstance = nullptr;
+
+FOnlineSubsystemEOS* FOnlineSubsystemEOS::GetDefaultInstance()
+{
+	if (!DefaultInstance)
+	{
+		// Only instances that initialized successfully are returned, so a failed lookup is retried on the next call
+		DefaultInstance = static_cast<FOnlineSubsystemEOS*>(IOnlineSubsystem::Get("EIK"));
+	}
+	return DefaultInstance;
+}
 
 void FOnlineSubsystemEOS::ModuleInit()
 {
@@ -278,6 +290,9 @@ bool FOnlineSubsystemEOS::PlatformCreate()
 		UE_LOG_ONLINE(Error, TEXT("FOnlineSubsystemEOS::PlatformCreate() failed to init EOS platform"));
 		return false;
 	}
+
+	// Lets voice chat run on this platform rather than creating its own for the same deployment
+	EOSSDKManager->RegisterSharedPlatform(ArtifactSettings.DeploymentId, EOSPlatformHandle);
 	return true;
 }
 
@@ -338,6 +353,12 @@ bool FOnlineSubsystemEOS::Init()
 	{
 		UE_LOG_ONLINE(Error, TEXT("FOnlineSubsystemEOS: failed to get Reports Handle"));
 	}
+	P2PHandle = EOS_Platform_GetP2PInterface(*EOSPlatformHandle);
+#if WITH_EOS_RTC
+	RTCHandle = EOS_Platform_GetRTCInterface(*EOSPlatformHandle);
+	RTCAudioHandle = RTCHandle ? EOS_RTC_GetAudioInterface(RTCHandle) : nullptr;
+	RTCAdminHandle = EOS_Platform_GetRTCAdminInterface(*EOSPlatformHandle);
+#endif
 	AntiCheatServerHandle = EOS_Platform_GetAntiCheatServerInterface(*EOSPlatformHandle);
 	if (AntiCheatServerHandle == nullptr)
 	{
@@ -458,6 +479,7 @@ bool FOnlineSubsystemEOS::Init()
 	AchievementsInterfacePtr = MakeShareable(new FOnlineAchievementsEOS(this));
 	TitleFileInterfacePtr = MakeShareable(new FOnlineTitleFileEOS(this));
 	UserCloudInterfacePtr = MakeShareable(new FOnlineUserCloudEOS(this));
+	PingServicePtr = MakeShareable(new FPingServiceEOS(this));
 
 	// We initialized ok so we can tick
 	StartTicker();
@@ -471,6 +493,10 @@ bool FOnlineSubsystemEOS::Shutdown()
 {
 	UE_LOG_ONLINE(VeryVerbose, TEXT("FOnlineSubsystemEOS::Shutdown()"));
 	EOSCallbackContext.Invalidate();
+	if (DefaultInstance == this)
+	{
+		DefaultInstance = nullptr;
+	}
 	// EOS-22677 workaround: Make sure tick is called at least once before shutting down.
 	if (EOSPlatformHandle)
 	{
@@ -485,6 +511,11 @@ bool FOnlineSubsystemEOS::Shutdown()
 		SocketSubsystem = nullptr;
 	}
 
+	if (StatsInterfacePtr.IsValid())
+	{
+		StatsInterfacePtr->Shutdown();
+	}
+
 	// Release our ref to the interfaces. May still exist since they can be aggregated
 	UserManager = nullptr;
 	SessionInterfacePtr = nullptr;
@@ -494,6 +525,11 @@ bool FOnlineSubsystemEOS::Shutdown()
 	StoreInterfacePtr = nullptr;
 	TitleFileInterfacePtr = nullptr;
 	UserCloudInterfacePtr = nullptr;
+	if (PingServicePtr.IsValid())
+	{
+		PingServicePtr->Shutdown();
+		PingServicePtr = nullptr;
+	}
 
 #if WITH_EOS_RTC
 	for (TPair<FUniqueNetIdRef, FOnlineSubsystemEOSVoiceChatUserWrapperRef>& Pair : LocalVoiceChatUsers)
@@ -502,9 +538,27 @@ bool FOnlineSubsystemEOS::Shutdown()
 		//VoiceChatInterface->ReleaseUser(&VoiceChatUserWrapper->VoiceChatUser);
 	}
 	LocalVoiceChatUsers.Reset();
+	if (VoiceChatInterface)
+	{
+		// Don't block shutdown on leaving the voice rooms, the SDK manager keeps ticking the platform until voice chat
+		// has finished with it. The delegate keeps the interface alive until then, uninitializing is bounded by a timeout.
+		VoiceChatInterface->Uninitialize(FOnVoiceChatUninitializeCompleteDelegate::CreateLambda([VoiceChat = VoiceChatInterface](const FVoiceChatResult& Result)
+		{
+			if (!Result.IsSuccess())
+			{
+				UE_LOG_ONLINE(Warning, TEXT("FOnlineSubsystemEOS::Shutdown voice chat uninitialize failed %s"), *LexToString(Result));
+			}
+		}));
+	}
 	VoiceChatInterface = nullptr;
 #endif
 
+	P2PHandle = nullptr;
+#if WITH_EOS_RTC
+	RTCHandle = nullptr;
+	RTCAudioHandle = nullptr;
+	RTCAdminHandle = nullptr;
+#endif
 	EOSPlatformHandle = nullptr;
 
 	return FOnlineSubsystemImpl::Shutdown();
@@ -519,6 +573,8 @@ bool FOnlineSubsystemEOS::Tick(float DeltaTime)
 
 	SessionInterfacePtr->Tick(DeltaTime);
 	UserManager->Tick(DeltaTime);
+	StatsInterfacePtr->Tick(DeltaTime);
+	PingServicePtr->Tick(DeltaTime);
 	FOnlineSubsystemImpl::Tick(DeltaTime);
 	return true;
 }
@@ -15,6 +15,12 @@ DECLARE_STATS_GROUP(TEXT("EOS"), STATGROUP_EOS, STATCAT_Advanced);
 #if WITH_EOS_SDK
 
 #include "eos_sdk.h"
+#include "eos_p2p_types.h"
+#if WITH_EOS_RTC
+#include "eos_rtc_types.h"
+#include "eos_rtc_audio_types.h"
+#include "eos_rtc_admin_types.h"
+#endif
 
 class FSocketSubsystemEOS;
 class IEOSSDKManager;
@@ -49,6 +55,9 @@ typedef TSharedPtr<class FOnlineTitleFileEOS, ESPMode::ThreadSafe> FOnlineTitleF
 class FOnlineUserCloudEOS;
 typedef TSharedPtr<class FOnlineUserCloudEOS, ESPMode::ThreadSafe> FOnlineUserCloudEOSPtr;
 
+class FPingServiceEOS;
+typedef TSharedPtr<class FPingServiceEOS, ESPMode::ThreadSafe> FPingServiceEOSPtr;
+
 typedef TSharedPtr<FPlatformEOSHelpers, ESPMode::ThreadSafe> FPlatformEOSHelpersPtr;
 
 /**
@@ -64,6 +73,12 @@ public:
 	static void ModuleInit();
 	static void ModuleShutdown();
 
+	/**
+	 * The instance IOnlineSubsystem::Get("EIK") returns, resolved once and forgotten when it shuts down.
+	 * Used by the Blueprint SDK wrappers to avoid a name based lookup per call. Game thread only.
+	 */
+	static FOnlineSubsystemEOS* GetDefaultInstance();
+
 	FPlatformEOSHelpersPtr GetEOSHelpers() { return EOSHelpersPtr; };
 
 // IOnlineSubsystemEOS
@@ -142,6 +157,12 @@ public:
 	EOS_HAntiCheatServer AntiCheatServerHandle;
 	EOS_HSanctions SanctionsHandle;
 	EOS_HReports ReportsHandle;
+	EOS_HP2P P2PHandle = nullptr;
+#if WITH_EOS_RTC
+	EOS_HRTC RTCHandle = nullptr;
+	EOS_HRTCAudio RTCAudioHandle = nullptr;
+	EOS_HRTCAdmin RTCAdminHandle = nullptr;
+#endif
 
 	/** Manager that handles all user interfaces */
 	FUserManagerEOSPtr UserManager;
@@ -158,6 +179,8 @@ public:
 	FOnlineTitleFileEOSPtr TitleFileInterfacePtr;
 	/** User Cloud interface pointer */
 	FOnlineUserCloudEOSPtr UserCloudInterfacePtr;
+	/** Measures latency to other users over P2P */
+	FPingServiceEOSPtr PingServicePtr;
 
 	bool bWasLaunchedByEGS;
 	bool bIsDefaultOSS;
@@ -166,6 +189,8 @@ public:
 	TSharedPtr<FSocketSubsystemEIK, ESPMode::ThreadSafe> SocketSubsystem;
 
 	static FPlatformEOSHelpersPtr EOSHelpersPtr;
+	/** Cached result of GetDefaultInstance */
+	static FOnlineSubsystemEOS* DefaultInstance;
 
 	FEOSVoiceChatUser* GetEOSVoiceChatUserInterface(const FUniqueNetId& LocalUserId);
 	void ReleaseVoiceChatUserInterface(const FUniqueNetId& LocalUserId);
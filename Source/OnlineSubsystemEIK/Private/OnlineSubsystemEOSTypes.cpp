@@ -3,8 +3,58 @@
 #include "OnlineSubsystemEOSTypes.h"
 
 #include "Algo/AnyOf.h"
+#include "Misc/Crc.h"
 #include "Misc/LazySingleton.h"
-#include "Misc/ScopeRWLock.h"
+#include "Misc/Parse.h"
+#include "Misc/ScopeLock.h"
+
+namespace
+{
+	/** Smallest table the registry's handle indices start with */
+	constexpr uint32 HandleIndexInitialCapacity = 256;
+
+	bool IsIdHalfSet(const uint8* Bytes)
+	{
+		return Algo::AnyOf(TArrayView<const uint8>(Bytes, ID_HALF_BYTE_SIZE));
+	}
+
+	/** Writes the lowercase hex form EOS uses for ids, OutHex must have room for ID_HALF_BYTE_SIZE * 2 characters */
+	template<typename CharType>
+	void IdHalfToHex(const uint8* Bytes, CharType* OutHex)
+	{
+		static const char Digits[] = "0123456789abcdef";
+		for (int32 Index = 0; Index < ID_HALF_BYTE_SIZE; ++Index)
+		{
+			OutHex[Index * 2] = Digits[Bytes[Index] >> 4];
+			OutHex[Index * 2 + 1] = Digits[Bytes[Index] & 0xf];
+		}
+	}
+
+	/** Reads ID_HALF_BYTE_SIZE * 2 hex characters, leaving OutBytes untouched if they are not all hex digits */
+	template<typename CharType>
+	bool HexToIdHalf(const CharType* Hex, uint8* OutBytes)
+	{
+		for (int32 Index = 0; Index < ID_HALF_BYTE_SIZE * 2; ++Index)
+		{
+			if (!FChar::IsHexDigit(Hex[Index]))
+			{
+				return false;
+			}
+		}
+		for (int32 Index = 0; Index < ID_HALF_BYTE_SIZE; ++Index)
+		{
+			OutBytes[Index] = uint8((FParse::HexDigit(Hex[Index * 2]) << 4) | FParse::HexDigit(Hex[Index * 2 + 1]));
+		}
+		return true;
+	}
+
+	/** The PUID identifies a player for the lifetime of the id, the EAS half is only used for EAS only ids */
+	uint32 HashIdBytes(const uint8* Bytes)
+	{
+		const uint8* HashedHalf = IsIdHalfSet(Bytes + ID_HALF_BYTE_SIZE) ? Bytes + ID_HALF_BYTE_SIZE : Bytes;
+		return FCrc::MemCrc32(HashedHalf, ID_HALF_BYTE_SIZE);
+	}
+}
 
 const FUniqueNetIdEOS& FUniqueNetIdEOS::Cast(const FUniqueNetId& NetId)
 {
@@ -54,16 +104,26 @@ bool FUniqueNetIdEOS::IsValid() const
 
 uint32 FUniqueNetIdEOS::GetTypeHash() const
 {
-	return ::GetTypeHash(static_cast<const void*>(this));
+	return Hash;
 }
 
 FString FUniqueNetIdEOS::ToString() const
 {
-	if(EIK_LexToString(EpicAccountId).IsEmpty())
+	// Built straight from the raw bytes, which are the ids' hex strings decoded
+	TCHAR Buffer[EOS_ID_BYTE_SIZE * 2 + 1];
+	int32 Length = 0;
+	if (IsIdHalfSet(RawBytes))
 	{
-		return EIK_LexToString(ProductUserId);
+		IdHalfToHex(RawBytes, Buffer);
+		Length = ID_HALF_BYTE_SIZE * 2;
+		Buffer[Length++] = EOS_ID_SEPARATOR[0];
 	}
-	return EIK_LexToString(EpicAccountId) + EOS_ID_SEPARATOR + EIK_LexToString(ProductUserId);
+	if (IsIdHalfSet(RawBytes + ID_HALF_BYTE_SIZE))
+	{
+		IdHalfToHex(RawBytes + ID_HALF_BYTE_SIZE, Buffer + Length);
+		Length += ID_HALF_BYTE_SIZE * 2;
+	}
+	return FString(Length, Buffer);
 }
 
 FString FUniqueNetIdEOS::ToDebugString() const
@@ -85,19 +145,19 @@ FUniqueNetIdEOS::FUniqueNetIdEOS(const uint8* Bytes, int32 Size)
 {
 	check(Size == EOS_ID_BYTE_SIZE);
 	FMemory::Memcpy(RawBytes, Bytes, EOS_ID_BYTE_SIZE);
+	Hash = HashIdBytes(RawBytes);
 
-	const bool bIsEasNonZero = Algo::AnyOf(TArrayView<const uint8>(Bytes, ID_HALF_BYTE_SIZE));
-	if (bIsEasNonZero)
+	char IdStr[ID_HALF_BYTE_SIZE * 2 + 1];
+	IdStr[ID_HALF_BYTE_SIZE * 2] = '\0';
+	if (IsIdHalfSet(Bytes))
 	{
-		const FString EpicAccountIdStr = BytesToHex(Bytes, ID_HALF_BYTE_SIZE);
-		EpicAccountId = EOS_EpicAccountId_FromString(TCHAR_TO_UTF8(*EpicAccountIdStr));
+		IdHalfToHex(Bytes, IdStr);
+		EpicAccountId = EOS_EpicAccountId_FromString(IdStr);
 	}
-
-	const bool bIsPuidNonZero = Algo::AnyOf(TArrayView<const uint8>(Bytes + ID_HALF_BYTE_SIZE, ID_HALF_BYTE_SIZE));
-	if (bIsPuidNonZero)
+	if (IsIdHalfSet(Bytes + ID_HALF_BYTE_SIZE))
 	{
-		const FString ProductUserIdStr = BytesToHex(Bytes + ID_HALF_BYTE_SIZE, ID_HALF_BYTE_SIZE);
-		ProductUserId = EOS_ProductUserId_FromString(TCHAR_TO_UTF8(*ProductUserIdStr));
+		IdHalfToHex(Bytes + ID_HALF_BYTE_SIZE, IdStr);
+		ProductUserId = EOS_ProductUserId_FromString(IdStr);
 	}
 }
 
@@ -105,8 +165,110 @@ FUniqueNetIdEOS::FUniqueNetIdEOS(EOS_EpicAccountId InEpicAccountId, EOS_ProductU
 	: EpicAccountId(InEpicAccountId)
 	, ProductUserId(InProductUserId)
 {
-	HexToBytes(EIK_LexToString(EpicAccountId), RawBytes);
-	HexToBytes(EIK_LexToString(ProductUserId), RawBytes + ID_HALF_BYTE_SIZE);
+	static_assert(EOS_EPICACCOUNTID_MAX_LENGTH == ID_HALF_BYTE_SIZE * 2 && EOS_PRODUCTUSERID_MAX_LENGTH == ID_HALF_BYTE_SIZE * 2, "EOS ids are expected to be the hex form of ID_HALF_BYTE_SIZE bytes");
+	char IdStr[ID_HALF_BYTE_SIZE * 2 + 1];
+	int32_t IdStrLength = sizeof(IdStr);
+	if (EOS_EpicAccountId_IsValid(EpicAccountId) == EOS_TRUE
+		&& EOS_EpicAccountId_ToString(EpicAccountId, IdStr, &IdStrLength) == EOS_EResult::EOS_Success
+		&& FCStringAnsi::Strlen(IdStr) == ID_HALF_BYTE_SIZE * 2)
+	{
+		HexToIdHalf(IdStr, RawBytes);
+	}
+	IdStrLength = sizeof(IdStr);
+	if (EOS_ProductUserId_IsValid(ProductUserId) == EOS_TRUE
+		&& EOS_ProductUserId_ToString(ProductUserId, IdStr, &IdStrLength) == EOS_EResult::EOS_Success
+		&& FCStringAnsi::Strlen(IdStr) == ID_HALF_BYTE_SIZE * 2)
+	{
+		HexToIdHalf(IdStr, RawBytes + ID_HALF_BYTE_SIZE);
+	}
+	Hash = HashIdBytes(RawBytes);
+}
+
+void FUniqueNetIdEOS::Update(EOS_EpicAccountId InEpicAccountId, EOS_ProductUserId InProductUserId)
+{
+	// Maps may already hold this id, so it has to keep hashing the same
+	const uint32 InternedHash = Hash;
+	*this = FUniqueNetIdEOS(InEpicAccountId, InProductUserId);
+	Hash = InternedHash;
+}
+
+FUniqueNetIdEOSRegistry::FHandleIndex::FTable::FTable(uint32 InCapacity)
+	: Mask(InCapacity - 1)
+	, Keys(new std::atomic<const void*>[InCapacity])
+	, Values(new std::atomic<const FUniqueNetIdEOSRef*>[InCapacity])
+{
+	check(FMath::IsPowerOfTwo(InCapacity));
+	for (uint32 Index = 0; Index < InCapacity; ++Index)
+	{
+		Keys[Index].store(nullptr, std::memory_order_relaxed);
+		Values[Index].store(nullptr, std::memory_order_relaxed);
+	}
+}
+
+const FUniqueNetIdEOSRef* FUniqueNetIdEOSRegistry::FHandleIndex::Find(const void* Handle) const
+{
+	if (const FTable* Table = Current.load(std::memory_order_acquire))
+	{
+		// Tables are never more than half full, so the probe always reaches an empty slot
+		for (uint32 Index = ::GetTypeHash(Handle) & Table->Mask;; Index = (Index + 1) & Table->Mask)
+		{
+			const void* Key = Table->Keys[Index].load(std::memory_order_acquire);
+			if (Key == Handle)
+			{
+				return Table->Values[Index].load(std::memory_order_acquire);
+			}
+			if (!Key)
+			{
+				break;
+			}
+		}
+	}
+	return nullptr;
+}
+
+void FUniqueNetIdEOSRegistry::FHandleIndex::Add(const void* Handle, const FUniqueNetIdEOSRef* NetId)
+{
+	FTable* Table = Current.load(std::memory_order_relaxed);
+	if (!Table || uint32(Table->Num + 1) * 2 > Table->Mask + 1)
+	{
+		TUniquePtr<FTable> NewTable = MakeUnique<FTable>(Table ? (Table->Mask + 1) * 2 : HandleIndexInitialCapacity);
+		if (Table)
+		{
+			for (uint32 Index = 0; Index <= Table->Mask; ++Index)
+			{
+				if (const void* Key = Table->Keys[Index].load(std::memory_order_relaxed))
+				{
+					Insert(*NewTable, Key, Table->Values[Index].load(std::memory_order_relaxed));
+				}
+			}
+		}
+		Table = NewTable.Get();
+		// The old table stays alive, readers may still be probing it
+		Tables.Emplace(MoveTemp(NewTable));
+		Current.store(Table, std::memory_order_release);
+	}
+	Insert(*Table, Handle, NetId);
+}
+
+void FUniqueNetIdEOSRegistry::FHandleIndex::Insert(FTable& Table, const void* Handle, const FUniqueNetIdEOSRef* NetId)
+{
+	for (uint32 Index = ::GetTypeHash(Handle) & Table.Mask;; Index = (Index + 1) & Table.Mask)
+	{
+		const void* Key = Table.Keys[Index].load(std::memory_order_relaxed);
+		if (Key == Handle)
+		{
+			Table.Values[Index].store(NetId, std::memory_order_release);
+			return;
+		}
+		if (!Key)
+		{
+			// Publish the value before the key, a reader that finds the key must see the value
+			Table.Values[Index].store(NetId, std::memory_order_relaxed);
+			Table.Keys[Index].store(Handle, std::memory_order_release);
+			++Table.Num;
+			return;
+		}
+	}
 }
 
 FUniqueNetIdEOSRegistry& FUniqueNetIdEOSRegistry::Get()
@@ -116,27 +278,30 @@ FUniqueNetIdEOSRegistry& FUniqueNetIdEOSRegistry::Get()
 
 FUniqueNetIdEOSPtr FUniqueNetIdEOSRegistry::FindOrAddImpl(const FString& NetIdStr)
 {
-	FString EpicAccountIdStr;
-	FString ProductUserIdStr;
-	if (!NetIdStr.Split(EOS_ID_SEPARATOR, &EpicAccountIdStr, &ProductUserIdStr)
-		|| (!EpicAccountIdStr.IsEmpty() && EpicAccountIdStr.Len() != EOS_EPICACCOUNTID_MAX_LENGTH)
-		|| (!ProductUserIdStr.IsEmpty() && ProductUserIdStr.Len() != EOS_PRODUCTUSERID_MAX_LENGTH))
+	int32 SeparatorIndex = INDEX_NONE;
+	if (!NetIdStr.FindChar(EOS_ID_SEPARATOR[0], SeparatorIndex))
 	{
 		return nullptr;
 	}
 
-	EOS_EpicAccountId EpicAccountId = nullptr;
-	if (!EpicAccountIdStr.IsEmpty())
+	const TCHAR* EpicAccountIdStr = *NetIdStr;
+	const int32 EpicAccountIdLength = SeparatorIndex;
+	const TCHAR* ProductUserIdStr = *NetIdStr + SeparatorIndex + 1;
+	const int32 ProductUserIdLength = NetIdStr.Len() - SeparatorIndex - 1;
+	if ((EpicAccountIdLength != 0 && EpicAccountIdLength != EOS_EPICACCOUNTID_MAX_LENGTH)
+		|| (ProductUserIdLength != 0 && ProductUserIdLength != EOS_PRODUCTUSERID_MAX_LENGTH))
 	{
-		EpicAccountId = EOS_EpicAccountId_FromString(TCHAR_TO_UTF8(*EpicAccountIdStr));
+		return nullptr;
 	}
-	EOS_ProductUserId ProductUserId = nullptr;
-	if (!ProductUserIdStr.IsEmpty())
+
+	// Decode to the binary form first, the bytes constructor then resolves both handles without any string copies
+	uint8 Bytes[EOS_ID_BYTE_SIZE] = { 0 };
+	if ((EpicAccountIdLength != 0 && !HexToIdHalf(EpicAccountIdStr, Bytes))
+		|| (ProductUserIdLength != 0 && !HexToIdHalf(ProductUserIdStr, Bytes + ID_HALF_BYTE_SIZE)))
 	{
-		ProductUserId = EOS_ProductUserId_FromString(TCHAR_TO_UTF8(*ProductUserIdStr));
+		return nullptr;
 	}
-
-	return FindOrAddImpl(EpicAccountId, ProductUserId);
+	return FindOrAddImpl(Bytes, EOS_ID_BYTE_SIZE);
 }
 
 FUniqueNetIdEOSPtr FUniqueNetIdEOSRegistry::FindOrAddImpl(const uint8* Bytes, int32 Size)
@@ -152,88 +317,80 @@ FUniqueNetIdEOSPtr FUniqueNetIdEOSRegistry::FindOrAddImpl(const uint8* Bytes, in
 
 FUniqueNetIdEOSPtr FUniqueNetIdEOSRegistry::FindOrAddImpl(const EOS_EpicAccountId InEpicAccountId, const EOS_ProductUserId InProductUserId)
 {
-	FUniqueNetIdEOSPtr Result;
 	const bool bInEpicAccountIdValid = EOS_EpicAccountId_IsValid(InEpicAccountId) == EOS_TRUE;
 	const bool bInProductUserIdValid = EOS_ProductUserId_IsValid(InProductUserId) == EOS_TRUE;
-	if (bInEpicAccountIdValid || bInProductUserIdValid)
+	if (!bInEpicAccountIdValid && !bInProductUserIdValid)
 	{
-		bool bUpdateEpicAccountId = false;
-		bool bUpdateProductUserId = false;
+		return nullptr;
+	}
 
-		auto FindExisting = [this, InEpicAccountId, InProductUserId, bInEpicAccountIdValid, bInProductUserIdValid, &bUpdateEpicAccountId, &bUpdateProductUserId]()
+	auto FindExisting = [this, InEpicAccountId, InProductUserId, bInEpicAccountIdValid, bInProductUserIdValid]()
+	{
+		const FUniqueNetIdEOSRef* Found = bInEpicAccountIdValid ? EasToNetId.Find(InEpicAccountId) : nullptr;
+		if (!Found && bInProductUserIdValid)
 		{
-			FUniqueNetIdEOSPtr Result;
-			if (const FUniqueNetIdEOSRef* FoundEas = bInEpicAccountIdValid ? EasToNetId.Find(InEpicAccountId) : nullptr)
-			{
-				Result = *FoundEas;
-			}
-			else if (const FUniqueNetIdEOSRef* FoundProd = bInProductUserIdValid ? PuidToNetId.Find(InProductUserId) : nullptr)
-			{
-				Result = *FoundProd;
-			}
-
-			if (Result.IsValid())
-			{
-				const EOS_EpicAccountId FoundEpicAccountId = Result->GetEpicAccountId();
-				const EOS_ProductUserId FoundProductUserId = Result->GetProductUserId();
-				const bool bFoundEpicAccountIdValid = EOS_EpicAccountId_IsValid(FoundEpicAccountId) == EOS_TRUE;
-				const bool bFoundProductUserIdValid = EOS_ProductUserId_IsValid(FoundProductUserId) == EOS_TRUE;
-
-				// Check that the found EAS/EOS ids are either unset, or match the input. If a valid input is passed for a currently unset field, this is an update
-				check(!bFoundEpicAccountIdValid || !bInEpicAccountIdValid || InEpicAccountId == FoundEpicAccountId);
-				check(!bFoundProductUserIdValid || !bInProductUserIdValid || InProductUserId == FoundProductUserId);
-				bUpdateEpicAccountId = !bFoundEpicAccountIdValid && bInEpicAccountIdValid;
-				bUpdateProductUserId = !bFoundProductUserIdValid && bInProductUserIdValid;
-
-			}
-			return Result;
-		};
-
+			Found = PuidToNetId.Find(InProductUserId);
+		}
+		return Found;
+	};
 
+	bool bUpdateEpicAccountId = false;
+	bool bUpdateProductUserId = false;
+	auto CheckForUpdate = [InEpicAccountId, InProductUserId, bInEpicAccountIdValid, bInProductUserIdValid, &bUpdateEpicAccountId, &bUpdateProductUserId](const FUniqueNetIdEOS& Found)
+	{
+		const EOS_EpicAccountId FoundEpicAccountId = Found.GetEpicAccountId();
+		const EOS_ProductUserId FoundProductUserId = Found.GetProductUserId();
+		const bool bFoundEpicAccountIdValid = EOS_EpicAccountId_IsValid(FoundEpicAccountId) == EOS_TRUE;
+		const bool bFoundProductUserIdValid = EOS_ProductUserId_IsValid(FoundProductUserId) == EOS_TRUE;
+
+		// Check that the found EAS/EOS ids are either unset, or match the input. If a valid input is passed for a currently unset field, this is an update
+		check(!bFoundEpicAccountIdValid || !bInEpicAccountIdValid || InEpicAccountId == FoundEpicAccountId);
+		check(!bFoundProductUserIdValid || !bInProductUserIdValid || InProductUserId == FoundProductUserId);
+		bUpdateEpicAccountId = !bFoundEpicAccountIdValid && bInEpicAccountIdValid;
+		bUpdateProductUserId = !bFoundProductUserIdValid && bInProductUserIdValid;
+		return bUpdateEpicAccountId || bUpdateProductUserId;
+	};
+
+	// Lock free lookup, which is all it takes once a player's id is complete
+	if (const FUniqueNetIdEOSRef* Found = FindExisting())
+	{
+		if (!CheckForUpdate(**Found))
 		{
-			// First take read lock and look for existing elements
-			const FReadScopeLock ReadLock(Lock);
-			Result = FindExisting();
+			return *Found;
 		}
+	}
 
-		if (!Result.IsValid())
+	// Look again under the lock, in case another thread raced with us and added or updated the id
+	const FScopeLock ScopeLock(&Lock);
+	const FUniqueNetIdEOSRef* Found = FindExisting();
+	if (!Found)
+	{
+		// if we didn't find one we can create a new one
+		Found = NetIds.Emplace_GetRef(MakeUnique<FUniqueNetIdEOSRef>(FUniqueNetIdEOS::Create(InEpicAccountId, InProductUserId))).Get();
+		if (bInEpicAccountIdValid)
 		{
-			// Double-checked locking. If we didn't find an element, we take the write lock, and look again, in case another thread raced with us and added one.
-			const FWriteScopeLock WriteLock(Lock);
-			Result = FindExisting();
-
-			if (!Result.IsValid())
-			{
-				// if we didn't find one we can create a new one
-				Result = FUniqueNetIdEOS::Create(InEpicAccountId, InProductUserId);
-				if (bInEpicAccountIdValid)
-				{
-					EasToNetId.Emplace(InEpicAccountId, Result.ToSharedRef());
-				}
-				if (bInProductUserIdValid)
-				{
-					PuidToNetId.Emplace(InProductUserId, Result.ToSharedRef());
-				}
-			}
+			EasToNetId.Add(InEpicAccountId, Found);
 		}
-
-		check(Result.IsValid());
-		if (bUpdateEpicAccountId || bUpdateProductUserId)
+		if (bInProductUserIdValid)
 		{
-			// Finally, update any previously unset fields for which we now have a valid value.
-			const FWriteScopeLock WriteLock(Lock);
-			if (bUpdateEpicAccountId)
-			{
-				EasToNetId.Emplace(InEpicAccountId, Result.ToSharedRef());
-				*ConstCastSharedPtr<FUniqueNetIdEOS>(Result) = FUniqueNetIdEOS(InEpicAccountId, Result->GetProductUserId());
-			}
-			if (bUpdateProductUserId)
-			{
-				PuidToNetId.Emplace(InProductUserId, Result.ToSharedRef());
-				*ConstCastSharedPtr<FUniqueNetIdEOS>(Result) = FUniqueNetIdEOS(Result->GetEpicAccountId(), InProductUserId);
-			}
+			PuidToNetId.Add(InProductUserId, Found);
 		}
+		return *Found;
 	}
 
-	return Result;
+	if (CheckForUpdate(**Found))
+	{
+		// Finally, update any previously unset fields for which we now have a valid value.
+		FUniqueNetIdEOS& NetId = ConstCastSharedRef<FUniqueNetIdEOS>(*Found).Get();
+		NetId.Update(bUpdateEpicAccountId ? InEpicAccountId : NetId.GetEpicAccountId(), bUpdateProductUserId ? InProductUserId : NetId.GetProductUserId());
+		if (bUpdateEpicAccountId)
+		{
+			EasToNetId.Add(InEpicAccountId, Found);
+		}
+		if (bUpdateProductUserId)
+		{
+			PuidToNetId.Add(InProductUserId, Found);
+		}
+	}
+	return *Found;
 }
@@ -12,6 +12,8 @@
 #include "OnlineSubsystem.h"
 #include "OnlineSubsystemTypes.h"
 
+#include <atomic>
+
 #define EOS_OSS_STRING_BUFFER_LENGTH 256 + 1 // 256 plus null terminator
 
 class FOnlineSubsystemEOS;
@@ -26,6 +28,10 @@ typedef TSharedRef<const class FUniqueNetIdEOS> FUniqueNetIdEOSRef;
 
 /**
  * Unique net id wrapper for a EOS account ids.
+ *
+ * Every id is interned by FUniqueNetIdEOSRegistry, so there is exactly one instance per player and it lives as long
+ * as the registry. The hash is computed from the id's bytes when it is interned and kept when the registry later fills
+ * in the missing EAS or PUID half, so an id can be used as a map key before and after it is completed.
  */
 class FUniqueNetIdEOS : public FUniqueNetId
 {
@@ -47,7 +53,7 @@ public:
 	virtual uint32 GetTypeHash() const;
 	friend uint32 GetTypeHash(const FUniqueNetIdEOS& A)
 	{
-		return ::GetTypeHash(A.EpicAccountId);
+		return A.GetTypeHash();
 	}
 #endif
 	virtual FString ToString() const override;
@@ -67,9 +73,13 @@ private:
 	EOS_EpicAccountId EpicAccountId = nullptr;
 	EOS_ProductUserId ProductUserId = nullptr;
 	uint8 RawBytes[EOS_ID_BYTE_SIZE] = { 0 };
+	uint32 Hash = 0;
 
 	friend class FUniqueNetIdEOSRegistry;
 
+	/** Fill in a previously unset half of the id, keeping the hash the id was interned with */
+	void Update(EOS_EpicAccountId InEpicAccountId, EOS_ProductUserId InProductUserId);
+
 	template<typename... TArgs>
 	static FUniqueNetIdEOSRef Create(TArgs&&... Args)
 	{
@@ -82,6 +92,28 @@ private:
 	explicit FUniqueNetIdEOS(EOS_EpicAccountId InEpicAccountId, EOS_ProductUserId InProductUserId);
 };
 
+/** Key funcs for maps keyed by interned EOS net ids. Interned ids are never freed, so the raw pointer is a safe key */
+template<typename ValueType>
+struct TUniqueNetIdEOSKeyFuncs : BaseKeyFuncs<TPair<const FUniqueNetIdEOS*, ValueType>, const FUniqueNetIdEOS*, false>
+{
+	static const FUniqueNetIdEOS* GetSetKey(const TPair<const FUniqueNetIdEOS*, ValueType>& Element)
+	{
+		return Element.Key;
+	}
+	static bool Matches(const FUniqueNetIdEOS* A, const FUniqueNetIdEOS* B)
+	{
+		return A == B || *A == *B;
+	}
+	static uint32 GetKeyHash(const FUniqueNetIdEOS* Key)
+	{
+		return Key->GetTypeHash();
+	}
+};
+
+/** Map from an interned EOS net id to ValueType, looked up without building the id's string form */
+template<typename ValueType>
+using TUniqueNetIdEOSMap = TMap<const FUniqueNetIdEOS*, ValueType, FDefaultSetAllocator, TUniqueNetIdEOSKeyFuncs<ValueType>>;
+
 class FUniqueNetIdEOSRegistry
 {
 public:
@@ -90,9 +122,40 @@ public:
 	static FUniqueNetIdEOSPtr FindOrAdd(EOS_EpicAccountId EpicAccountId, EOS_ProductUserId ProductUserId) { return Get().FindOrAddImpl(EpicAccountId, ProductUserId); }
 
 private:
-	FRWLock Lock;
-	TMap<EOS_EpicAccountId, FUniqueNetIdEOSRef> EasToNetId;
-	TMap<EOS_ProductUserId, FUniqueNetIdEOSRef> PuidToNetId;
+	/**
+	 * Insert only open addressing table from an EOS handle to its interned net id. Lookups are lock free, inserts
+	 * happen under the registry's lock. Growing publishes a new table and keeps the old ones alive, so a reader that
+	 * loaded a table before it was replaced can keep using it.
+	 */
+	class FHandleIndex
+	{
+	public:
+		const FUniqueNetIdEOSRef* Find(const void* Handle) const;
+		void Add(const void* Handle, const FUniqueNetIdEOSRef* NetId);
+
+	private:
+		struct FTable
+		{
+			explicit FTable(uint32 InCapacity);
+
+			const uint32 Mask;
+			int32 Num = 0;
+			TUniquePtr<std::atomic<const void*>[]> Keys;
+			TUniquePtr<std::atomic<const FUniqueNetIdEOSRef*>[]> Values;
+		};
+
+		static void Insert(FTable& Table, const void* Handle, const FUniqueNetIdEOSRef* NetId);
+
+		std::atomic<FTable*> Current { nullptr };
+		TArray<TUniquePtr<FTable>> Tables;
+	};
+
+	/** Serializes inserts and updates, lookups never take it */
+	FCriticalSection Lock;
+	/** Owns every interned id, the indices point into it */
+	TArray<TUniquePtr<FUniqueNetIdEOSRef>> NetIds;
+	FHandleIndex EasToNetId;
+	FHandleIndex PuidToNetId;
 
 	static FUniqueNetIdEOSRegistry& Get();
 
@@ -358,27 +421,37 @@ class TEOSCallback :
 	public FCallbackBase
 {
 public:
-	TFunction<void(const CallbackType*)> CallbackLambda;
+	TEIKCallbackFunction<void(const CallbackType*)> CallbackLambda;
 
 #if ENGINE_MAJOR_VERSION == 5
 	TEOSCallback(TWeakPtr<OwningType> InOwner)
 	: FCallbackBase()
 	, Owner(InOwner)
 	{
+		FEIKSDKActivity::AddPendingRequest();
+		TEIKCallbackTypeStats<CallbackType>::Get().OnCreated();
 	}
 	TEOSCallback(TWeakPtr<const OwningType> InOwner)
 		: FCallbackBase()
 		, Owner(InOwner)
 	{
+		FEIKSDKActivity::AddPendingRequest();
+		TEIKCallbackTypeStats<CallbackType>::Get().OnCreated();
 	}
 #else
 	TEOSCallback()
 	{
-
+		FEIKSDKActivity::AddPendingRequest();
+		TEIKCallbackTypeStats<CallbackType>::Get().OnCreated();
 	}
 #endif
 	
-	virtual ~TEOSCallback() = default;
+	/** Each callback object is one request in flight until it is completed and deleted */
+	virtual ~TEOSCallback()
+	{
+		FEIKSDKActivity::RemovePendingRequest();
+		TEIKCallbackTypeStats<CallbackType>::Get().OnDestroyed();
+	}
 
 
 	CallbackFuncType GetCallbackPtr()
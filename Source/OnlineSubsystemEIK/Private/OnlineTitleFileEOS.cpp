@@ -45,19 +45,20 @@ void FEOSTitleFile::Unload()
 
 bool FOnlineTitleFileEOS::GetFileContents(const FString& FileName, TArray<uint8>& FileContents)
 {
-	FEOSTitleFile* File = FileSet.Find(FileName);
-	if (File != nullptr)
+	const TSharedRef<FEOSTitleFile>* FoundFile = FileSet.Find(FileName);
+	if (FoundFile != nullptr)
 	{
-		if (File->bIsLoaded)
+		FEOSTitleFile& File = FoundFile->Get();
+		if (File.bIsLoaded)
 		{
-			FileContents = File->Contents;
+			FileContents = File.Contents;
 			UE_LOG_ONLINE_TITLEFILE(Verbose, TEXT("GetFileContents() got data for (%s), %d bytes"), *FileName, FileContents.Num());
 			return true;
 		}
 		else
 		{
 			// Are we still downloading?
-			if (File->bInProgress)
+			if (File.bInProgress)
 			{
 				UE_LOG_ONLINE_TITLEFILE(Warning, TEXT("GetFileContents() file (%s) is being read"), *FileName);
 			}
@@ -78,20 +79,19 @@ bool FOnlineTitleFileEOS::GetFileContents(const FString& FileName, TArray<uint8>
 
 bool FOnlineTitleFileEOS::ClearFiles()
 {
-	for (TPair<FString, FEOSTitleFile>& TitleFile : FileSet)
+	for (TPair<FString, TSharedRef<FEOSTitleFile>>& TitleFile : FileSet)
 	{
-		FEOSTitleFile& File = TitleFile.Value;
-		File.Unload();
+		TitleFile.Value->Unload();
 	}
 	return true;
 }
 
 bool FOnlineTitleFileEOS::ClearFile(const FString& FileName)
 {
-	FEOSTitleFile* File = FileSet.Find(FileName);
+	const TSharedRef<FEOSTitleFile>* File = FileSet.Find(FileName);
 	if (File != nullptr)
 	{
-		File->Unload();
+		(*File)->Unload();
 		return true;
 	}
 	return false;
@@ -99,9 +99,11 @@ bool FOnlineTitleFileEOS::ClearFile(const FString& FileName)
 
 void FOnlineTitleFileEOS::DeleteCachedFiles(bool bSkipEnumerated)
 {
-	if (bSkipEnumerated)
+	// The SDK cache can only be deleted as a whole, so keep it while it holds enumerated files
+	if (bSkipEnumerated && QueryFileSet.Num() > 0)
 	{
-		UE_LOG_ONLINE_TITLEFILE(Warning, TEXT("DeleteCachedFiles() bSkipEnumerated option ignored"));
+		UE_LOG_ONLINE_TITLEFILE(Verbose, TEXT("DeleteCachedFiles() skipped, %d enumerated files are cached"), QueryFileSet.Num());
+		return;
 	}
 
 	EOS_TitleStorage_DeleteCacheOptions DeleteCacheOptions = { };
@@ -148,6 +150,8 @@ bool FOnlineTitleFileEOS::EnumerateFiles(const FPagedQuery& Page)
 
 	if (!bStarted)
 	{
+		// No query will complete to start a pending prefetch
+		bPrefetchOnEnumerate = false;
 		EOSSubsystem->ExecuteNextTick([this, ErrorStr]()
 		{
 			UE_LOG_ONLINE_TITLEFILE(Error, TEXT("EnumerateFiles() %s"), *ErrorStr);
@@ -213,7 +217,12 @@ bool FOnlineTitleFileEOS::EnumerateFiles(const FPagedQuery& Page)
 				{
 					if (FileMetadata && FileMetadata->Filename)
 					{
-						QueryFileSet.Emplace(FCloudFileHeader(ANSI_TO_TCHAR(FileMetadata->Filename), ANSI_TO_TCHAR(FileMetadata->Filename), FileMetadata->FileSizeBytes));
+						FCloudFileHeader& FileHeader = QueryFileSet.Emplace_GetRef(ANSI_TO_TCHAR(FileMetadata->Filename), ANSI_TO_TCHAR(FileMetadata->Filename), FileMetadata->FileSizeBytes);
+						if (FileMetadata->MD5Hash)
+						{
+							FileHeader.Hash = ANSI_TO_TCHAR(FileMetadata->MD5Hash);
+							FileHeader.HashType = TEXT("MD5");
+						}
 						UE_LOG_ONLINE_TITLEFILE(VeryVerbose, TEXT("Metadata for (%s), size %d"), ANSI_TO_TCHAR(FileMetadata->Filename), FileMetadata->FileSizeBytes);
 					}
 					EOS_TitleStorage_FileMetadata_Release(FileMetadata);
@@ -232,6 +241,19 @@ bool FOnlineTitleFileEOS::EnumerateFiles(const FPagedQuery& Page)
 		}
 
 		TriggerOnEnumerateFilesCompleteDelegates(bWasSuccessful, *ErrorStr);
+
+		if (bPrefetchOnEnumerate)
+		{
+			bPrefetchOnEnumerate = false;
+			if (bWasSuccessful)
+			{
+				for (const FCloudFileHeader& FileHeader : QueryFileSet)
+				{
+					PrefetchQueue.AddUnique(FileHeader.FileName);
+				}
+				PumpPrefetchQueue();
+			}
+		}
 	};
 
 	EOS_TitleStorage_QueryFileList(EOSSubsystem->TitleStorageHandle, &QueryFileListOptions, CallbackObj, CallbackObj->GetCallbackPtr());
@@ -245,113 +267,181 @@ void FOnlineTitleFileEOS::GetFileList(TArray<FCloudFileHeader>& Files)
 }
 
 bool FOnlineTitleFileEOS::ReadFile(const FString& FileName)
+{
+	return ReadFileInternal(FileName, false);
+}
+
+bool FOnlineTitleFileEOS::PrefetchFiles(const FPagedQuery& Page)
+{
+	MaxConcurrentPrefetches = FMath::Max(UEIKSettings::GetSettings().TitleStorageMaxConcurrentPrefetches, 1);
+
+	bPrefetchOnEnumerate = true;
+	if (!EnumerateFiles(Page))
+	{
+		bPrefetchOnEnumerate = false;
+		return false;
+	}
+	return true;
+}
+
+void FOnlineTitleFileEOS::PumpPrefetchQueue()
+{
+	while (PrefetchQueue.Num() > 0 && NumPrefetchReadsInFlight < MaxConcurrentPrefetches)
+	{
+		const FString FileName = PrefetchQueue[0];
+		PrefetchQueue.RemoveAt(0);
+
+		// Files already being read are left to finish on their own, loaded files are only read again if they changed
+		const TSharedRef<FEOSTitleFile>* ExistingTitleFile = FileSet.Find(FileName);
+		if (ExistingTitleFile != nullptr)
+		{
+			const FEOSTitleFile& ExistingFile = ExistingTitleFile->Get();
+			const FCloudFileHeader* FileHeader = FindEnumeratedFile(FileName);
+			if (ExistingFile.bInProgress || (ExistingFile.bIsLoaded && FileHeader && FileHeader->Hash == ExistingFile.Hash))
+			{
+				continue;
+			}
+		}
+
+		NumPrefetchReadsInFlight++;
+		ReadFileInternal(FileName, true);
+	}
+}
+
+const FCloudFileHeader* FOnlineTitleFileEOS::FindEnumeratedFile(const FString& FileName) const
+{
+	return QueryFileSet.FindByPredicate([&FileName](const FCloudFileHeader& FileHeader) { return FileHeader.FileName == FileName; });
+}
+
+void FOnlineTitleFileEOS::FinishReadFile(bool bWasSuccessful, const FString& FileName, bool bIsPrefetch)
+{
+	// Prefetches are internal, the game is only told about the reads it asked for
+	if (bIsPrefetch)
+	{
+		NumPrefetchReadsInFlight--;
+		PumpPrefetchQueue();
+	}
+	else
+	{
+		TriggerOnReadFileCompleteDelegates(bWasSuccessful, FileName);
+	}
+}
+
+bool FOnlineTitleFileEOS::ReadFileInternal(const FString& FileName, bool bIsPrefetch)
 {
 	// If this file is already downloading, dont try to start it again.
 	// Do allow the re-reading of files previously cleared, or already loaded files that may have changed in the cloud.
-	FEOSTitleFile *ExistingTitleFile = FileSet.Find(FileName);
-	if (ExistingTitleFile != nullptr && ExistingTitleFile->bInProgress)
+	const TSharedRef<FEOSTitleFile>* ExistingTitleFile = FileSet.Find(FileName);
+	if (ExistingTitleFile != nullptr && (*ExistingTitleFile)->bInProgress)
 	{
-		EOSSubsystem->ExecuteNextTick([this, FileName]()
+		// The game asking for a file that is being prefetched takes the prefetch over, so it gets the completion
+		FEOSTitleFile& ExistingFile = ExistingTitleFile->Get();
+		if (!bIsPrefetch && ExistingFile.bIsPrefetch)
+		{
+			UE_LOG_ONLINE_TITLEFILE(Verbose, TEXT("ReadFile() attached to prefetch of (%s)"), *FileName);
+			ExistingFile.bIsPrefetch = false;
+			NumPrefetchReadsInFlight--;
+			PumpPrefetchQueue();
+			return true;
+		}
+
+		EOSSubsystem->ExecuteNextTick([this, FileName, bIsPrefetch]()
 		{
 			UE_LOG_ONLINE_TITLEFILE(Warning, TEXT("ReadFile() already being read (%s)"), *FileName);
-			TriggerOnReadFileCompleteDelegates(false, FileName);
+			FinishReadFile(false, FileName, bIsPrefetch);
 		});
 		return true;
 	}
 
+	TSharedRef<FEOSTitleFile> TitleFile = MakeShared<FEOSTitleFile>();
+	TitleFile->Filename = FileName;
+	TitleFile->bIsPrefetch = bIsPrefetch;
+	if (const FCloudFileHeader* FileHeader = FindEnumeratedFile(FileName))
+	{
+		TitleFile->Hash = FileHeader->Hash;
+	}
+
 #if ENGINE_MAJOR_VERSION == 5
 	FReadTitleFileCompleteCallback* CallbackObj = new FReadTitleFileCompleteCallback(FOnlineTitleFileEOSWeakPtr(AsShared()));
 #else
 	FReadTitleFileCompleteCallback* CallbackObj = new FReadTitleFileCompleteCallback();
 #endif
 	
-	CallbackObj->SetNested1CallbackLambda([this](const EOS_TitleStorage_ReadFileDataCallbackInfo* Data)
+	CallbackObj->SetNested1CallbackLambda([TitleFile](const EOS_TitleStorage_ReadFileDataCallbackInfo* Data)
 	{
 		UE_LOG_ONLINE_TITLEFILE(VeryVerbose, TEXT("Read file data (%s) %d bytes"), ANSI_TO_TCHAR(Data->Filename), Data->DataChunkLengthBytes);
-		FEOSTitleFile* TitleFile = FileSet.Find(FString(ANSI_TO_TCHAR(Data->Filename)));
-		if (TitleFile != nullptr)
+		check(TitleFile->bInProgress);
+		// Is this is the first chunk of data we have received for this file?
+		if (TitleFile->ContentSize == 0 && TitleFile->ContentIndex == 0)
 		{
-			check(TitleFile->bInProgress);
-			// Is this is the first chunk of data we have received for this file?
-			if (TitleFile->ContentSize == 0 && TitleFile->ContentIndex == 0)
-			{
-				// Store the actual size of the file being read
-				TitleFile->ContentSize = Data->TotalFileSizeBytes;
+			// Store the actual size of the file being read
+			TitleFile->ContentSize = Data->TotalFileSizeBytes;
 
-				// Is the file being read empty?
-				if (TitleFile->ContentSize == 0)
-				{
-					return EOS_TitleStorage_EReadResult::EOS_TS_RR_ContinueReading;
-				}
-
-				TitleFile->Contents.AddUninitialized(Data->TotalFileSizeBytes);
-			}
-
-			if (TitleFile->ContentIndex + Data->DataChunkLengthBytes <= TitleFile->ContentSize)
+			// Is the file being read empty?
+			if (TitleFile->ContentSize == 0)
 			{
-				check(Data->DataChunkLengthBytes > 0);
-				FMemory::Memcpy(TitleFile->Contents.GetData()+ TitleFile->ContentIndex, Data->DataChunk, Data->DataChunkLengthBytes);
-				TitleFile->ContentIndex += Data->DataChunkLengthBytes;
 				return EOS_TitleStorage_EReadResult::EOS_TS_RR_ContinueReading;
 			}
-			else
-			{
-				UE_LOG_ONLINE_TITLEFILE(Warning, TEXT("EOS_TitleStorage_ReadFile() read size exceeded specified file size (%s)"), ANSI_TO_TCHAR(Data->Filename));
-				return EOS_TitleStorage_EReadResult::EOS_TS_RR_FailRequest;
-			}
+
+			TitleFile->Contents.AddUninitialized(Data->TotalFileSizeBytes);
+		}
+
+		if (TitleFile->ContentIndex + Data->DataChunkLengthBytes <= TitleFile->ContentSize)
+		{
+			check(Data->DataChunkLengthBytes > 0);
+			FMemory::Memcpy(TitleFile->Contents.GetData() + TitleFile->ContentIndex, Data->DataChunk, Data->DataChunkLengthBytes);
+			TitleFile->ContentIndex += Data->DataChunkLengthBytes;
+			return EOS_TitleStorage_EReadResult::EOS_TS_RR_ContinueReading;
 		}
 		else
 		{
-			UE_LOG_ONLINE_TITLEFILE(Warning, TEXT("EOS_TitleStorage_ReadFile() unknown file cancelling transfer request (%s)"), ANSI_TO_TCHAR(Data->Filename));
+			UE_LOG_ONLINE_TITLEFILE(Warning, TEXT("EOS_TitleStorage_ReadFile() read size exceeded specified file size (%s)"), ANSI_TO_TCHAR(Data->Filename));
+			return EOS_TitleStorage_EReadResult::EOS_TS_RR_FailRequest;
 		}
-
-		return EOS_TitleStorage_EReadResult::EOS_TS_RR_CancelRequest;
 	});
 
-	CallbackObj->SetNested2CallbackLambda([this](const EOS_TitleStorage_FileTransferProgressCallbackInfo* Data)
+	CallbackObj->SetNested2CallbackLambda([this, FileName](const EOS_TitleStorage_FileTransferProgressCallbackInfo* Data)
 	{
 		float Megabytesdone = Data->BytesTransferred / (1024.0f * 1024.0f);
 		float MegabytesTotal = Data->TotalFileSizeBytes / (1024.0f * 1024.0f);
 		float FPercentagedone = (Megabytesdone / MegabytesTotal);
 		uint64 percentagedone = (uint64)(FPercentagedone * 100.0f);
-		UE_LOG_ONLINE_TITLEFILE(VeryVerbose, TEXT("File transfer progress (%s) %llu bytes"), ANSI_TO_TCHAR(Data->Filename), percentagedone);
-		TriggerOnReadFileProgressDelegates(FString(ANSI_TO_TCHAR(Data->Filename)), percentagedone);
+		UE_LOG_ONLINE_TITLEFILE(VeryVerbose, TEXT("File transfer progress (%s) %llu bytes"), *FileName, percentagedone);
+		TriggerOnReadFileProgressDelegates(FileName, percentagedone);
 	});
 
-	CallbackObj->CallbackLambda = [this](const EOS_TitleStorage_ReadFileCallbackInfo* Data)
+	CallbackObj->CallbackLambda = [this, FileName, TitleFile](const EOS_TitleStorage_ReadFileCallbackInfo* Data)
 	{
 		bool bWasSuccessful = Data->ResultCode == EOS_EResult::EOS_Success;
 
-		FEOSTitleFile* TitleFile = FileSet.Find(FString(ANSI_TO_TCHAR(Data->Filename)));
-		if (TitleFile != nullptr)
+		if (TitleFile->FileTransferRequest != nullptr)
 		{
-			if (TitleFile->FileTransferRequest != nullptr)
-			{
-				EOS_TitleStorageFileTransferRequest_Release(TitleFile->FileTransferRequest);
-				TitleFile->FileTransferRequest = nullptr;
-			}
+			EOS_TitleStorageFileTransferRequest_Release(TitleFile->FileTransferRequest);
+			TitleFile->FileTransferRequest = nullptr;
+		}
 
-			if (bWasSuccessful)
-			{
-				TitleFile->bIsLoaded = true;
-				TitleFile->bInProgress = false;
-				UE_LOG_ONLINE_TITLEFILE(Verbose, TEXT("Read (%s), size %d"), *TitleFile->Filename, TitleFile->ContentSize);
-			}
-			else
-			{
-				// If we fail to complete reading the file, discard it from the known files
-				FileSet.Remove(FString(ANSI_TO_TCHAR(Data->Filename)));
+		TitleFile->bInProgress = false;
 
-				UE_LOG_ONLINE_TITLEFILE(Error, TEXT("EOS_TitleStorage_ReadFile() failed with error code (%s)"), ANSI_TO_TCHAR(EOS_EResult_ToString(Data->ResultCode)));
-			}
+		const TSharedRef<FEOSTitleFile>* CurrentTitleFile = FileSet.Find(FileName);
+		if (CurrentTitleFile == nullptr || *CurrentTitleFile != TitleFile)
+		{
+			bWasSuccessful = false;
+			UE_LOG_ONLINE_TITLEFILE(Warning, TEXT("EOS_TitleStorage_ReadFile() unknown transfer request (%s)"), *FileName);
+		}
+		else if (bWasSuccessful)
+		{
+			TitleFile->bIsLoaded = true;
+			UE_LOG_ONLINE_TITLEFILE(Verbose, TEXT("Read (%s), size %d"), *TitleFile->Filename, TitleFile->ContentSize);
 		}
 		else
 		{
-			bWasSuccessful = false;
-			UE_LOG_ONLINE_TITLEFILE(Warning, TEXT("EOS_TitleStorage_ReadFile() unknown transfer request (%s)"), ANSI_TO_TCHAR(Data->Filename));
+			// If we fail to complete reading the file, discard it from the known files
+			FileSet.Remove(FileName);
+
+			UE_LOG_ONLINE_TITLEFILE(Error, TEXT("EOS_TitleStorage_ReadFile() failed with error code (%s)"), ANSI_TO_TCHAR(EOS_EResult_ToString(Data->ResultCode)));
 		}
 
-		TriggerOnReadFileCompleteDelegates(bWasSuccessful, FString(ANSI_TO_TCHAR(Data->Filename)));
+		FinishReadFile(bWasSuccessful, FileName, TitleFile->bIsPrefetch);
 	};
 
 	FTCHARToUTF8 FileNameConverter(*FileName);
@@ -373,23 +463,22 @@ bool FOnlineTitleFileEOS::ReadFile(const FString& FileName)
 	ReadFileOptions.FileTransferProgressCallback = CallbackObj->GetNested2CallbackPtr();
 
 	UE_LOG_ONLINE_TITLEFILE(Verbose, TEXT("ReadFile() reading (%s)"), *FileName);
+	TitleFile->bInProgress = true;
 	EOS_HTitleStorageFileTransferRequest FileTransferRequest = EOS_TitleStorage_ReadFile(EOSSubsystem->TitleStorageHandle, &ReadFileOptions, CallbackObj, CallbackObj->GetCallbackPtr());
 
 	bool bStarted = (FileTransferRequest != nullptr);
 	if (bStarted)
 	{
-		FEOSTitleFile TitleFile;
-		TitleFile.Filename = FileName;
-		TitleFile.FileTransferRequest = FileTransferRequest;
-		TitleFile.bInProgress = true;
-		FileSet.FindOrAdd(FileName) = MoveTemp(TitleFile);			// Replace the last title file, or create a new entry
+		TitleFile->FileTransferRequest = FileTransferRequest;
+		FileSet.Add(FileName, TitleFile);			// Replace the last title file, or create a new entry
 	}
 	else
 	{
-		EOSSubsystem->ExecuteNextTick([this, FileName]()
+		TitleFile->bInProgress = false;
+		EOSSubsystem->ExecuteNextTick([this, FileName, bIsPrefetch]()
 		{
 			UE_LOG_ONLINE_TITLEFILE(Error, TEXT("ReadFile() failed to create a transfer request (%s)"), *FileName);
-			TriggerOnReadFileCompleteDelegates(false, FileName);
+			FinishReadFile(false, FileName, bIsPrefetch);
 		});
 	}
 
@@ -422,6 +511,19 @@ bool FOnlineTitleFileEOS::HandleTitleFileExec(UWorld* InWorld, const TCHAR* Cmd,
 		EnumerateFiles(FPagedQuery(Page));
 		return true;
 	}
+	else if (FParse::Command(&Cmd, TEXT("PREFETCH")))
+	{
+		FString PageString;
+		int32 Page = 0;
+
+		if (FParse::Token(Cmd, PageString, false))
+		{
+			Page = FCString::Atoi(*PageString);
+		}
+
+		PrefetchFiles(FPagedQuery(Page));
+		return true;
+	}
 	else if (FParse::Command(&Cmd, TEXT("GETFILELIST")))
 	{
 		TArray<FCloudFileHeader> Files;
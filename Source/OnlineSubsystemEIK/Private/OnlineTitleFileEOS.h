@@ -24,17 +24,22 @@ struct FEOSTitleFile
 	size_t ContentIndex;
 	bool bIsLoaded;
 	bool bInProgress;
+	/** Whether this read was queued by PrefetchFiles and has not been asked for by the game since */
+	bool bIsPrefetch;
 	FString Filename;
+	/** Enumerated MD5 hash of the file when it was read, empty if it was not enumerated */
+	FString Hash;
 	EOS_HTitleStorageFileTransferRequest FileTransferRequest;		// TODO: Mark.Fitt this does not auto release
 
-	FEOSTitleFile() : ContentSize(0), ContentIndex(0), bIsLoaded(false), bInProgress(false)
+	FEOSTitleFile() : ContentSize(0), ContentIndex(0), bIsLoaded(false), bInProgress(false), bIsPrefetch(false), FileTransferRequest(nullptr)
 	{
 	}
 
 	void Unload();
 };
 
-using FTitleFileCollection = TMap<FString, FEOSTitleFile>;
+/** Entries are shared so transfer callbacks can hold on to their file instead of looking it up per chunk */
+using FTitleFileCollection = TMap<FString, TSharedRef<FEOSTitleFile>>;
 
 class FOnlineTitleFileEOS
 	: public IOnlineTitleFile, public TSharedFromThis<FOnlineTitleFileEOS, ESPMode::ThreadSafe>
@@ -60,14 +65,33 @@ public:
 
 	bool HandleTitleFileExec(UWorld* InWorld, const TCHAR* Cmd, FOutputDevice& Ar);
 
+	/**
+	 * Enumerates the files of a tag page and reads all of them, a few at a time. Unchanged files come from the
+	 * SDK's encrypted cache without downloading. Prefetch reads do not trigger OnReadFileComplete.
+	 */
+	bool PrefetchFiles(const FPagedQuery& Page = FPagedQuery());
+
 protected:
 	FOnlineSubsystemEOS* EOSSubsystem;
 
 private:
+	bool ReadFileInternal(const FString& FileName, bool bIsPrefetch);
+	void FinishReadFile(bool bWasSuccessful, const FString& FileName, bool bIsPrefetch);
+	void PumpPrefetchQueue();
+	/** Finds the header of an enumerated file, nullptr if it was not part of the last enumeration */
+	const FCloudFileHeader* FindEnumeratedFile(const FString& FileName) const;
+
 	/** Results of the last file enumeration */
 	TArray<FCloudFileHeader> QueryFileSet;
 	/** The list of available files, indexed by filename that have been or are loaded */
 	FTitleFileCollection FileSet;
+
+	/** Set by PrefetchFiles to read every file once the pending enumeration completes */
+	bool bPrefetchOnEnumerate = false;
+	TArray<FString> PrefetchQueue;
+	int32 NumPrefetchReadsInFlight = 0;
+	/** Most prefetch reads in flight at once, read when PrefetchFiles is called */
+	int32 MaxConcurrentPrefetches = 4;
 };
 
 typedef TSharedPtr<FOnlineTitleFileEOS, ESPMode::ThreadSafe> FOnlineTitleFileEOSPtr;
@@ -7,6 +7,11 @@
 #include "OnlineSubsystemEOSTypes.h"
 #include "UserManagerEOS.h"
 #include "EIKSettings.h"
+#include "Async/Async.h"
+#include "Hash/CityHash.h"
+#include "Misc/Compression.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
 
 #if WITH_EOS_SDK
 #include "eos_playerdatastorage.h"
@@ -42,6 +47,264 @@ typedef TEOSCallbackWithNested2<EOS_PlayerDataStorage_OnReadFileCompleteCallback
 typedef TEOSCallback<EOS_PlayerDataStorage_OnDeleteFileCompleteCallback, EOS_PlayerDataStorage_DeleteFileCallbackInfo> FOnDeleteFileCallback;
 
 #endif
+/** Identifies user files written with an encoding header, files without it are read back as is */
+static const uint32 UserCloudFileMagic = 0x554B4945;
+static const uint8 UserCloudFileVersion = 1;
+static const int32 UserCloudFileHeaderSize = 12;
+/** Largest decoded size accepted from a header, so a corrupt or hostile file cannot make us allocate gigabytes */
+static const uint32 UserCloudMaxRawSize = 256 * 1024 * 1024;
+
+enum class EUserCloudFileEncoding : uint8
+{
+	Raw,
+	Compressed,
+	BlockManifest
+};
+
+enum class EUserCloudCompressionFormat : uint8
+{
+	None,
+	Zlib,
+	Oodle
+};
+
+static FName GetCompressionFormatName(EUserCloudCompressionFormat Format)
+{
+	switch (Format)
+	{
+	case EUserCloudCompressionFormat::Zlib:
+		return NAME_Zlib;
+	case EUserCloudCompressionFormat::Oodle:
+#if ENGINE_MAJOR_VERSION == 5
+		return NAME_Oodle;
+#else
+		return FName(TEXT("Oodle"));
+#endif
+	default:
+		return NAME_None;
+	}
+}
+
+static void WriteUserCloudFileHeader(TArray<uint8>& OutData, EUserCloudFileEncoding Encoding, EUserCloudCompressionFormat Format, uint32 RawSize)
+{
+	FMemoryWriter Writer(OutData);
+	uint32 Magic = UserCloudFileMagic;
+	uint8 Version = UserCloudFileVersion;
+	uint8 EncodingValue = (uint8)Encoding;
+	uint8 FormatValue = (uint8)Format;
+	uint8 Reserved = 0;
+	Writer << Magic << Version << EncodingValue << FormatValue << Reserved << RawSize;
+}
+
+/** Encodes Data with a header, compressing it when asked to and when that makes it smaller. Safe to call from any thread. */
+static void EncodeUserCloudData(const uint8* Data, int32 DataSize, bool bCompress, TArray<uint8>& OutData)
+{
+	OutData.Reset();
+
+	if (bCompress && DataSize > 0)
+	{
+#if ENGINE_MAJOR_VERSION == 5
+		const EUserCloudCompressionFormat Format = EUserCloudCompressionFormat::Oodle;
+#else
+		const EUserCloudCompressionFormat Format = EUserCloudCompressionFormat::Zlib;
+#endif
+		const FName FormatName = GetCompressionFormatName(Format);
+		int32 CompressedSize = FCompression::CompressMemoryBound(FormatName, DataSize);
+
+		WriteUserCloudFileHeader(OutData, EUserCloudFileEncoding::Compressed, Format, DataSize);
+		OutData.AddUninitialized(CompressedSize);
+		if (FCompression::CompressMemory(FormatName, OutData.GetData() + UserCloudFileHeaderSize, CompressedSize, Data, DataSize) && CompressedSize < DataSize)
+		{
+			OutData.SetNum(UserCloudFileHeaderSize + CompressedSize);
+			return;
+		}
+		OutData.Reset();
+	}
+
+	WriteUserCloudFileHeader(OutData, EUserCloudFileEncoding::Compressed, EUserCloudCompressionFormat::None, DataSize);
+	OutData.Append(Data, DataSize);
+}
+
+/** Decodes data read from the cloud, returning the encoding it was stored with */
+static bool DecodeUserCloudData(const TArray<uint8>& Data, TArray<uint8>& OutData, EUserCloudFileEncoding& OutEncoding)
+{
+	OutEncoding = EUserCloudFileEncoding::Raw;
+
+	uint32 Magic = 0;
+	if (Data.Num() >= UserCloudFileHeaderSize)
+	{
+		FMemoryReader Reader(Data);
+		Reader << Magic;
+	}
+	if (Magic != UserCloudFileMagic)
+	{
+		OutData = Data;
+		return true;
+	}
+
+	FMemoryReader Reader(Data);
+	uint8 Version = 0;
+	uint8 EncodingValue = 0;
+	uint8 FormatValue = 0;
+	uint8 Reserved = 0;
+	uint32 RawSize = 0;
+	Reader << Magic << Version << EncodingValue << FormatValue << Reserved << RawSize;
+	if (Version > UserCloudFileVersion)
+	{
+		UE_LOG_ONLINE_CLOUD(Warning, TEXT("[DecodeUserCloudData] Unsupported file version %d"), Version);
+		return false;
+	}
+
+	OutEncoding = (EUserCloudFileEncoding)EncodingValue;
+	const uint8* Payload = Data.GetData() + UserCloudFileHeaderSize;
+	const int32 PayloadSize = Data.Num() - UserCloudFileHeaderSize;
+
+	const EUserCloudCompressionFormat Format = (EUserCloudCompressionFormat)FormatValue;
+	if (Format == EUserCloudCompressionFormat::None)
+	{
+		if ((uint32)PayloadSize != RawSize)
+		{
+			UE_LOG_ONLINE_CLOUD(Warning, TEXT("[DecodeUserCloudData] Expected %u bytes, found %d"), RawSize, PayloadSize);
+			return false;
+		}
+		OutData.Reset(PayloadSize);
+		OutData.Append(Payload, PayloadSize);
+		return true;
+	}
+
+	if (RawSize > UserCloudMaxRawSize)
+	{
+		UE_LOG_ONLINE_CLOUD(Warning, TEXT("[DecodeUserCloudData] Decoded size %u exceeds the limit of %u bytes"), RawSize, UserCloudMaxRawSize);
+		return false;
+	}
+
+	const FName FormatName = GetCompressionFormatName(Format);
+	OutData.SetNumUninitialized(RawSize);
+	if (FormatName.IsNone() || !FCompression::UncompressMemory(FormatName, OutData.GetData(), RawSize, Payload, PayloadSize))
+	{
+		UE_LOG_ONLINE_CLOUD(Warning, TEXT("[DecodeUserCloudData] Failed to decompress %d bytes with format %d"), PayloadSize, FormatValue);
+		OutData.Reset();
+		return false;
+	}
+	return true;
+}
+
+static void EncodeBlockManifest(const FEOSUserCloudBlockManifest& Manifest, TArray<uint8>& OutData)
+{
+	TArray<uint8> ManifestData;
+	FMemoryWriter Writer(ManifestData);
+	uint32 BlockSize = Manifest.BlockSize;
+	uint32 TotalSize = Manifest.TotalSize;
+	int32 NumBlocks = Manifest.BlockHashes.Num();
+	Writer << BlockSize << TotalSize << NumBlocks;
+	for (uint64 BlockHash : Manifest.BlockHashes)
+	{
+		Writer << BlockHash;
+	}
+
+	OutData.Reset();
+	WriteUserCloudFileHeader(OutData, EUserCloudFileEncoding::BlockManifest, EUserCloudCompressionFormat::None, ManifestData.Num());
+	OutData.Append(ManifestData);
+}
+
+static bool DecodeBlockManifest(const TArray<uint8>& ManifestData, FEOSUserCloudBlockManifest& OutManifest)
+{
+	FMemoryReader Reader(ManifestData);
+	int32 NumBlocks = 0;
+	Reader << OutManifest.BlockSize << OutManifest.TotalSize << NumBlocks;
+	if (Reader.IsError() || OutManifest.BlockSize == 0 || OutManifest.TotalSize > UserCloudMaxRawSize || NumBlocks != (int32)FMath::DivideAndRoundUp(OutManifest.TotalSize, OutManifest.BlockSize))
+	{
+		return false;
+	}
+
+	OutManifest.BlockHashes.SetNumUninitialized(NumBlocks);
+	for (uint64& BlockHash : OutManifest.BlockHashes)
+	{
+		Reader << BlockHash;
+	}
+	return !Reader.IsError();
+}
+
+static FString GetBlockFileName(const FString& FileName, int32 BlockIndex, uint64 BlockHash)
+{
+	return FString::Printf(TEXT("%s.b%d.%016llx"), *FileName, BlockIndex, BlockHash);
+}
+
+/** Returns the length of the name of the file a block belongs to, or INDEX_NONE if it is not a block file name */
+static int32 GetBlockParentFileNameLen(const FString& BlockFileName)
+{
+	int32 DotIndex = INDEX_NONE;
+	if (!BlockFileName.FindLastChar(TEXT('.'), DotIndex) || BlockFileName.Len() - DotIndex - 1 != 16)
+	{
+		return INDEX_NONE;
+	}
+	const int32 BlockIndexStart = BlockFileName.Left(DotIndex).Find(TEXT(".b"), ESearchCase::CaseSensitive, ESearchDir::FromEnd);
+	return BlockIndexStart != INDEX_NONE && BlockFileName.Mid(BlockIndexStart + 2, DotIndex - BlockIndexStart - 2).IsNumeric() ? BlockIndexStart : INDEX_NONE;
+}
+
+static bool IsBlockFileName(const FString& FileName)
+{
+	return GetBlockParentFileNameLen(FileName) != INDEX_NONE;
+}
+
+static bool IsBlockFileOf(const FString& BlockFileName, const FString& FileName)
+{
+	return GetBlockParentFileNameLen(BlockFileName) == FileName.Len() && BlockFileName.StartsWith(FileName, ESearchCase::CaseSensitive);
+}
+
+/**
+ * Encodes a write for upload. With a block size set, large files are split into content addressed blocks
+ * and only the blocks not already stored for the file are uploaded. Safe to call from any thread.
+ */
+static void EncodeUserCloudWrite(const FString& FileName, bool bCompress, int32 BlockSize, const TSet<FString>& ExistingBlocks, FEOSUserCloudEncodedWrite& EncodedWrite)
+{
+	const int32 DataSize = EncodedWrite.Contents.Num();
+
+	// Every block name has to fit the SDK's file name limit
+	const bool bUseBlocks = BlockSize > 0 && DataSize > BlockSize
+		&& FTCHARToUTF8(*GetBlockFileName(FileName, DataSize / BlockSize, 0)).Length() < EOS_PLAYERDATASTORAGE_FILENAME_MAX_LENGTH_BYTES;
+	if (!bUseBlocks)
+	{
+		EncodeUserCloudData(EncodedWrite.Contents.GetData(), DataSize, bCompress, EncodedWrite.FileData);
+		EncodedWrite.StaleBlocks = ExistingBlocks.Array();
+		return;
+	}
+
+	// Blocks sit at fixed offsets, so inserting or removing bytes shifts every later block and they all get uploaded again
+	FEOSUserCloudBlockManifest& Manifest = EncodedWrite.Manifest;
+	Manifest.BlockSize = BlockSize;
+	Manifest.TotalSize = DataSize;
+
+	TSet<FString> BlockFileNames;
+	for (int32 Offset = 0, BlockIndex = 0; Offset < DataSize; Offset += BlockSize, ++BlockIndex)
+	{
+		const uint8* BlockData = EncodedWrite.Contents.GetData() + Offset;
+		const int32 BlockDataSize = FMath::Min(BlockSize, DataSize - Offset);
+		const uint64 BlockHash = CityHash64((const char*)BlockData, BlockDataSize);
+		Manifest.BlockHashes.Add(BlockHash);
+
+		const FString BlockFileName = GetBlockFileName(FileName, BlockIndex, BlockHash);
+		BlockFileNames.Add(BlockFileName);
+
+		// Block names carry their index and content hash, so a block already stored under its name is unchanged
+		if (!ExistingBlocks.Contains(BlockFileName))
+		{
+			TPair<FString, TArray<uint8>>& Block = EncodedWrite.Blocks.Emplace_GetRef(BlockFileName, TArray<uint8>());
+			EncodeUserCloudData(BlockData, BlockDataSize, bCompress, Block.Value);
+		}
+	}
+
+	for (const FString& BlockFileName : ExistingBlocks)
+	{
+		if (!BlockFileNames.Contains(BlockFileName))
+		{
+			EncodedWrite.StaleBlocks.Add(BlockFileName);
+		}
+	}
+
+	EncodeBlockManifest(Manifest, EncodedWrite.FileData);
+}
+
 void FEOSUserCloudFile::Unload()
 {
 	if (bIsLoaded)
@@ -55,6 +318,12 @@ void FEOSUserCloudFile::Unload()
 	}
 }
 
+FOnlineUserCloudEOS::FOnlineUserCloudEOS(FOnlineSubsystemEOS* InSubsystem)
+	: EOSSubsystem(InSubsystem)
+	, DeltaBlockSize(FMath::Max(UEIKSettings::GetSettings().UserCloudDeltaBlockSize, 0))
+{
+}
+
 bool FOnlineUserCloudEOS::GetFileContents(const FUniqueNetId& UserId, const FString& FileName, TArray<uint8>& FileContents)
 {
 	FUniqueNetIdPtr UniqueNetId = EOSSubsystem->UserManager->GetUniquePlayerId(EOSSubsystem->UserManager->GetLocalUserNumFromUniqueNetId(UserId));
@@ -242,7 +511,8 @@ void FOnlineUserCloudEOS::EnumerateUserFiles(const FUniqueNetId& UserId)
 					EOS_EResult Result = EOS_PlayerDataStorage_CopyFileMetadataAtIndex(EOSSubsystem->PlayerDataStorageHandle, &CopyFileMetadataAtIndexOptions, &FileMetadata);
 					if (Result == EOS_EResult::EOS_Success)
 					{
-						if (FileMetadata && FileMetadata->Filename)
+						// Blocks of files written in delta mode are listed through their file's manifest
+						if (FileMetadata && FileMetadata->Filename && !IsBlockFileName(ANSI_TO_TCHAR(FileMetadata->Filename)))
 						{
 							QueryFileSet.Emplace(FCloudFileHeader(ANSI_TO_TCHAR(FileMetadata->Filename), ANSI_TO_TCHAR(FileMetadata->Filename), FileMetadata->FileSizeBytes));
 
@@ -324,6 +594,20 @@ bool FOnlineUserCloudEOS::ReadUserFile(const FUniqueNetId& UserId, const FString
 		}
 	}
 
+	if (!StartReadFile(SharedUserId, FileName))
+	{
+		EOSSubsystem->ExecuteNextTick([this, UserIdRef = UserId.AsShared(), FileName]()
+			{
+				UE_LOG_ONLINE_CLOUD(Warning, TEXT("[FOnlineUserCloudEOS::ReadUserFile] Failed to create a transfer request for user's %s file with name %s"), *UserIdRef->ToString(), *FileName);
+				TriggerOnReadUserFileCompleteDelegates(false, *UserIdRef, FileName);
+			});
+	}
+
+	return true;
+}
+
+bool FOnlineUserCloudEOS::StartReadFile(const FUniqueNetIdRef& SharedUserId, const FString& FileName)
+{
 	// We prepare all the components for the Options object
 
 	FTCHARToUTF8 FileNameUtf8(*FileName);
@@ -442,14 +726,12 @@ bool FOnlineUserCloudEOS::ReadUserFile(const FUniqueNetId& UserId, const FString
 			UE_LOG_ONLINE_CLOUD(Warning, TEXT("[FOnlineUserCloudEOS::ReadUserFile] Unknown user %s for file %s's transfer request"), *SharedUserId->ToString(), *FileName);
 		}
 
-		TriggerOnReadUserFileCompleteDelegates(bWasSuccessful, *SharedUserId, FileName);
+		FinishReadFile(bWasSuccessful, SharedUserId, FileName);
 	};
 
-	const FUniqueNetIdEOS& UserEOSId = FUniqueNetIdEOS::Cast(UserId);
-
 	EOS_PlayerDataStorage_ReadFileOptions ReadFileOptions = {};
 	ReadFileOptions.ApiVersion = EOS_PLAYERDATASTORAGE_READFILEOPTIONS_API_LATEST;
-	ReadFileOptions.LocalUserId = UserEOSId.GetProductUserId();
+	ReadFileOptions.LocalUserId = FUniqueNetIdEOS::Cast(*SharedUserId).GetProductUserId();
 	ReadFileOptions.Filename = FileNameUtf8.Get();
 	ReadFileOptions.ReadChunkLengthBytes = (uint32_t)ReadChunkSize;
 	ReadFileOptions.ReadFileDataCallback = CallbackObj->GetNested1CallbackPtr();
@@ -457,24 +739,161 @@ bool FOnlineUserCloudEOS::ReadUserFile(const FUniqueNetId& UserId, const FString
 
 	EOS_HPlayerDataStorageFileTransferRequest FileTransferRequest = EOS_PlayerDataStorage_ReadFile(EOSSubsystem->PlayerDataStorageHandle, &ReadFileOptions, CallbackObj, CallbackObj->GetCallbackPtr());
 
-	if (FileTransferRequest != nullptr)
+	if (FileTransferRequest == nullptr)
 	{
-		FEOSUserCloudFile UserCloudFile;
-		UserCloudFile.Filename = FileName;
-		UserCloudFile.FileTransferRequest = FileTransferRequest;
-		UserCloudFile.bInProgress = true;
-		FileSetsPerUser.FindOrAdd(SharedUserId).FindOrAdd(FileName) = MoveTemp(UserCloudFile); // Replace the last file, or create a new entry, same with the user
+		return false;
 	}
-	else
+
+	FEOSUserCloudFile UserCloudFile;
+	UserCloudFile.Filename = FileName;
+	UserCloudFile.FileTransferRequest = FileTransferRequest;
+	UserCloudFile.bInProgress = true;
+	FileSetsPerUser.FindOrAdd(SharedUserId).FindOrAdd(FileName) = MoveTemp(UserCloudFile); // Replace the last file, or create a new entry, same with the user
+	return true;
+}
+
+void FOnlineUserCloudEOS::FinishReadFile(bool bWasSuccessful, const FUniqueNetIdRef& SharedUserId, const FString& FileName)
+{
+	FUserCloudFileCollection* UserCloudFileCollection = FileSetsPerUser.Find(SharedUserId);
+	FEOSUserCloudFile* UserCloudFile = (bWasSuccessful && UserCloudFileCollection != nullptr) ? UserCloudFileCollection->Find(FileName) : nullptr;
+
+	TArray<uint8> DecodedContents;
+	EUserCloudFileEncoding Encoding = EUserCloudFileEncoding::Raw;
+	if (UserCloudFile != nullptr && !DecodeUserCloudData(UserCloudFile->Contents, DecodedContents, Encoding))
 	{
-		EOSSubsystem->ExecuteNextTick([this, UserIdRef = UserId.AsShared(), FileName]()
+		UE_LOG_ONLINE_CLOUD(Warning, TEXT("[FOnlineUserCloudEOS::ReadUserFile] Unable to decode file %s"), *FileName);
+		UserCloudFileCollection->Remove(FileName);
+		UserCloudFile = nullptr;
+		bWasSuccessful = false;
+	}
+
+	FString ParentFileName;
+	if (FEOSUserCloudBlockTransfer* Transfer = FindBlockTransfer(SharedUserId, FileName, ParentFileName))
+	{
+		const int32 BlockIndex = Transfer->PendingBlocks.FindAndRemoveChecked(FileName);
+		const uint32 BlockOffset = BlockIndex * Transfer->Manifest.BlockSize;
+		const uint32 BlockDataSize = FMath::Min(Transfer->Manifest.BlockSize, Transfer->Manifest.TotalSize - BlockOffset);
+		if (UserCloudFile != nullptr && (uint32)DecodedContents.Num() == BlockDataSize && CityHash64((const char*)DecodedContents.GetData(), BlockDataSize) == Transfer->Manifest.BlockHashes[BlockIndex])
+		{
+			FMemory::Memcpy(Transfer->Contents.GetData() + BlockOffset, DecodedContents.GetData(), BlockDataSize);
+		}
+		else
+		{
+			UE_LOG_ONLINE_CLOUD(Warning, TEXT("[FOnlineUserCloudEOS::ReadUserFile] Block %d of file %s is missing or does not match its manifest"), BlockIndex, *ParentFileName);
+			Transfer->bFailed = true;
+		}
+
+		// Blocks are only tracked as part of the file they belong to
+		if (UserCloudFileCollection != nullptr)
+		{
+			UserCloudFileCollection->Remove(FileName);
+		}
+
+		if (Transfer->PendingBlocks.Num() == 0)
+		{
+			FinishBlockRead(SharedUserId, ParentFileName);
+		}
+		return;
+	}
+
+	if (UserCloudFile != nullptr && Encoding == EUserCloudFileEncoding::BlockManifest)
+	{
+		FEOSUserCloudBlockManifest Manifest;
+		if (!DecodeBlockManifest(DecodedContents, Manifest))
+		{
+			UE_LOG_ONLINE_CLOUD(Warning, TEXT("[FOnlineUserCloudEOS::ReadUserFile] Invalid block manifest for file %s"), *FileName);
+			UserCloudFileCollection->Remove(FileName);
+			TriggerOnReadUserFileCompleteDelegates(false, *SharedUserId, FileName);
+			return;
+		}
+
+		// The file stays in progress until all of its blocks are in
+		UserCloudFile->Contents.Empty();
+		UserCloudFile->bIsLoaded = false;
+		UserCloudFile->bInProgress = true;
+
+		FEOSUserCloudBlockTransfer& Transfer = BlockTransfersPerUser.FindOrAdd(SharedUserId).Add(FileName);
+		Transfer.Contents.SetNumUninitialized(Manifest.TotalSize);
+		Transfer.Manifest = MoveTemp(Manifest);
+
+		UE_LOG_ONLINE_CLOUD(Verbose, TEXT("[FOnlineUserCloudEOS::ReadUserFile] Reading %d blocks for file %s"), Transfer.Manifest.BlockHashes.Num(), *FileName);
+
+		for (int32 BlockIndex = 0; BlockIndex < Transfer.Manifest.BlockHashes.Num(); ++BlockIndex)
+		{
+			const FString BlockFileName = GetBlockFileName(FileName, BlockIndex, Transfer.Manifest.BlockHashes[BlockIndex]);
+			if (!StartReadFile(SharedUserId, BlockFileName))
 			{
-				UE_LOG_ONLINE_CLOUD(Warning, TEXT("[FOnlineUserCloudEOS::ReadUserFile] Failed to create a transfer request for user's %s file with name %s"), *UserIdRef->ToString(), *FileName);
-				TriggerOnReadUserFileCompleteDelegates(false, *UserIdRef, FileName);
-			});
+				UE_LOG_ONLINE_CLOUD(Warning, TEXT("[FOnlineUserCloudEOS::ReadUserFile] Failed to create a transfer request for block %s"), *BlockFileName);
+				Transfer.bFailed = true;
+				break;
+			}
+			Transfer.PendingBlocks.Add(BlockFileName, BlockIndex);
+		}
+
+		if (Transfer.PendingBlocks.Num() == 0)
+		{
+			FinishBlockRead(SharedUserId, FileName);
+		}
+		return;
 	}
 
-	return true;
+	if (UserCloudFile != nullptr)
+	{
+		UserCloudFile->Contents = MoveTemp(DecodedContents);
+		UserCloudFile->ContentSize = UserCloudFile->Contents.Num();
+	}
+
+	TriggerOnReadUserFileCompleteDelegates(bWasSuccessful, *SharedUserId, FileName);
+}
+
+void FOnlineUserCloudEOS::FinishBlockRead(const FUniqueNetIdRef& SharedUserId, const FString& FileName)
+{
+	TMap<FString, FEOSUserCloudBlockTransfer>& BlockTransfers = BlockTransfersPerUser.FindChecked(SharedUserId);
+	FEOSUserCloudBlockTransfer Transfer = MoveTemp(BlockTransfers.FindChecked(FileName));
+	BlockTransfers.Remove(FileName);
+
+	bool bWasSuccessful = !Transfer.bFailed;
+
+	FUserCloudFileCollection* UserCloudFileCollection = FileSetsPerUser.Find(SharedUserId);
+	FEOSUserCloudFile* UserCloudFile = UserCloudFileCollection != nullptr ? UserCloudFileCollection->Find(FileName) : nullptr;
+	if (UserCloudFile == nullptr)
+	{
+		bWasSuccessful = false;
+		UE_LOG_ONLINE_CLOUD(Warning, TEXT("[FOnlineUserCloudEOS::ReadUserFile] Unknown transfer request for file %s"), *FileName);
+	}
+	else if (bWasSuccessful)
+	{
+		UserCloudFile->Contents = MoveTemp(Transfer.Contents);
+		UserCloudFile->ContentSize = UserCloudFile->Contents.Num();
+		UserCloudFile->bIsLoaded = true;
+		UserCloudFile->bInProgress = false;
+
+		UE_LOG_ONLINE_CLOUD(Verbose, TEXT("[FOnlineUserCloudEOS::ReadUserFile] Read file %s with size %d from its blocks"), *FileName, UserCloudFile->ContentSize);
+	}
+	else
+	{
+		UserCloudFileCollection->Remove(FileName);
+
+		UE_LOG_ONLINE_CLOUD(Warning, TEXT("[FOnlineUserCloudEOS::ReadUserFile] Failed to read the blocks of file %s"), *FileName);
+	}
+
+	TriggerOnReadUserFileCompleteDelegates(bWasSuccessful, *SharedUserId, FileName);
+}
+
+FOnlineUserCloudEOS::FEOSUserCloudBlockTransfer* FOnlineUserCloudEOS::FindBlockTransfer(const FUniqueNetIdRef& SharedUserId, const FString& BlockFileName, FString& OutFileName)
+{
+	if (TMap<FString, FEOSUserCloudBlockTransfer>* BlockTransfers = BlockTransfersPerUser.Find(SharedUserId))
+	{
+		for (TPair<FString, FEOSUserCloudBlockTransfer>& BlockTransfer : *BlockTransfers)
+		{
+			if (BlockTransfer.Value.PendingBlocks.Contains(BlockFileName))
+			{
+				OutFileName = BlockTransfer.Key;
+				return &BlockTransfer.Value;
+			}
+		}
+	}
+	return nullptr;
 }
 
 bool FOnlineUserCloudEOS::WriteUserFile(const FUniqueNetId& UserId, const FString& FileName, TArray<uint8>& FileContents, bool bCompressBeforeUpload)
@@ -510,6 +929,122 @@ bool FOnlineUserCloudEOS::WriteUserFile(const FUniqueNetId& UserId, const FStrin
 		}
 	}
 
+	if (!bCompressBeforeUpload && DeltaBlockSize <= 0)
+	{
+		if (!StartWriteFile(SharedUserId, FileName, TArray<uint8>(FileContents), TOptional<TArray<uint8>>()))
+		{
+			EOSSubsystem->ExecuteNextTick([this, UserIdRef = UserId.AsShared(), FileName]()
+				{
+					UE_LOG_ONLINE_CLOUD(Warning, TEXT("[FOnlineUserCloudEOS::WriteUserFile] Failed to create a transfer request for user's %s file with name %s"), *UserIdRef->ToString(), *FileName);
+					TriggerOnWriteUserFileCompleteDelegates(false, *UserIdRef, FileName);
+				});
+		}
+		return true;
+	}
+
+	// Hold on to the file while it is encoded, so it can't be read or written in the meantime
+	FEOSUserCloudFile& PendingUserCloudFile = FileSetsPerUser.FindOrAdd(SharedUserId).FindOrAdd(FileName);
+	PendingUserCloudFile = FEOSUserCloudFile();
+	PendingUserCloudFile.Filename = FileName;
+	PendingUserCloudFile.bInProgress = true;
+
+	if (DeltaBlockSize <= 0)
+	{
+		EncodeWrite(SharedUserId, FileName, TArray<uint8>(FileContents), bCompressBeforeUpload, TSet<FString>());
+		return true;
+	}
+
+	// The blocks already stored for the file are listed first, so unchanged ones are not uploaded again and the rest can be deleted
+	QueryBlockFiles(SharedUserId, FileName, [this, SharedUserId, FileName, Contents = FileContents, bCompressBeforeUpload](bool bWasSuccessful, TSet<FString>&& ExistingBlocks) mutable
+	{
+		if (!bWasSuccessful)
+		{
+			UE_LOG_ONLINE_CLOUD(Warning, TEXT("[FOnlineUserCloudEOS::WriteUserFile] Unable to list the stored blocks of file %s, all of its blocks will be uploaded"), *FileName);
+		}
+		EncodeWrite(SharedUserId, FileName, MoveTemp(Contents), bCompressBeforeUpload, MoveTemp(ExistingBlocks));
+	});
+
+	return true;
+}
+
+void FOnlineUserCloudEOS::EncodeWrite(const FUniqueNetIdRef& SharedUserId, const FString& FileName, TArray<uint8>&& FileContents, bool bCompressBeforeUpload, TSet<FString>&& ExistingBlocks)
+{
+	// Compressing and hashing a large save can take a while, so it is done off the game thread
+	FOnlineUserCloudEOSWeakPtr WeakThis(AsShared());
+	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [WeakThis, SharedUserId, FileName, Contents = MoveTemp(FileContents), bCompressBeforeUpload, BlockSize = DeltaBlockSize, ExistingBlocks = MoveTemp(ExistingBlocks)]() mutable
+	{
+		TSharedRef<FEOSUserCloudEncodedWrite, ESPMode::ThreadSafe> EncodedWrite = MakeShared<FEOSUserCloudEncodedWrite, ESPMode::ThreadSafe>();
+		EncodedWrite->Contents = MoveTemp(Contents);
+		EncodeUserCloudWrite(FileName, bCompressBeforeUpload, BlockSize, ExistingBlocks, *EncodedWrite);
+
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, SharedUserId, FileName, EncodedWrite]()
+		{
+			if (FOnlineUserCloudEOSPtr StrongThis = WeakThis.Pin())
+			{
+				StrongThis->StartEncodedWrite(SharedUserId, FileName, MoveTemp(*EncodedWrite));
+			}
+		});
+	});
+}
+
+void FOnlineUserCloudEOS::StartEncodedWrite(const FUniqueNetIdRef& SharedUserId, const FString& FileName, FEOSUserCloudEncodedWrite&& EncodedWrite)
+{
+	if (EncodedWrite.Manifest.BlockSize == 0)
+	{
+		UE_LOG_ONLINE_CLOUD(Verbose, TEXT("[FOnlineUserCloudEOS::WriteUserFile] Encoded file %s from %d to %d bytes"), *FileName, EncodedWrite.Contents.Num(), EncodedWrite.FileData.Num());
+
+		// A file written whole replaces any blocks it was stored as before, which are deleted once it is in place
+		if (EncodedWrite.StaleBlocks.Num() > 0)
+		{
+			FEOSUserCloudBlockTransfer& Transfer = BlockTransfersPerUser.FindOrAdd(SharedUserId).Add(FileName);
+			Transfer.bIsWrite = true;
+			Transfer.StaleBlocks = MoveTemp(EncodedWrite.StaleBlocks);
+		}
+
+		if (!StartWriteFile(SharedUserId, FileName, MoveTemp(EncodedWrite.FileData), MoveTemp(EncodedWrite.Contents)))
+		{
+			UE_LOG_ONLINE_CLOUD(Warning, TEXT("[FOnlineUserCloudEOS::WriteUserFile] Failed to create a transfer request for user's %s file with name %s"), *SharedUserId->ToString(), *FileName);
+			if (TMap<FString, FEOSUserCloudBlockTransfer>* BlockTransfers = BlockTransfersPerUser.Find(SharedUserId))
+			{
+				BlockTransfers->Remove(FileName);
+			}
+			if (FUserCloudFileCollection* UserCloudFileCollection = FileSetsPerUser.Find(SharedUserId))
+			{
+				UserCloudFileCollection->Remove(FileName);
+			}
+			TriggerOnWriteUserFileCompleteDelegates(false, *SharedUserId, FileName);
+		}
+		return;
+	}
+
+	UE_LOG_ONLINE_CLOUD(Verbose, TEXT("[FOnlineUserCloudEOS::WriteUserFile] Writing %d of %d blocks for file %s"), EncodedWrite.Blocks.Num(), EncodedWrite.Manifest.BlockHashes.Num(), *FileName);
+
+	FEOSUserCloudBlockTransfer& Transfer = BlockTransfersPerUser.FindOrAdd(SharedUserId).Add(FileName);
+	Transfer.bIsWrite = true;
+	Transfer.Manifest = MoveTemp(EncodedWrite.Manifest);
+	Transfer.Contents = MoveTemp(EncodedWrite.Contents);
+	Transfer.ManifestData = MoveTemp(EncodedWrite.FileData);
+	Transfer.StaleBlocks = MoveTemp(EncodedWrite.StaleBlocks);
+
+	for (TPair<FString, TArray<uint8>>& Block : EncodedWrite.Blocks)
+	{
+		if (!StartWriteFile(SharedUserId, Block.Key, MoveTemp(Block.Value), TOptional<TArray<uint8>>()))
+		{
+			UE_LOG_ONLINE_CLOUD(Warning, TEXT("[FOnlineUserCloudEOS::WriteUserFile] Failed to create a transfer request for block %s"), *Block.Key);
+			Transfer.bFailed = true;
+			break;
+		}
+		Transfer.PendingBlocks.Add(Block.Key, INDEX_NONE);
+	}
+
+	if (Transfer.PendingBlocks.Num() == 0)
+	{
+		FinishBlockWrite(SharedUserId, FileName);
+	}
+}
+
+bool FOnlineUserCloudEOS::StartWriteFile(const FUniqueNetIdRef& SharedUserId, const FString& FileName, TArray<uint8>&& FileData, TOptional<TArray<uint8>>&& DecodedContents)
+{
 	// We prepare all the components for the Options object
 
 	FTCHARToUTF8 FileNameUtf8(*FileName);
@@ -606,6 +1141,12 @@ bool FOnlineUserCloudEOS::WriteUserFile(const FUniqueNetId& UserId, const FStrin
 
 				if (bWasSuccessful)
 				{
+					if (UserCloudFile->DecodedContents.IsSet())
+					{
+						UserCloudFile->Contents = MoveTemp(UserCloudFile->DecodedContents.GetValue());
+						UserCloudFile->ContentSize = UserCloudFile->Contents.Num();
+						UserCloudFile->DecodedContents.Reset();
+					}
 					UserCloudFile->bIsLoaded = true;
 					UserCloudFile->bInProgress = false;
 					UE_LOG_ONLINE_CLOUD(Verbose, TEXT("[FOnlineUserCloudEOS::WriteUserFile] Wrote file %s with size %d"), *UserCloudFile->Filename, UserCloudFile->ContentSize);
@@ -629,14 +1170,12 @@ bool FOnlineUserCloudEOS::WriteUserFile(const FUniqueNetId& UserId, const FStrin
 			UE_LOG_ONLINE_CLOUD(Warning, TEXT("[FOnlineUserCloudEOS::WriteUserFile] Unknown user %s for file %s's transfer request"), *SharedUserId->ToString(), *FileName);
 		}
 
-		TriggerOnWriteUserFileCompleteDelegates(bWasSuccessful, *SharedUserId, FileName);
+		FinishWriteFile(bWasSuccessful, SharedUserId, FileName);
 	};
 
-	const FUniqueNetIdEOS& UserEOSId = FUniqueNetIdEOS::Cast(UserId);
-
 	EOS_PlayerDataStorage_WriteFileOptions WriteFileOptions = {};
 	WriteFileOptions.ApiVersion = EOS_PLAYERDATASTORAGE_WRITEFILEOPTIONS_API_LATEST;
-	WriteFileOptions.LocalUserId = UserEOSId.GetProductUserId();
+	WriteFileOptions.LocalUserId = FUniqueNetIdEOS::Cast(*SharedUserId).GetProductUserId();
 	WriteFileOptions.Filename = FileNameUtf8.Get();
 	WriteFileOptions.ChunkLengthBytes = (uint32_t)ReadChunkSize;
 	WriteFileOptions.WriteFileDataCallback = CallbackObj->GetNested1CallbackPtr();
@@ -644,26 +1183,157 @@ bool FOnlineUserCloudEOS::WriteUserFile(const FUniqueNetId& UserId, const FStrin
 
 	EOS_HPlayerDataStorageFileTransferRequest FileTransferRequest = EOS_PlayerDataStorage_WriteFile(EOSSubsystem->PlayerDataStorageHandle, &WriteFileOptions, CallbackObj, CallbackObj->GetCallbackPtr());
 
-	if (FileTransferRequest != nullptr)
+	if (FileTransferRequest == nullptr)
 	{
-		FEOSUserCloudFile UserCloudFile;
-		UserCloudFile.Filename = FileName;
-		UserCloudFile.FileTransferRequest = FileTransferRequest;
-		UserCloudFile.bInProgress = true;
-		UserCloudFile.ContentSize = FileContents.Num();
-		UserCloudFile.Contents = FileContents;
-		FileSetsPerUser.FindOrAdd(SharedUserId).FindOrAdd(FileName) = MoveTemp(UserCloudFile); // Replace the last title file, or create a new entry, same with the user
+		return false;
 	}
-	else
+
+	FEOSUserCloudFile UserCloudFile;
+	UserCloudFile.Filename = FileName;
+	UserCloudFile.FileTransferRequest = FileTransferRequest;
+	UserCloudFile.bInProgress = true;
+	UserCloudFile.ContentSize = FileData.Num();
+	UserCloudFile.Contents = MoveTemp(FileData);
+	UserCloudFile.DecodedContents = MoveTemp(DecodedContents);
+	FileSetsPerUser.FindOrAdd(SharedUserId).FindOrAdd(FileName) = MoveTemp(UserCloudFile); // Replace the last title file, or create a new entry, same with the user
+	return true;
+}
+
+void FOnlineUserCloudEOS::FinishWriteFile(bool bWasSuccessful, const FUniqueNetIdRef& SharedUserId, const FString& FileName)
+{
+	FString ParentFileName;
+	if (FEOSUserCloudBlockTransfer* Transfer = FindBlockTransfer(SharedUserId, FileName, ParentFileName))
 	{
-		EOSSubsystem->ExecuteNextTick([this, UserIdRef = UserId.AsShared(), FileName]()
+		Transfer->PendingBlocks.Remove(FileName);
+		Transfer->bFailed |= !bWasSuccessful;
+
+		// Blocks are only tracked as part of the file they belong to
+		if (FUserCloudFileCollection* UserCloudFileCollection = FileSetsPerUser.Find(SharedUserId))
+		{
+			UserCloudFileCollection->Remove(FileName);
+		}
+
+		if (Transfer->PendingBlocks.Num() == 0)
+		{
+			FinishBlockWrite(SharedUserId, ParentFileName);
+		}
+		return;
+	}
+
+	TMap<FString, FEOSUserCloudBlockTransfer>* BlockTransfers = BlockTransfersPerUser.Find(SharedUserId);
+	FEOSUserCloudBlockTransfer* Transfer = BlockTransfers != nullptr ? BlockTransfers->Find(FileName) : nullptr;
+	if (Transfer != nullptr)
+	{
+		// The file's own data is written last, so the blocks it replaced can go once it is in place
+		if (bWasSuccessful)
+		{
+			DeleteBlockFiles(SharedUserId, Transfer->StaleBlocks);
+		}
+		BlockTransfers->Remove(FileName);
+	}
+
+	TriggerOnWriteUserFileCompleteDelegates(bWasSuccessful, *SharedUserId, FileName);
+}
+
+void FOnlineUserCloudEOS::FinishBlockWrite(const FUniqueNetIdRef& SharedUserId, const FString& FileName)
+{
+	TMap<FString, FEOSUserCloudBlockTransfer>& BlockTransfers = BlockTransfersPerUser.FindChecked(SharedUserId);
+	FEOSUserCloudBlockTransfer& Transfer = BlockTransfers.FindChecked(FileName);
+
+	// The transfer is kept until the manifest is written
+	if (!Transfer.bFailed && StartWriteFile(SharedUserId, FileName, MoveTemp(Transfer.ManifestData), MoveTemp(Transfer.Contents)))
+	{
+		return;
+	}
+
+	UE_LOG_ONLINE_CLOUD(Warning, TEXT("[FOnlineUserCloudEOS::WriteUserFile] Failed to write the blocks of file %s"), *FileName);
+
+	BlockTransfers.Remove(FileName);
+	if (FUserCloudFileCollection* UserCloudFileCollection = FileSetsPerUser.Find(SharedUserId))
+	{
+		UserCloudFileCollection->Remove(FileName);
+	}
+
+	TriggerOnWriteUserFileCompleteDelegates(false, *SharedUserId, FileName);
+}
+
+void FOnlineUserCloudEOS::DeleteBlockFiles(const FUniqueNetIdRef& SharedUserId, const TArray<FString>& BlockFileNames)
+{
+	for (const FString& BlockFileName : BlockFileNames)
+	{
+		FTCHARToUTF8 FileNameUtf8(*BlockFileName);
+
+		EOS_PlayerDataStorage_DeleteFileOptions Options = {};
+		Options.ApiVersion = EOS_PLAYERDATASTORAGE_DELETEFILEOPTIONS_API_LATEST;
+		Options.LocalUserId = FUniqueNetIdEOS::Cast(*SharedUserId).GetProductUserId();
+		Options.Filename = FileNameUtf8.Get();
+
+#if ENGINE_MAJOR_VERSION == 5
+		FOnDeleteFileCallback* CallbackObj = new FOnDeleteFileCallback(FOnlineUserCloudEOSWeakPtr(AsShared()));
+#else
+		FOnDeleteFileCallback* CallbackObj = new FOnDeleteFileCallback();
+#endif
+		CallbackObj->CallbackLambda = [BlockFileName](const EOS_PlayerDataStorage_DeleteFileCallbackInfo* Data)
+		{
+			if (Data->ResultCode != EOS_EResult::EOS_Success && Data->ResultCode != EOS_EResult::EOS_NotFound)
 			{
-				UE_LOG_ONLINE_CLOUD(Warning, TEXT("[FOnlineUserCloudEOS::WriteUserFile] Failed to create a transfer request for user's %s file with name %s"), *UserIdRef->ToString(), *FileName);
-				TriggerOnWriteUserFileCompleteDelegates(false, *UserIdRef, FileName);
-			});		
+				UE_LOG_ONLINE_CLOUD(Warning, TEXT("[FOnlineUserCloudEOS::DeleteBlockFiles] EOS_PlayerDataStorage_DeleteFile was not successful for block %s. Finished with error %s"), *BlockFileName, ANSI_TO_TCHAR(EOS_EResult_ToString(Data->ResultCode)));
+			}
+		};
+
+		EOS_PlayerDataStorage_DeleteFile(EOSSubsystem->PlayerDataStorageHandle, &Options, CallbackObj, CallbackObj->GetCallbackPtr());
 	}
+}
 
-	return true;
+void FOnlineUserCloudEOS::QueryBlockFiles(const FUniqueNetIdRef& SharedUserId, const FString& FileName, TFunction<void(bool bWasSuccessful, TSet<FString>&& BlockFileNames)>&& OnComplete)
+{
+	EOS_PlayerDataStorage_QueryFileListOptions Options = {};
+	Options.ApiVersion = EOS_PLAYERDATASTORAGE_QUERYFILELISTOPTIONS_API_LATEST;
+	Options.LocalUserId = FUniqueNetIdEOS::Cast(*SharedUserId).GetProductUserId();
+
+#if ENGINE_MAJOR_VERSION == 5
+	FOnQueryFileListCallback* CallbackObj = new FOnQueryFileListCallback(FOnlineUserCloudEOSWeakPtr(AsShared()));
+#else
+	FOnQueryFileListCallback* CallbackObj = new FOnQueryFileListCallback();
+#endif
+	CallbackObj->CallbackLambda = [this, FileName, OnComplete = MoveTemp(OnComplete)](const EOS_PlayerDataStorage_QueryFileListCallbackInfo* Data)
+	{
+		TSet<FString> BlockFileNames;
+
+		const bool bWasSuccessful = Data->ResultCode == EOS_EResult::EOS_Success || Data->ResultCode == EOS_EResult::EOS_NotFound;
+		if (bWasSuccessful)
+		{
+			for (uint32 Index = 0; Index < Data->FileCount; ++Index)
+			{
+				EOS_PlayerDataStorage_CopyFileMetadataAtIndexOptions CopyFileMetadataAtIndexOptions = { };
+				CopyFileMetadataAtIndexOptions.ApiVersion = EOS_PLAYERDATASTORAGE_COPYFILEMETADATAATINDEXOPTIONS_API_LATEST;
+				CopyFileMetadataAtIndexOptions.LocalUserId = Data->LocalUserId;
+				CopyFileMetadataAtIndexOptions.Index = Index;
+
+				EOS_PlayerDataStorage_FileMetadata* FileMetadata = nullptr;
+				if (EOS_PlayerDataStorage_CopyFileMetadataAtIndex(EOSSubsystem->PlayerDataStorageHandle, &CopyFileMetadataAtIndexOptions, &FileMetadata) == EOS_EResult::EOS_Success)
+				{
+					if (FileMetadata && FileMetadata->Filename)
+					{
+						const FString StoredFileName(ANSI_TO_TCHAR(FileMetadata->Filename));
+						if (IsBlockFileOf(StoredFileName, FileName))
+						{
+							BlockFileNames.Add(StoredFileName);
+						}
+					}
+					EOS_PlayerDataStorage_FileMetadata_Release(FileMetadata);
+				}
+			}
+		}
+		else
+		{
+			UE_LOG_ONLINE_CLOUD(Warning, TEXT("[FOnlineUserCloudEOS::QueryBlockFiles] EOS_PlayerDataStorage_QueryFileList was not successful for file %s. Finished with error %s"), *FileName, ANSI_TO_TCHAR(EOS_EResult_ToString(Data->ResultCode)));
+		}
+
+		OnComplete(bWasSuccessful, MoveTemp(BlockFileNames));
+	};
+
+	EOS_PlayerDataStorage_QueryFileList(EOSSubsystem->PlayerDataStorageHandle, &Options, CallbackObj, CallbackObj->GetCallbackPtr());
 }
 
 void FOnlineUserCloudEOS::CancelWriteUserFile(const FUniqueNetId& UserId, const FString& FileName)
@@ -688,7 +1358,11 @@ void FOnlineUserCloudEOS::CancelWriteUserFile(const FUniqueNetId& UserId, const
 		FEOSUserCloudFile* UserCloudFile = UserCloudFileCollection->Find(FileName);
 		if (UserCloudFile != nullptr)
 		{
-			if (UserCloudFile->bInProgress)
+			if (UserCloudFile->bInProgress && UserCloudFile->FileTransferRequest == nullptr)
+			{
+				UE_LOG_ONLINE_CLOUD(Warning, TEXT("[FOnlineUserCloudEOS::CancelWriteUserFile] File %s is being encoded or written as blocks. Unable to cancel."), *FileName);
+			}
+			else if (UserCloudFile->bInProgress)
 			{
 				EOS_EResult Result = EOS_PlayerDataStorageFileTransferRequest_CancelRequest(UserCloudFile->FileTransferRequest);
 				bWasSuccessful = Result == EOS_EResult::EOS_Success;
@@ -804,6 +1478,15 @@ bool FOnlineUserCloudEOS::DeleteUserFile(const FUniqueNetId& UserId, const FStri
 			if (bWasSuccessful)
 			{
 				UE_LOG_ONLINE_CLOUD(Verbose, TEXT("[FOnlineUserCloudEOS::DeleteUserFile] EOS_PlayerDataStorage_DeleteFile was successful."));
+
+				// Blocks are only stored by files written in delta mode
+				if (DeltaBlockSize > 0)
+				{
+					QueryBlockFiles(UserIdRef, FileName, [this, UserIdRef](bool bWasListed, TSet<FString>&& BlockFileNames)
+					{
+						DeleteBlockFiles(UserIdRef, BlockFileNames.Array());
+					});
+				}
 			}
 			else
 			{
@@ -17,9 +17,38 @@ class FOnlineSubsystemEOS;
 #if WITH_EOS_SDK
 	#include "eos_playerdatastorage_types.h"
 
+/**
+ * Block list stored in place of a file that was uploaded in delta mode. Blocks are cut at fixed offsets, so only
+ * in place edits are cheap: an insertion or removal changes every following block and amounts to a full rewrite.
+ */
+struct FEOSUserCloudBlockManifest
+{
+	uint32 BlockSize = 0;
+	uint32 TotalSize = 0;
+	/** Content hash of each block, which is also part of the block's file name */
+	TArray<uint64> BlockHashes;
+};
+
+/** Result of encoding a write on a worker thread, ready to be uploaded */
+struct FEOSUserCloudEncodedWrite
+{
+	/** The contents as the game wrote them */
+	TArray<uint8> Contents;
+	/** Data uploaded under the file's own name, the encoded contents or the block manifest */
+	TArray<uint8> FileData;
+	/** Valid when the file is uploaded as blocks */
+	FEOSUserCloudBlockManifest Manifest;
+	/** Blocks not already stored for the file */
+	TArray<TPair<FString, TArray<uint8>>> Blocks;
+	/** Blocks stored for the file that the new data no longer references */
+	TArray<FString> StaleBlocks;
+};
+
 struct FEOSUserCloudFile
 {
 	TArray<uint8> Contents;
+	/** Set while Contents holds encoded data being uploaded, replaces it once the upload completes */
+	TOptional<TArray<uint8>> DecodedContents;
 	size_t ContentSize;
 	size_t ContentIndex;
 	bool bIsLoaded;
@@ -27,7 +56,7 @@ struct FEOSUserCloudFile
 	FString Filename;
 	EOS_HPlayerDataStorageFileTransferRequest FileTransferRequest;
 
-	FEOSUserCloudFile() : ContentSize(0), ContentIndex(0), bIsLoaded(false), bInProgress(false)
+	FEOSUserCloudFile() : ContentSize(0), ContentIndex(0), bIsLoaded(false), bInProgress(false), FileTransferRequest(nullptr)
 	{
 	}
 
@@ -58,10 +87,7 @@ public:
 	virtual void DumpCloudFileState(const FUniqueNetId& UserId, const FString& FileName) override;
 //~ IOnlineUserCloud
 
-	FOnlineUserCloudEOS(FOnlineSubsystemEOS* InSubsystem)
-		: EOSSubsystem(InSubsystem)
-	{
-	}
+	FOnlineUserCloudEOS(FOnlineSubsystemEOS* InSubsystem);
 
 	bool HandleUserCloudExec(UWorld* InWorld, const TCHAR* Cmd, FOutputDevice& Ar);
 
@@ -69,6 +95,42 @@ protected:
 	FOnlineSubsystemEOS* EOSSubsystem;
 
 private:
+	/** A file being assembled from, or uploaded as, its blocks */
+	struct FEOSUserCloudBlockTransfer
+	{
+		FEOSUserCloudBlockManifest Manifest;
+		/** Block files still in flight, mapped to their index in the manifest */
+		TMap<FString, int32> PendingBlocks;
+		/** Assembled contents when reading, the contents being written otherwise */
+		TArray<uint8> Contents;
+		/** Manifest uploaded once all blocks are written */
+		TArray<uint8> ManifestData;
+		/** Blocks deleted once the file's own data is written */
+		TArray<FString> StaleBlocks;
+		bool bIsWrite = false;
+		bool bFailed = false;
+	};
+
+	bool StartReadFile(const FUniqueNetIdRef& UserId, const FString& FileName);
+	bool StartWriteFile(const FUniqueNetIdRef& UserId, const FString& FileName, TArray<uint8>&& FileData, TOptional<TArray<uint8>>&& DecodedContents);
+	void EncodeWrite(const FUniqueNetIdRef& UserId, const FString& FileName, TArray<uint8>&& FileContents, bool bCompressBeforeUpload, TSet<FString>&& ExistingBlocks);
+	void StartEncodedWrite(const FUniqueNetIdRef& UserId, const FString& FileName, FEOSUserCloudEncodedWrite&& EncodedWrite);
+	void FinishReadFile(bool bWasSuccessful, const FUniqueNetIdRef& UserId, const FString& FileName);
+	void FinishBlockRead(const FUniqueNetIdRef& UserId, const FString& FileName);
+	void FinishWriteFile(bool bWasSuccessful, const FUniqueNetIdRef& UserId, const FString& FileName);
+	void FinishBlockWrite(const FUniqueNetIdRef& UserId, const FString& FileName);
+	void DeleteBlockFiles(const FUniqueNetIdRef& UserId, const TArray<FString>& BlockFileNames);
+	/** Lists the blocks stored on the server for a file */
+	void QueryBlockFiles(const FUniqueNetIdRef& UserId, const FString& FileName, TFunction<void(bool bWasSuccessful, TSet<FString>&& BlockFileNames)>&& OnComplete);
+	/** Returns the transfer a block file belongs to, if any */
+	FEOSUserCloudBlockTransfer* FindBlockTransfer(const FUniqueNetIdRef& UserId, const FString& BlockFileName, FString& OutFileName);
+
+	/** Files larger than this are split into blocks, of which only the changed ones are uploaded. Disabled when 0 */
+	int32 DeltaBlockSize = 0;
+
+	/** Delta transfers in flight per user, indexed by the name of the file being assembled or uploaded */
+	TUniqueNetIdMap<TMap<FString, FEOSUserCloudBlockTransfer>> BlockTransfersPerUser;
+
 	/** Results of the last file enumeration per user */
 	TUniqueNetIdMap<TArray<FCloudFileHeader>> QueryFileSetsPerUser;
 
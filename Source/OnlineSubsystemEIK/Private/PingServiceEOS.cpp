@@ -0,0 +1,511 @@
+// Copyright (c) 2024 Betide Studio. All Rights Reserved.
+
+#include "PingServiceEOS.h"
+#include "OnlineSubsystemEOS.h"
+#include "OnlineSubsystemEOSPrivate.h"
+#include "OnlineSessionEOS.h"
+#include "OnlineSessionSettings.h"
+#include "UserManagerEOS.h"
+#include "EIKSettings.h"
+
+#if WITH_EOS_SDK
+#include "eos_p2p.h"
+
+#if ENGINE_MAJOR_VERSION == 5
+typedef TEIKGlobalCallback<EOS_P2P_OnIncomingConnectionRequestCallback, EOS_P2P_OnIncomingConnectionRequestInfo, FPingServiceEOS> FPingConnectionRequestCallback;
+#else
+typedef TEIKGlobalCallback<EOS_P2P_OnIncomingConnectionRequestCallback, EOS_P2P_OnIncomingConnectionRequestInfo> FPingConnectionRequestCallback;
+#endif
+
+/** Probe packets are [Magic][Type][Sequence:4][Cycles:8], the reply echoes the probe with its type changed */
+#define PING_PACKET_MAGIC 0xE1
+#define PING_PACKET_PROBE 1
+#define PING_PACKET_REPLY 2
+#define PING_PACKET_SIZE 14
+#define PING_MAX_PACKETS_PER_TICK 256
+#define PING_PRUNE_INTERVAL_SECONDS 10.0
+
+FPingServiceEOS::FPingServiceEOS(FOnlineSubsystemEOS* InSubsystem)
+	: EOSSubsystem(InSubsystem)
+{
+	const FEOSSettings Settings = UEIKSettings::GetSettings();
+	bEnabled = Settings.bEnablePingService;
+	Channel = (uint8)FMath::Clamp(Settings.PingChannel, 0, 255);
+	DefaultNumSamples = FMath::Max(Settings.PingSamplesPerProbe, 1);
+	ProbeIntervalSeconds = Settings.PingProbeIntervalSeconds;
+	ProbeTimeoutSeconds = Settings.PingProbeTimeoutSeconds;
+	LossWindow = FMath::Max(Settings.PingLossWindow, 1);
+	StatsRetentionSeconds = Settings.PingStatsRetentionSeconds;
+
+	SocketId.ApiVersion = EOS_P2P_SOCKETID_API_LATEST;
+	FCStringAnsi::Strncpy(SocketId.SocketName, TCHAR_TO_UTF8(*Settings.PingSocketName), sizeof(SocketId.SocketName));
+}
+
+void FPingServiceEOS::Shutdown()
+{
+	if (ConnectionRequestNotificationId != EOS_INVALID_NOTIFICATIONID)
+	{
+		EOS_P2P_RemoveNotifyPeerConnectionRequest(EOSSubsystem->P2PHandle, ConnectionRequestNotificationId);
+		ConnectionRequestNotificationId = EOS_INVALID_NOTIFICATIONID;
+	}
+	delete ConnectionRequestCallback;
+	ConnectionRequestCallback = nullptr;
+	NotifiedLocalUserId = nullptr;
+
+	Remotes.Empty();
+	ProbeRequests.Empty();
+}
+
+void FPingServiceEOS::Tick(float DeltaTime)
+{
+	if (!bEnabled || EOSSubsystem->P2PHandle == nullptr)
+	{
+		return;
+	}
+
+	UpdateConnectionRequestNotification();
+
+	TArray<EOS_ProductUserId, TInlineAllocator<2>> LocalUserIds;
+	if (NotifiedLocalUserId != nullptr)
+	{
+		LocalUserIds.Add(NotifiedLocalUserId);
+	}
+	for (const TPair<FString, FRemoteState>& Remote : Remotes)
+	{
+		if (Remote.Value.PendingProbes.Num() > 0)
+		{
+			LocalUserIds.AddUnique(Remote.Value.LocalUserId);
+		}
+	}
+	for (EOS_ProductUserId LocalUserId : LocalUserIds)
+	{
+		ReceivePackets(LocalUserId);
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	if (ProbeRequests.Num() > 0)
+	{
+		CheckTimeouts(Now);
+		SendProbes(Now);
+		CompleteProbeRequests();
+	}
+	if (Now >= NextPruneTime)
+	{
+		NextPruneTime = Now + PING_PRUNE_INTERVAL_SECONDS;
+		PruneRemotes(Now);
+	}
+}
+
+void FPingServiceEOS::UpdateConnectionRequestNotification()
+{
+	const EOS_ProductUserId LocalUserId = EOSSubsystem->UserManager->GetLocalProductUserId();
+	if (LocalUserId == NotifiedLocalUserId)
+	{
+		return;
+	}
+
+	if (ConnectionRequestNotificationId != EOS_INVALID_NOTIFICATIONID)
+	{
+		EOS_P2P_RemoveNotifyPeerConnectionRequest(EOSSubsystem->P2PHandle, ConnectionRequestNotificationId);
+		ConnectionRequestNotificationId = EOS_INVALID_NOTIFICATIONID;
+	}
+	delete ConnectionRequestCallback;
+	ConnectionRequestCallback = nullptr;
+	NotifiedLocalUserId = LocalUserId;
+
+	if (LocalUserId == nullptr)
+	{
+		return;
+	}
+
+#if ENGINE_MAJOR_VERSION == 5
+	FPingConnectionRequestCallback* CallbackObj = new FPingConnectionRequestCallback(AsWeak());
+#else
+	FPingConnectionRequestCallback* CallbackObj = new FPingConnectionRequestCallback();
+#endif
+	ConnectionRequestCallback = CallbackObj;
+	CallbackObj->CallbackLambda = [this](const EOS_P2P_OnIncomingConnectionRequestInfo* Data)
+	{
+		// Only hosts are probed, anyone else has no reason to open a connection to arbitrary users
+		if (!EOSSubsystem->SessionInterfacePtr.IsValid() || !EOSSubsystem->SessionInterfacePtr->IsHostingSession(Data->LocalUserId))
+		{
+			UE_LOG_ONLINE(Verbose, TEXT("[FPingServiceEOS] Ignoring connection request from %s, not hosting a session"), *EIK_LexToString(Data->RemoteUserId));
+			return;
+		}
+
+		EOS_P2P_AcceptConnectionOptions Options = { };
+		Options.ApiVersion = EOS_P2P_ACCEPTCONNECTION_API_LATEST;
+		Options.LocalUserId = Data->LocalUserId;
+		Options.RemoteUserId = Data->RemoteUserId;
+		Options.SocketId = &SocketId;
+		const EOS_EResult Result = EOS_P2P_AcceptConnection(EOSSubsystem->P2PHandle, &Options);
+		if (Result != EOS_EResult::EOS_Success)
+		{
+			UE_LOG_ONLINE(Warning, TEXT("[FPingServiceEOS] EOS_P2P_AcceptConnection failed for %s with EOS result code (%s)"), *EIK_LexToString(Data->RemoteUserId), ANSI_TO_TCHAR(EOS_EResult_ToString(Result)));
+		}
+	};
+
+	EOS_P2P_AddNotifyPeerConnectionRequestOptions Options = { };
+	Options.ApiVersion = EOS_P2P_ADDNOTIFYPEERCONNECTIONREQUEST_API_LATEST;
+	Options.LocalUserId = LocalUserId;
+	Options.SocketId = &SocketId;
+	ConnectionRequestNotificationId = EOS_P2P_AddNotifyPeerConnectionRequest(EOSSubsystem->P2PHandle, &Options, CallbackObj, CallbackObj->GetCallbackPtr());
+}
+
+void FPingServiceEOS::ReceivePackets(EOS_ProductUserId LocalUserId)
+{
+	uint8 Data[PING_PACKET_SIZE];
+
+	EOS_P2P_ReceivePacketOptions Options = { };
+	Options.ApiVersion = EOS_P2P_RECEIVEPACKET_API_LATEST;
+	Options.LocalUserId = LocalUserId;
+	Options.MaxDataSizeBytes = PING_PACKET_SIZE;
+	Options.RequestedChannel = &Channel;
+
+	for (int32 NumPackets = 0; NumPackets < PING_MAX_PACKETS_PER_TICK; NumPackets++)
+	{
+		EOS_ProductUserId PeerId = nullptr;
+		EOS_P2P_SocketId PacketSocketId = { };
+		uint8 PacketChannel = 0;
+		uint32 BytesWritten = 0;
+		const EOS_EResult Result = EOS_P2P_ReceivePacket(EOSSubsystem->P2PHandle, &Options, &PeerId, &PacketSocketId, &PacketChannel, Data, &BytesWritten);
+		if (Result != EOS_EResult::EOS_Success)
+		{
+			break;
+		}
+		if (BytesWritten != PING_PACKET_SIZE || Data[0] != PING_PACKET_MAGIC || FCStringAnsi::Strcmp(PacketSocketId.SocketName, SocketId.SocketName) != 0)
+		{
+			continue;
+		}
+
+		uint32 Sequence;
+		uint64 Cycles;
+		FMemory::Memcpy(&Sequence, Data + 2, sizeof(Sequence));
+		FMemory::Memcpy(&Cycles, Data + 6, sizeof(Cycles));
+
+		if (Data[1] == PING_PACKET_PROBE)
+		{
+			// Answer straight away, the timestamp is only meaningful to the sender
+			SendPacket(LocalUserId, PeerId, PING_PACKET_REPLY, Sequence, Cycles);
+		}
+		else if (Data[1] == PING_PACKET_REPLY)
+		{
+			if (FRemoteState* Remote = Remotes.Find(EIK_LexToString(PeerId)))
+			{
+				OnProbeReply(*Remote, Sequence, Cycles);
+			}
+		}
+	}
+}
+
+bool FPingServiceEOS::SendPacket(EOS_ProductUserId LocalUserId, EOS_ProductUserId RemoteUserId, uint8 Type, uint32 Sequence, uint64 Cycles)
+{
+	uint8 Data[PING_PACKET_SIZE];
+	Data[0] = PING_PACKET_MAGIC;
+	Data[1] = Type;
+	FMemory::Memcpy(Data + 2, &Sequence, sizeof(Sequence));
+	FMemory::Memcpy(Data + 6, &Cycles, sizeof(Cycles));
+
+	EOS_P2P_SendPacketOptions Options = { };
+	Options.ApiVersion = EOS_P2P_SENDPACKET_API_LATEST;
+	Options.LocalUserId = LocalUserId;
+	Options.RemoteUserId = RemoteUserId;
+	Options.SocketId = &SocketId;
+	Options.Channel = Channel;
+	Options.DataLengthBytes = PING_PACKET_SIZE;
+	Options.Data = Data;
+	// Probes are queued until the connection is up, the warm up probe absorbs that delay
+	Options.bAllowDelayedDelivery = EOS_TRUE;
+	Options.Reliability = EOS_EPacketReliability::EOS_PR_UnreliableUnordered;
+	Options.bDisableAutoAcceptConnection = EOS_FALSE;
+
+	const EOS_EResult Result = EOS_P2P_SendPacket(EOSSubsystem->P2PHandle, &Options);
+	if (Result != EOS_EResult::EOS_Success)
+	{
+		UE_LOG_ONLINE(Verbose, TEXT("[FPingServiceEOS] EOS_P2P_SendPacket to %s failed with EOS result code (%s)"), *EIK_LexToString(RemoteUserId), ANSI_TO_TCHAR(EOS_EResult_ToString(Result)));
+		return false;
+	}
+	return true;
+}
+
+bool FPingServiceEOS::Probe(int32 LocalUserNum, const TArray<EOS_ProductUserId>& RemoteUserIds, int32 NumSamples, const FOnPingProbeComplete& Delegate)
+{
+	const EOS_ProductUserId LocalUserId = EOSSubsystem->UserManager->GetLocalProductUserId(LocalUserNum);
+	if (!bEnabled || EOSSubsystem->P2PHandle == nullptr || LocalUserId == nullptr)
+	{
+		return false;
+	}
+
+	FProbeRequest& Request = ProbeRequests.AddDefaulted_GetRef();
+	Request.Delegate = Delegate;
+
+	const double Now = FPlatformTime::Seconds();
+	for (EOS_ProductUserId RemoteUserId : RemoteUserIds)
+	{
+		if (!EOS_ProductUserId_IsValid(RemoteUserId) || RemoteUserId == LocalUserId)
+		{
+			continue;
+		}
+
+		const FString RemoteUserIdStr = EIK_LexToString(RemoteUserId);
+		if (Request.RemoteUserIds.Contains(RemoteUserIdStr))
+		{
+			continue;
+		}
+		Request.RemoteUserIds.Add(RemoteUserIdStr);
+
+		FRemoteState& Remote = Remotes.FindOrAdd(RemoteUserIdStr);
+		Remote.RemoteUserId = RemoteUserId;
+		if (Remote.LocalUserId != LocalUserId)
+		{
+			Remote.LocalUserId = LocalUserId;
+			Remote.bConnected = false;
+		}
+		Remote.LastRequestTime = Now;
+		// Overlapping requests share the probes, so only top up what's still missing
+		Remote.NumProbesToSend = FMath::Max(Remote.NumProbesToSend, NumSamples);
+		if (Remote.PendingProbes.Num() == 0)
+		{
+			Remote.NextProbeTime = Now;
+		}
+	}
+
+	SendProbes(Now);
+	return true;
+}
+
+void FPingServiceEOS::SendProbes(double Now)
+{
+	for (TPair<FString, FRemoteState>& Pair : Remotes)
+	{
+		FRemoteState& Remote = Pair.Value;
+		if (Remote.NumProbesToSend <= 0 || Now < Remote.NextProbeTime)
+		{
+			continue;
+		}
+
+		// Until the warm up probe comes back there's no point sending samples that would sit in the same queue
+		const bool bWarmUp = !Remote.bConnected;
+		if (bWarmUp && Remote.PendingProbes.Num() > 0)
+		{
+			continue;
+		}
+
+		const uint32 Sequence = Remote.NextSequence++;
+		const uint64 Cycles = FPlatformTime::Cycles64();
+		if (!SendPacket(Remote.LocalUserId, Remote.RemoteUserId, PING_PACKET_PROBE, Sequence, Cycles))
+		{
+			AddOutcome(Remote, false);
+			Remote.NumProbesToSend = 0;
+			continue;
+		}
+
+		FPendingProbe& PendingProbe = Remote.PendingProbes.Add(Sequence);
+		PendingProbe.SendCycles = Cycles;
+		PendingProbe.SendTime = Now;
+		PendingProbe.bWarmUp = bWarmUp;
+		if (!bWarmUp)
+		{
+			Remote.NumProbesToSend--;
+		}
+		Remote.NextProbeTime = Now + ProbeIntervalSeconds;
+	}
+}
+
+void FPingServiceEOS::OnProbeReply(FRemoteState& Remote, uint32 Sequence, uint64 SendCycles)
+{
+	FPendingProbe PendingProbe;
+	if (!Remote.PendingProbes.RemoveAndCopyValue(Sequence, PendingProbe) || PendingProbe.SendCycles != SendCycles)
+	{
+		// Late reply to a probe that already timed out, or not one of ours
+		return;
+	}
+
+	const double RttMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - SendCycles);
+	Remote.bConnected = true;
+	if (PendingProbe.bWarmUp)
+	{
+		Remote.NextProbeTime = FPlatformTime::Seconds();
+		return;
+	}
+
+	FEOSPingStats& Stats = Remote.Stats;
+	if (Stats.NumSamples == 0)
+	{
+		Stats.RttMs = RttMs;
+		Stats.MinRttMs = RttMs;
+	}
+	else
+	{
+		// Same smoothing as TCP's SRTT (RFC 6298) and RTP's interarrival jitter (RFC 3550)
+		Stats.RttMs += (RttMs - Stats.RttMs) / 8.0;
+		Stats.MinRttMs = FMath::Min(Stats.MinRttMs, RttMs);
+	}
+	if (Remote.LastRttMs >= 0.0)
+	{
+		Stats.JitterMs += (FMath::Abs(RttMs - Remote.LastRttMs) - Stats.JitterMs) / 16.0;
+	}
+	Remote.LastRttMs = RttMs;
+	Stats.NumSamples++;
+	Stats.LastUpdateTime = FPlatformTime::Seconds();
+	AddOutcome(Remote, true);
+}
+
+void FPingServiceEOS::AddOutcome(FRemoteState& Remote, bool bReceived)
+{
+	if (Remote.RecentOutcomes.Num() < LossWindow)
+	{
+		Remote.RecentOutcomes.Add(bReceived);
+	}
+	else
+	{
+		Remote.RecentOutcomes[Remote.NextOutcomeIndex] = bReceived;
+		Remote.NextOutcomeIndex = (Remote.NextOutcomeIndex + 1) % LossWindow;
+	}
+
+	int32 NumLost = 0;
+	for (bool bOutcome : Remote.RecentOutcomes)
+	{
+		NumLost += bOutcome ? 0 : 1;
+	}
+	Remote.Stats.PacketLoss = (float)NumLost / (float)Remote.RecentOutcomes.Num();
+}
+
+void FPingServiceEOS::CheckTimeouts(double Now)
+{
+	for (TPair<FString, FRemoteState>& Pair : Remotes)
+	{
+		FRemoteState& Remote = Pair.Value;
+		for (auto It = Remote.PendingProbes.CreateIterator(); It; ++It)
+		{
+			if (Now - It.Value().SendTime < ProbeTimeoutSeconds)
+			{
+				continue;
+			}
+
+			if (It.Value().bWarmUp)
+			{
+				// No connection could be made, so the remaining probes would go the same way
+				for (int32 Index = 0; Index < Remote.NumProbesToSend; Index++)
+				{
+					AddOutcome(Remote, false);
+				}
+				Remote.NumProbesToSend = 0;
+			}
+			else
+			{
+				AddOutcome(Remote, false);
+			}
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void FPingServiceEOS::CompleteProbeRequests()
+{
+	for (int32 Index = 0; Index < ProbeRequests.Num(); Index++)
+	{
+		bool bIsComplete = true;
+		for (const FString& RemoteUserId : ProbeRequests[Index].RemoteUserIds)
+		{
+			const FRemoteState& Remote = Remotes.FindChecked(RemoteUserId);
+			if (Remote.NumProbesToSend > 0 || Remote.PendingProbes.Num() > 0)
+			{
+				bIsComplete = false;
+				break;
+			}
+		}
+		if (!bIsComplete)
+		{
+			continue;
+		}
+
+		FProbeRequest Request = MoveTemp(ProbeRequests[Index]);
+		ProbeRequests.RemoveAt(Index--);
+
+		TMap<FString, FEOSPingStats> Results;
+		for (const FString& RemoteUserId : Request.RemoteUserIds)
+		{
+			FRemoteState& Remote = Remotes.FindChecked(RemoteUserId);
+			Results.Add(RemoteUserId, Remote.Stats);
+
+			const bool bIsStillProbed = ProbeRequests.ContainsByPredicate([&RemoteUserId](const FProbeRequest& OtherRequest)
+			{
+				return OtherRequest.RemoteUserIds.Contains(RemoteUserId);
+			});
+			if (!bIsStillProbed)
+			{
+				CloseConnection(Remote);
+			}
+		}
+		Request.Delegate.ExecuteIfBound(Results);
+	}
+}
+
+void FPingServiceEOS::CloseConnection(FRemoteState& Remote)
+{
+	EOS_P2P_CloseConnectionOptions Options = { };
+	Options.ApiVersion = EOS_P2P_CLOSECONNECTION_API_LATEST;
+	Options.LocalUserId = Remote.LocalUserId;
+	Options.RemoteUserId = Remote.RemoteUserId;
+	Options.SocketId = &SocketId;
+	const EOS_EResult Result = EOS_P2P_CloseConnection(EOSSubsystem->P2PHandle, &Options);
+	if (Result != EOS_EResult::EOS_Success)
+	{
+		UE_LOG_ONLINE(Verbose, TEXT("[FPingServiceEOS] EOS_P2P_CloseConnection to %s failed with EOS result code (%s)"), *EIK_LexToString(Remote.RemoteUserId), ANSI_TO_TCHAR(EOS_EResult_ToString(Result)));
+	}
+	// The next probe has to set the connection up again
+	Remote.bConnected = false;
+}
+
+void FPingServiceEOS::PruneRemotes(double Now)
+{
+	for (auto It = Remotes.CreateIterator(); It; ++It)
+	{
+		const FRemoteState& Remote = It.Value();
+		if (Remote.NumProbesToSend > 0 || Remote.PendingProbes.Num() > 0 || Now - Remote.LastRequestTime < StatsRetentionSeconds)
+		{
+			continue;
+		}
+		const FString& RemoteUserId = It.Key();
+		const bool bIsRequested = ProbeRequests.ContainsByPredicate([&RemoteUserId](const FProbeRequest& Request)
+		{
+			return Request.RemoteUserIds.Contains(RemoteUserId);
+		});
+		if (!bIsRequested)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+const FEOSPingStats* FPingServiceEOS::GetPingStats(EOS_ProductUserId RemoteUserId) const
+{
+	const FRemoteState* Remote = Remotes.Find(EIK_LexToString(RemoteUserId));
+	return Remote && Remote->Stats.NumSamples > 0 ? &Remote->Stats : nullptr;
+}
+
+int32 FPingServiceEOS::GetPingInMs(const FOnlineSessionSearchResult& SearchResult, int32 Default) const
+{
+	if (EOS_ProductUserId Owner = GetSearchResultOwner(SearchResult))
+	{
+		if (const FEOSPingStats* Stats = GetPingStats(Owner))
+		{
+			return FMath::RoundToInt(Stats->RttMs);
+		}
+	}
+	return Default;
+}
+
+EOS_ProductUserId FPingServiceEOS::GetSearchResultOwner(const FOnlineSessionSearchResult& SearchResult)
+{
+	const FUniqueNetIdPtr& OwningUserId = SearchResult.Session.OwningUserId;
+	if (!OwningUserId.IsValid() || OwningUserId->GetType() != FUniqueNetIdEOS::GetTypeStatic())
+	{
+		return nullptr;
+	}
+	const EOS_ProductUserId Owner = FUniqueNetIdEOS::Cast(*OwningUserId).GetProductUserId();
+	return EOS_ProductUserId_IsValid(Owner) ? Owner : nullptr;
+}
+
+#endif
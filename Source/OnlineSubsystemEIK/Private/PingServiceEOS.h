@@ -0,0 +1,141 @@
+// Copyright (c) 2024 Betide Studio. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Runtime/Launch/Resources/Version.h"
+#include "OnlineSubsystemEOSTypes.h"
+
+class FOnlineSubsystemEOS;
+class FOnlineSessionSearchResult;
+
+#if WITH_EOS_SDK
+#include "eos_p2p_types.h"
+
+/** Rolling latency estimate for one remote user */
+struct FEOSPingStats
+{
+	/** Smoothed round trip time */
+	double RttMs = 0.0;
+	/** Lowest round trip time seen */
+	double MinRttMs = 0.0;
+	/** Smoothed difference between consecutive round trip times */
+	double JitterMs = 0.0;
+	/** Fraction of the recent probes that never got a reply */
+	float PacketLoss = 0.0f;
+	/** Number of round trips measured */
+	int32 NumSamples = 0;
+	/** FPlatformTime::Seconds() of the last probe that completed */
+	double LastUpdateTime = 0.0;
+};
+
+/** Stats of every probed remote user, keyed by product user id string. Unreachable users have a packet loss of 1. */
+DECLARE_DELEGATE_OneParam(FOnPingProbeComplete, const TMap<FString, FEOSPingStats>& /*Results*/);
+
+/**
+ * Measures latency to remote users with small timestamped probes over a dedicated EOS P2P socket.
+ *
+ * Off unless bEnablePingService is set. Local users that host a session or lobby accept probe connections and answer
+ * them, so listen server hosts and lobby owners can be probed without a beacon or net connection. Many users can be
+ * probed in parallel, each with several samples, and the results are folded into a smoothed RTT, jitter and loss
+ * estimate that is kept for PingStatsRetentionSeconds after the last probe. The connection to a remote user is closed
+ * once its probes complete. Packets are polled once per tick on both sides, so a round trip can include up to a
+ * frame of latency on each.
+ */
+class FPingServiceEOS
+	: public TSharedFromThis<FPingServiceEOS, ESPMode::ThreadSafe>
+{
+public:
+	FPingServiceEOS() = delete;
+	explicit FPingServiceEOS(FOnlineSubsystemEOS* InSubsystem);
+	virtual ~FPingServiceEOS() = default;
+
+	void Shutdown();
+	void Tick(float DeltaTime);
+
+	/**
+	 * Sends NumSamples probes to each remote user and calls Delegate once every probe has been answered or has timed out
+	 *
+	 * @return false if the local user isn't logged in or the service is disabled
+	 */
+	bool Probe(int32 LocalUserNum, const TArray<EOS_ProductUserId>& RemoteUserIds, int32 NumSamples, const FOnPingProbeComplete& Delegate);
+
+	/** Latest estimate for a remote user, or nullptr if it was never probed */
+	const FEOSPingStats* GetPingStats(EOS_ProductUserId RemoteUserId) const;
+
+	/** Measured RTT to the owner of a search result, or Default if there is no measurement for them */
+	int32 GetPingInMs(const FOnlineSessionSearchResult& SearchResult, int32 Default) const;
+
+	/** Product user id of the host of a search result, or nullptr for hosts that can't be probed, such as dedicated servers */
+	static EOS_ProductUserId GetSearchResultOwner(const FOnlineSessionSearchResult& SearchResult);
+
+	int32 GetDefaultNumSamples() const { return DefaultNumSamples; }
+
+private:
+	struct FPendingProbe
+	{
+		uint64 SendCycles = 0;
+		double SendTime = 0.0;
+		/** The first probe to a user also sets up the connection, so its round trip isn't used as a sample */
+		bool bWarmUp = false;
+	};
+
+	struct FRemoteState
+	{
+		EOS_ProductUserId RemoteUserId = nullptr;
+		EOS_ProductUserId LocalUserId = nullptr;
+		FEOSPingStats Stats;
+		double LastRttMs = -1.0;
+		bool bConnected = false;
+		uint32 NextSequence = 0;
+		TMap<uint32, FPendingProbe> PendingProbes;
+		int32 NumProbesToSend = 0;
+		double NextProbeTime = 0.0;
+		/** When the remote user was last asked to be probed, used to forget idle users */
+		double LastRequestTime = 0.0;
+		/** Whether each of the most recent probes got a reply, used as a ring buffer */
+		TArray<bool> RecentOutcomes;
+		int32 NextOutcomeIndex = 0;
+	};
+
+	struct FProbeRequest
+	{
+		TArray<FString> RemoteUserIds;
+		FOnPingProbeComplete Delegate;
+	};
+
+	/** Makes sure probes sent to the local user get accepted */
+	void UpdateConnectionRequestNotification();
+	void ReceivePackets(EOS_ProductUserId LocalUserId);
+	void SendProbes(double Now);
+	void CheckTimeouts(double Now);
+	void CompleteProbeRequests();
+	/** Forgets remote users that were not probed for PingStatsRetentionSeconds */
+	void PruneRemotes(double Now);
+	void CloseConnection(FRemoteState& Remote);
+	bool SendPacket(EOS_ProductUserId LocalUserId, EOS_ProductUserId RemoteUserId, uint8 Type, uint32 Sequence, uint64 Cycles);
+	void OnProbeReply(FRemoteState& Remote, uint32 Sequence, uint64 SendCycles);
+	void AddOutcome(FRemoteState& Remote, bool bReceived);
+
+	FOnlineSubsystemEOS* EOSSubsystem;
+
+	bool bEnabled = false;
+	EOS_P2P_SocketId SocketId;
+	uint8 Channel = 250;
+	int32 DefaultNumSamples = 5;
+	float ProbeIntervalSeconds = 0.1f;
+	float ProbeTimeoutSeconds = 2.0f;
+	int32 LossWindow = 32;
+	float StatsRetentionSeconds = 300.0f;
+	double NextPruneTime = 0.0;
+
+	/** Remote users that were ever probed, keyed by product user id string */
+	TMap<FString, FRemoteState> Remotes;
+	TArray<FProbeRequest> ProbeRequests;
+
+	EOS_ProductUserId NotifiedLocalUserId = nullptr;
+	EOS_NotificationId ConnectionRequestNotificationId = EOS_INVALID_NOTIFICATIONID;
+	FCallbackBase* ConnectionRequestCallback = nullptr;
+};
+
+#endif
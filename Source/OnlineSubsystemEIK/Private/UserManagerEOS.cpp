@@ -10,6 +10,7 @@
 #include "OnlineError.h"
 #include "OnlineSubsystemEOS.h"
 #include "OnlineSubsystemEOSPrivate.h"
+#include "OnlineStatsEOS.h"
 #include "SocketSubsystem.h"
 #include "Engine/Engine.h"
 #include "Engine/GameInstance.h"
@@ -142,7 +143,6 @@ static inline EOS_EExternalCredentialType ToEOS_EExternalCredentialType(FName OS
 
 /** Delegates that are used for internal calls and are meant to be ignored */
 IOnlinePresence::FOnPresenceTaskCompleteDelegate IgnoredPresenceDelegate;
-IOnlineUser::FOnQueryExternalIdMappingsComplete IgnoredMappingDelegate;
 
 #if ENGINE_MAJOR_VERSION == 5
 typedef TEIKGlobalCallback<EOS_UI_OnDisplaySettingsUpdatedCallback, EOS_UI_OnDisplaySettingsUpdatedCallbackInfo, FUserManagerEOS> FOnDisplaySettingsUpdatedCallback;
@@ -171,6 +171,11 @@ FUserManagerEOS::FUserManagerEOS(FOnlineSubsystemEOS* InSubsystem)
 
 void FUserManagerEOS::Init()
 {
+	const FEOSSettings Settings = UEIKSettings::GetSettings();
+	UserLookupBatchWindowSeconds = FMath::Max(Settings.UserLookupBatchWindowSeconds, 0.f);
+	UserLookupCacheSeconds = FMath::Max(Settings.UserLookupCacheSeconds, 0.f);
+	MaxUserInfoLookupsInFlight = FMath::Max(Settings.MaxUserInfoLookupsInFlight, 1);
+
 	// This delegate would cause a crash when running a dedicated server
 	if (!IsRunningDedicatedServer())
 	{
@@ -1386,7 +1391,7 @@ void FUserManagerEOS::RefreshConnectLogin(int32 LocalUserNum)
 		{
 			// We update the auth token cached in the user account, along with the user information
 			const FUniqueNetIdEOSPtr UniqueNetId = UserNumToNetIdMap.FindChecked(LocalUserNum);
-			const FUserOnlineAccountEOSRef UserAccountRef = StringToUserAccountMap.FindChecked(UniqueNetId->ToString());
+			const FUserOnlineAccountEOSRef UserAccountRef = NetIdToUserAccountMap.FindChecked(UniqueNetId.Get());
 			UserAccountRef->SetAuthAttribute(AUTH_ATTR_ID_TOKEN, AuthToken->AccessToken);
 			UpdateUserInfo(UserAccountRef, AccountId, AccountId);
 
@@ -1622,6 +1627,13 @@ bool FUserManagerEOS::Logout(int32 LocalUserNum)
 		TriggerOnLogoutCompleteDelegates(LocalUserNum, false);
 		return false;
 	}
+
+	// Accumulated stat updates have to be ingested while the user can still do so
+	if (EOSSubsystem->StatsInterfacePtr.IsValid())
+	{
+		EOSSubsystem->StatsInterfacePtr->FlushStats();
+	}
+
 	if(UserId.Get()->GetEpicAccountId())
 	{
 #if ENGINE_MAJOR_VERSION == 5
@@ -1672,6 +1684,20 @@ CallbackObj->CallbackLambda = [LocalUserNum, this](const EOS_Auth_LogoutCallback
 
 void FUserManagerEOS::Tick(float DeltaTime)
 {
+	if (UserLookupFlushTime != 0.0 && FPlatformTime::Seconds() >= UserLookupFlushTime)
+	{
+		UserLookupFlushTime = 0.0;
+		FlushUserInfoLookups();
+		FlushExternalIdLookups();
+		FlushProductUserIdLookups();
+	}
+
+	if (FPlatformTime::Seconds() >= UserLookupPruneTime)
+	{
+		UserLookupPruneTime = FPlatformTime::Seconds() + UserLookupCacheSeconds;
+		PruneUserLookupTimes();
+	}
+
 	UEnum* EnumPtr = FindObject<UEnum>(nullptr, TEXT("/Script/OnlineSubsystemEIK.EEIK_EExternalCredentialType"));
 	UEIKSettings* EIKSettings = GetMutableDefault<UEIKSettings>();
 	if(EnumPtr && EIKSettings)
@@ -2052,16 +2078,16 @@ void FUserManagerEOS::AddLocalUser(int32 LocalUserNum, EOS_EpicAccountId EpicAcc
 	}
 
 	FUniqueNetIdEOSRef UserNetId = FUniqueNetIdEOSRegistry::FindOrAdd(EpicAccountId, UserId).ToSharedRef();
-	const FString& NetId = UserNetId->ToString();
+	const FUniqueNetIdEOS* NetId = &UserNetId.Get();
 	FUserOnlineAccountEOSRef UserAccountRef(new FUserOnlineAccountEOS(UserNetId));
 
 	UserNumToNetIdMap.Emplace(LocalUserNum, UserNetId);
 	UserNumToAccountIdMap.Emplace(LocalUserNum, EpicAccountId);
 	AccountIdToUserNumMap.Emplace(EpicAccountId, LocalUserNum);
-	NetIdStringToOnlineUserMap.Emplace(*NetId, UserAccountRef);
-	StringToUserAccountMap.Emplace(NetId, UserAccountRef);
-	AccountIdToStringMap.Emplace(EpicAccountId, NetId);
-	ProductUserIdToStringMap.Emplace(UserId, *NetId);
+	NetIdToOnlineUserMap.Emplace(NetId, UserAccountRef);
+	NetIdToUserAccountMap.Emplace(NetId, UserAccountRef);
+	AccountIdToNetIdMap.Emplace(EpicAccountId, UserNetId);
+	ProductUserIdToNetIdMap.Emplace(UserId, UserNetId);
 	EpicAccountIdToAttributeAccessMap.Emplace(EpicAccountId, UserAccountRef);
 	UserNumToProductUserIdMap.Emplace(LocalUserNum, UserId);
 	ProductUserIdToUserNumMap.Emplace(UserId, LocalUserNum);
@@ -2069,17 +2095,17 @@ void FUserManagerEOS::AddLocalUser(int32 LocalUserNum, EOS_EpicAccountId EpicAcc
 	// Init player lists
 	FFriendsListEOSRef FriendsList = MakeShareable(new FFriendsListEOS(LocalUserNum, UserNetId));
 	LocalUserNumToFriendsListMap.Emplace(LocalUserNum, FriendsList);
-	NetIdStringToFriendsListMap.Emplace(NetId, FriendsList);
+	NetIdToFriendsListMap.Emplace(NetId, FriendsList);
 	ReadFriendsList(LocalUserNum, FString());
 
 	FBlockedPlayersListEOSRef BlockedPlayersList = MakeShareable(new FBlockedPlayersListEOS(LocalUserNum, UserNetId));
 	LocalUserNumToBlockedPlayerListMap.Emplace(LocalUserNum, BlockedPlayersList);
-	NetIdStringToBlockedPlayerListMap.Emplace(NetId, BlockedPlayersList);
+	NetIdToBlockedPlayerListMap.Emplace(NetId, BlockedPlayersList);
 	QueryBlockedPlayers(*UserNetId);
 
 	FRecentPlayersListEOSRef RecentPlayersList = MakeShareable(new FRecentPlayersListEOS(LocalUserNum, UserNetId));
 	LocalUserNumToRecentPlayerListMap.Emplace(LocalUserNum, RecentPlayersList);
-	NetIdStringToRecentPlayerListMap.Emplace(NetId, RecentPlayersList);
+	NetIdToRecentPlayerListMap.Emplace(NetId, RecentPlayersList);
 
 	// Get auth token info
 	EOS_Auth_Token* AuthToken = nullptr;
@@ -2142,7 +2168,7 @@ TSharedPtr<FUserOnlineAccount> FUserManagerEOS::GetUserAccount(const FUniqueNetI
 	TSharedPtr<FUserOnlineAccount> Result;
 
 	const FUniqueNetIdEOS& EOSID = FUniqueNetIdEOS::Cast(UserId);
-	const FUserOnlineAccountEOSRef* FoundUserAccount = StringToUserAccountMap.Find(EOSID.ToString());
+	const FUserOnlineAccountEOSRef* FoundUserAccount = NetIdToUserAccountMap.Find(&EOSID);
 	if (FoundUserAccount != nullptr)
 	{
 		return *FoundUserAccount;
@@ -2155,7 +2181,7 @@ TArray<TSharedPtr<FUserOnlineAccount>> FUserManagerEOS::GetAllUserAccounts() con
 {
 	TArray<TSharedPtr<FUserOnlineAccount>> Result;
 
-	for (TMap<FString, FUserOnlineAccountEOSRef>::TConstIterator It(StringToUserAccountMap); It; ++It)
+	for (TUniqueNetIdEOSMap<FUserOnlineAccountEOSRef>::TConstIterator It(NetIdToUserAccountMap); It; ++It)
 	{
 		Result.Add(It.Value());
 	}
@@ -2320,69 +2346,130 @@ void FUserManagerEOS::ResolveUniqueNetId(const EOS_ProductUserId& ProductUserId,
 
 void FUserManagerEOS::ResolveUniqueNetIds(const TArray<EOS_ProductUserId>& ProductUserIds, const FResolveUniqueNetIdsCallback& Callback) const
 {
-	TMap<EOS_ProductUserId, FUniqueNetIdEOSRef> ResolvedUniqueNetIds;
-	TArray<EOS_ProductUserId> ProductUserIdsToResolve;
+	struct FResolveState
+	{
+		TMap<EOS_ProductUserId, FUniqueNetIdEOSRef> ResolvedUniqueNetIds;
+		int32 NumRemaining = 1;
+		FResolveUniqueNetIdsCallback Callback;
+	};
+	TSharedRef<FResolveState> State = MakeShared<FResolveState>();
+	State->Callback = Callback;
 
+	const double Now = FPlatformTime::Seconds();
 	for (const EOS_ProductUserId& ProductUserId : ProductUserIds)
 	{
-		EOS_EpicAccountId EpicAccountId;
-		// We check first if the Product User Id has already been queried, which would allow us to retrieve its Epic Account Id directly
-		if (GetEpicAccountIdFromProductUserId(ProductUserId, EpicAccountId))
+		if (ProductUserId == nullptr || State->ResolvedUniqueNetIds.Contains(ProductUserId))
 		{
-			const FUniqueNetIdEOSRef UniqueNetId = FUniqueNetIdEOSRegistry::FindOrAdd(EpicAccountId, ProductUserId).ToSharedRef();
-			ResolvedUniqueNetIds.Add(ProductUserId, UniqueNetId);
+			continue;
 		}
-		else
+
+		EOS_EpicAccountId EpicAccountId = nullptr;
+		// We check first if the Product User Id has already been queried, which would allow us to retrieve its Epic Account Id directly.
+		// Users without an Epic account never map to one, so a recent lookup that found none is trusted too
+		const double* LookupTime = ProductUserIdLookupTimes.Find(ProductUserId);
+		if (GetEpicAccountIdFromProductUserId(ProductUserId, EpicAccountId)
+			|| (LookupTime != nullptr && Now - *LookupTime < UserLookupCacheSeconds && !PendingProductUserIdLookups.Contains(ProductUserId)))
 		{
-			// If that's not the case, we'll have to query them first
-			ProductUserIdsToResolve.Add(ProductUserId);
+			State->ResolvedUniqueNetIds.Add(ProductUserId, FUniqueNetIdEOSRegistry::FindOrAdd(EpicAccountId, ProductUserId).ToSharedRef());
+			continue;
 		}
+
+		// If that's not the case, we'll have to query them first. Placeholders keep duplicates in the input from queueing twice
+		State->ResolvedUniqueNetIds.Add(ProductUserId, FUniqueNetIdEOS::EmptyId());
+		State->NumRemaining++;
+		RequestProductUserIdMapping(ProductUserId, [this, State, ProductUserId](bool bWasSuccessful, const FString& ErrorStr)
+		{
+			EOS_EpicAccountId EpicAccountId = nullptr;
+			GetEpicAccountIdFromProductUserId(ProductUserId, EpicAccountId);
+			State->ResolvedUniqueNetIds.Add(ProductUserId, FUniqueNetIdEOSRegistry::FindOrAdd(EpicAccountId, ProductUserId).ToSharedRef());
+
+			if (--State->NumRemaining == 0)
+			{
+				State->Callback(State->ResolvedUniqueNetIds);
+			}
+		});
 	}
-	
 
-	if (ProductUserIdsToResolve.Num() > 0)
+	if (--State->NumRemaining == 0)
+	{
+		State->Callback(State->ResolvedUniqueNetIds);
+	}
+}
+
+bool FUserManagerEOS::RequestProductUserIdMapping(EOS_ProductUserId ProductUserId, FUserLookupCompleteCallback&& OnComplete) const
+{
+	FPendingUserLookup* Lookup = PendingProductUserIdLookups.Find(ProductUserId);
+	if (Lookup == nullptr)
 	{
+		Lookup = &PendingProductUserIdLookups.Add(ProductUserId);
+		QueuedProductUserIdLookups.Add(ProductUserId);
+		ScheduleUserLookupFlush();
+	}
+
+	if (OnComplete)
+	{
+		Lookup->Callbacks.Add(MoveTemp(OnComplete));
+	}
+	return true;
+}
+
+void FUserManagerEOS::FlushProductUserIdLookups() const
+{
+	// The backend takes at most as many product user ids per query as it does external account ids
+	static constexpr int32 MaxProductUserIdsPerQuery = EOS_CONNECT_QUERYEXTERNALACCOUNTMAPPINGS_MAX_ACCOUNT_IDS;
+
+	for (int32 QueryStart = 0; QueryStart < QueuedProductUserIdLookups.Num(); QueryStart += MaxProductUserIdsPerQuery)
+	{
+		TArray<EOS_ProductUserId> BatchIds(QueuedProductUserIdLookups.GetData() + QueryStart, FMath::Min(QueuedProductUserIdLookups.Num() - QueryStart, MaxProductUserIdsPerQuery));
+		for (const EOS_ProductUserId ProductUserId : BatchIds)
+		{
+			PendingProductUserIdLookups.FindChecked(ProductUserId).bInFlight = true;
+		}
+
 		EOS_Connect_QueryProductUserIdMappingsOptions QueryProductUserIdMappingsOptions = {};
 		QueryProductUserIdMappingsOptions.ApiVersion = EOS_CONNECT_QUERYPRODUCTUSERIDMAPPINGS_API_LATEST;
-		QueryProductUserIdMappingsOptions.LocalUserId = EOSSubsystem->UserManager->GetLocalProductUserId(0);
-		QueryProductUserIdMappingsOptions.ProductUserIds = ProductUserIdsToResolve.GetData();
-		QueryProductUserIdMappingsOptions.ProductUserIdCount = ProductUserIdsToResolve.Num();
+		QueryProductUserIdMappingsOptions.LocalUserId = GetLocalProductUserId();
+		QueryProductUserIdMappingsOptions.ProductUserIds = BatchIds.GetData();
+		QueryProductUserIdMappingsOptions.ProductUserIdCount = BatchIds.Num();
 #if ENGINE_MAJOR_VERSION == 5
 		FConnectQueryProductUserIdMappingsCallback* CallbackObj = new FConnectQueryProductUserIdMappingsCallback(FUserManagerEOSConstWeakPtr(AsShared()));
 #else
 		FConnectQueryProductUserIdMappingsCallback* CallbackObj = new FConnectQueryProductUserIdMappingsCallback();
 #endif
-		CallbackObj->CallbackLambda = [this, ProductUserIdsToResolve, ResolvedUniqueNetIds = MoveTemp(ResolvedUniqueNetIds), Callback](const EOS_Connect_QueryProductUserIdMappingsCallbackInfo* Data) mutable
+		CallbackObj->CallbackLambda = [this, BatchIds](const EOS_Connect_QueryProductUserIdMappingsCallbackInfo* Data)
 		{
-			if (Data->ResultCode != EOS_EResult::EOS_Success)
+			const bool bWasSuccessful = Data->ResultCode == EOS_EResult::EOS_Success;
+			FString ErrorStr;
+			if (bWasSuccessful)
+			{
+				const double Now = FPlatformTime::Seconds();
+				for (const EOS_ProductUserId ProductUserId : BatchIds)
+				{
+					ProductUserIdLookupTimes.Add(ProductUserId, Now);
+				}
+			}
+			else
 			{
 				UE_LOG_ONLINE(Verbose, TEXT("[FUserManagerEOS::ResolveUniqueNetIds] EOS_Connect_QueryProductUserIdMappings not successful for user (%s). Finished with EOS_EResult %s."), *EIK_LexToString(Data->LocalUserId), ANSI_TO_TCHAR(EOS_EResult_ToString(Data->ResultCode)));
+				ErrorStr = FString::Printf(TEXT("EOS_Connect_QueryProductUserIdMappings() failed with EOS result code (%s)"), ANSI_TO_TCHAR(EOS_EResult_ToString(Data->ResultCode)));
 			}
 
-			for (const EOS_ProductUserId& ProductUserId : ProductUserIdsToResolve)
+			for (const EOS_ProductUserId ProductUserId : BatchIds)
 			{
-				if(ProductUserId == nullptr)
+				FPendingUserLookup Lookup;
+				if (PendingProductUserIdLookups.RemoveAndCopyValue(ProductUserId, Lookup))
 				{
-					continue;
+					for (const FUserLookupCompleteCallback& LookupCallback : Lookup.Callbacks)
+					{
+						LookupCallback(bWasSuccessful, ErrorStr);
+					}
 				}
-				EOS_EpicAccountId EpicAccountId = nullptr;
-
-				GetEpicAccountIdFromProductUserId(ProductUserId, EpicAccountId);
-
-				const FUniqueNetIdEOSRef UniqueNetId = FUniqueNetIdEOSRegistry::FindOrAdd(EpicAccountId, ProductUserId).ToSharedRef();
-
-				ResolvedUniqueNetIds.Add(ProductUserId, UniqueNetId);
 			}
-
-			Callback(ResolvedUniqueNetIds);
 		};
-		
+
 		EOS_Connect_QueryProductUserIdMappings(EOSSubsystem->ConnectHandle, &QueryProductUserIdMappingsOptions, CallbackObj, CallbackObj->GetCallbackPtr());
 	}
-	else
-	{
-		Callback(ResolvedUniqueNetIds);
-	}
+	QueuedProductUserIdLookups.Reset();
 }
 
 FOnlineUserPtr FUserManagerEOS::GetLocalOnlineUser(int32 LocalUserNum) const
@@ -2391,10 +2478,7 @@ FOnlineUserPtr FUserManagerEOS::GetLocalOnlineUser(int32 LocalUserNum) const
 	if (UserNumToNetIdMap.Contains(LocalUserNum))
 	{
 		const FUniqueNetIdEOSPtr NetId = UserNumToNetIdMap.FindRef(LocalUserNum);
-		if (NetIdStringToOnlineUserMap.Contains(NetId->ToString()))
-		{
-			OnlineUser = NetIdStringToOnlineUserMap.FindRef(NetId->ToString());
-		}
+		OnlineUser = NetIdToOnlineUserMap.FindRef(NetId.Get());
 	}
 	return OnlineUser;
 }
@@ -2402,13 +2486,9 @@ FOnlineUserPtr FUserManagerEOS::GetLocalOnlineUser(int32 LocalUserNum) const
 FOnlineUserPtr FUserManagerEOS::GetOnlineUser(EOS_ProductUserId UserId) const
 {
 	FOnlineUserPtr OnlineUser;
-	if (ProductUserIdToStringMap.Contains(UserId))
+	if (const FUniqueNetIdEOSRef* NetId = ProductUserIdToNetIdMap.Find(UserId))
 	{
-		const FString& NetId = ProductUserIdToStringMap.FindRef(UserId);
-		if (NetIdStringToOnlineUserMap.Contains(NetId))
-		{
-			OnlineUser = NetIdStringToOnlineUserMap.FindRef(*NetId);
-		}
+		OnlineUser = NetIdToOnlineUserMap.FindRef(&NetId->Get());
 	}
 	return OnlineUser;
 }
@@ -2416,13 +2496,9 @@ FOnlineUserPtr FUserManagerEOS::GetOnlineUser(EOS_ProductUserId UserId) const
 FOnlineUserPtr FUserManagerEOS::GetOnlineUser(EOS_EpicAccountId AccountId) const
 {
 	FOnlineUserPtr OnlineUser;
-	if (AccountIdToStringMap.Contains(AccountId))
+	if (const FUniqueNetIdEOSRef* NetId = AccountIdToNetIdMap.Find(AccountId))
 	{
-		const FString& NetId = AccountIdToStringMap.FindRef(AccountId);
-		if (NetIdStringToOnlineUserMap.Contains(NetId))
-		{
-			OnlineUser = NetIdStringToOnlineUserMap.FindRef(NetId);
-		}
+		OnlineUser = NetIdToOnlineUserMap.FindRef(&NetId->Get());
 	}
 	return OnlineUser;
 }
@@ -2434,17 +2510,17 @@ void FUserManagerEOS::RemoveLocalUser(int32 LocalUserNum)
 	{
 		EOSSubsystem->ReleaseVoiceChatUserInterface(**FoundId);
 		LocalUserNumToFriendsListMap.Remove(LocalUserNum);
-		const FString& NetId = (*FoundId)->ToString();
+		const FUniqueNetIdEOS* NetId = FoundId->Get();
 		const EOS_EpicAccountId AccountId = (*FoundId)->GetEpicAccountId();
-		AccountIdToStringMap.Remove(AccountId);
+		AccountIdToNetIdMap.Remove(AccountId);
 		AccountIdToUserNumMap.Remove(AccountId);
-		NetIdStringToOnlineUserMap.Remove(NetId);
-		StringToUserAccountMap.Remove(NetId);
+		NetIdToOnlineUserMap.Remove(NetId);
+		NetIdToUserAccountMap.Remove(NetId);
 		UserNumToNetIdMap.Remove(LocalUserNum);
 		UserNumToAccountIdMap.Remove(LocalUserNum);
 		EOS_ProductUserId UserId = UserNumToProductUserIdMap[LocalUserNum];
 		ProductUserIdToUserNumMap.Remove(UserId);
-		ProductUserIdToStringMap.Remove(UserId);
+		ProductUserIdToNetIdMap.Remove(UserId);
 		UserNumToProductUserIdMap.Remove(LocalUserNum);
 	}
 	// Reset this for the next user login
@@ -2780,13 +2856,14 @@ void FUserManagerEOS::FriendStatusChanged(const EOS_Friends_OnFriendsUpdateInfo*
 		int32 LocalUserNum = AccountIdToUserNumMap[Data->LocalUserId];
 		FUniqueNetIdEOSPtr LocalEOSID = UserNumToNetIdMap[LocalUserNum];
 		// If we don't know them yet, then add them to kick off the reads
-		if (!AccountIdToStringMap.Contains(Data->TargetUserId))
+		if (!AccountIdToNetIdMap.Contains(Data->TargetUserId))
 		{
 			AddFriend(LocalUserNum, Data->TargetUserId);
 		}
 		// They are in our list now
 		FOnlineUserPtr OnlineUser = EpicAccountIdToOnlineUserMap[Data->TargetUserId];
-		FOnlineFriendEOSPtr Friend = LocalUserNumToFriendsListMap[LocalUserNum]->GetByNetIdString(AccountIdToStringMap[Data->TargetUserId]);
+		const FUniqueNetIdEOSRef TargetNetId = AccountIdToNetIdMap[Data->TargetUserId];
+		FOnlineFriendEOSPtr Friend = LocalUserNumToFriendsListMap[LocalUserNum]->GetByNetId(*TargetNetId);
 		// Figure out which notification to fire
 		if (Data->CurrentStatus == EOS_EFriendsStatus::EOS_FS_Friends)
 		{
@@ -2795,7 +2872,7 @@ void FUserManagerEOS::FriendStatusChanged(const EOS_Friends_OnFriendsUpdateInfo*
 		}
 		else if (Data->PreviousStatus == EOS_EFriendsStatus::EOS_FS_Friends && Data->CurrentStatus == EOS_EFriendsStatus::EOS_FS_NotFriends)
 		{
-			LocalUserNumToFriendsListMap[LocalUserNum]->Remove(AccountIdToStringMap[Data->TargetUserId], Friend.ToSharedRef());
+			LocalUserNumToFriendsListMap[LocalUserNum]->Remove(*TargetNetId, Friend.ToSharedRef());
 			Friend->SetInviteStatus(EInviteStatus::Unknown);
 			TriggerOnFriendRemovedDelegates(*LocalEOSID, *OnlineUser->GetUserId());
 		}
@@ -2805,7 +2882,7 @@ void FUserManagerEOS::FriendStatusChanged(const EOS_Friends_OnFriendsUpdateInfo*
 			{
 				return; // Early return to avoid crash
 			}
-			if (!AccountIdToStringMap.Contains(Data->TargetUserId))
+			if (!AccountIdToNetIdMap.Contains(Data->TargetUserId))
 			{
 				return;
 			}
@@ -2814,7 +2891,7 @@ void FUserManagerEOS::FriendStatusChanged(const EOS_Friends_OnFriendsUpdateInfo*
 				UE_LOG(LogTemp, Error, TEXT("Invalid LocalUserNum or FriendsListMap entry for LocalUserNum: %d"), LocalUserNum);
 				return;
 			}
-			LocalUserNumToFriendsListMap[LocalUserNum]->Remove(AccountIdToStringMap[Data->TargetUserId], Friend.ToSharedRef());
+			LocalUserNumToFriendsListMap[LocalUserNum]->Remove(*TargetNetId, Friend.ToSharedRef());
 			Friend->SetInviteStatus(EInviteStatus::Unknown);
 			TriggerOnInviteRejectedDelegates(*LocalEOSID, *OnlineUser->GetUserId());
 		}
@@ -2830,9 +2907,8 @@ void FUserManagerEOS::FriendStatusChanged(const EOS_Friends_OnFriendsUpdateInfo*
 void FUserManagerEOS::AddFriend(int32 LocalUserNum, EOS_EpicAccountId EpicAccountId)
 {
 	FUniqueNetIdEOSRef FriendNetId = FUniqueNetIdEOSRegistry::FindOrAdd(EpicAccountId, nullptr).ToSharedRef();
-	const FString NetId = FriendNetId->ToString();
 	FOnlineFriendEOSRef FriendRef = MakeShareable(new FOnlineFriendEOS(FriendNetId));
-	LocalUserNumToFriendsListMap[LocalUserNum]->Add(NetId, FriendRef);
+	LocalUserNumToFriendsListMap[LocalUserNum]->Add(*FriendNetId, FriendRef);
 
 	EOS_Friends_GetStatusOptions Options = { };
 	Options.ApiVersion = EOS_FRIENDS_GETSTATUS_API_LATEST;
@@ -2843,7 +2919,7 @@ void FUserManagerEOS::AddFriend(int32 LocalUserNum, EOS_EpicAccountId EpicAccoun
 	FriendRef->SetInviteStatus(ToEInviteStatus(Status));
 
 	// Add this friend as a remote player (this will grab user info)
-	AddRemotePlayer(LocalUserNum, NetId, EpicAccountId, FriendNetId, FriendRef, FriendRef);
+	AddRemotePlayer(LocalUserNum, FriendNetId, EpicAccountId, FriendRef, FriendRef);
 
 	// Querying the presence of a non-friend would cause an SDK error.
 	// Players that sent/recieved a friend invitation from us still count as "friends", so check
@@ -2854,22 +2930,21 @@ void FUserManagerEOS::AddFriend(int32 LocalUserNum, EOS_EpicAccountId EpicAccoun
 	}
 }
 
-void FUserManagerEOS::AddRemotePlayer(int32 LocalUserNum, const FString& NetId, EOS_EpicAccountId EpicAccountId)
+void FUserManagerEOS::AddRemotePlayer(int32 LocalUserNum, const FUniqueNetIdEOSRef& NetId, EOS_EpicAccountId EpicAccountId)
 {
-	FUniqueNetIdEOSRef EOSID = FUniqueNetIdEOSRegistry::FindOrAdd(NetId).ToSharedRef();
-	FOnlineUserEOSRef UserRef = MakeShareable(new FOnlineUserEOS(EOSID));
+	FOnlineUserEOSRef UserRef = MakeShareable(new FOnlineUserEOS(NetId));
 	// Add this user as a remote (this will grab presence & user info)
-	AddRemotePlayer(LocalUserNum, NetId, EpicAccountId, EOSID, UserRef, UserRef);
+	AddRemotePlayer(LocalUserNum, NetId, EpicAccountId, UserRef, UserRef);
 }
 
-void FUserManagerEOS::AddRemotePlayer(int32 LocalUserNum, const FString& NetId, EOS_EpicAccountId EpicAccountId, FUniqueNetIdEOSPtr UniqueNetId, FOnlineUserPtr OnlineUser, IAttributeAccessInterfaceRef AttributeRef)
+void FUserManagerEOS::AddRemotePlayer(int32 LocalUserNum, const FUniqueNetIdEOSRef& NetId, EOS_EpicAccountId EpicAccountId, FOnlineUserPtr OnlineUser, IAttributeAccessInterfaceRef AttributeRef)
 {
-	NetIdStringToOnlineUserMap.Emplace(NetId, OnlineUser);
+	NetIdToOnlineUserMap.Emplace(&NetId.Get(), OnlineUser);
 	EpicAccountIdToOnlineUserMap.Emplace(EpicAccountId, OnlineUser);
-	NetIdStringToAttributeAccessMap.Emplace(NetId, AttributeRef);
+	NetIdToAttributeAccessMap.Emplace(&NetId.Get(), AttributeRef);
 	EpicAccountIdToAttributeAccessMap.Emplace(EpicAccountId, AttributeRef);
 
-	AccountIdToStringMap.Emplace(EpicAccountId, NetId);
+	AccountIdToNetIdMap.Emplace(EpicAccountId, NetId);
 
 	// Read the user info for this player
 	ReadUserInfo(LocalUserNum, EpicAccountId);
@@ -2877,47 +2952,12 @@ void FUserManagerEOS::AddRemotePlayer(int32 LocalUserNum, const FString& NetId,
 
 void FUserManagerEOS::UpdateRemotePlayerProductUserId(EOS_EpicAccountId EpicAccountId, EOS_ProductUserId ProductUserId)
 {
-	// See if the net ids have changed for this user and bail if they are the same
-	const FString PrevNetIdStr = AccountIdToStringMap[EpicAccountId];
-	// Note that calling FindOrAdd with previously invalid EAS/EOS components will update the net id in place.
-	const FString NewNetIdStr = FUniqueNetIdEOSRegistry::FindOrAdd(EpicAccountId, ProductUserId)->ToString();
-	if (PrevNetIdStr == NewNetIdStr)
+	// Calling FindOrAdd with a previously invalid EAS/EOS component updates the net id in place. Every map is keyed by
+	// the interned id and its hash does not change, so only the product user id lookup needs adding.
+	const FUniqueNetIdEOSPtr NetId = FUniqueNetIdEOSRegistry::FindOrAdd(EpicAccountId, ProductUserId);
+	if (NetId.IsValid())
 	{
-		// No change, so skip any work
-		return;
-	}
-
-	const FString ProductUserIdStr = EIK_LexToString(ProductUserId);
-
-	// Get the unique net id and rebuild the string for it
-	IAttributeAccessInterfaceRef AttrAccess = NetIdStringToAttributeAccessMap[PrevNetIdStr];
-	FUniqueNetIdEOSPtr NetIdEOS = AttrAccess->GetUniqueNetIdEOS();
-	// Update any old friends entries with the new net id key
-	for (TMap<int32, FFriendsListEOSRef>::TConstIterator It(LocalUserNumToFriendsListMap); It; ++It)
-	{
-		FFriendsListEOSRef FriendsList = It.Value();
-		FOnlineFriendEOSPtr FoundFriend = FriendsList->GetByNetIdString(PrevNetIdStr);
-		if (FoundFriend.IsValid())
-		{
-			FriendsList->UpdateNetIdStr(PrevNetIdStr, NewNetIdStr);
-		}
-	}
-	// Update all of the other net id to X mappings
-	AccountIdToStringMap.Remove(EpicAccountId);
-	AccountIdToStringMap.Emplace(EpicAccountId, NewNetIdStr);
-	ProductUserIdToStringMap.Remove(ProductUserId);
-	ProductUserIdToStringMap.Emplace(ProductUserId, *NewNetIdStr);
-	FOnlineUserPtr OnlineUser = NetIdStringToOnlineUserMap[PrevNetIdStr];
-	NetIdStringToOnlineUserMap.Remove(PrevNetIdStr);
-	NetIdStringToOnlineUserMap.Emplace(NewNetIdStr, OnlineUser);
-	NetIdStringToAttributeAccessMap.Remove(PrevNetIdStr);
-	NetIdStringToAttributeAccessMap.Emplace(NewNetIdStr, AttrAccess);
-	// Presence may not be available for all online users
-	if (NetIdStringToOnlineUserPresenceMap.Contains(PrevNetIdStr))
-	{
-		FOnlineUserPresenceRef UserPresence = NetIdStringToOnlineUserPresenceMap[PrevNetIdStr];
-		NetIdStringToOnlineUserPresenceMap.Remove(PrevNetIdStr);
-		NetIdStringToOnlineUserPresenceMap.Emplace(NewNetIdStr, UserPresence);
+		ProductUserIdToNetIdMap.Emplace(ProductUserId, NetId.ToSharedRef());
 	}
 }
 
@@ -2975,8 +3015,6 @@ bool FUserManagerEOS::ReadFriendsList(int32 LocalUserNum, const FString& ListNam
 
 			LocalUserNumToFriendsListMap[LocalUserNum]->Empty(FriendCount);
 
-			TArray<FString> FriendEasIds;
-			FriendEasIds.Reserve(FriendCount);
 			// Process each friend returned
 			for (int32 Index = 0; Index < FriendCount; Index++)
 			{
@@ -2988,29 +3026,29 @@ bool FUserManagerEOS::ReadFriendsList(int32 LocalUserNum, const FString& ListNam
 				if (FriendEpicAccountId != nullptr)
 				{
 					AddFriend(LocalUserNum, FriendEpicAccountId);
-					FriendEasIds.Add(EIK_LexToString(FriendEpicAccountId));
-				}
-			}
 
-			const TFunction<FOnQueryExternalIdMappingsComplete::TFuncType>& OnExternalIdMappingsQueriedLambda =
-#if ENGINE_MAJOR_VERSION == 5
-				[this, WeakThis = AsWeak(), LocalUserNum](bool bWasSuccessful, const FUniqueNetId& UserId, const FExternalIdQueryOptions& QueryOptions, const TArray<FString>& ExternalIds, const FString& Error)
-{
-if (FUserManagerEOSPtr StrongThis = WeakThis.Pin())
+					// Friends whose product user id isn't known yet are looked up in the same batches as any other caller's
+					const bool bQueued = RequestExternalIdMapping(LocalUserNum, FriendEpicAccountId, [this, LocalUserNum, FriendEpicAccountId](bool bWasSuccessful, const FString& ErrorStr)
+					{
+						if (TArray<EOS_EpicAccountId>* OngoingQueries = IsPlayerQueryExternalMappingsOngoingForLocalUserMap.Find(LocalUserNum))
+						{
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 5
+							OngoingQueries->RemoveSwap(FriendEpicAccountId, EAllowShrinking::No);
 #else
-				[this, LocalUserNum](bool bWasSuccessful, const FUniqueNetId& UserId, const FExternalIdQueryOptions& QueryOptions, const TArray<FString>& ExternalIds, const FString& Error)
-			{
-				if (FUserManagerEOSPtr StrongThis = AsShared())
+							OngoingQueries->RemoveSwap(FriendEpicAccountId, false);
 #endif
-				{
-					ProcessReadFriendsListComplete(LocalUserNum, bWasSuccessful, Error);
+						}
+						ProcessReadFriendsListComplete(LocalUserNum, bWasSuccessful, ErrorStr);
+					});
+					if (bQueued)
+					{
+						IsPlayerQueryExternalMappingsOngoingForLocalUserMap.FindOrAdd(LocalUserNum).Add(FriendEpicAccountId);
+					}
 				}
-			};
-
-			const auto& ExternalMappingsCallback = OSSInternalCallback::Create<FOnQueryExternalIdMappingsComplete>(EOSSubsystem->UserManager, OnExternalIdMappingsQueriedLambda);
-
-			QueryExternalIdMappings(*GetLocalUniqueNetIdEOS(DefaultLocalUser), FExternalIdQueryOptions(), FriendEasIds, ExternalMappingsCallback);
+			}
 
+			// Completes right away if every friend's info and mapping was already cached
+			ProcessReadFriendsListComplete(LocalUserNum, true, TEXT(""));
 		}
 		else
 		{
@@ -3109,15 +3147,15 @@ bool FUserManagerEOS::SendInvite(int32 LocalUserNum, const FUniqueNetId& FriendI
 	{
 		if (Data->ResultCode == EOS_EResult::EOS_Success)
 		{
-			const FString& NetId = AccountIdToStringMap[Data->TargetUserId];
+			const FUniqueNetIdEOSRef NetId = AccountIdToNetIdMap[Data->TargetUserId];
 
 			FString ErrorString;
 			bool bWasSuccessful = Data->ResultCode == EOS_EResult::EOS_Success;
 			if (!bWasSuccessful)
 			{
-				ErrorString = FString::Printf(TEXT("Failed to send invite for user (%d) to player (%s) with result code (%s)"), LocalUserNum, *NetId, ANSI_TO_TCHAR(EOS_EResult_ToString(Data->ResultCode)));
+				ErrorString = FString::Printf(TEXT("Failed to send invite for user (%d) to player (%s) with result code (%s)"), LocalUserNum, *NetId->ToString(), ANSI_TO_TCHAR(EOS_EResult_ToString(Data->ResultCode)));
 			}
-			Delegate.ExecuteIfBound(LocalUserNum, bWasSuccessful, *FUniqueNetIdEOSRegistry::FindOrAdd(NetId), ListName, ErrorString);
+			Delegate.ExecuteIfBound(LocalUserNum, bWasSuccessful, *NetId, ListName, ErrorString);
 		}
 	};
 
@@ -3159,15 +3197,15 @@ bool FUserManagerEOS::AcceptInvite(int32 LocalUserNum, const FUniqueNetId& Frien
 #endif
 	CallbackObj->CallbackLambda = [LocalUserNum, ListName, this, Delegate](const EOS_Friends_AcceptInviteCallbackInfo* Data)
 	{
-		const FString& NetId = AccountIdToStringMap[Data->TargetUserId];
+		const FUniqueNetIdEOSRef NetId = AccountIdToNetIdMap[Data->TargetUserId];
 
 		FString ErrorString;
 		bool bWasSuccessful = Data->ResultCode == EOS_EResult::EOS_Success;
 		if (!bWasSuccessful)
 		{
-			ErrorString = FString::Printf(TEXT("Failed to accept invite for user (%d) from friend (%s) with result code (%s)"), LocalUserNum, *NetId, ANSI_TO_TCHAR(EOS_EResult_ToString(Data->ResultCode)));
+			ErrorString = FString::Printf(TEXT("Failed to accept invite for user (%d) from friend (%s) with result code (%s)"), LocalUserNum, *NetId->ToString(), ANSI_TO_TCHAR(EOS_EResult_ToString(Data->ResultCode)));
 		}
-		Delegate.ExecuteIfBound(LocalUserNum, bWasSuccessful, *FUniqueNetIdEOSRegistry::FindOrAdd(NetId), ListName, ErrorString);
+		Delegate.ExecuteIfBound(LocalUserNum, bWasSuccessful, *NetId, ListName, ErrorString);
 	};
 
 	EOS_Friends_AcceptInviteOptions Options = { };
@@ -3288,7 +3326,7 @@ TSharedPtr<FOnlineFriend> FUserManagerEOS::GetFriend(int32 LocalUserNum, const F
 	{
 		FFriendsListEOSRef FriendsList = LocalUserNumToFriendsListMap[LocalUserNum];
 		const FUniqueNetIdEOS& EosId = FUniqueNetIdEOS::Cast(FriendId);
-		FOnlineFriendEOSPtr FoundFriend = FriendsList->GetByNetIdString(EosId.ToString());
+		FOnlineFriendEOSPtr FoundFriend = FriendsList->GetByNetId(EosId);
 		if (FoundFriend.IsValid())
 		{
 			const FOnlineUserPresence& Presence = FoundFriend->GetPresence();
@@ -3608,9 +3646,9 @@ void FUserManagerEOS::SetPresence(const FUniqueNetId& UserId, const FOnlineUserP
 #endif
 	CallbackObj->CallbackLambda = [this, Delegate](const EOS_Presence_SetPresenceCallbackInfo* Data)
 	{
-		if (Data->ResultCode == EOS_EResult::EOS_Success && AccountIdToStringMap.Contains(Data->LocalUserId))
+		if (Data->ResultCode == EOS_EResult::EOS_Success && AccountIdToNetIdMap.Contains(Data->LocalUserId))
 		{
-			FUniqueNetIdEOSRef EOSID = FUniqueNetIdEOSRegistry::FindOrAdd(AccountIdToStringMap[Data->LocalUserId]).ToSharedRef();
+			FUniqueNetIdEOSRef EOSID = AccountIdToNetIdMap[Data->LocalUserId];
 			Delegate.ExecuteIfBound(*EOSID, true);
 			return;
 		}
@@ -3702,15 +3740,16 @@ void FUserManagerEOS::UpdatePresence(EOS_EpicAccountId AccountId)
 	EOS_EResult CopyResult = EOS_Presence_CopyPresence(EOSSubsystem->PresenceHandle, &Options, &PresenceInfo);
 	if (CopyResult == EOS_EResult::EOS_Success)
 	{
-		const FString& NetId = AccountIdToStringMap[AccountId];
+		const FUniqueNetIdEOSRef NetId = AccountIdToNetIdMap[AccountId];
 		// Create it on demand if we don't have one yet
-		if (!NetIdStringToOnlineUserPresenceMap.Contains(NetId))
+		FOnlineUserPresenceRef* FoundPresence = NetIdToOnlineUserPresenceMap.Find(&NetId.Get());
+		if (!FoundPresence)
 		{
-			FOnlineUserPresenceRef PresenceRef = MakeShareable(new FOnlineUserPresence());
-			NetIdStringToOnlineUserPresenceMap.Emplace(NetId, PresenceRef);
+			FOnlineUserPresenceRef NewPresenceRef = MakeShareable(new FOnlineUserPresence());
+			FoundPresence = &NetIdToOnlineUserPresenceMap.Emplace(&NetId.Get(), NewPresenceRef);
 		}
 
-		FOnlineUserPresenceRef PresenceRef = NetIdStringToOnlineUserPresenceMap[NetId];
+		FOnlineUserPresenceRef PresenceRef = *FoundPresence;
 		const FString ProductId(UTF8_TO_TCHAR(PresenceInfo->ProductId));
 		const FString ProdVersion(UTF8_TO_TCHAR(PresenceInfo->ProductVersion));
 		const FString Platform(UTF8_TO_TCHAR(PresenceInfo->Platform));
@@ -3732,7 +3771,7 @@ void FUserManagerEOS::UpdatePresence(EOS_EpicAccountId AccountId)
 		}
 
 		// Copy the presence if this is a friend that was updated, so that their data is in sync
-		UpdateFriendPresence(NetId, PresenceRef);
+		UpdateFriendPresence(*NetId, PresenceRef);
 
 		EOS_Presence_Info_Release(PresenceInfo);
 	}
@@ -3742,12 +3781,12 @@ void FUserManagerEOS::UpdatePresence(EOS_EpicAccountId AccountId)
 	}
 }
 
-void FUserManagerEOS::UpdateFriendPresence(const FString& FriendId, FOnlineUserPresenceRef Presence)
+void FUserManagerEOS::UpdateFriendPresence(const FUniqueNetIdEOS& FriendId, FOnlineUserPresenceRef Presence)
 {
 	for (TMap<int32, FFriendsListEOSRef>::TConstIterator It(LocalUserNumToFriendsListMap); It; ++It)
 	{
 		FFriendsListEOSRef FriendsList = It.Value();
-		FOnlineFriendEOSPtr Friend = FriendsList->GetByNetIdString(FriendId);
+		FOnlineFriendEOSPtr Friend = FriendsList->GetByNetId(FriendId);
 		if (Friend.IsValid())
 		{
 			Friend->SetPresence(Presence);
@@ -3758,9 +3797,9 @@ void FUserManagerEOS::UpdateFriendPresence(const FString& FriendId, FOnlineUserP
 EOnlineCachedResult::Type FUserManagerEOS::GetCachedPresence(const FUniqueNetId& UserId, TSharedPtr<FOnlineUserPresence>& OutPresence)
 {
 	const FUniqueNetIdEOS& EOSID = FUniqueNetIdEOS::Cast(UserId);
-	if (NetIdStringToOnlineUserPresenceMap.Contains(EOSID.ToString()))
+	if (const FOnlineUserPresenceRef* FoundPresence = NetIdToOnlineUserPresenceMap.Find(&EOSID))
 	{
-		OutPresence = NetIdStringToOnlineUserPresenceMap[EOSID.ToString()];
+		OutPresence = *FoundPresence;
 		return EOnlineCachedResult::Success;
 	}
 	return EOnlineCachedResult::NotFound;
@@ -3773,15 +3812,12 @@ EOnlineCachedResult::Type FUserManagerEOS::GetCachedPresenceForApp(const FUnique
 
 bool FUserManagerEOS::QueryUserInfo(int32 LocalUserNum, const TArray<FUniqueNetIdRef>& UserIds)
 {
-	TArray<FString> UserEasIdsNeedingExternalMappings;
-	UserEasIdsNeedingExternalMappings.Reserve(UserIds.Num());
-	
 	// Trigger a query for each user in the list
 	for (const FUniqueNetIdRef& NetId : UserIds)
 	{
 		const FUniqueNetIdEOS& EOSID = FUniqueNetIdEOS::Cast(*NetId);
 		// Skip querying for local users since we already have that data
-		if (StringToUserAccountMap.Contains(EOSID.ToString()))
+		if (NetIdToUserAccountMap.Contains(&EOSID))
 		{
 			continue;
 		}
@@ -3796,17 +3832,14 @@ bool FUserManagerEOS::QueryUserInfo(int32 LocalUserNum, const TArray<FUniqueNetI
 			}
 			else
 			{
-				// If the user is not registered, we'll add it and query their user info
-				UserEasIdsNeedingExternalMappings.Add(EIK_LexToString(AccountId));
-
 				// Registering the player will also query the user info data
-				AddRemotePlayer(LocalUserNum, EOSID.ToString(), AccountId);
+				AddRemotePlayer(LocalUserNum, FUniqueNetIdEOSRegistry::FindOrAdd(AccountId, EOSID.GetProductUserId()).ToSharedRef(), AccountId);
+
+				// If the user is not registered, we'll also look up their product user id
+				RequestExternalIdMapping(LocalUserNum, AccountId, nullptr);
 			}
 		}
 	}
-
-	const FUniqueNetIdEOSPtr LocalId = GetLocalUniqueNetIdEOS(LocalUserNum);
-	QueryExternalIdMappings(*LocalId, FExternalIdQueryOptions(), UserEasIdsNeedingExternalMappings, IgnoredMappingDelegate);
 	
 	return true;
 }
@@ -3818,43 +3851,156 @@ typedef TEOSCallback<EOS_UserInfo_OnQueryUserInfoCallback, EOS_UserInfo_QueryUse
 #endif
 void FUserManagerEOS::ReadUserInfo(int32 LocalUserNum, EOS_EpicAccountId EpicAccountId)
 {
-#if ENGINE_MAJOR_VERSION == 5
-	FReadUserInfoCallback* CallbackObj = new FReadUserInfoCallback(AsWeak());
+	const bool bQueued = RequestUserInfo(EpicAccountId, [this, LocalUserNum, EpicAccountId](bool bWasSuccessful, const FString& ErrorStr)
+	{
+		// We mark this player as processed
+		if (TArray<EOS_EpicAccountId>* OngoingQueries = IsFriendQueryUserInfoOngoingForLocalUserMap.Find(LocalUserNum))
+		{
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 5
+			OngoingQueries->RemoveSwap(EpicAccountId, EAllowShrinking::No);
 #else
-	FReadUserInfoCallback* CallbackObj = new FReadUserInfoCallback();
+			OngoingQueries->RemoveSwap(EpicAccountId, false);
 #endif
-	CallbackObj->CallbackLambda = [this, LocalUserNum, EpicAccountId](const EOS_UserInfo_QueryUserInfoCallbackInfo* Data)
+		}
+		ProcessReadFriendsListComplete(LocalUserNum, true, TEXT(""));
+	});
+
+	if (bQueued)
 	{
-		if (Data->ResultCode == EOS_EResult::EOS_Success)
+		// We mark this player as pending for processing
+		IsFriendQueryUserInfoOngoingForLocalUserMap.FindOrAdd(LocalUserNum).Add(EpicAccountId);
+	}
+}
+
+bool FUserManagerEOS::RequestUserInfo(EOS_EpicAccountId AccountId, FUserLookupCompleteCallback&& OnComplete)
+{
+	FPendingUserLookup* Lookup = PendingUserInfoLookups.Find(AccountId);
+	if (Lookup == nullptr)
+	{
+		// Info queried recently is still in the SDK's cache, so copy it over without going back to the backend
+		const double* LookupTime = UserInfoLookupTimes.Find(AccountId);
+		if (LookupTime != nullptr && FPlatformTime::Seconds() - *LookupTime < UserLookupCacheSeconds)
 		{
-			IAttributeAccessInterfaceRef AttributeAccessRef = EpicAccountIdToAttributeAccessMap[Data->TargetUserId];
-			UpdateUserInfo(AttributeAccessRef, Data->LocalUserId, Data->TargetUserId);
+			if (const IAttributeAccessInterfaceRef* AttributeAccessRef = EpicAccountIdToAttributeAccessMap.Find(AccountId))
+			{
+				UpdateUserInfo(*AttributeAccessRef, UserNumToAccountIdMap.FindRef(DefaultLocalUser), AccountId);
+			}
+			return false;
 		}
 
-		// We mark this player as processed
-#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 5
-		IsFriendQueryUserInfoOngoingForLocalUserMap[LocalUserNum].RemoveSwap(EpicAccountId, EAllowShrinking::No);
+		Lookup = &PendingUserInfoLookups.Add(AccountId);
+		QueuedUserInfoLookups.Add(AccountId);
+		ScheduleUserLookupFlush();
+	}
+
+	if (OnComplete)
+	{
+		Lookup->Callbacks.Add(MoveTemp(OnComplete));
+	}
+	return true;
+}
+
+void FUserManagerEOS::FlushUserInfoLookups()
+{
+	const EOS_EpicAccountId LocalUserId = UserNumToAccountIdMap.FindRef(DefaultLocalUser);
+
+	int32 NumSent = 0;
+	for (; NumSent < QueuedUserInfoLookups.Num() && NumUserInfoLookupsInFlight < MaxUserInfoLookupsInFlight; NumSent++)
+	{
+		const EOS_EpicAccountId AccountId = QueuedUserInfoLookups[NumSent];
+		PendingUserInfoLookups.FindChecked(AccountId).bInFlight = true;
+		NumUserInfoLookupsInFlight++;
+
+#if ENGINE_MAJOR_VERSION == 5
+		FReadUserInfoCallback* CallbackObj = new FReadUserInfoCallback(AsWeak());
 #else
-		IsFriendQueryUserInfoOngoingForLocalUserMap[LocalUserNum].RemoveSwap(EpicAccountId, false);
+		FReadUserInfoCallback* CallbackObj = new FReadUserInfoCallback();
 #endif
-		ProcessReadFriendsListComplete(LocalUserNum, true, TEXT(""));
-	};
+		CallbackObj->CallbackLambda = [this, AccountId](const EOS_UserInfo_QueryUserInfoCallbackInfo* Data)
+		{
+			CompleteUserInfoLookup(AccountId, Data->LocalUserId, Data->ResultCode);
+		};
 
-	EOS_UserInfo_QueryUserInfoOptions Options = { };
-	Options.ApiVersion = EOS_USERINFO_QUERYUSERINFO_API_LATEST;
-	Options.LocalUserId = UserNumToAccountIdMap[DefaultLocalUser];
-	Options.TargetUserId = EpicAccountId;
-	EOS_UserInfo_QueryUserInfo(EOSSubsystem->UserInfoHandle, &Options, CallbackObj, CallbackObj->GetCallbackPtr());
+		EOS_UserInfo_QueryUserInfoOptions Options = { };
+		Options.ApiVersion = EOS_USERINFO_QUERYUSERINFO_API_LATEST;
+		Options.LocalUserId = LocalUserId;
+		Options.TargetUserId = AccountId;
+		EOS_UserInfo_QueryUserInfo(EOSSubsystem->UserInfoHandle, &Options, CallbackObj, CallbackObj->GetCallbackPtr());
+	}
+	QueuedUserInfoLookups.RemoveAt(0, NumSent);
+}
+
+void FUserManagerEOS::CompleteUserInfoLookup(EOS_EpicAccountId AccountId, EOS_EpicAccountId LocalUserId, EOS_EResult Result)
+{
+	NumUserInfoLookupsInFlight--;
+	if (QueuedUserInfoLookups.Num() > 0)
+	{
+		ScheduleUserLookupFlush();
+	}
 
-	// We mark this player as pending for processing
-	IsFriendQueryUserInfoOngoingForLocalUserMap.FindOrAdd(LocalUserNum).Add(EpicAccountId);
+	FPendingUserLookup Lookup;
+	if (!PendingUserInfoLookups.RemoveAndCopyValue(AccountId, Lookup))
+	{
+		return;
+	}
+
+	const bool bWasSuccessful = Result == EOS_EResult::EOS_Success;
+	FString ErrorStr;
+	if (bWasSuccessful)
+	{
+		UserInfoLookupTimes.Add(AccountId, FPlatformTime::Seconds());
+		if (const IAttributeAccessInterfaceRef* AttributeAccessRef = EpicAccountIdToAttributeAccessMap.Find(AccountId))
+		{
+			UpdateUserInfo(*AttributeAccessRef, LocalUserId, AccountId);
+		}
+	}
+	else
+	{
+		ErrorStr = FString::Printf(TEXT("EOS_UserInfo_QueryUserInfo() failed with EOS result code (%s)"), ANSI_TO_TCHAR(EOS_EResult_ToString(Result)));
+	}
+
+	for (const FUserLookupCompleteCallback& Callback : Lookup.Callbacks)
+	{
+		Callback(bWasSuccessful, ErrorStr);
+	}
+}
+
+namespace
+{
+	template<typename KeyType>
+	void PruneLookupTimes(TMap<KeyType, double>& LookupTimes, double ExpiredBefore)
+	{
+		for (auto It = LookupTimes.CreateIterator(); It; ++It)
+		{
+			if (It.Value() < ExpiredBefore)
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+}
+
+void FUserManagerEOS::PruneUserLookupTimes()
+{
+	const double ExpiredBefore = FPlatformTime::Seconds() - UserLookupCacheSeconds;
+	PruneLookupTimes(UserInfoLookupTimes, ExpiredBefore);
+	PruneLookupTimes(ExternalIdLookupTimes, ExpiredBefore);
+	PruneLookupTimes(ProductUserIdLookupTimes, ExpiredBefore);
+}
+
+void FUserManagerEOS::ScheduleUserLookupFlush() const
+{
+	if (UserLookupFlushTime == 0.0)
+	{
+		UserLookupFlushTime = FPlatformTime::Seconds() + UserLookupBatchWindowSeconds;
+	}
 }
 
 bool FUserManagerEOS::GetAllUserInfo(int32 LocalUserNum, TArray<TSharedRef<FOnlineUser>>& OutUsers)
 {
 	OutUsers.Reset();
 	// Get remote users
-	for (TMap<FString, FOnlineUserPtr>::TConstIterator It(NetIdStringToOnlineUserMap); It; ++It)
+	for (TUniqueNetIdEOSMap<FOnlineUserPtr>::TConstIterator It(NetIdToOnlineUserMap); It; ++It)
 	{
 		if (It.Value().IsValid())
 		{
@@ -3862,7 +4008,7 @@ bool FUserManagerEOS::GetAllUserInfo(int32 LocalUserNum, TArray<TSharedRef<FOnli
 		}
 	}
 	// Get local users
-	for (TMap<FString, FUserOnlineAccountEOSRef>::TConstIterator It(StringToUserAccountMap); It; ++It)
+	for (TUniqueNetIdEOSMap<FUserOnlineAccountEOSRef>::TConstIterator It(NetIdToUserAccountMap); It; ++It)
 	{
 		OutUsers.Add(It.Value());
 	}
@@ -3873,10 +4019,7 @@ TSharedPtr<FOnlineUser> FUserManagerEOS::GetUserInfo(int32 LocalUserNum, const F
 {
 	TSharedPtr<FOnlineUser> OnlineUser;
 	const FUniqueNetIdEOS& EOSID = FUniqueNetIdEOS::Cast(UserId);
-	if (NetIdStringToOnlineUserMap.Contains(EOSID.ToString()))
-	{
-		OnlineUser = NetIdStringToOnlineUserMap[EOSID.ToString()];
-	}
+	OnlineUser = NetIdToOnlineUserMap.FindRef(&EOSID);
 	return OnlineUser;
 }
 
@@ -3928,15 +4071,15 @@ bool FUserManagerEOS::QueryUserIdMapping(const FUniqueNetId& UserId, const FStri
 		bool bWasSuccessful = Result == EOS_EResult::EOS_Success;
 		if (bWasSuccessful)
 		{
-			const FString NetIdStr = EIK_LexToString(Data->TargetUserId);
+			const FUniqueNetIdEOSRef TargetNetId = FUniqueNetIdEOSRegistry::FindOrAdd(Data->TargetUserId, nullptr).ToSharedRef();
 			FUniqueNetIdEOSPtr LocalUserId = UserNumToNetIdMap[DefaultLocalUser];
 			if (!EpicAccountIdToOnlineUserMap.Contains(Data->TargetUserId))
 			{
 				// Registering the player will also query the presence/user info data
-				AddRemotePlayer(LocalUserNum, NetIdStr, Data->TargetUserId);
+				AddRemotePlayer(LocalUserNum, TargetNetId, Data->TargetUserId);
 			}
 
-			Delegate.ExecuteIfBound(true, *LocalUserId, DisplayNameOrEmail, *FUniqueNetIdEOSRegistry::FindOrAdd(NetIdStr), ErrorString);
+			Delegate.ExecuteIfBound(true, *LocalUserId, DisplayNameOrEmail, *TargetNetId, ErrorString);
 		}
 		else
 		{
@@ -4016,33 +4159,102 @@ bool FUserManagerEOS::QueryExternalIdMappings(const FUniqueNetId& UserId, const
 		return false;
 	}
 
-	int32 LocalUserNum = GetLocalUserNumFromUniqueNetId(UserId);
+	// The ids are merged into the shared lookup queue, the delegate fires once all of them have resolved
+	struct FQueryState
+	{
+		int32 NumRemaining = 1;
+		bool bWasSuccessful = true;
+		FString ErrorStr;
+	};
+	TSharedRef<FQueryState> State = MakeShared<FQueryState>();
+	const int32 LocalUserNum = GetLocalUserNumFromUniqueNetId(UserId);
+	TFunction<void(bool, const FString&)> OnLookupComplete = [State, UserIdRef = UserId.AsShared(), QueryOptions, ExternalIds, Delegate](bool bWasSuccessful, const FString& ErrorStr)
+	{
+		if (!bWasSuccessful)
+		{
+			State->bWasSuccessful = false;
+			State->ErrorStr = ErrorStr;
+		}
+		if (--State->NumRemaining == 0)
+		{
+			Delegate.ExecuteIfBound(State->bWasSuccessful, *UserIdRef, QueryOptions, ExternalIds, State->ErrorStr);
+		}
+	};
+
+	for (const FString& ExternalId : ExternalIds)
+	{
+		const EOS_EpicAccountId ExternalAccountId = EOS_EpicAccountId_FromString(TCHAR_TO_UTF8(*ExternalId));
+		if (EOS_EpicAccountId_IsValid(ExternalAccountId) == EOS_TRUE && RequestExternalIdMapping(LocalUserNum, ExternalAccountId, CopyTemp(OnLookupComplete)))
+		{
+			State->NumRemaining++;
+		}
+	}
+	OnLookupComplete(true, FString());
+
+	return true;
+}
+
+bool FUserManagerEOS::RequestExternalIdMapping(int32 LocalUserNum, EOS_EpicAccountId AccountId, FUserLookupCompleteCallback&& OnComplete)
+{
+	FPendingUserLookup* Lookup = PendingExternalIdLookups.Find(AccountId);
+	if (Lookup == nullptr)
+	{
+		// Skip accounts we already know the product user id of, or that were looked up recently without one
+		const FUniqueNetIdEOSRef* NetId = AccountIdToNetIdMap.Find(AccountId);
+		if (NetId != nullptr && EOS_ProductUserId_IsValid((*NetId)->GetProductUserId()) == EOS_TRUE)
+		{
+			return false;
+		}
+		const double* LookupTime = ExternalIdLookupTimes.Find(AccountId);
+		if (LookupTime != nullptr && FPlatformTime::Seconds() - *LookupTime < UserLookupCacheSeconds)
+		{
+			return false;
+		}
+
+		Lookup = &PendingExternalIdLookups.Add(AccountId);
+		QueuedExternalIdLookups.FindOrAdd(LocalUserNum).Add(AccountId);
+		ScheduleUserLookupFlush();
+	}
+
+	if (OnComplete)
+	{
+		Lookup->Callbacks.Add(MoveTemp(OnComplete));
+	}
+	return true;
+}
+
+void FUserManagerEOS::FlushExternalIdLookups()
+{
+	for (const TPair<int32, TArray<EOS_EpicAccountId>>& QueuedLookups : QueuedExternalIdLookups)
+	{
+		FlushExternalIdLookups(QueuedLookups.Key, QueuedLookups.Value);
+	}
+	QueuedExternalIdLookups.Reset();
+}
 
-	// Mark the queries as in progress
-	IsPlayerQueryExternalMappingsOngoingForLocalUserMap.FindOrAdd(LocalUserNum).Append(ExternalIds);
+void FUserManagerEOS::FlushExternalIdLookups(int32 LocalUserNum, const TArray<EOS_EpicAccountId>& AccountIds)
+{
+	const EOS_ProductUserId LocalUserId = GetLocalProductUserId(LocalUserNum);
 
-	const EOS_ProductUserId LocalUserId = EOSID.GetProductUserId();
-	const int32 NumBatches = (ExternalIds.Num() / EOS_CONNECT_QUERYEXTERNALACCOUNTMAPPINGS_MAX_ACCOUNT_IDS) + 1;
-	int32 QueryStart = 0;
 	// Process queries in batches since there's a max that can be done at once
-	for (int32 BatchCount = 0; BatchCount < NumBatches; BatchCount++)
+	for (int32 QueryStart = 0; QueryStart < AccountIds.Num(); QueryStart += EOS_CONNECT_QUERYEXTERNALACCOUNTMAPPINGS_MAX_ACCOUNT_IDS)
 	{
-		const uint32 AmountToProcess = FMath::Min(ExternalIds.Num() - QueryStart, EOS_CONNECT_QUERYEXTERNALACCOUNTMAPPINGS_MAX_ACCOUNT_IDS);
-		TArray<FString> BatchIds;
-		BatchIds.Empty(AmountToProcess);
+		const int32 AmountToProcess = FMath::Min(AccountIds.Num() - QueryStart, EOS_CONNECT_QUERYEXTERNALACCOUNTMAPPINGS_MAX_ACCOUNT_IDS);
+		TArray<EOS_EpicAccountId> BatchIds(AccountIds.GetData() + QueryStart, AmountToProcess);
 		FQueryByStringIdsOptions Options(AmountToProcess, LocalUserId);
 		// Build an options up per batch
-		for (uint32 ProcessedCount = 0; ProcessedCount < AmountToProcess; ProcessedCount++, QueryStart++)
+		for (int32 Index = 0; Index < AmountToProcess; Index++)
 		{
-			FCStringAnsi::Strncpy(Options.PointerArray[ProcessedCount], TCHAR_TO_UTF8(*ExternalIds[ProcessedCount]), EOS_CONNECT_EXTERNAL_ACCOUNT_ID_MAX_LENGTH+1);
-			BatchIds.Add(ExternalIds[ProcessedCount]);
+			int32_t BufferLen = EOS_CONNECT_EXTERNAL_ACCOUNT_ID_MAX_LENGTH + 1;
+			EOS_EpicAccountId_ToString(BatchIds[Index], Options.PointerArray[Index], &BufferLen);
+			PendingExternalIdLookups.FindChecked(BatchIds[Index]).bInFlight = true;
 		}
 #if ENGINE_MAJOR_VERSION == 5
 		FQueryByStringIdsCallback* CallbackObj = new FQueryByStringIdsCallback(AsWeak());
 #else
 		FQueryByStringIdsCallback* CallbackObj = new FQueryByStringIdsCallback();
 #endif
-		CallbackObj->CallbackLambda = [LocalUserNum, QueryOptions, BatchIds, this, Delegate](const EOS_Connect_QueryExternalAccountMappingsCallbackInfo* Data)
+		CallbackObj->CallbackLambda = [this, LocalUserNum, BatchIds = MoveTemp(BatchIds)](const EOS_Connect_QueryExternalAccountMappingsCallbackInfo* Data)
 		{
 			EOS_EResult Result = Data->ResultCode;
 			if (GetLoginStatus(LocalUserNum) != ELoginStatus::LoggedIn)
@@ -4051,49 +4263,44 @@ bool FUserManagerEOS::QueryExternalIdMappings(const FUniqueNetId& UserId, const
 				Result = EOS_EResult::EOS_InvalidUser;
 			}
 
+			const bool bWasSuccessful = Result == EOS_EResult::EOS_Success;
 			FString ErrorString;
-			FUniqueNetIdEOSPtr EOSID = FUniqueNetIdEOS::EmptyId();
-			if (Result == EOS_EResult::EOS_Success)
+			if (!bWasSuccessful)
 			{
-				EOSID = UserNumToNetIdMap[LocalUserNum];
+				ErrorString = FString::Printf(TEXT("EOS_Connect_QueryExternalAccountMappings() failed with result code (%s)"), ANSI_TO_TCHAR(EOS_EResult_ToString(Result)));
+			}
 
-				FGetAccountMappingOptions Options;
-				Options.LocalUserId = UserNumToProductUserIdMap[DefaultLocalUser];
-				// Get the product id for each epic account passed in
-				for (const FString& StringId : BatchIds)
+			const double Now = FPlatformTime::Seconds();
+			FGetAccountMappingOptions Options;
+			Options.LocalUserId = Data->LocalUserId;
+			for (const EOS_EpicAccountId AccountId : BatchIds)
+			{
+				if (bWasSuccessful)
 				{
-					FCStringAnsi::Strncpy(Options.AccountId, TCHAR_TO_UTF8(*StringId), EOS_CONNECT_EXTERNAL_ACCOUNT_ID_MAX_LENGTH + 1);
+					// Get the product id for each epic account passed in
+					int32_t BufferLen = sizeof(Options.AccountId);
+					EOS_EpicAccountId_ToString(AccountId, Options.AccountId, &BufferLen);
 					EOS_ProductUserId ProductUserId = EOS_Connect_GetExternalAccountMapping(EOSSubsystem->ConnectHandle, &Options);
 					if (EOS_ProductUserId_IsValid(ProductUserId) == EOS_TRUE)
 					{
-						EOS_EpicAccountId AccountId = EOS_EpicAccountId_FromString(Options.AccountId);
 						UpdateRemotePlayerProductUserId(AccountId, ProductUserId);
 					}
+					ExternalIdLookupTimes.Add(AccountId, Now);
 				}
-			}
-			else
-			{
-				ErrorString = FString::Printf(TEXT("EOS_Connect_QueryExternalAccountMappings() failed with result code (%s)"), ANSI_TO_TCHAR(EOS_EResult_ToString(Result)));
-			}
 
-			// Mark all queries as complete
-			TArray<FString>& OngoingQueries = IsPlayerQueryExternalMappingsOngoingForLocalUserMap[LocalUserNum];
-			for (const FString& StringId : BatchIds)
-			{
-#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 5
-				OngoingQueries.RemoveSwap(StringId, EAllowShrinking::No);
-#else
-				OngoingQueries.RemoveSwap(StringId, false);
-#endif
+				FPendingUserLookup Lookup;
+				if (PendingExternalIdLookups.RemoveAndCopyValue(AccountId, Lookup))
+				{
+					for (const FUserLookupCompleteCallback& Callback : Lookup.Callbacks)
+					{
+						Callback(bWasSuccessful, ErrorString);
+					}
+				}
 			}
-
-			const bool bWasSuccessful = Result == EOS_EResult::EOS_Success;
-			Delegate.ExecuteIfBound(bWasSuccessful, *EOSID, QueryOptions, BatchIds, ErrorString);
 		};
 
 		EOS_Connect_QueryExternalAccountMappings(EOSSubsystem->ConnectHandle, &Options, CallbackObj, CallbackObj->GetCallbackPtr());
 	}
-	return true;
 }
 
 void FUserManagerEOS::GetExternalIdMappings(const FExternalIdQueryOptions& QueryOptions, const TArray<FString>& ExternalIds, TArray<FUniqueNetIdPtr>& OutIds)
@@ -4109,10 +4316,9 @@ FUniqueNetIdPtr FUserManagerEOS::GetExternalIdMapping(const FExternalIdQueryOpti
 {
 	FUniqueNetIdPtr NetId;
 	EOS_EpicAccountId AccountId = EOS_EpicAccountId_FromString(TCHAR_TO_UTF8(*ExternalId));
-	if (EOS_EpicAccountId_IsValid(AccountId) == EOS_TRUE && AccountIdToStringMap.Contains(AccountId))
+	if (EOS_EpicAccountId_IsValid(AccountId) == EOS_TRUE && AccountIdToNetIdMap.Contains(AccountId))
 	{
-		const FString& NetIdStr = AccountIdToStringMap[AccountId];
-		NetId = NetIdStringToOnlineUserMap[NetIdStr]->GetUserId();
+		NetId = NetIdToOnlineUserMap[&AccountIdToNetIdMap[AccountId].Get()]->GetUserId();
 	}
 	return NetId;
 }
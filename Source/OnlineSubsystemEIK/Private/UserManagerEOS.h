@@ -116,8 +116,8 @@ class TOnlinePlayerList
 	FUniqueNetIdEOSRef OwningNetId;
 	/** The array of list class entries */
 	TArray<ListClass> ListEntries;
-	/** Indexed by string form of account id for fast look up */
-	TMap<FString, ListClass> NetIdStringToListEntryMap;
+	/** Indexed by the entry's net id for fast look up */
+	TUniqueNetIdEOSMap<ListClass> NetIdToListEntryMap;
 
 public:
 	TOnlinePlayerList(int32 InLocalUserNum, FUniqueNetIdEOSRef InOwningNetId)
@@ -131,33 +131,22 @@ public:
 		return ListEntries;
 	}
 
-	void Add(const FString& InNetId, ListClass InListEntry)
+	void Add(const FUniqueNetIdEOS& InNetId, ListClass InListEntry)
 	{
 		ListEntries.Add(InListEntry);
-		NetIdStringToListEntryMap.Add(InNetId, InListEntry);
+		NetIdToListEntryMap.Add(&InNetId, InListEntry);
 	}
 
-	void Remove(const FString& InNetId, ListClass InListEntry)
+	void Remove(const FUniqueNetIdEOS& InNetId, ListClass InListEntry)
 	{
-		const ListClass* Found = NetIdStringToListEntryMap.Find(InNetId);
-		if (Found != nullptr)
-		{
-			NetIdStringToListEntryMap.Remove(InNetId);
-		}
+		NetIdToListEntryMap.Remove(&InNetId);
 		ListEntries.Remove(InListEntry);
 	}
 
 	void Empty(int32 Slack = 0)
 	{
 		ListEntries.Empty(Slack);
-		NetIdStringToListEntryMap.Empty(Slack);
-	}
-
-	void UpdateNetIdStr(const FString& PrevNetId, const FString& NewNetId)
-	{
-		ListClass ListEntry = NetIdStringToListEntryMap[PrevNetId];
-		NetIdStringToListEntryMap.Remove(PrevNetId);
-		NetIdStringToListEntryMap.Add(NewNetId, ListEntry);
+		NetIdToListEntryMap.Empty(Slack);
 	}
 
 	ListClassReturnType GetByIndex(int32 Index)
@@ -169,9 +158,9 @@ public:
 		return ListClassReturnType();
 	}
 
-	ListClassReturnType GetByNetIdString(const FString& NetId)
+	ListClassReturnType GetByNetId(const FUniqueNetIdEOS& NetId)
 	{
-		const ListClass* Found = NetIdStringToListEntryMap.Find(NetId);
+		const ListClass* Found = NetIdToListEntryMap.Find(&NetId);
 		if (Found != nullptr)
 		{
 			return *Found;
@@ -430,17 +419,33 @@ private:
 	void AddLocalUser(int32 LocalUserNum, EOS_EpicAccountId EpicAccountId, EOS_ProductUserId UserId);
 
 	void AddFriend(int32 LocalUserNum, EOS_EpicAccountId EpicAccountId);
-	void AddRemotePlayer(int32 LocalUserNum, const FString& NetId, EOS_EpicAccountId EpicAccountId);
-	void AddRemotePlayer(int32 LocalUserNum, const FString& NetId, EOS_EpicAccountId EpicAccountId, FUniqueNetIdEOSPtr UniqueNetId, FOnlineUserPtr OnlineUser, IAttributeAccessInterfaceRef AttributeRef);
+	void AddRemotePlayer(int32 LocalUserNum, const FUniqueNetIdEOSRef& NetId, EOS_EpicAccountId EpicAccountId);
+	void AddRemotePlayer(int32 LocalUserNum, const FUniqueNetIdEOSRef& NetId, EOS_EpicAccountId EpicAccountId, FOnlineUserPtr OnlineUser, IAttributeAccessInterfaceRef AttributeRef);
 	void UpdateRemotePlayerProductUserId(EOS_EpicAccountId AccountId, EOS_ProductUserId UserId);
 	void ReadUserInfo(int32 LocalUserNum, EOS_EpicAccountId EpicAccountId);
 
+	// Batched user lookups. User info, external account and product user id queries are queued, deduplicated against
+	// lookups in flight or resolved recently, and flushed from Tick in the largest batches each SDK call allows
+	typedef TFunction<void(bool bWasSuccessful, const FString& ErrorStr)> FUserLookupCompleteCallback;
+	/** Returns false if nothing was queued because the SDK's cached data could be used right away */
+	bool RequestUserInfo(EOS_EpicAccountId AccountId, FUserLookupCompleteCallback&& OnComplete);
+	bool RequestExternalIdMapping(int32 LocalUserNum, EOS_EpicAccountId AccountId, FUserLookupCompleteCallback&& OnComplete);
+	bool RequestProductUserIdMapping(EOS_ProductUserId ProductUserId, FUserLookupCompleteCallback&& OnComplete) const;
+	void ScheduleUserLookupFlush() const;
+	void FlushUserInfoLookups();
+	void FlushExternalIdLookups();
+	void FlushExternalIdLookups(int32 LocalUserNum, const TArray<EOS_EpicAccountId>& AccountIds);
+	void FlushProductUserIdLookups() const;
+	/** Drops lookup times older than UserLookupCacheSeconds, they no longer skip a lookup */
+	void PruneUserLookupTimes();
+	void CompleteUserInfoLookup(EOS_EpicAccountId AccountId, EOS_EpicAccountId LocalUserId, EOS_EResult Result);
+
 	void UpdateUserInfo(IAttributeAccessInterfaceRef AttriubteAccessRef, EOS_EpicAccountId LocalId, EOS_EpicAccountId TargetId);
 	bool IsFriendQueryUserInfoOngoing(int32 LocalUserNum);
 	void ProcessReadFriendsListComplete(int32 LocalUserNum, bool bWasSuccessful, const FString& ErrorStr);
 
 	void UpdatePresence(EOS_EpicAccountId AccountId);
-	void UpdateFriendPresence(const FString& FriendId, FOnlineUserPresenceRef Presence);
+	void UpdateFriendPresence(const FUniqueNetIdEOS& FriendId, FOnlineUserPresenceRef Presence);
 
 	IOnlineSubsystem* GetPlatformOSS() const;
 	FString GetPlatformDisplayName(int32 LocalUserNum) const;
@@ -466,35 +471,63 @@ private:
 	TMap<int32, FUniqueNetIdEOSPtr> UserNumToNetIdMap;
 	TMap<int32, EOS_ProductUserId> UserNumToProductUserIdMap;
 	TMap<EOS_ProductUserId, int32> ProductUserIdToUserNumMap;
-	TMap<FString, FUserOnlineAccountEOSRef> StringToUserAccountMap;
+	TUniqueNetIdEOSMap<FUserOnlineAccountEOSRef> NetIdToUserAccountMap;
 
-	/** General account mappings */
-	TMap<EOS_EpicAccountId, FString> AccountIdToStringMap;
-	TMap<EOS_ProductUserId, FString> ProductUserIdToStringMap;
+	/** General account mappings. Net ids are completed in place, so these stay valid when a PUID or EAS id is learned later */
+	TMap<EOS_EpicAccountId, FUniqueNetIdEOSRef> AccountIdToNetIdMap;
+	TMap<EOS_ProductUserId, FUniqueNetIdEOSRef> ProductUserIdToNetIdMap;
 
 	/** Per user friends lists accessible by user num or net id */
 	TMap<int32, FFriendsListEOSRef> LocalUserNumToFriendsListMap;
-	TMap<FString, FFriendsListEOSRef> NetIdStringToFriendsListMap;
+	TUniqueNetIdEOSMap<FFriendsListEOSRef> NetIdToFriendsListMap;
 	/** Per user blocked player lists accessible by user num or net id */
 	TMap<int32, FBlockedPlayersListEOSRef> LocalUserNumToBlockedPlayerListMap;
-	TMap<FString, FBlockedPlayersListEOSRef> NetIdStringToBlockedPlayerListMap;
+	TUniqueNetIdEOSMap<FBlockedPlayersListEOSRef> NetIdToBlockedPlayerListMap;
 	/** Per user recent player lists accessible by user num or net id */
 	TMap<int32, FRecentPlayersListEOSRef> LocalUserNumToRecentPlayerListMap;
-	TMap<FString, FRecentPlayersListEOSRef> NetIdStringToRecentPlayerListMap;
+	TUniqueNetIdEOSMap<FRecentPlayersListEOSRef> NetIdToRecentPlayerListMap;
 
 	/** Ids mapped to remote users */
-	TMap<FString, FOnlineUserPtr> NetIdStringToOnlineUserMap;
+	TUniqueNetIdEOSMap<FOnlineUserPtr> NetIdToOnlineUserMap;
 	TMap<EOS_EpicAccountId, FOnlineUserPtr> EpicAccountIdToOnlineUserMap;
-	TMap<FString, IAttributeAccessInterfaceRef> NetIdStringToAttributeAccessMap;
+	TUniqueNetIdEOSMap<IAttributeAccessInterfaceRef> NetIdToAttributeAccessMap;
 	TMap<EOS_EpicAccountId, IAttributeAccessInterfaceRef> EpicAccountIdToAttributeAccessMap;
 
 	/** Ids mapped to remote user presence */
-	TMap<FString, FOnlineUserPresenceRef> NetIdStringToOnlineUserPresenceMap;
+	TUniqueNetIdEOSMap<FOnlineUserPresenceRef> NetIdToOnlineUserPresenceMap;
 
 	/** Id map to keep track of which friends have been processed during async user info queries */
 	TMap<int32, TArray<EOS_EpicAccountId>> IsFriendQueryUserInfoOngoingForLocalUserMap;
 	/** Id map to keep track of which players still need their external id synced */
-	TMap<int32, TArray<FString>> IsPlayerQueryExternalMappingsOngoingForLocalUserMap;
+	TMap<int32, TArray<EOS_EpicAccountId>> IsPlayerQueryExternalMappingsOngoingForLocalUserMap;
+
+	/** A queued or in flight user lookup, with everyone waiting on its result */
+	struct FPendingUserLookup
+	{
+		TArray<FUserLookupCompleteCallback, TInlineAllocator<1>> Callbacks;
+		bool bInFlight = false;
+	};
+	TMap<EOS_EpicAccountId, FPendingUserLookup> PendingUserInfoLookups;
+	TArray<EOS_EpicAccountId> QueuedUserInfoLookups;
+	TMap<EOS_EpicAccountId, double> UserInfoLookupTimes;
+	int32 NumUserInfoLookupsInFlight = 0;
+	TMap<EOS_EpicAccountId, FPendingUserLookup> PendingExternalIdLookups;
+	/** Queued external account lookups, by the local user they are queried for */
+	TMap<int32, TArray<EOS_EpicAccountId>> QueuedExternalIdLookups;
+	TMap<EOS_EpicAccountId, double> ExternalIdLookupTimes;
+	/** Product user id lookups are started from the const ResolveUniqueNetIds */
+	mutable TMap<EOS_ProductUserId, FPendingUserLookup> PendingProductUserIdLookups;
+	mutable TArray<EOS_ProductUserId> QueuedProductUserIdLookups;
+	mutable TMap<EOS_ProductUserId, double> ProductUserIdLookupTimes;
+	/** Time the queued lookups are sent at, zero if nothing is scheduled */
+	mutable double UserLookupFlushTime = 0.0;
+	/** Time the lookup times are next pruned at */
+	double UserLookupPruneTime = 0.0;
+	/** How long lookups are collected before being sent, and how long a completed lookup is reused for */
+	double UserLookupBatchWindowSeconds = 0.05;
+	double UserLookupCacheSeconds = 60.0;
+	/** EOS_UserInfo_QueryUserInfo takes one user per call, so cap how many are outstanding at once instead */
+	int32 MaxUserInfoLookupsInFlight = 32;
 
 	/** Cache for the info passed on to ReadFriendsList, kept while user info queries complete */
 	struct ReadUserListInfo
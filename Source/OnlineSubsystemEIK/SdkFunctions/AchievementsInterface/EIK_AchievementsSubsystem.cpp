@@ -10,7 +10,7 @@
 FEIK_NotificationId UEIK_AchievementsSubsystem::EIK_Achievements_AddNotifyAchievementsUnlockedV2(FOnAchievementsUnlockedV2Callback Callback)
 {
 	OnAchievementsUnlockedV2 = Callback;
-	if(	IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if(	IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -31,7 +31,7 @@ FEIK_NotificationId UEIK_AchievementsSubsystem::EIK_Achievements_AddNotifyAchiev
 TEnumAsByte<EEIK_Result> UEIK_AchievementsSubsystem::EIK_Achievements_CopyAchievementDefinitionV2ByIndex(int32 Index,
 	FEIK_Achievements_DefinitionV2& OutAchievementDefinition)
 {
-	if(	IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if(	IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -52,7 +52,7 @@ TEnumAsByte<EEIK_Result> UEIK_AchievementsSubsystem::EIK_Achievements_CopyPlayer
 	FEIK_ProductUserId TargetUserId, int32 Index, FEIK_ProductUserId LocalUserId,
 	FEIK_Achievements_PlayerAchievement& OutPlayerAchievement)
 {
-	if(	IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if(	IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -77,7 +77,7 @@ void UEIK_AchievementsSubsystem::EIK_Achievements_DefinitionV2_Release(
 
 int32 UEIK_AchievementsSubsystem::EIK_Achievements_GetAchievementDefinitionCount()
 {
-	if(	IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if(	IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -92,7 +92,7 @@ int32 UEIK_AchievementsSubsystem::EIK_Achievements_GetAchievementDefinitionCount
 
 int32 UEIK_AchievementsSubsystem::EIK_Achievements_GetPlayerAchievementCount(FEIK_ProductUserId UserId)
 {
-	if(	IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if(	IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -114,7 +114,7 @@ void UEIK_AchievementsSubsystem::EIK_Achievements_PlayerAchievement_Release(
 
 TEnumAsByte<EEIK_Result> UEIK_AchievementsSubsystem::EIK_Achievements_QueryDefinitions(FEIK_ProductUserId UserId)
 {
-	if(	IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if(	IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -131,7 +131,7 @@ TEnumAsByte<EEIK_Result> UEIK_AchievementsSubsystem::EIK_Achievements_QueryDefin
 
 void UEIK_AchievementsSubsystem::EIK_Achievements_RemoveNotifyAchievementsUnlocked(FEIK_NotificationId Id)
 {
-	if(	IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if(	IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -142,7 +142,7 @@ void UEIK_AchievementsSubsystem::EIK_Achievements_RemoveNotifyAchievementsUnlock
 
 TEnumAsByte<EEIK_Result> UEIK_AchievementsSubsystem::EIK_Achievements_CopyPlayerAchievementByAchievementId(FEIK_ProductUserId TargetUserId, FString AchievementId, FEIK_ProductUserId LocalUserId, FEIK_Achievements_PlayerAchievement& OutPlayerAchievement)
 {
-	if(	IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if(	IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -166,7 +166,7 @@ TEnumAsByte<EEIK_Result> UEIK_AchievementsSubsystem::EIK_Achievements_CopyPlayer
 
 TEnumAsByte<EEIK_Result> UEIK_AchievementsSubsystem::EIK_Achievements_CopyAchievementDefinitionV2ByAchievementId(FString AchievementId, FEIK_Achievements_DefinitionV2& OutAchievementDefinition)
 {
-	if(	IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if(	IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
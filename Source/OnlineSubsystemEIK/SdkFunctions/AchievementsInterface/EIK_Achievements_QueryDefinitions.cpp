@@ -17,7 +17,7 @@ UEIK_Achievements_QueryDefinitions* UEIK_Achievements_QueryDefinitions::EIK_Achi
 void UEIK_Achievements_QueryDefinitions::Activate()
 {
 	Super::Activate();
-	if(	IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if(	IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
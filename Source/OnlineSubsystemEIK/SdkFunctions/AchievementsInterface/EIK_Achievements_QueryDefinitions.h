@@ -3,14 +3,14 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "Kismet/BlueprintAsyncActionBase.h"
+#include "OnlineSubsystemEIK/SdkFunctions/EIK_SdkAsyncAction.h"
 #include "OnlineSubsystemEIK/SdkFunctions/EIK_SharedFunctionFile.h"
 #include "EIK_Achievements_QueryDefinitions.generated.h"
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnEIK_Achievements_QueryDefinitionsComplete, TEnumAsByte<EEIK_Result>, ResultCode);
 
 UCLASS()
-class ONLINESUBSYSTEMEIK_API UEIK_Achievements_QueryDefinitions : public UBlueprintAsyncActionBase
+class ONLINESUBSYSTEMEIK_API UEIK_Achievements_QueryDefinitions : public UEIK_SdkAsyncAction
 {
 	GENERATED_BODY()
 
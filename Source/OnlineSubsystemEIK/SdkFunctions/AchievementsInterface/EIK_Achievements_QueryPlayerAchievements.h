@@ -3,14 +3,14 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "Kismet/BlueprintAsyncActionBase.h"
+#include "OnlineSubsystemEIK/SdkFunctions/EIK_SdkAsyncAction.h"
 #include "eos_achievements.h"
 #include "OnlineSubsystemEIK/SdkFunctions/EIK_SharedFunctionFile.h"
 #include "EIK_Achievements_QueryPlayerAchievements.generated.h"
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnEIK_Achievements_QueryPlayerAchievementsComplete, TEnumAsByte<EEIK_Result>, ResultCode, FEIK_ProductUserId, LocalUserId, FEIK_ProductUserId, TargetUserId);
 UCLASS()
-class ONLINESUBSYSTEMEIK_API UEIK_Achievements_QueryPlayerAchievements : public UBlueprintAsyncActionBase
+class ONLINESUBSYSTEMEIK_API UEIK_Achievements_QueryPlayerAchievements : public UEIK_SdkAsyncAction
 {
 	GENERATED_BODY()
 
@@ -18,7 +18,7 @@ UEIK_Achievements_UnlockAchievements* UEIK_Achievements_UnlockAchievements::EIK_
 void UEIK_Achievements_UnlockAchievements::Activate()
 {
 	Super::Activate();
-	if(	IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if(	IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
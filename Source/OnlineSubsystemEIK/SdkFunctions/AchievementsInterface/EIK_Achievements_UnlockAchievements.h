@@ -3,14 +3,14 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "Kismet/BlueprintAsyncActionBase.h"
+#include "OnlineSubsystemEIK/SdkFunctions/EIK_SdkAsyncAction.h"
 #include "eos_achievements.h"
 #include "OnlineSubsystemEIK/SdkFunctions/EIK_SharedFunctionFile.h"
 #include "EIK_Achievements_UnlockAchievements.generated.h"
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnEIK_Achievements_UnlockAchievementsComplete, TEnumAsByte<EEIK_Result>, ResultCode, FEIK_ProductUserId, UserId, int32, AchievementCount);
 UCLASS()
-class ONLINESUBSYSTEMEIK_API UEIK_Achievements_UnlockAchievements : public UBlueprintAsyncActionBase
+class ONLINESUBSYSTEMEIK_API UEIK_Achievements_UnlockAchievements : public UEIK_SdkAsyncAction
 {
 	GENERATED_BODY()
 
@@ -17,7 +17,7 @@ UEIK_Auth_DeletePersistentAuth* UEIK_Auth_DeletePersistentAuth::DeletePersistent
 void UEIK_Auth_DeletePersistentAuth::Activate()
 {
 	Super::Activate();
-	if(	IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if(	IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
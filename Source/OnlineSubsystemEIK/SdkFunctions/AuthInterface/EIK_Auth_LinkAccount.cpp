@@ -20,7 +20,7 @@ UEIK_Auth_LinkAccount* UEIK_Auth_LinkAccount::LinkAccount(FEIK_ContinuanceToken
 void UEIK_Auth_LinkAccount::Activate()
 {
 	Super::Activate();
-	if(	IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if(	IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -8,7 +8,7 @@ THIRD_PARTY_INCLUDES_START
 #include "eos_auth_types.h"
 #include "eos_auth.h"
 THIRD_PARTY_INCLUDES_END
-#include "Kismet/BlueprintAsyncActionBase.h"
+#include "OnlineSubsystemEIK/SdkFunctions/EIK_SdkAsyncAction.h"
 #include "EIK_Auth_LinkAccount.generated.h"
 
 USTRUCT(BlueprintType)
@@ -46,7 +46,7 @@ struct FEIK_Auth_LinkAccountCallbackInfo
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FEIK_Auth_OnLinkAccountCallback, FEIK_Auth_LinkAccountCallbackInfo, Data);
 
 UCLASS()
-class ONLINESUBSYSTEMEIK_API UEIK_Auth_LinkAccount : public UBlueprintAsyncActionBase
+class ONLINESUBSYSTEMEIK_API UEIK_Auth_LinkAccount : public UEIK_SdkAsyncAction
 {
 	GENERATED_BODY()
 
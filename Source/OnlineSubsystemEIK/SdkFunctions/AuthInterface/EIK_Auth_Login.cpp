@@ -17,7 +17,7 @@ UEIK_Auth_Login* UEIK_Auth_Login::Login(FEIK_Auth_LoginOptions Options)
 void UEIK_Auth_Login::Activate()
 {
 	Super::Activate();
-	if(	IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if(	IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -9,7 +9,7 @@ THIRD_PARTY_INCLUDES_START
 #include <eos_base.h>
 #include <eos_auth.h>
 THIRD_PARTY_INCLUDES_END
-#include "Kismet/BlueprintAsyncActionBase.h"
+#include "OnlineSubsystemEIK/SdkFunctions/EIK_SdkAsyncAction.h"
 #include "EIK_Auth_Login.generated.h"
 
 USTRUCT(BlueprintType)
@@ -80,7 +80,7 @@ struct FEIK_Auth_LoginOptions
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FEIK_Auth_LoginCallback, const FEIK_Auth_LoginCallbackInfo&, Data);
 
 UCLASS()
-class ONLINESUBSYSTEMEIK_API UEIK_Auth_Login : public UBlueprintAsyncActionBase
+class ONLINESUBSYSTEMEIK_API UEIK_Auth_Login : public UEIK_SdkAsyncAction
 {
 	GENERATED_BODY()
 
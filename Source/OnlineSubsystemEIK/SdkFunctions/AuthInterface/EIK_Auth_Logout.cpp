@@ -17,7 +17,7 @@ UEIK_Auth_Logout* UEIK_Auth_Logout::Logout(FEIK_EpicAccountId EpicAccountId)
 void UEIK_Auth_Logout::Activate()
 {
 	Super::Activate();
-	if(	IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if(	IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -3,7 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "Kismet/BlueprintAsyncActionBase.h"
+#include "OnlineSubsystemEIK/SdkFunctions/EIK_SdkAsyncAction.h"
 THIRD_PARTY_INCLUDES_START
 #include <eos_auth.h>
 THIRD_PARTY_INCLUDES_END
@@ -12,7 +12,7 @@ THIRD_PARTY_INCLUDES_END
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnLogoutCallback, TEnumAsByte<EEIK_Result>, ResultCode, FEIK_EpicAccountId, EpicAccountId);
 UCLASS()
-class ONLINESUBSYSTEMEIK_API UEIK_Auth_Logout : public UBlueprintAsyncActionBase
+class ONLINESUBSYSTEMEIK_API UEIK_Auth_Logout : public UEIK_SdkAsyncAction
 {
 	GENERATED_BODY()
 
@@ -37,7 +37,7 @@ void UEIK_Auth_QueryIdToken::OnQueryIdTokenCallback(const EOS_Auth_QueryIdTokenC
 void UEIK_Auth_QueryIdToken::Activate()
 {
 	Super::Activate();
-	if(	IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if(	IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -6,14 +6,14 @@
 THIRD_PARTY_INCLUDES_START
 #include <eos_auth.h>
 THIRD_PARTY_INCLUDES_END
-#include "Kismet/BlueprintAsyncActionBase.h"
+#include "OnlineSubsystemEIK/SdkFunctions/EIK_SdkAsyncAction.h"
 #include "OnlineSubsystemEIK/SdkFunctions/EIK_SharedFunctionFile.h"
 #include "EIK_Auth_QueryIdToken.generated.h"
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FEIK_Auth_OnQueryIdTokenCallback, TEnumAsByte<EEIK_Result>, ResultCode, FEIK_EpicAccountId, LocalUserId, FEIK_EpicAccountId, TargetAccountId);
 
 UCLASS()
-class ONLINESUBSYSTEMEIK_API UEIK_Auth_QueryIdToken : public UBlueprintAsyncActionBase
+class ONLINESUBSYSTEMEIK_API UEIK_Auth_QueryIdToken : public UEIK_SdkAsyncAction
 {
 	GENERATED_BODY()
 
@@ -35,7 +35,7 @@ void UEIK_Auth_VerifyIdToken::OnVerifyIdTokenCallback(const EOS_Auth_VerifyIdTok
 void UEIK_Auth_VerifyIdToken::Activate()
 {
 	Super::Activate();
-	if(	IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if(	IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
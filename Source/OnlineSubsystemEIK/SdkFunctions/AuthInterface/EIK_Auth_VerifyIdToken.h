@@ -6,7 +6,7 @@
 THIRD_PARTY_INCLUDES_START
 #include <eos_auth.h>
 THIRD_PARTY_INCLUDES_END
-#include "Kismet/BlueprintAsyncActionBase.h"
+#include "OnlineSubsystemEIK/SdkFunctions/EIK_SdkAsyncAction.h"
 #include "OnlineSubsystemEIK/SdkFunctions/EIK_SharedFunctionFile.h"
 #include "EIK_Auth_VerifyIdToken.generated.h"
 
@@ -92,7 +92,7 @@ struct FEIK_Auth_VerifyIdTokenCallbackInfo
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FEIK_Auth_OnVerifyIdTokenCallback, const FEIK_Auth_VerifyIdTokenCallbackInfo&, Data);
 UCLASS()
-class ONLINESUBSYSTEMEIK_API UEIK_Auth_VerifyIdToken : public UBlueprintAsyncActionBase
+class ONLINESUBSYSTEMEIK_API UEIK_Auth_VerifyIdToken : public UEIK_SdkAsyncAction
 {
 	GENERATED_BODY()
 
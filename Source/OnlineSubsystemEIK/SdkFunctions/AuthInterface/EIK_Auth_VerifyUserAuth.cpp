@@ -35,7 +35,7 @@ void UEIK_Auth_VerifyUserAuth::OnVerifyUserAuthCallback(const EOS_Auth_VerifyUse
 void UEIK_Auth_VerifyUserAuth::Activate()
 {
 	Super::Activate();
-	if(	IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if(	IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -6,14 +6,14 @@
 THIRD_PARTY_INCLUDES_START
 #include <eos_auth.h>
 THIRD_PARTY_INCLUDES_END
-#include "Kismet/BlueprintAsyncActionBase.h"
+#include "OnlineSubsystemEIK/SdkFunctions/EIK_SdkAsyncAction.h"
 #include "OnlineSubsystemEIK/SdkFunctions/EIK_SharedFunctionFile.h"
 #include "EIK_Auth_VerifyUserAuth.generated.h"
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FEIK_Auth_OnVerifyUserAuthCallback, TEnumAsByte<EEIK_Result>, ResultCode);
 
 UCLASS()
-class ONLINESUBSYSTEMEIK_API UEIK_Auth_VerifyUserAuth : public UBlueprintAsyncActionBase
+class ONLINESUBSYSTEMEIK_API UEIK_Auth_VerifyUserAuth : public UEIK_SdkAsyncAction
 {
 	GENERATED_BODY()
 
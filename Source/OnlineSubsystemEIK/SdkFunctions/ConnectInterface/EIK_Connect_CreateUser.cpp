@@ -19,7 +19,7 @@ UEIK_Connect_CreateUser* UEIK_Connect_CreateUser::CreateUser(FEIK_ContinuanceTok
 void UEIK_Connect_CreateUser::Activate()
 {
 	Super::Activate();
-	if(	IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if(	IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
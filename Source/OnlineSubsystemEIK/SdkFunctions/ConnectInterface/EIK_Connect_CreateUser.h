@@ -3,14 +3,14 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "Kismet/BlueprintAsyncActionBase.h"
+#include "OnlineSubsystemEIK/SdkFunctions/EIK_SdkAsyncAction.h"
 #include "OnlineSubsystemEIK/SdkFunctions/EIK_SharedFunctionFile.h"
 #include "EIK_Connect_CreateUser.generated.h"
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnCreateUserCallback, EEIK_Result, ResultCode, FEIK_ProductUserId, LocalUserId);
 
 UCLASS()
-class ONLINESUBSYSTEMEIK_API UEIK_Connect_CreateUser : public UBlueprintAsyncActionBase
+class ONLINESUBSYSTEMEIK_API UEIK_Connect_CreateUser : public UEIK_SdkAsyncAction
 {
 	GENERATED_BODY()
 
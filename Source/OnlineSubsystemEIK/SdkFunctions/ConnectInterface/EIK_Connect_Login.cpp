@@ -36,7 +36,7 @@ void UEIK_Connect_Login::OnLoginCallback(const EOS_Connect_LoginCallbackInfo* Da
 void UEIK_Connect_Login::Activate()
 {
 	Super::Activate();
-	if(	IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if(	IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -4,7 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "eos_connect_types.h"
-#include "Kismet/BlueprintAsyncActionBase.h"
+#include "OnlineSubsystemEIK/SdkFunctions/EIK_SdkAsyncAction.h"
 #include "OnlineSubsystemEIK/SdkFunctions/EIK_SharedFunctionFile.h"
 #include "EIK_Connect_Login.generated.h"
 
@@ -104,7 +104,7 @@ struct FEIK_Connect_Credentials
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnLoginCallback, TEnumAsByte<EEIK_Result>, ResultCode, FEIK_ProductUserId, LocalUserId, FEIK_ContinuanceToken, ContinuanceToken);
 UCLASS()
-class ONLINESUBSYSTEMEIK_API UEIK_Connect_Login : public UBlueprintAsyncActionBase
+class ONLINESUBSYSTEMEIK_API UEIK_Connect_Login : public UEIK_SdkAsyncAction
 {
 	GENERATED_BODY()
 
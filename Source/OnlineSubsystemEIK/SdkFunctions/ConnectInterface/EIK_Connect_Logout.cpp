@@ -34,7 +34,7 @@ void UEIK_Connect_Logout::OnLogoutCallback(const EOS_Connect_LogoutCallbackInfo*
 void UEIK_Connect_Logout::Activate()
 {
 	Super::Activate();
-	if(	IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if(	IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
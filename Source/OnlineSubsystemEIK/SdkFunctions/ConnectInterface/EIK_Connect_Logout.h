@@ -3,14 +3,14 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "Kismet/BlueprintAsyncActionBase.h"
+#include "OnlineSubsystemEIK/SdkFunctions/EIK_SdkAsyncAction.h"
 #include "OnlineSubsystemEIK/SdkFunctions/EIK_SharedFunctionFile.h"
 #include "EIK_Connect_Logout.generated.h"
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FEIK_Connect_Logout_Delegate, const FEIK_ProductUserId&, ProductUserId);
 
 UCLASS()
-class ONLINESUBSYSTEMEIK_API UEIK_Connect_Logout : public UBlueprintAsyncActionBase
+class ONLINESUBSYSTEMEIK_API UEIK_Connect_Logout : public UEIK_SdkAsyncAction
 {
 	GENERATED_BODY()
 
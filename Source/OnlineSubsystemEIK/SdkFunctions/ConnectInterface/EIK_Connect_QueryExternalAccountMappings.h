@@ -3,14 +3,14 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "Kismet/BlueprintAsyncActionBase.h"
+#include "OnlineSubsystemEIK/SdkFunctions/EIK_SdkAsyncAction.h"
 #include "OnlineSubsystemEIK/SdkFunctions/EIK_SharedFunctionFile.h"
 #include "EIK_Connect_QueryExternalAccountMappings.generated.h"
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FEIK_Connect_QueryExternalAccountMappings_Delegate, const FEIK_ProductUserId&, ProductUserId, TEnumAsByte<EEIK_Result>, Result);
 
 UCLASS()
-class ONLINESUBSYSTEMEIK_API UEIK_Connect_QueryExternalAccountMappings : public UBlueprintAsyncActionBase
+class ONLINESUBSYSTEMEIK_API UEIK_Connect_QueryExternalAccountMappings : public UEIK_SdkAsyncAction
 {
 	GENERATED_BODY()
 
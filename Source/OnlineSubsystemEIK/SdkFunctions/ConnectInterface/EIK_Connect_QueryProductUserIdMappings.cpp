@@ -38,7 +38,7 @@ void UEIK_Connect_QueryProductUserIdMappings::OnQueryProductUserIdMappingsCallba
 void UEIK_Connect_QueryProductUserIdMappings::Activate()
 {
 	Super::Activate();
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -38,7 +38,7 @@ void UEIK_Connect_TransferDeviceIdAccount::OnTransferDeviceIdAccountCallback(
 void UEIK_Connect_TransferDeviceIdAccount::Activate()
 {
 	Super::Activate();
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
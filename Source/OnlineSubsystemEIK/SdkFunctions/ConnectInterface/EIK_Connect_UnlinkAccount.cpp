@@ -34,7 +34,7 @@ void UEIK_Connect_UnlinkAccount::OnUnlinkAccountCallback(const EOS_Connect_Unlin
 void UEIK_Connect_UnlinkAccount::Activate()
 {
 	Super::Activate();
-	if(IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if(IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if(FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
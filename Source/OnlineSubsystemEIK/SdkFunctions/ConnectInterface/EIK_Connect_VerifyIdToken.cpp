@@ -34,7 +34,7 @@ void UEIK_Connect_VerifyIdToken::OnVerifyIdTokenCallback(const EOS_Connect_Verif
 void UEIK_Connect_VerifyIdToken::Activate()
 {
 	Super::Activate();
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -3,7 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "Kismet/BlueprintAsyncActionBase.h"
+#include "OnlineSubsystemEIK/SdkFunctions/EIK_SdkAsyncAction.h"
 #include "OnlineSubsystemEIK/SdkFunctions/EIK_SharedFunctionFile.h"
 #include "EIK_Connect_VerifyIdToken.generated.h"
 
@@ -84,7 +84,7 @@ struct FEIK_Connect_VerifyIdTokenCallbackInfo
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FEIK_Connect_VerifyIdToken_Delegate, const FEIK_Connect_VerifyIdTokenCallbackInfo&, Data);
 UCLASS()
-class ONLINESUBSYSTEMEIK_API UEIK_Connect_VerifyIdToken : public UBlueprintAsyncActionBase
+class ONLINESUBSYSTEMEIK_API UEIK_Connect_VerifyIdToken : public UEIK_SdkAsyncAction
 {
 	GENERATED_BODY()
 
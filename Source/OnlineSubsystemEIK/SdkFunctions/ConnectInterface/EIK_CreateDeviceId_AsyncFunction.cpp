@@ -17,7 +17,7 @@ UEIK_CreateDeviceId_AsyncFunction* UEIK_CreateDeviceId_AsyncFunction::CreateDevi
 void UEIK_CreateDeviceId_AsyncFunction::Activate()
 {
 	Super::Activate();
-	if(	IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if(	IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
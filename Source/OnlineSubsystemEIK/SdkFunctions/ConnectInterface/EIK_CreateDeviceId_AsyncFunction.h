@@ -5,7 +5,7 @@
 #include "CoreMinimal.h"
 #include "eos_base.h"
 #include "eos_connect_types.h"
-#include "Kismet/BlueprintAsyncActionBase.h"
+#include "OnlineSubsystemEIK/SdkFunctions/EIK_SdkAsyncAction.h"
 #include "OnlineSubsystemEIK/SdkFunctions/EIK_SharedFunctionFile.h"
 #include "EIK_CreateDeviceId_AsyncFunction.generated.h"
 
@@ -15,7 +15,7 @@
  */
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnCreateDeviceIdComplete, const TEnumAsByte<EEIK_Result>&, Result);
 UCLASS()
-class ONLINESUBSYSTEMEIK_API UEIK_CreateDeviceId_AsyncFunction : public UBlueprintAsyncActionBase
+class ONLINESUBSYSTEMEIK_API UEIK_CreateDeviceId_AsyncFunction : public UEIK_SdkAsyncAction
 {
 	GENERATED_BODY()
 
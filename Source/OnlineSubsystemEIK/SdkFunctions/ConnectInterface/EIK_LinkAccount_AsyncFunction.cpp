@@ -37,7 +37,7 @@ void UEIK_LinkAccount_AsyncFunction::OnLinkAccountCallback(const EOS_Connect_Lin
 void UEIK_LinkAccount_AsyncFunction::Activate()
 {
 	Super::Activate();
-	if(	IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if(	IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
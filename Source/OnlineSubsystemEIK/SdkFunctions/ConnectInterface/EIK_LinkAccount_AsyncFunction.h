@@ -7,13 +7,13 @@
 #include "eos_connect.h"
 #include "OnlineSubsystem.h"
 #include "OnlineSubsystemEOS.h"
-#include "Kismet/BlueprintAsyncActionBase.h"
+#include "OnlineSubsystemEIK/SdkFunctions/EIK_SdkAsyncAction.h"
 #include "OnlineSubsystemEIK/SdkFunctions/EIK_SharedFunctionFile.h"
 #include "EIK_LinkAccount_AsyncFunction.generated.h"
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnLinkAccountCallback, TEnumAsByte<EEIK_Result>, Result);
 UCLASS()
-class ONLINESUBSYSTEMEIK_API UEIK_LinkAccount_AsyncFunction : public UBlueprintAsyncActionBase
+class ONLINESUBSYSTEMEIK_API UEIK_LinkAccount_AsyncFunction : public UEIK_SdkAsyncAction
 {
 	GENERATED_BODY()
 
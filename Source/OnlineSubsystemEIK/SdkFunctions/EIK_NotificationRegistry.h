@@ -0,0 +1,132 @@
+﻿// Copyright (c) 2024 Betide Studio. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Runtime/Launch/Resources/Version.h"
+
+THIRD_PARTY_INCLUDES_START
+#include "eos_common.h"
+THIRD_PARTY_INCLUDES_END
+
+/** One subscription to an SDK notification made through a Blueprint subsystem, passed to the SDK as ClientData */
+template<typename DelegateType>
+struct TEIKNotification
+{
+	DelegateType Delegate;
+
+	/** Interned room the subscription is for, NAME_None for notifications that aren't tied to a room */
+	FName RoomHandle;
+
+	/** Room name converted once on subscribe, so callbacks can pass it on without converting Data->RoomName */
+	FString RoomName;
+
+	/** Reused for data payloads, so receiving a packet doesn't allocate once the buffer has grown to the packet size */
+	TArray<uint8> PayloadBuffer;
+};
+
+/**
+ * Subscriptions to one notification type, keyed by notification id.
+ *
+ * Every AddNotify call gets its own entry instead of overwriting a single delegate on the subsystem, so any number
+ * of listeners and rooms (say a squad room, a proximity room and a spectator room) can be subscribed at once
+ * without their callbacks crossing over. Entries are only added and removed on the game thread, callbacks reach
+ * their entry straight through ClientData and never touch the map. Audio callbacks run on the audio thread and can
+ * still be inside their entry when RemoveNotify returns, so removed entries are freed a couple of ticks later.
+ */
+template<typename DelegateType>
+class TEIKNotificationRegistry
+{
+public:
+	using FEntry = TEIKNotification<DelegateType>;
+
+	~TEIKNotificationRegistry()
+	{
+		for (TPair<EOS_NotificationId, TUniquePtr<FEntry>>& Pair : Entries)
+		{
+			Retire(MoveTemp(Pair.Value));
+		}
+	}
+
+	/** Creates an entry to pass to the SDK as ClientData, hand the id the SDK returns to Bind afterwards */
+	FEntry* Add(const DelegateType& Delegate, const FString& RoomName = FString())
+	{
+		check(!PendingEntry.IsValid());
+		PendingEntry = MakeUnique<FEntry>();
+		PendingEntry->Delegate = Delegate;
+		PendingEntry->RoomHandle = RoomName.IsEmpty() ? NAME_None : FName(*RoomName);
+		PendingEntry->RoomName = RoomName;
+		return PendingEntry.Get();
+	}
+
+	/** Keeps the entry created by Add alive for as long as the notification is registered, and drops it if registering failed */
+	EOS_NotificationId Bind(FEntry* Entry, EOS_NotificationId NotificationId)
+	{
+		check(PendingEntry.Get() == Entry);
+		if (NotificationId != EOS_INVALID_NOTIFICATIONID)
+		{
+			Entries.Add(NotificationId, MoveTemp(PendingEntry));
+		}
+		PendingEntry.Reset();
+		return NotificationId;
+	}
+
+	/** Call after the notification was removed from the SDK, no new callback will start for it */
+	bool Remove(EOS_NotificationId NotificationId)
+	{
+		TUniquePtr<FEntry> Entry;
+		if (!Entries.RemoveAndCopyValue(NotificationId, Entry))
+		{
+			return false;
+		}
+		Retire(MoveTemp(Entry));
+		return true;
+	}
+
+	/** Ids of every subscription for RoomHandle, or of all subscriptions if RoomHandle is NAME_None */
+	TArray<EOS_NotificationId> GetNotificationIds(FName RoomHandle = NAME_None) const
+	{
+		TArray<EOS_NotificationId> Result;
+		for (const TPair<EOS_NotificationId, TUniquePtr<FEntry>>& Pair : Entries)
+		{
+			if (RoomHandle.IsNone() || Pair.Value->RoomHandle == RoomHandle)
+			{
+				Result.Add(Pair.Key);
+			}
+		}
+		return Result;
+	}
+
+	int32 Num() const
+	{
+		return Entries.Num();
+	}
+
+private:
+	/** Frees an entry once the game thread has ticked twice, which outlasts a callback already running on another thread */
+	static void Retire(TUniquePtr<FEntry>&& Entry)
+	{
+		if (!Entry.IsValid())
+		{
+			return;
+		}
+		auto FreeEntry = [RetiredEntry = Entry.Release(), NumTicks = 0](float) mutable
+		{
+			if (++NumTicks < 2)
+			{
+				return true;
+			}
+			delete RetiredEntry;
+			return false;
+		};
+#if ENGINE_MAJOR_VERSION == 5
+		FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda(MoveTemp(FreeEntry)));
+#else
+		FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda(MoveTemp(FreeEntry)));
+#endif
+	}
+
+	TMap<EOS_NotificationId, TUniquePtr<FEntry>> Entries;
+	TUniquePtr<FEntry> PendingEntry;
+};
@@ -0,0 +1,36 @@
+﻿// Copyright (c) 2023 Betide Studio. All Rights Reserved.
+
+#include "EIK_SdkAsyncAction.h"
+#include "EOSSharedTypes.h"
+
+void UEIK_SdkAsyncAction::Activate()
+{
+	Super::Activate();
+	if (!bPendingRequest)
+	{
+		bPendingRequest = true;
+		FEIKSDKActivity::AddPendingRequest();
+	}
+}
+
+void UEIK_SdkAsyncAction::SetReadyToDestroy()
+{
+	RemovePendingRequest();
+	Super::SetReadyToDestroy();
+}
+
+void UEIK_SdkAsyncAction::BeginDestroy()
+{
+	// Nodes that are collected without completing must not keep the request counted
+	RemovePendingRequest();
+	Super::BeginDestroy();
+}
+
+void UEIK_SdkAsyncAction::RemovePendingRequest()
+{
+	if (bPendingRequest)
+	{
+		bPendingRequest = false;
+		FEIKSDKActivity::RemovePendingRequest();
+	}
+}
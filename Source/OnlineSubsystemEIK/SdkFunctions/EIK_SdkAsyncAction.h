@@ -0,0 +1,27 @@
+﻿// Copyright (c) 2023 Betide Studio. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "OnlineSubsystemEIK/SdkFunctions/EIK_SdkAsyncAction.h"
+#include "EIK_SdkAsyncAction.generated.h"
+
+/**
+ * Base of the SDK wrapper nodes. Counts the node as a pending SDK request from Activate until it is ready to
+ * destroy, so adaptive platform ticking runs at full rate while the node's completion is outstanding.
+ */
+UCLASS(Abstract)
+class ONLINESUBSYSTEMEIK_API UEIK_SdkAsyncAction : public UEIK_SdkAsyncAction
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Activate() override;
+	virtual void SetReadyToDestroy() override;
+	virtual void BeginDestroy() override;
+
+private:
+	void RemovePendingRequest();
+
+	bool bPendingRequest = false;
+};
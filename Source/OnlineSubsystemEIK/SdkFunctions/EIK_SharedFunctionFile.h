@@ -3431,15 +3431,25 @@ struct FEIK_RTCAudio_AudioBuffer
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "EOS Integration Kit | SDK Functions | RTC Audio Interface")
 	int32 NumChannels;
 
-	EOS_RTCAudio_AudioBuffer GetValueAsEosType() const
+	/**
+	 * Narrows Data back to 16 bits into FramesStorage, which is reused between calls so it stops allocating
+	 * once it has grown to the frame size. The returned buffer points into FramesStorage.
+	 */
+	EOS_RTCAudio_AudioBuffer GetValueAsEosType(TArray<int16>& FramesStorage) const
 	{
-		EOS_RTCAudio_AudioBuffer AudioBuffer;
-		AudioBuffer.ApiVersion = EOS_RTCAUDIO_AUDIOBUFFER_API_LATEST;
-		AudioBuffer.Frames = new int16[Data.Num()];
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 4
+		FramesStorage.SetNumUninitialized(Data.Num(), EAllowShrinking::No);
+#else
+		FramesStorage.SetNumUninitialized(Data.Num(), false);
+#endif
 		for (int32 i = 0; i < Data.Num(); i++)
 		{
-			AudioBuffer.Frames[i] = Data[i];
+			FramesStorage[i] = static_cast<int16>(FMath::Clamp(Data[i], MIN_int16, MAX_int16));
 		}
+
+		EOS_RTCAudio_AudioBuffer AudioBuffer;
+		AudioBuffer.ApiVersion = EOS_RTCAUDIO_AUDIOBUFFER_API_LATEST;
+		AudioBuffer.Frames = FramesStorage.GetData();
 		AudioBuffer.FramesCount = FramesCount;
 		AudioBuffer.SampleRate = SampleRate;
 		AudioBuffer.Channels = NumChannels;
@@ -3449,22 +3459,16 @@ struct FEIK_RTCAudio_AudioBuffer
 	{
 	}
 	FEIK_RTCAudio_AudioBuffer(EOS_RTCAudio_AudioBuffer InAudioBuffer)
+		: FEIK_RTCAudio_AudioBuffer(&InAudioBuffer)
 	{
-		Data.Empty();
-		for (int32 i = 0; i < static_cast<int32>(InAudioBuffer.FramesCount * InAudioBuffer.Channels); i++)
-		{
-			Data.Add(InAudioBuffer.Frames[i]);
-		}
-		FramesCount = InAudioBuffer.FramesCount;
-		SampleRate = InAudioBuffer.SampleRate;
-		NumChannels = InAudioBuffer.Channels;
 	}
 	FEIK_RTCAudio_AudioBuffer(EOS_RTCAudio_AudioBuffer* InAudioBuffer)
 	{
-		Data.Empty();
-		for (int32 i = 0; i < static_cast<int32>(InAudioBuffer->FramesCount * InAudioBuffer->Channels); i++)
+		const int32 NumSamples = static_cast<int32>(InAudioBuffer->FramesCount * InAudioBuffer->Channels);
+		Data.SetNumUninitialized(NumSamples);
+		for (int32 i = 0; i < NumSamples; i++)
 		{
-			Data.Add(InAudioBuffer->Frames[i]);
+			Data[i] = InAudioBuffer->Frames[i];
 		}
 		FramesCount = InAudioBuffer->FramesCount;
 		SampleRate = InAudioBuffer->SampleRate;
@@ -24,7 +24,7 @@ void UEIK_EcomSubsystem::EIK_Ecom_CatalogRelease_Release(FEIK_Ecom_CatalogReleas
 TEnumAsByte<EEIK_Result> UEIK_EcomSubsystem::EIK_Ecom_CopyEntitlementById(FEIK_EpicAccountId LocalUserId,
 	const FString& EntitlementId, FEIK_Ecom_Entitlement& OutEntitlement)
 {
-	if(	IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if(	IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -46,7 +46,7 @@ TEnumAsByte<EEIK_Result> UEIK_EcomSubsystem::EIK_Ecom_CopyEntitlementById(FEIK_E
 TEnumAsByte<EEIK_Result> UEIK_EcomSubsystem::EIK_Ecom_CopyEntitlementByIndex(FEIK_EpicAccountId LocalUserId,
                                                                              int32 EntitlementIndex, FEIK_Ecom_Entitlement& OutEntitlement)
 {
-	if(	IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if(	IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -68,7 +68,7 @@ TEnumAsByte<EEIK_Result> UEIK_EcomSubsystem::EIK_Ecom_CopyEntitlementByNameAndIn
 	FEIK_EpicAccountId LocalUserId, const FString& EntitlementName, int32 Index,
 	FEIK_Ecom_Entitlement& OutEntitlement)
 {
-	if(	IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if(	IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -90,7 +90,7 @@ TEnumAsByte<EEIK_Result> UEIK_EcomSubsystem::EIK_Ecom_CopyEntitlementByNameAndIn
 TEnumAsByte<EEIK_Result> UEIK_EcomSubsystem::EIK_Ecom_CopyItemById(FEIK_EpicAccountId LocalUserId,
 	const FString& ItemId, FEIK_Ecom_CatalogItem& OutCatalogItem)
 {
-	if(	IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if(	IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -111,7 +111,7 @@ TEnumAsByte<EEIK_Result> UEIK_EcomSubsystem::EIK_Ecom_CopyItemById(FEIK_EpicAcco
 TEnumAsByte<EEIK_Result> UEIK_EcomSubsystem::EIK_Ecom_CopyItemImageInfoByIndex(FEIK_EpicAccountId LocalUserId,
 	FEIK_Ecom_CatalogItemId ItemId, int32 ImageInfoIndex, FEIK_Ecom_KeyImageInfo& OutKeyImageInfo)
 {
-	if(	IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if(	IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -133,7 +133,7 @@ TEnumAsByte<EEIK_Result> UEIK_EcomSubsystem::EIK_Ecom_CopyItemImageInfoByIndex(F
 TEnumAsByte<EEIK_Result> UEIK_EcomSubsystem::EIK_Ecom_CopyItemReleaseByIndex(FEIK_EpicAccountId LocalUserId,
 	FEIK_Ecom_CatalogItemId ItemId, int32 ReleaseIndex, FEIK_Ecom_CatalogRelease& OutRelease)
 {
-	if(	IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if(	IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -155,7 +155,7 @@ TEnumAsByte<EEIK_Result> UEIK_EcomSubsystem::EIK_Ecom_CopyItemReleaseByIndex(FEI
 TEnumAsByte<EEIK_Result> UEIK_EcomSubsystem::EIK_Ecom_CopyLastRedeemedEntitlementByIndex(
 	FEIK_EpicAccountId LocalUserId, int32 RedeemedEntitlementIndex, FString& OutRedeemedEntitlementId)
 {
-	if(	IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if(	IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -177,7 +177,7 @@ TEnumAsByte<EEIK_Result> UEIK_EcomSubsystem::EIK_Ecom_CopyLastRedeemedEntitlemen
 TEnumAsByte<EEIK_Result> UEIK_EcomSubsystem::EIK_Ecom_CopyOfferById(FEIK_EpicAccountId LocalUserId,
 	const FEIK_Ecom_CatalogOfferId& OfferId, FEIK_Ecom_CatalogOffer& OutCatalogOffer)
 {
-	if(	IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if(	IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -198,7 +198,7 @@ TEnumAsByte<EEIK_Result> UEIK_EcomSubsystem::EIK_Ecom_CopyOfferById(FEIK_EpicAcc
 TEnumAsByte<EEIK_Result> UEIK_EcomSubsystem::EIK_Ecom_CopyOfferImageInfoByIndex(FEIK_EpicAccountId LocalUserId,
 	const FEIK_Ecom_CatalogOfferId& OfferId, int32 ImageInfoIndex, FEIK_Ecom_KeyImageInfo& OutKeyImageInfo)
 {
-	if(	IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if(	IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -220,7 +220,7 @@ TEnumAsByte<EEIK_Result> UEIK_EcomSubsystem::EIK_Ecom_CopyOfferImageInfoByIndex(
 TEnumAsByte<EEIK_Result> UEIK_EcomSubsystem::EIK_Ecom_CopyOfferItemByIndex(FEIK_EpicAccountId LocalUserId,
 	const FEIK_Ecom_CatalogOfferId& OfferId, int32 ItemIndex, FEIK_Ecom_CatalogItem& OutCatalogItem)
 {
-	if(	IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if(	IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -242,7 +242,7 @@ TEnumAsByte<EEIK_Result> UEIK_EcomSubsystem::EIK_Ecom_CopyOfferItemByIndex(FEIK_
 TEnumAsByte<EEIK_Result> UEIK_EcomSubsystem::EIK_Ecom_CopyOfferByIndex(FEIK_EpicAccountId LocalUserId,
 	int32 OfferIndex, FEIK_Ecom_CatalogOffer& OutCatalogOffer)
 {
-	if(	IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if(	IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -263,7 +263,7 @@ TEnumAsByte<EEIK_Result> UEIK_EcomSubsystem::EIK_Ecom_CopyOfferByIndex(FEIK_Epic
 TEnumAsByte<EEIK_Result> UEIK_EcomSubsystem::EIK_Ecom_CopyTransactionById(FEIK_EpicAccountId LocalUserId,
                                                                           const FString& TransactionId, FEIK_Ecom_HTransaction& OutTransaction)
 {
-	if(	IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if(	IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -287,7 +287,7 @@ TEnumAsByte<EEIK_Result> UEIK_EcomSubsystem::EIK_Ecom_CopyTransactionById(FEIK_E
 TEnumAsByte<EEIK_Result> UEIK_EcomSubsystem::EIK_Ecom_CopyTransactionByIndex(FEIK_EpicAccountId LocalUserId,
 	int32 TransactionIndex, FEIK_Ecom_HTransaction& OutTransaction)
 {
-	if(	IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if(	IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -316,7 +316,7 @@ void UEIK_EcomSubsystem::EIK_Ecom_Entitlement_Release(FEIK_Ecom_Entitlement Enti
 int32 UEIK_EcomSubsystem::EIK_Ecom_GetEntitlementsByNameCount(FEIK_EpicAccountId LocalUserId,
 	const FEIK_Ecom_EntitlementName& EntitlementName)
 {
-	if(	IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if(	IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -333,7 +333,7 @@ int32 UEIK_EcomSubsystem::EIK_Ecom_GetEntitlementsByNameCount(FEIK_EpicAccountId
 
 int32 UEIK_EcomSubsystem::EIK_Ecom_GetEntitlementsCount(FEIK_EpicAccountId LocalUserId)
 {
-	if(	IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if(	IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -350,7 +350,7 @@ int32 UEIK_EcomSubsystem::EIK_Ecom_GetEntitlementsCount(FEIK_EpicAccountId Local
 int32 UEIK_EcomSubsystem::EIK_Ecom_GetItemImageInfoCount(FEIK_EpicAccountId LocalUserId,
 	FEIK_Ecom_CatalogItemId ItemId)
 {
-	if(	IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if(	IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -368,7 +368,7 @@ int32 UEIK_EcomSubsystem::EIK_Ecom_GetItemImageInfoCount(FEIK_EpicAccountId Loca
 int32 UEIK_EcomSubsystem::EIK_Ecom_GetItemReleaseCount(FEIK_EpicAccountId LocalUserId,
 	FEIK_Ecom_CatalogItemId ItemId)
 {
-	if(	IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if(	IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -385,7 +385,7 @@ int32 UEIK_EcomSubsystem::EIK_Ecom_GetItemReleaseCount(FEIK_EpicAccountId LocalU
 
 int32 UEIK_EcomSubsystem::EIK_Ecom_GetLastRedeemedEntitlementsCount(FEIK_EpicAccountId LocalUserId)
 {
-	if(	IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if(	IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -401,7 +401,7 @@ int32 UEIK_EcomSubsystem::EIK_Ecom_GetLastRedeemedEntitlementsCount(FEIK_EpicAcc
 
 int32 UEIK_EcomSubsystem::EIK_Ecom_GetOfferCount(FEIK_EpicAccountId LocalUserId)
 {
-	if(	IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if(	IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -418,7 +418,7 @@ int32 UEIK_EcomSubsystem::EIK_Ecom_GetOfferCount(FEIK_EpicAccountId LocalUserId)
 int32 UEIK_EcomSubsystem::EIK_Ecom_GetOfferImageInfoCount(FEIK_EpicAccountId LocalUserId,
 	const FEIK_Ecom_CatalogOfferId& OfferId)
 {
-	if(	IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if(	IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -436,7 +436,7 @@ int32 UEIK_EcomSubsystem::EIK_Ecom_GetOfferImageInfoCount(FEIK_EpicAccountId Loc
 int32 UEIK_EcomSubsystem::EIK_Ecom_GetOfferItemCount(FEIK_EpicAccountId LocalUserId,
 	const FEIK_Ecom_CatalogOfferId& OfferId)
 {
-	if(	IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if(	IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -453,7 +453,7 @@ int32 UEIK_EcomSubsystem::EIK_Ecom_GetOfferItemCount(FEIK_EpicAccountId LocalUse
 
 int32 UEIK_EcomSubsystem::EIK_Ecom_GetTransactionCount(FEIK_EpicAccountId LocalUserId)
 {
-	if(	IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if(	IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -475,7 +475,7 @@ void UEIK_EcomSubsystem::EIK_Ecom_KeyImageInfo_Release(FEIK_Ecom_KeyImageInfo Ke
 TEnumAsByte<EEIK_Result> UEIK_EcomSubsystem::EIK_Ecom_Transaction_CopyEntitlementByIndex(int32 EntitlementIndex,
 	FEIK_Ecom_HTransaction Transaction, FEIK_Ecom_Entitlement& OutEntitlement)
 {
-	if(	IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if(	IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
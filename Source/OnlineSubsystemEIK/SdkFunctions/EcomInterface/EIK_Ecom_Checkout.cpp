@@ -34,7 +34,7 @@ void UEIK_Ecom_Checkout::OnCheckoutCallback(const EOS_Ecom_CheckoutCallbackInfo*
 void UEIK_Ecom_Checkout::Activate()
 {
 	Super::Activate();
-	if(	IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if(	IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
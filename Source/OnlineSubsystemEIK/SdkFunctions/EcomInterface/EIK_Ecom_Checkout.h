@@ -9,7 +9,7 @@ THIRD_PARTY_INCLUDES_START
 #include "eos_ecom.h"
 #include "eos_ecom_types.h"
 THIRD_PARTY_INCLUDES_END
-#include "Kismet/BlueprintAsyncActionBase.h"
+#include "OnlineSubsystemEIK/SdkFunctions/EIK_SdkAsyncAction.h"
 #include "EIK_Ecom_Checkout.generated.h"
 
 USTRUCT(BlueprintType)
@@ -93,7 +93,7 @@ struct FEIK_Ecom_CheckoutCallbackInfo
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FEIK_Ecom_CheckoutCallback, const FEIK_Ecom_CheckoutCallbackInfo&, Data);
 
 UCLASS()
-class ONLINESUBSYSTEMEIK_API UEIK_Ecom_Checkout : public UBlueprintAsyncActionBase
+class ONLINESUBSYSTEMEIK_API UEIK_Ecom_Checkout : public UEIK_SdkAsyncAction
 {
 	GENERATED_BODY()
 
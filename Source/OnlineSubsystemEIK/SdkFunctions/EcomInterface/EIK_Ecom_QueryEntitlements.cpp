@@ -35,7 +35,7 @@ void UEIK_Ecom_QueryEntitlements::OnQueryEntitlementsCallback(const EOS_Ecom_Que
 void UEIK_Ecom_QueryEntitlements::Activate()
 {
 	Super::Activate();
-	if(	IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if(	IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -3,7 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "Kismet/BlueprintAsyncActionBase.h"
+#include "OnlineSubsystemEIK/SdkFunctions/EIK_SdkAsyncAction.h"
 #include "OnlineSubsystemEIK/SdkFunctions/EIK_SharedFunctionFile.h"
 #include "EIK_Ecom_QueryEntitlements.generated.h"
 
@@ -49,7 +49,7 @@ struct FEIK_Ecom_QueryEntitlementsOptions
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FEIK_Ecom_QueryEntitlementsCallback, const FEIK_EpicAccountId&, LocalUserId, const TEnumAsByte<EEIK_Result>&, Result);
 
 UCLASS()
-class ONLINESUBSYSTEMEIK_API UEIK_Ecom_QueryEntitlements : public UBlueprintAsyncActionBase
+class ONLINESUBSYSTEMEIK_API UEIK_Ecom_QueryEntitlements : public UEIK_SdkAsyncAction
 {
 	GENERATED_BODY()
 
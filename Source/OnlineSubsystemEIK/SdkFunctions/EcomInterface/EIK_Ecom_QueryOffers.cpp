@@ -35,7 +35,7 @@ void UEIK_Ecom_QueryOffers::OnQueryOffersCallback(const EOS_Ecom_QueryOffersCall
 void UEIK_Ecom_QueryOffers::Activate()
 {
 	Super::Activate();
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -3,14 +3,14 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "Kismet/BlueprintAsyncActionBase.h"
+#include "OnlineSubsystemEIK/SdkFunctions/EIK_SdkAsyncAction.h"
 #include "OnlineSubsystemEIK/SdkFunctions/EIK_SharedFunctionFile.h"
 #include "EIK_Ecom_QueryOffers.generated.h"
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FEIK_Ecom_QueryOffersCallback, FEIK_EpicAccountId, LocalUserId, const TEnumAsByte<EEIK_Result>&, ResultCode);
 
 UCLASS()
-class ONLINESUBSYSTEMEIK_API UEIK_Ecom_QueryOffers : public UBlueprintAsyncActionBase
+class ONLINESUBSYSTEMEIK_API UEIK_Ecom_QueryOffers : public UEIK_SdkAsyncAction
 {
 	GENERATED_BODY()
 
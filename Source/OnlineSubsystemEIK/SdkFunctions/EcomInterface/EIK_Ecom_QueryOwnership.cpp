@@ -35,7 +35,7 @@ void UEIK_Ecom_QueryOwnership::OnQueryOwnershipCallback(const EOS_Ecom_QueryOwne
 void UEIK_Ecom_QueryOwnership::Activate()
 {
 	Super::Activate();
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -3,7 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "Kismet/BlueprintAsyncActionBase.h"
+#include "OnlineSubsystemEIK/SdkFunctions/EIK_SdkAsyncAction.h"
 #include "OnlineSubsystemEIK/SdkFunctions/EIK_SharedFunctionFile.h"
 #include "EIK_Ecom_QueryOwnership.generated.h"
 
@@ -82,7 +82,7 @@ struct FEIK_Ecom_QueryOwnershipCallbackInfo
 };
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FEIK_Ecom_QueryOwnershipCallback, const FEIK_Ecom_QueryOwnershipCallbackInfo&, Data);
 UCLASS()
-class ONLINESUBSYSTEMEIK_API UEIK_Ecom_QueryOwnership : public UBlueprintAsyncActionBase
+class ONLINESUBSYSTEMEIK_API UEIK_Ecom_QueryOwnership : public UEIK_SdkAsyncAction
 {
 	GENERATED_BODY()
 
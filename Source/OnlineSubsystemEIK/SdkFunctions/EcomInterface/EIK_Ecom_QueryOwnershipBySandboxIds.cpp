@@ -36,7 +36,7 @@ void UEIK_Ecom_QueryOwnershipBySandboxIds::OnQueryOwnershipBySandboxIdsCallback(
 void UEIK_Ecom_QueryOwnershipBySandboxIds::Activate()
 {
 	Super::Activate();
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -3,7 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "Kismet/BlueprintAsyncActionBase.h"
+#include "OnlineSubsystemEIK/SdkFunctions/EIK_SdkAsyncAction.h"
 #include "OnlineSubsystemEIK/SdkFunctions/EIK_SharedFunctionFile.h"
 #include "EIK_Ecom_QueryOwnershipBySandboxIds.generated.h"
 
@@ -77,7 +77,7 @@ struct FEIK_Ecom_QueryOwnershipBySandboxIdsCallbackInfo
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FEIK_Ecom_QueryOwnershipBySandboxIdsCallback, const FEIK_Ecom_QueryOwnershipBySandboxIdsCallbackInfo&, Data);
 UCLASS()
-class ONLINESUBSYSTEMEIK_API UEIK_Ecom_QueryOwnershipBySandboxIds : public UBlueprintAsyncActionBase
+class ONLINESUBSYSTEMEIK_API UEIK_Ecom_QueryOwnershipBySandboxIds : public UEIK_SdkAsyncAction
 {
 	GENERATED_BODY()
 
@@ -35,7 +35,7 @@ void UEIK_Ecom_QueryOwnershipToken::OnQueryOwnershipTokenCallback(const EOS_Ecom
 void UEIK_Ecom_QueryOwnershipToken::Activate()
 {
 	Super::Activate();
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
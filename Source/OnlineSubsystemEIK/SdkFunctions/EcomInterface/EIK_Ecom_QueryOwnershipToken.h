@@ -3,7 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "Kismet/BlueprintAsyncActionBase.h"
+#include "OnlineSubsystemEIK/SdkFunctions/EIK_SdkAsyncAction.h"
 #include "OnlineSubsystemEIK/SdkFunctions/EIK_SharedFunctionFile.h"
 #include "EIK_Ecom_QueryOwnershipToken.generated.h"
 
@@ -80,7 +80,7 @@ struct FEIK_Ecom_QueryOwnershipTokenCallbackInfo
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FEIK_Ecom_QueryOwnershipTokenCallback, const FEIK_Ecom_QueryOwnershipTokenCallbackInfo&, Data);
 
 UCLASS()
-class ONLINESUBSYSTEMEIK_API UEIK_Ecom_QueryOwnershipToken : public UBlueprintAsyncActionBase
+class ONLINESUBSYSTEMEIK_API UEIK_Ecom_QueryOwnershipToken : public UEIK_SdkAsyncAction
 {
 	GENERATED_BODY()
 public:
@@ -36,7 +36,7 @@ void UEIK_Ecom_RedeemEntitlements::OnRedeemEntitlementsCallback(const EOS_Ecom_R
 void UEIK_Ecom_RedeemEntitlements::Activate()
 {
 	Super::Activate();
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
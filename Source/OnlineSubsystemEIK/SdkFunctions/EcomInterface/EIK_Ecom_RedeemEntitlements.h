@@ -3,14 +3,14 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "Kismet/BlueprintAsyncActionBase.h"
+#include "OnlineSubsystemEIK/SdkFunctions/EIK_SdkAsyncAction.h"
 #include "OnlineSubsystemEIK/SdkFunctions/EIK_SharedFunctionFile.h"
 #include "EIK_Ecom_RedeemEntitlements.generated.h"
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FEIK_Ecom_RedeemEntitlementsCallback, const FEIK_EpicAccountId&, LocalUserId, const TEnumAsByte<EEIK_Result>, ResultCode, int32, RedeemedEntitlementIdsCount);
 
 UCLASS()
-class ONLINESUBSYSTEMEIK_API UEIK_Ecom_RedeemEntitlements : public UBlueprintAsyncActionBase
+class ONLINESUBSYSTEMEIK_API UEIK_Ecom_RedeemEntitlements : public UEIK_SdkAsyncAction
 {
 	GENERATED_BODY()
 
@@ -27,7 +27,7 @@ void UEIK_FriendsSubsystem::OnBlockedUserUpdateCallback(const EOS_Friends_OnBloc
 
 FEIK_NotificationId UEIK_FriendsSubsystem::EIK_Friends_AddNotifyBlockedUsersUpdate(FEIK_Friends_OnBlockedUsersUpdateCallback Callback)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -57,7 +57,7 @@ void UEIK_FriendsSubsystem::OnFriendsUpdateCallback(const EOS_Friends_OnFriendsU
 FEIK_NotificationId UEIK_FriendsSubsystem::EIK_Friends_AddNotifyFriendsUpdate(
 	FEIK_Friends_OnFriendsUpdateCallback Callback)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -73,7 +73,7 @@ FEIK_NotificationId UEIK_FriendsSubsystem::EIK_Friends_AddNotifyFriendsUpdate(
 
 FEIK_EpicAccountId UEIK_FriendsSubsystem::EIK_Friends_GetBlockedUserAtIndex(FEIK_EpicAccountId LocalUserId, int32 Index)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -90,7 +90,7 @@ FEIK_EpicAccountId UEIK_FriendsSubsystem::EIK_Friends_GetBlockedUserAtIndex(FEIK
 
 int32 UEIK_FriendsSubsystem::EIK_Friends_GetBlockedUsersCount(FEIK_EpicAccountId LocalUserId)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -106,7 +106,7 @@ int32 UEIK_FriendsSubsystem::EIK_Friends_GetBlockedUsersCount(FEIK_EpicAccountId
 
 FEIK_EpicAccountId UEIK_FriendsSubsystem::EIK_Friends_GetFriendAtIndex(FEIK_EpicAccountId LocalUserId, int32 Index)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -123,7 +123,7 @@ FEIK_EpicAccountId UEIK_FriendsSubsystem::EIK_Friends_GetFriendAtIndex(FEIK_Epic
 
 int32 UEIK_FriendsSubsystem::EIK_Friends_GetFriendsCount(FEIK_EpicAccountId LocalUserId)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -140,7 +140,7 @@ int32 UEIK_FriendsSubsystem::EIK_Friends_GetFriendsCount(FEIK_EpicAccountId Loca
 TEnumAsByte<EEIK_EFriendsStatus> UEIK_FriendsSubsystem::EIK_Friends_GetStatus(FEIK_EpicAccountId LocalUserId,
 	FEIK_EpicAccountId TargetUserId)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -157,7 +157,7 @@ TEnumAsByte<EEIK_EFriendsStatus> UEIK_FriendsSubsystem::EIK_Friends_GetStatus(FE
 
 void UEIK_FriendsSubsystem::EIK_Friends_RemoveNotifyBlockedUsersUpdate(FEIK_NotificationId NotificationId)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -170,7 +170,7 @@ void UEIK_FriendsSubsystem::EIK_Friends_RemoveNotifyBlockedUsersUpdate(FEIK_Noti
 
 void UEIK_FriendsSubsystem::EIK_Friends_RemoveNotifyFriendsUpdate(FEIK_NotificationId NotificationId)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
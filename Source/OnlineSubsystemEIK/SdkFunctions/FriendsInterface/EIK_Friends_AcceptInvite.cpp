@@ -34,7 +34,7 @@ void UEIK_Friends_AcceptInvite::OnAcceptInviteCallback(const EOS_Friends_AcceptI
 void UEIK_Friends_AcceptInvite::Activate()
 {
 	Super::Activate();
-	if(	IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if(	IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -3,7 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "Kismet/BlueprintAsyncActionBase.h"
+#include "OnlineSubsystemEIK/SdkFunctions/EIK_SdkAsyncAction.h"
 THIRD_PARTY_INCLUDES_START
 #include "eos_friends.h"
 #include "eos_friends_types.h"
@@ -18,7 +18,7 @@ THIRD_PARTY_INCLUDES_END
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FEIK_Friends_AcceptInviteCallback, const TEnumAsByte<EEIK_Result>&, Result, const FEIK_EpicAccountId&, LocalUserId, const FEIK_EpicAccountId&, TargetUserId);
 
 UCLASS()
-class ONLINESUBSYSTEMEIK_API UEIK_Friends_AcceptInvite : public UBlueprintAsyncActionBase
+class ONLINESUBSYSTEMEIK_API UEIK_Friends_AcceptInvite : public UEIK_SdkAsyncAction
 {
 	GENERATED_BODY()
 
@@ -31,7 +31,7 @@ void UEIK_Friends_QueryFriends::OnQueryFriendsCallback(const EOS_Friends_QueryFr
 void UEIK_Friends_QueryFriends::Activate()
 {
 	Super::Activate();
-	if(	IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if(	IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -3,7 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "Kismet/BlueprintAsyncActionBase.h"
+#include "OnlineSubsystemEIK/SdkFunctions/EIK_SdkAsyncAction.h"
 THIRD_PARTY_INCLUDES_START
 #include "eos_friends.h"
 #include "eos_friends_types.h"
@@ -13,7 +13,7 @@ THIRD_PARTY_INCLUDES_END
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FEIK_Friends_QueryFriendsCallback, const TEnumAsByte<EEIK_Result>&, Result, const FEIK_EpicAccountId&, LocalUserId);
 UCLASS()
-class ONLINESUBSYSTEMEIK_API UEIK_Friends_QueryFriends : public UBlueprintAsyncActionBase
+class ONLINESUBSYSTEMEIK_API UEIK_Friends_QueryFriends : public UEIK_SdkAsyncAction
 {
 	GENERATED_BODY()
 
@@ -36,7 +36,7 @@ void UEIK_Friends_RejectInvite::OnRejectInviteCallback(const EOS_Friends_RejectI
 void UEIK_Friends_RejectInvite::Activate()
 {
 	Super::Activate();
-	if(	IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if(	IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -29,7 +29,7 @@ void UEIK_Friends_SendInvite::OnSendInviteCallback(const EOS_Friends_SendInviteC
 void UEIK_Friends_SendInvite::Activate()
 {
 	Super::Activate();
-	if(	IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if(	IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
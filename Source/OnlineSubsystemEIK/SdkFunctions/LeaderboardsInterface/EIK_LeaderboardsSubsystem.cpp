@@ -8,7 +8,7 @@
 TEnumAsByte<EEIK_Result> UEIK_LeaderboardsSubsystem::EIK_Leaderboards_CopyLeaderboardDefinitionByIndex(
 	int32 LeaderboardIndex, FEIK_Leaderboards_Definition& OutLeaderboardDefinition)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -31,7 +31,7 @@ TEnumAsByte<EEIK_Result> UEIK_LeaderboardsSubsystem::EIK_Leaderboards_CopyLeader
 TEnumAsByte<EEIK_Result> UEIK_LeaderboardsSubsystem::EIK_Leaderboards_CopyLeaderboardDefinitionByLeaderboardId(
 	FString LeaderboardId, FEIK_Leaderboards_Definition& OutLeaderboardDefinition)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -54,7 +54,7 @@ TEnumAsByte<EEIK_Result> UEIK_LeaderboardsSubsystem::EIK_Leaderboards_CopyLeader
 TEnumAsByte<EEIK_Result> UEIK_LeaderboardsSubsystem::EIK_Leaderboards_CopyLeaderboardRecordByIndex(
 	int32 LeaderboardRecordIndex, FEIK_Leaderboards_LeaderboardRecord& OutLeaderboardRecord)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -77,7 +77,7 @@ TEnumAsByte<EEIK_Result> UEIK_LeaderboardsSubsystem::EIK_Leaderboards_CopyLeader
 TEnumAsByte<EEIK_Result> UEIK_LeaderboardsSubsystem::EIK_Leaderboards_CopyLeaderboardRecordByUserId(
 	FEIK_ProductUserId UserId, FEIK_Leaderboards_LeaderboardRecord& OutLeaderboardRecord)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -100,7 +100,7 @@ TEnumAsByte<EEIK_Result> UEIK_LeaderboardsSubsystem::EIK_Leaderboards_CopyLeader
 TEnumAsByte<EEIK_Result> UEIK_LeaderboardsSubsystem::EIK_Leaderboards_CopyLeaderboardUserScoreByIndex(
 	int32 LeaderboardUserScoreIndex, FString StatName, FEIK_Leaderboards_LeaderboardUserScore& OutLeaderboardUserScore)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -124,7 +124,7 @@ TEnumAsByte<EEIK_Result> UEIK_LeaderboardsSubsystem::EIK_Leaderboards_CopyLeader
 TEnumAsByte<EEIK_Result> UEIK_LeaderboardsSubsystem::EIK_Leaderboards_CopyLeaderboardUserScoreByUserId(
 	FEIK_ProductUserId UserId, FString StatName, FEIK_Leaderboards_LeaderboardUserScore& OutLeaderboardUserScore)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -154,7 +154,7 @@ void UEIK_LeaderboardsSubsystem::EIK_Leaderboards_LeaderboardDefinition_Release(
 
 int32 UEIK_LeaderboardsSubsystem::EIK_Leaderboards_GetLeaderboardDefinitionCount()
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -169,7 +169,7 @@ int32 UEIK_LeaderboardsSubsystem::EIK_Leaderboards_GetLeaderboardDefinitionCount
 
 int32 UEIK_LeaderboardsSubsystem::EIK_Leaderboards_GetLeaderboardRecordCount()
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -184,7 +184,7 @@ int32 UEIK_LeaderboardsSubsystem::EIK_Leaderboards_GetLeaderboardRecordCount()
 
 int32 UEIK_LeaderboardsSubsystem::EIK_Leaderboards_GetLeaderboardUserScoreCount()
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -3,7 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "Kismet/BlueprintAsyncActionBase.h"
+#include "OnlineSubsystemEIK/SdkFunctions/EIK_SdkAsyncAction.h"
 #include "OnlineSubsystemEIK/SdkFunctions/EIK_SharedFunctionFile.h"
 THIRD_PARTY_INCLUDES_START
 #include "eos_leaderboards.h"
@@ -49,7 +49,7 @@ struct FEIK_Leaderboards_QueryLeaderboardDefinitionsOptions
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FEIK_Leaderboards_OnQueryLeaderboardDefinitionsCompleteCallback, const TEnumAsByte<EEIK_Result>&, Result);
 
 UCLASS()
-class ONLINESUBSYSTEMEIK_API UEIK_Leaderboards_QueryLeaderboardDefinitions : public UBlueprintAsyncActionBase
+class ONLINESUBSYSTEMEIK_API UEIK_Leaderboards_QueryLeaderboardDefinitions : public UEIK_SdkAsyncAction
 {
 	GENERATED_BODY()
 
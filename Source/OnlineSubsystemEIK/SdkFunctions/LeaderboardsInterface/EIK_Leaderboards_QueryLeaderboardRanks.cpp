@@ -13,7 +13,7 @@ UEIK_Leaderboards_QueryLeaderboardRanks* UEIK_Leaderboards_QueryLeaderboardRanks
 void UEIK_Leaderboards_QueryLeaderboardRanks::Activate()
 {
 	Super::Activate();
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -3,7 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "Kismet/BlueprintAsyncActionBase.h"
+#include "OnlineSubsystemEIK/SdkFunctions/EIK_SdkAsyncAction.h"
 #include "OnlineSubsystemEIK/SdkFunctions/EIK_SharedFunctionFile.h"
 #include "OnlineSubsystemEOS.h"
 #include "Async/Async.h"
@@ -45,7 +45,7 @@ struct FEIK_Leaderboards_QueryLeaderboardRanksOptions
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FEIK_Leaderboards_OnQueryLeaderboardRanksCompleteCallback, const TEnumAsByte<EEIK_Result>&, Result, const FString&, LeaderboardId);
 
 UCLASS()
-class ONLINESUBSYSTEMEIK_API UEIK_Leaderboards_QueryLeaderboardRanks : public UBlueprintAsyncActionBase
+class ONLINESUBSYSTEMEIK_API UEIK_Leaderboards_QueryLeaderboardRanks : public UEIK_SdkAsyncAction
 {
 	GENERATED_BODY()
 
@@ -14,7 +14,7 @@ EIK_Leaderboards_QueryLeaderboardUserScores(const FEIK_Leaderboards_QueryLeaderb
 void UEIK_Leaderboards_QueryLeaderboardUserScores::Activate()
 {
 	Super::Activate();
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
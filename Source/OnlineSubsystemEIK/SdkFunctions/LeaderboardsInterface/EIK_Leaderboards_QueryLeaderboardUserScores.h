@@ -3,7 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "Kismet/BlueprintAsyncActionBase.h"
+#include "OnlineSubsystemEIK/SdkFunctions/EIK_SdkAsyncAction.h"
 #include "OnlineSubsystemEIK/SdkFunctions/EIK_SharedFunctionFile.h"
 #include "OnlineSubsystemEOS.h"
 #include "Async/Async.h"
@@ -74,7 +74,7 @@ struct FEIK_Leaderboards_QueryLeaderboardUserScoresOptions
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FEIK_Leaderboards_OnQueryLeaderboardUserScoresCompleteCallback, const TEnumAsByte<EEIK_Result>&, Result);
 
 UCLASS()
-class ONLINESUBSYSTEMEIK_API UEIK_Leaderboards_QueryLeaderboardUserScores : public UBlueprintAsyncActionBase
+class ONLINESUBSYSTEMEIK_API UEIK_Leaderboards_QueryLeaderboardUserScores : public UEIK_SdkAsyncAction
 {
 	GENERATED_BODY()
 
@@ -16,7 +16,7 @@ UEIK_LobbySearch_Find* UEIK_LobbySearch_Find::EIK_LobbySearch_Find(FEIK_HLobbySe
 void UEIK_LobbySearch_Find::Activate()
 {
 	Super::Activate();
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
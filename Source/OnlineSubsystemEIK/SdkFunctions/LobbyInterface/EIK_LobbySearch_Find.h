@@ -3,7 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "Kismet/BlueprintAsyncActionBase.h"
+#include "OnlineSubsystemEIK/SdkFunctions/EIK_SdkAsyncAction.h"
 #include "OnlineSessionEOS.h"
 #include "OnlineSubsystemEOS.h"
 #include "Async/Async.h"
@@ -13,7 +13,7 @@
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FEIKLobbySearchFind, const TEnumAsByte<EEIK_Result>&, ResultCode);
 UCLASS()
-class ONLINESUBSYSTEMEIK_API UEIK_LobbySearch_Find : public UBlueprintAsyncActionBase
+class ONLINESUBSYSTEMEIK_API UEIK_LobbySearch_Find : public UEIK_SdkAsyncAction
 {
 	GENERATED_BODY()
 	
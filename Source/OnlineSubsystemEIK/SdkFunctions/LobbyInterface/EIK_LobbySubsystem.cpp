@@ -10,23 +10,28 @@
 #include "Async/Async.h"
 #include "OnlineSubsystemEIK/SdkFunctions/ConnectInterface/EIK_ConnectSubsystem.h"
 #include "UserManagerEOS.h"
+#include "EOSSharedTypes.h"
 
 FEIK_NotificationId UEIK_LobbySubsystem::EIK_Lobby_AddNotifyJoinLobbyAccepted(FEIK_Lobby_OnJoinLobbyAcceptedCallback Callback)
 {
-	OnJoinLobbyAccepted = Callback;
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
 			EOS_Lobby_AddNotifyJoinLobbyAcceptedOptions Options = {};
 			Options.ApiVersion = EOS_LOBBY_ADDNOTIFYJOINLOBBYACCEPTED_API_LATEST;
-			return EOS_Lobby_AddNotifyJoinLobbyAccepted(EOSRef->SessionInterfacePtr->LobbyHandle, &Options, this, [](const EOS_Lobby_JoinLobbyAcceptedCallbackInfo* Data)
+			PRAGMA_DISABLE_DEPRECATION_WARNINGS
+			OnJoinLobbyAccepted = Callback;
+			PRAGMA_ENABLE_DEPRECATION_WARNINGS
+			TEIKNotification<FEIK_Lobby_OnJoinLobbyAcceptedCallback>* Entry = JoinLobbyAcceptedNotifications.Add(Callback);
+			return JoinLobbyAcceptedNotifications.Bind(Entry, EOS_Lobby_AddNotifyJoinLobbyAccepted(EOSRef->SessionInterfacePtr->LobbyHandle, &Options, Entry, [](const EOS_Lobby_JoinLobbyAcceptedCallbackInfo* Data)
 			{
-				if (UEIK_LobbySubsystem* CallbackObj = static_cast<UEIK_LobbySubsystem*>(Data->ClientData))
+				TEIKNotification<FEIK_Lobby_OnJoinLobbyAcceptedCallback>* Notification = static_cast<TEIKNotification<FEIK_Lobby_OnJoinLobbyAcceptedCallback>*>(Data->ClientData);
+				if (Notification)
 				{
-						CallbackObj->OnJoinLobbyAccepted.ExecuteIfBound(Data->LocalUserId, Data->UiEventId);
+					Notification->Delegate.ExecuteIfBound(Data->LocalUserId, Data->UiEventId);
 				}
-			});
+			}));
 		}
 	}
 	return FEIK_NotificationId();
@@ -34,32 +39,37 @@ FEIK_NotificationId UEIK_LobbySubsystem::EIK_Lobby_AddNotifyJoinLobbyAccepted(FE
 
 void UEIK_LobbySubsystem::EIK_Lobby_RemoveNotifyJoinLobbyAccepted(FEIK_NotificationId InId)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
 			EOS_Lobby_RemoveNotifyJoinLobbyAccepted(EOSRef->SessionInterfacePtr->LobbyHandle, InId.GetValueAsEosType());
 		}
 	}
+	JoinLobbyAcceptedNotifications.Remove(InId.GetValueAsEosType());
 }
 
 FEIK_NotificationId UEIK_LobbySubsystem::EIK_Lobby_AddNotifyLeaveLobbyRequested(
 	FEIK_Lobby_OnLeaveLobbyRequestedCallback Callback)
 {
-	OnLeaveLobbyRequested = Callback;
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
 			EOS_Lobby_AddNotifyLeaveLobbyRequestedOptions Options = {};
 			Options.ApiVersion = EOS_LOBBY_ADDNOTIFYLEAVELOBBYREQUESTED_API_LATEST;
-			return EOS_Lobby_AddNotifyLeaveLobbyRequested(EOSRef->SessionInterfacePtr->LobbyHandle, &Options, this, [](const EOS_Lobby_LeaveLobbyRequestedCallbackInfo* Data)
+			PRAGMA_DISABLE_DEPRECATION_WARNINGS
+			OnLeaveLobbyRequested = Callback;
+			PRAGMA_ENABLE_DEPRECATION_WARNINGS
+			TEIKNotification<FEIK_Lobby_OnLeaveLobbyRequestedCallback>* Entry = LeaveLobbyRequestedNotifications.Add(Callback);
+			return LeaveLobbyRequestedNotifications.Bind(Entry, EOS_Lobby_AddNotifyLeaveLobbyRequested(EOSRef->SessionInterfacePtr->LobbyHandle, &Options, Entry, [](const EOS_Lobby_LeaveLobbyRequestedCallbackInfo* Data)
 			{
-				if (UEIK_LobbySubsystem* CallbackObj = static_cast<UEIK_LobbySubsystem*>(Data->ClientData))
+				TEIKNotification<FEIK_Lobby_OnLeaveLobbyRequestedCallback>* Notification = static_cast<TEIKNotification<FEIK_Lobby_OnLeaveLobbyRequestedCallback>*>(Data->ClientData);
+				if (Notification)
 				{
-						CallbackObj->OnLeaveLobbyRequested.ExecuteIfBound(Data->LocalUserId, Data->LobbyId);
+					Notification->Delegate.ExecuteIfBound(Data->LocalUserId, Data->LobbyId);
 				}
-			});
+			}));
 		}
 	}
 	return FEIK_NotificationId();
@@ -67,32 +77,37 @@ FEIK_NotificationId UEIK_LobbySubsystem::EIK_Lobby_AddNotifyLeaveLobbyRequested(
 
 void UEIK_LobbySubsystem::EIK_Lobby_RemoveNotifyLeaveLobbyRequested(FEIK_NotificationId InId)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
 			EOS_Lobby_RemoveNotifyLeaveLobbyRequested(EOSRef->SessionInterfacePtr->LobbyHandle, InId.GetValueAsEosType());
 		}
 	}
+	LeaveLobbyRequestedNotifications.Remove(InId.GetValueAsEosType());
 }
 
 FEIK_NotificationId UEIK_LobbySubsystem::EIK_Lobby_AddNotifyLobbyInviteAccepted(
 	FEIK_Lobby_OnLobbyInviteAcceptedCallback Callback)
 {
-	OnLobbyInviteAccepted = Callback;
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
 			EOS_Lobby_AddNotifyLobbyInviteAcceptedOptions Options = {};
 			Options.ApiVersion = EOS_LOBBY_ADDNOTIFYLOBBYINVITEACCEPTED_API_LATEST;
-			return EOS_Lobby_AddNotifyLobbyInviteAccepted(EOSRef->SessionInterfacePtr->LobbyHandle, &Options, this, [](const EOS_Lobby_LobbyInviteAcceptedCallbackInfo* Data)
+			PRAGMA_DISABLE_DEPRECATION_WARNINGS
+			OnLobbyInviteAccepted = Callback;
+			PRAGMA_ENABLE_DEPRECATION_WARNINGS
+			TEIKNotification<FEIK_Lobby_OnLobbyInviteAcceptedCallback>* Entry = LobbyInviteAcceptedNotifications.Add(Callback);
+			return LobbyInviteAcceptedNotifications.Bind(Entry, EOS_Lobby_AddNotifyLobbyInviteAccepted(EOSRef->SessionInterfacePtr->LobbyHandle, &Options, Entry, [](const EOS_Lobby_LobbyInviteAcceptedCallbackInfo* Data)
 			{
-				if (UEIK_LobbySubsystem* CallbackObj = static_cast<UEIK_LobbySubsystem*>(Data->ClientData))
+				TEIKNotification<FEIK_Lobby_OnLobbyInviteAcceptedCallback>* Notification = static_cast<TEIKNotification<FEIK_Lobby_OnLobbyInviteAcceptedCallback>*>(Data->ClientData);
+				if (Notification)
 				{
-					CallbackObj->OnLobbyInviteAccepted.ExecuteIfBound(Data->LocalUserId, Data->TargetUserId, Data->LobbyId, Data->InviteId);
+					Notification->Delegate.ExecuteIfBound(Data->LocalUserId, Data->TargetUserId, Data->LobbyId, Data->InviteId);
 				}
-			});
+			}));
 		}
 	}
 	return FEIK_NotificationId();
@@ -100,31 +115,36 @@ FEIK_NotificationId UEIK_LobbySubsystem::EIK_Lobby_AddNotifyLobbyInviteAccepted(
 
 void UEIK_LobbySubsystem::EIK_Lobby_RemoveNotifyLobbyInviteAccepted(FEIK_NotificationId InId)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
 			EOS_Lobby_RemoveNotifyLobbyInviteAccepted(EOSRef->SessionInterfacePtr->LobbyHandle, InId.GetValueAsEosType());
 		}
 	}
+	LobbyInviteAcceptedNotifications.Remove(InId.GetValueAsEosType());
 }
 
 FEIK_NotificationId UEIK_LobbySubsystem::EIK_Lobby_AddNotifyLobbyInviteReceived(FEIK_Lobby_OnLobbyInviteReceivedCallback Callback)
 {
-	OnLobbyInviteReceived = Callback;
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
 			EOS_Lobby_AddNotifyLobbyInviteReceivedOptions Options = {};
 			Options.ApiVersion = EOS_LOBBY_ADDNOTIFYLOBBYINVITERECEIVED_API_LATEST;
-			return EOS_Lobby_AddNotifyLobbyInviteReceived(EOSRef->SessionInterfacePtr->LobbyHandle, &Options, this, [](const EOS_Lobby_LobbyInviteReceivedCallbackInfo* Data)
+			PRAGMA_DISABLE_DEPRECATION_WARNINGS
+			OnLobbyInviteReceived = Callback;
+			PRAGMA_ENABLE_DEPRECATION_WARNINGS
+			TEIKNotification<FEIK_Lobby_OnLobbyInviteReceivedCallback>* Entry = LobbyInviteReceivedNotifications.Add(Callback);
+			return LobbyInviteReceivedNotifications.Bind(Entry, EOS_Lobby_AddNotifyLobbyInviteReceived(EOSRef->SessionInterfacePtr->LobbyHandle, &Options, Entry, [](const EOS_Lobby_LobbyInviteReceivedCallbackInfo* Data)
 			{
-				if (UEIK_LobbySubsystem* CallbackObj = static_cast<UEIK_LobbySubsystem*>(Data->ClientData))
+				TEIKNotification<FEIK_Lobby_OnLobbyInviteReceivedCallback>* Notification = static_cast<TEIKNotification<FEIK_Lobby_OnLobbyInviteReceivedCallback>*>(Data->ClientData);
+				if (Notification)
 				{
-					CallbackObj->OnLobbyInviteReceived.ExecuteIfBound(Data->LocalUserId, Data->TargetUserId, StringCast<TCHAR>(Data->InviteId).Get());
+					Notification->Delegate.ExecuteIfBound(Data->LocalUserId, Data->TargetUserId, StringCast<TCHAR>(Data->InviteId).Get());
 				}
-			});
+			}));
 		}
 	}
 	return FEIK_NotificationId();
@@ -132,35 +152,41 @@ FEIK_NotificationId UEIK_LobbySubsystem::EIK_Lobby_AddNotifyLobbyInviteReceived(
 
 void UEIK_LobbySubsystem::EIK_Lobby_RemoveNotifyLobbyInviteReceived(FEIK_NotificationId InId)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
 			EOS_Lobby_RemoveNotifyLobbyInviteReceived(EOSRef->SessionInterfacePtr->LobbyHandle, InId.GetValueAsEosType());
 		}
 	}
+	LobbyInviteReceivedNotifications.Remove(InId.GetValueAsEosType());
 }
 
 FEIK_NotificationId UEIK_LobbySubsystem::EIK_Lobby_AddNotifyLobbyInviteRejected(
 	FEIK_Lobby_OnLobbyInviteRejectedCallback Callback)
 {
-	OnLobbyInviteRejected = Callback;
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
 			EOS_Lobby_AddNotifyLobbyInviteRejectedOptions Options = {};
 			Options.ApiVersion = EOS_LOBBY_ADDNOTIFYLOBBYINVITEREJECTED_API_LATEST;
-			return EOS_Lobby_AddNotifyLobbyInviteRejected(EOSRef->SessionInterfacePtr->LobbyHandle, &Options, this, [](const EOS_Lobby_LobbyInviteRejectedCallbackInfo* Data)
+			PRAGMA_DISABLE_DEPRECATION_WARNINGS
+			OnLobbyInviteRejected = Callback;
+			PRAGMA_ENABLE_DEPRECATION_WARNINGS
+			TEIKNotification<FEIK_Lobby_OnLobbyInviteRejectedCallback>* Entry = LobbyInviteRejectedNotifications.Add(Callback);
+			return LobbyInviteRejectedNotifications.Bind(Entry, EOS_Lobby_AddNotifyLobbyInviteRejected(EOSRef->SessionInterfacePtr->LobbyHandle, &Options, Entry, [](const EOS_Lobby_LobbyInviteRejectedCallbackInfo* Data)
 			{
-				if (UEIK_LobbySubsystem* CallbackObj = static_cast<UEIK_LobbySubsystem*>(Data->ClientData))
+				TEIKNotification<FEIK_Lobby_OnLobbyInviteRejectedCallback>* Notification = static_cast<TEIKNotification<FEIK_Lobby_OnLobbyInviteRejectedCallback>*>(Data->ClientData);
+				if (Notification)
 				{
-					AsyncTask(ENamedThreads::GameThread, [CallbackObj, Data]()
+					// Data only lives for the duration of the callback, so take copies before hopping to the game thread
+					AsyncTask(ENamedThreads::GameThread, [Delegate = Notification->Delegate, LocalUserId = FEIK_ProductUserId(Data->LocalUserId), TargetUserId = FEIK_ProductUserId(Data->TargetUserId), LobbyId = FEIK_LobbyId(Data->LobbyId), InviteId = FString(UTF8_TO_TCHAR(Data->InviteId))]()
 					{
-						CallbackObj->OnLobbyInviteRejected.ExecuteIfBound(Data->LocalUserId, Data->TargetUserId, Data->LobbyId, Data->InviteId);
+						Delegate.ExecuteIfBound(LocalUserId, TargetUserId, LobbyId, InviteId);
 					});
 				}
-			});
+			}));
 		}
 	}
 	return FEIK_NotificationId();
@@ -168,68 +194,74 @@ FEIK_NotificationId UEIK_LobbySubsystem::EIK_Lobby_AddNotifyLobbyInviteRejected(
 
 void UEIK_LobbySubsystem::EIK_Lobby_RemoveNotifyLobbyInviteRejected(FEIK_NotificationId InId)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
 			EOS_Lobby_RemoveNotifyLobbyInviteRejected(EOSRef->SessionInterfacePtr->LobbyHandle, InId.GetValueAsEosType());
 		}
 	}
+	LobbyInviteRejectedNotifications.Remove(InId.GetValueAsEosType());
 }
 
 void UEIK_LobbySubsystem::EIK_Lobby_RemoveNotifyLobbyMemberStatusReceived(FEIK_NotificationId InId)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
 			EOS_Lobby_RemoveNotifyLobbyMemberStatusReceived(EOSRef->SessionInterfacePtr->LobbyHandle, InId.GetValueAsEosType());
 		}
 	}
+	LobbyMemberStatusReceivedNotifications.Remove(InId.GetValueAsEosType());
 }
 
 void UEIK_LobbySubsystem::EIK_Lobby_RemoveNotifyLobbyMemberUpdateReceived(FEIK_NotificationId InId)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
 			EOS_Lobby_RemoveNotifyLobbyMemberUpdateReceived(EOSRef->SessionInterfacePtr->LobbyHandle, InId.GetValueAsEosType());
 		}
 	}
+	LobbyMemberUpdateReceivedNotifications.Remove(InId.GetValueAsEosType());
 }
 
 void UEIK_LobbySubsystem::EIK_Lobby_RemoveNotifyLobbyUpdateReceived(FEIK_NotificationId InId)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
 			EOS_Lobby_RemoveNotifyLobbyUpdateReceived(EOSRef->SessionInterfacePtr->LobbyHandle, InId.GetValueAsEosType());
 		}
 	}
+	LobbyUpdateReceivedNotifications.Remove(InId.GetValueAsEosType());
 }
 
 void UEIK_LobbySubsystem::EIK_Lobby_RemoveNotifyRTCRoomConnectionChanged(FEIK_NotificationId InId)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
 			EOS_Lobby_RemoveNotifyRTCRoomConnectionChanged(EOSRef->SessionInterfacePtr->LobbyHandle, InId.GetValueAsEosType());
 		}
 	}
+	RTCRoomConnectionChangedNotifications.Remove(InId.GetValueAsEosType());
 }
 
 void UEIK_LobbySubsystem::EIK_Lobby_RemoveNotifySendLobbyNativeInviteRequested(FEIK_NotificationId InId)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
 			EOS_Lobby_RemoveNotifySendLobbyNativeInviteRequested(EOSRef->SessionInterfacePtr->LobbyHandle, InId.GetValueAsEosType());
 		}
 	}
+	SendLobbyNativeInviteRequestedNotifications.Remove(InId.GetValueAsEosType());
 }
 
 void UEIK_LobbySubsystem::EIK_Lobby_Attribute_Release(const FEIK_Lobby_Attribute& Attribute)
@@ -241,7 +273,7 @@ void UEIK_LobbySubsystem::EIK_Lobby_Attribute_Release(const FEIK_Lobby_Attribute
 TEnumAsByte<EEIK_Result> UEIK_LobbySubsystem::EIK_Lobby_CopyLobbyDetailsHandle(FEIK_LobbyId LobbyId,
 	FEIK_ProductUserId LocalUserId, FEIK_HLobbyDetails& OutLobbyDetailsHandle)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -261,7 +293,7 @@ TEnumAsByte<EEIK_Result> UEIK_LobbySubsystem::EIK_Lobby_CopyLobbyDetailsHandle(F
 TEnumAsByte<EEIK_Result> UEIK_LobbySubsystem::EIK_Lobby_CopyLobbyDetailsHandleByInviteId(FString InviteId,
 	FEIK_HLobbyDetails& OutLobbyDetailsHandle)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -281,7 +313,7 @@ TEnumAsByte<EEIK_Result> UEIK_LobbySubsystem::EIK_Lobby_CopyLobbyDetailsHandleBy
 TEnumAsByte<EEIK_Result> UEIK_LobbySubsystem::EIK_Lobby_CopyLobbyDetailsHandleByUiEventId(
 	const FEIK_UI_EventId& UiEventId, FEIK_HLobbyDetails& OutLobbyDetailsHandle)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -301,7 +333,7 @@ TEnumAsByte<EEIK_Result> UEIK_LobbySubsystem::EIK_Lobby_CopyLobbyDetailsHandleBy
 TEnumAsByte<EEIK_Result> UEIK_LobbySubsystem::EIK_Lobby_CreateLobbySearch(int32 MaxResults,
 	FEIK_HLobbySearch& OutLobbySearchHandle)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -326,7 +358,7 @@ TEnumAsByte<EEIK_Result> UEIK_LobbySubsystem::EIK_Lobby_GetConnectString(FEIK_Pr
 	FEIK_LobbyId LobbyId, FString& OutConnectString)
 {
 	char Buffer[EOS_LOBBY_GETCONNECTSTRING_BUFFER_SIZE];
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -346,7 +378,7 @@ TEnumAsByte<EEIK_Result> UEIK_LobbySubsystem::EIK_Lobby_GetConnectString(FEIK_Pr
 
 int32 UEIK_LobbySubsystem::EIK_Lobby_GetInviteCount(FEIK_ProductUserId LocalUserId)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -364,7 +396,7 @@ TEnumAsByte<EEIK_Result> UEIK_LobbySubsystem::EIK_Lobby_GetInviteIdByIndex(FEIK_
 	FString& OutInviteId)
 {
 	char Buffer[256];
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -386,7 +418,7 @@ TEnumAsByte<EEIK_Result> UEIK_LobbySubsystem::EIK_Lobby_GetRTCRoomName(FEIK_Prod
 	FEIK_LobbyId LobbyId, FString& OutRTCRoomName)
 {
 	char Buffer[256];
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -407,7 +439,7 @@ TEnumAsByte<EEIK_Result> UEIK_LobbySubsystem::EIK_Lobby_GetRTCRoomName(FEIK_Prod
 TEnumAsByte<EEIK_Result> UEIK_LobbySubsystem::EIK_Lobby_IsRTCRoomConnected(FEIK_ProductUserId LocalUserId,
 	FEIK_LobbyId LobbyId, bool& bOutIsConnected)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -428,7 +460,7 @@ TEnumAsByte<EEIK_Result> UEIK_LobbySubsystem::EIK_Lobby_IsRTCRoomConnected(FEIK_
 TEnumAsByte<EEIK_Result> UEIK_LobbySubsystem::EIK_Lobby_ParseLobbyIdFromConnectString(FString ConnectString,
 	FEIK_LobbyId& OutLobbyId)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub)) {
 			EOS_Lobby_ParseConnectStringOptions Options = {};
@@ -448,7 +480,7 @@ TEnumAsByte<EEIK_Result> UEIK_LobbySubsystem::EIK_Lobby_ParseLobbyIdFromConnectS
 TEnumAsByte<EEIK_Result> UEIK_LobbySubsystem::EIK_Lobby_UpdateLobbyModification(FEIK_ProductUserId LocalUserId,
 	FEIK_LobbyId LobbyId, FEIK_HLobbyModification& OutLobbyModificationHandle)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub)) {
 			EOS_Lobby_UpdateLobbyModificationOptions Options = {};
@@ -468,7 +500,7 @@ TEnumAsByte<EEIK_Result> UEIK_LobbySubsystem::EIK_Lobby_UpdateLobbyModification(
 TEnumAsByte<EEIK_Result> UEIK_LobbySubsystem::EIK_LobbyDetails_CopyAttributeByIndex(
 	FEIK_HLobbyDetails LobbyDetailsHandle, int32 AttrIndex, FEIK_Lobby_Attribute& OutAttribute)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub)) {
 			EOS_LobbyDetails_CopyAttributeByIndexOptions Options = {};
@@ -491,7 +523,7 @@ TEnumAsByte<EEIK_Result> UEIK_LobbySubsystem::EIK_LobbyDetails_CopyAttributeByIn
 TEnumAsByte<EEIK_Result> UEIK_LobbySubsystem::EIK_LobbyDetails_CopyAttributeByKey(FEIK_HLobbyDetails LobbyDetailsHandle,
 	const FString& AttrKey, FEIK_Lobby_Attribute& OutAttribute)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub)) {
 			EOS_LobbyDetails_CopyAttributeByKeyOptions Options = {};
@@ -520,7 +552,7 @@ TEnumAsByte<EEIK_Result> UEIK_LobbySubsystem::EIK_LobbyDetails_CopyInfo(FEIK_HLo
 		return EEIK_Result::EOS_NotFound;
 	}
 	FEIK_LobbyDetailsInfo Info = {};
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub)) {
 			EOS_LobbyDetails_CopyInfoOptions Options = {};
@@ -544,7 +576,7 @@ TEnumAsByte<EEIK_Result> UEIK_LobbySubsystem::EIK_LobbyDetails_CopyMemberAttribu
 	FEIK_HLobbyDetails LobbyDetailsHandle, FEIK_ProductUserId TargetUserId, int32 AttrIndex,
 	FEIK_Lobby_Attribute& OutAttribute)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub)) {
 			EOS_LobbyDetails_CopyMemberAttributeByIndexOptions Options = {};
@@ -569,7 +601,7 @@ TEnumAsByte<EEIK_Result> UEIK_LobbySubsystem::EIK_LobbyDetails_CopyMemberAttribu
 	FEIK_HLobbyDetails LobbyDetailsHandle, FEIK_ProductUserId TargetUserId, const FString& AttrKey,
 	FEIK_Lobby_Attribute& OutAttribute)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub)) {
 			EOS_LobbyDetails_CopyMemberAttributeByKeyOptions Options = {};
@@ -594,7 +626,7 @@ TEnumAsByte<EEIK_Result> UEIK_LobbySubsystem::EIK_LobbyDetails_CopyMemberInfo(FE
 	FEIK_ProductUserId TargetUserId, FEIK_LobbyDetails_MemberInfo& OutMemberInfo)
 {
 	FEIK_LobbyDetails_MemberInfo Info = {};
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub)) {
 			EOS_LobbyDetails_CopyMemberInfoOptions Options = {};
@@ -613,7 +645,7 @@ TEnumAsByte<EEIK_Result> UEIK_LobbySubsystem::EIK_LobbyDetails_CopyMemberInfo(FE
 
 int32 UEIK_LobbySubsystem::EIK_LobbyDetails_GetAttributeCount(FEIK_HLobbyDetails LobbyDetailsHandle)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub)) {
 			EOS_LobbyDetails_GetAttributeCountOptions Options = {};
@@ -628,7 +660,7 @@ int32 UEIK_LobbySubsystem::EIK_LobbyDetails_GetAttributeCount(FEIK_HLobbyDetails
 FEIK_ProductUserId UEIK_LobbySubsystem::EIK_LobbyDetails_GetLobbyOwner(FEIK_HLobbyDetails LobbyDetailsHandle)
 {
 	EOS_ProductUserId ProductUserId = nullptr;
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub)) {
 			EOS_LobbyDetails_GetLobbyOwnerOptions Options = {};
@@ -642,7 +674,7 @@ FEIK_ProductUserId UEIK_LobbySubsystem::EIK_LobbyDetails_GetLobbyOwner(FEIK_HLob
 int32 UEIK_LobbySubsystem::EIK_LobbyDetails_GetMemberAttributeCount(FEIK_HLobbyDetails LobbyDetailsHandle,
 	FEIK_ProductUserId TargetUserId)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub)) {
 			EOS_LobbyDetails_GetMemberAttributeCountOptions Options = {};
@@ -659,7 +691,7 @@ FEIK_ProductUserId UEIK_LobbySubsystem::EIK_LobbyDetails_GetMemberByIndex(FEIK_H
 	int32 MemberIndex)
 {
 	EOS_ProductUserId ProductUserId = nullptr;
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub)) {
 			EOS_LobbyDetails_GetMemberByIndexOptions Options = {};
@@ -673,7 +705,7 @@ FEIK_ProductUserId UEIK_LobbySubsystem::EIK_LobbyDetails_GetMemberByIndex(FEIK_H
 
 int32 UEIK_LobbySubsystem::EIK_LobbyDetails_GetMemberCount(FEIK_HLobbyDetails LobbyDetailsHandle)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub)) {
 			EOS_LobbyDetails_GetMemberCountOptions Options = {};
@@ -687,7 +719,7 @@ int32 UEIK_LobbySubsystem::EIK_LobbyDetails_GetMemberCount(FEIK_HLobbyDetails Lo
 
 void UEIK_LobbySubsystem::EIK_LobbyDetails_Info_Release(FEIK_LobbyDetailsInfo& LobbyDetailsInfo)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub)) {
 			EOS_LobbyDetails_Info_Release(&LobbyDetailsInfo.Ref);
@@ -697,7 +729,7 @@ void UEIK_LobbySubsystem::EIK_LobbyDetails_Info_Release(FEIK_LobbyDetailsInfo& L
 
 void UEIK_LobbySubsystem::EIK_LobbyDetails_MemberInfo_Release(FEIK_LobbyDetails_MemberInfo& MemberInfo)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub)) {
 			EOS_LobbyDetails_MemberInfo_Release(&MemberInfo.Ref);
@@ -706,7 +738,7 @@ void UEIK_LobbySubsystem::EIK_LobbyDetails_MemberInfo_Release(FEIK_LobbyDetails_
 }
 void UEIK_LobbySubsystem::EIK_LobbyDetails_Release(FEIK_HLobbyDetails LobbyDetailsHandle)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -719,7 +751,7 @@ TEnumAsByte<EEIK_Result> UEIK_LobbySubsystem::EIK_LobbyModification_AddAttribute
 	FEIK_HLobbyModification LobbyModificationHandle, const FEIK_Lobby_AttributeData& Attribute,
 	const TEnumAsByte<EEIK_ELobbyAttributeVisibility>& Visibility)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -738,7 +770,7 @@ TEnumAsByte<EEIK_Result> UEIK_LobbySubsystem::EIK_LobbyModification_AddMemberAtt
 	FEIK_HLobbyModification LobbyModificationHandle, const FEIK_Lobby_AttributeData& Attribute,
 	const TEnumAsByte<EEIK_ELobbyAttributeVisibility>& Visibility)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -755,7 +787,7 @@ TEnumAsByte<EEIK_Result> UEIK_LobbySubsystem::EIK_LobbyModification_AddMemberAtt
 
 void UEIK_LobbySubsystem::EIK_LobbyModification_Release(FEIK_HLobbyModification LobbyModificationHandle)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -767,7 +799,7 @@ void UEIK_LobbySubsystem::EIK_LobbyModification_Release(FEIK_HLobbyModification
 TEnumAsByte<EEIK_Result> UEIK_LobbySubsystem::EIK_LobbyModification_RemoveAttribute(
 	FEIK_HLobbyModification LobbyModificationHandle, const FString& Options)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -784,7 +816,7 @@ TEnumAsByte<EEIK_Result> UEIK_LobbySubsystem::EIK_LobbyModification_RemoveAttrib
 TEnumAsByte<EEIK_Result> UEIK_LobbySubsystem::EIK_LobbyModification_RemoveMemberAttribute(
 	FEIK_HLobbyModification LobbyModificationHandle, const FString& Options)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -801,7 +833,7 @@ TEnumAsByte<EEIK_Result> UEIK_LobbySubsystem::EIK_LobbyModification_RemoveMember
 TEnumAsByte<EEIK_Result> UEIK_LobbySubsystem::EIK_LobbyModification_SetAllowedPlatformIds(
 	FEIK_HLobbyModification LobbyModificationHandle, const TArray<int32>& Options)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -829,7 +861,7 @@ TEnumAsByte<EEIK_Result> UEIK_LobbySubsystem::EIK_LobbyModification_SetAllowedPl
 TEnumAsByte<EEIK_Result> UEIK_LobbySubsystem::EIK_LobbyModification_SetBucketId(
 	FEIK_HLobbyModification LobbyModificationHandle, const FString& Options)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub)) {
 			EOS_LobbyModification_SetBucketIdOptions LocalOptions = {};
@@ -845,7 +877,7 @@ TEnumAsByte<EEIK_Result> UEIK_LobbySubsystem::EIK_LobbyModification_SetBucketId(
 TEnumAsByte<EEIK_Result> UEIK_LobbySubsystem::EIK_LobbyModification_SetInvitesAllowed(
 	FEIK_HLobbyModification LobbyModificationHandle, const bool& Options)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub)) {
 			EOS_LobbyModification_SetInvitesAllowedOptions LocalOptions = {};
@@ -861,7 +893,7 @@ TEnumAsByte<EEIK_Result> UEIK_LobbySubsystem::EIK_LobbyModification_SetInvitesAl
 TEnumAsByte<EEIK_Result> UEIK_LobbySubsystem::EIK_LobbyModification_SetMaxMembers(
 	FEIK_HLobbyModification LobbyModificationHandle, const int32& Options)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub)) {
 			EOS_LobbyModification_SetMaxMembersOptions LocalOptions = {};
@@ -877,7 +909,7 @@ TEnumAsByte<EEIK_Result> UEIK_LobbySubsystem::EIK_LobbyModification_SetMaxMember
 TEnumAsByte<EEIK_Result> UEIK_LobbySubsystem::EIK_LobbyModification_SetPermissionLevel(
 	FEIK_HLobbyModification LobbyModificationHandle, const TEnumAsByte<EEIK_ELobbyPermissionLevel>& Options)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub)) {
 			EOS_LobbyModification_SetPermissionLevelOptions LocalOptions = {};
@@ -893,7 +925,7 @@ TEnumAsByte<EEIK_Result> UEIK_LobbySubsystem::EIK_LobbyModification_SetPermissio
 TEnumAsByte<EEIK_Result> UEIK_LobbySubsystem::EIK_LobbySearch_CopySearchResultByIndex(
 	FEIK_HLobbySearch LobbySearchHandle, int32 LobbyIndex, FEIK_HLobbyDetails& OutLobbyDetailsHandle)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -912,7 +944,7 @@ TEnumAsByte<EEIK_Result> UEIK_LobbySubsystem::EIK_LobbySearch_CopySearchResultBy
 
 int32 UEIK_LobbySubsystem::EIK_LobbySearch_GetSearchResultCount(FEIK_HLobbySearch LobbySearchHandle)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -927,7 +959,7 @@ int32 UEIK_LobbySubsystem::EIK_LobbySearch_GetSearchResultCount(FEIK_HLobbySearc
 
 void UEIK_LobbySubsystem::EIK_LobbySearch_Release(FEIK_HLobbySearch LobbySearchHandle)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -940,7 +972,7 @@ void UEIK_LobbySubsystem::EIK_LobbySearch_Release(FEIK_HLobbySearch LobbySearchH
 TEnumAsByte<EEIK_Result> UEIK_LobbySubsystem::EIK_LobbySearch_RemoveParameter(FEIK_HLobbySearch LobbySearchHandle,
 	const FString& Key, const TEnumAsByte<EEIK_EComparisonOp>& ComparisonOp)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -958,7 +990,7 @@ TEnumAsByte<EEIK_Result> UEIK_LobbySubsystem::EIK_LobbySearch_RemoveParameter(FE
 TEnumAsByte<EEIK_Result> UEIK_LobbySubsystem::EIK_LobbySearch_SetLobbyId(FEIK_HLobbySearch LobbySearchHandle,
 	const FEIK_LobbyId& Options)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -975,7 +1007,7 @@ TEnumAsByte<EEIK_Result> UEIK_LobbySubsystem::EIK_LobbySearch_SetLobbyId(FEIK_HL
 TEnumAsByte<EEIK_Result> UEIK_LobbySubsystem::EIK_LobbySearch_SetMaxResults(FEIK_HLobbySearch LobbySearchHandle,
 	const int32 MaxResults)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -992,7 +1024,7 @@ TEnumAsByte<EEIK_Result> UEIK_LobbySubsystem::EIK_LobbySearch_SetMaxResults(FEIK
 TEnumAsByte<EEIK_Result> UEIK_LobbySubsystem::EIK_LobbySearch_SetParameter(FEIK_HLobbySearch LobbySearchHandle,
 	const FEIK_Lobby_AttributeData& Parameter, const TEnumAsByte<EEIK_EComparisonOp>& ComparisonOp)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -1010,7 +1042,7 @@ TEnumAsByte<EEIK_Result> UEIK_LobbySubsystem::EIK_LobbySearch_SetParameter(FEIK_
 TEnumAsByte<EEIK_Result> UEIK_LobbySubsystem::EIK_LobbySearch_SetTargetUserId(FEIK_HLobbySearch LobbySearchHandle,
 FEIK_ProductUserId Options)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -1027,23 +1059,28 @@ FEIK_ProductUserId Options)
 FEIK_NotificationId UEIK_LobbySubsystem::EIK_Lobby_AddNotifyLobbyMemberStatusReceived(
 	FEIK_Lobby_OnLobbyMemberStatusReceivedCallback Callback)
 {
-	OnLobbyMemberStatusReceived = Callback;
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
 			EOS_Lobby_AddNotifyLobbyMemberStatusReceivedOptions Options = {};
 			Options.ApiVersion = EOS_LOBBY_ADDNOTIFYLOBBYMEMBERSTATUSRECEIVED_API_LATEST;
-			return EOS_Lobby_AddNotifyLobbyMemberStatusReceived(EOSRef->SessionInterfacePtr->LobbyHandle, &Options, this, [](const EOS_Lobby_LobbyMemberStatusReceivedCallbackInfo* Data)
+			PRAGMA_DISABLE_DEPRECATION_WARNINGS
+			OnLobbyMemberStatusReceived = Callback;
+			PRAGMA_ENABLE_DEPRECATION_WARNINGS
+			TEIKNotification<FEIK_Lobby_OnLobbyMemberStatusReceivedCallback>* Entry = LobbyMemberStatusReceivedNotifications.Add(Callback);
+			return LobbyMemberStatusReceivedNotifications.Bind(Entry, EOS_Lobby_AddNotifyLobbyMemberStatusReceived(EOSRef->SessionInterfacePtr->LobbyHandle, &Options, Entry, [](const EOS_Lobby_LobbyMemberStatusReceivedCallbackInfo* Data)
 			{
-				if (UEIK_LobbySubsystem* CallbackObj = static_cast<UEIK_LobbySubsystem*>(Data->ClientData))
+				TEIKNotification<FEIK_Lobby_OnLobbyMemberStatusReceivedCallback>* Notification = static_cast<TEIKNotification<FEIK_Lobby_OnLobbyMemberStatusReceivedCallback>*>(Data->ClientData);
+				if (Notification)
 				{
-					AsyncTask(ENamedThreads::GameThread, [CallbackObj, Data]()
+					// Data only lives for the duration of the callback, so take copies before hopping to the game thread
+					AsyncTask(ENamedThreads::GameThread, [Delegate = Notification->Delegate, TargetUserId = FEIK_ProductUserId(Data->TargetUserId), LobbyId = FEIK_LobbyId(Data->LobbyId), CurrentStatus = static_cast<EEIK_ELobbyMemberStatus>(Data->CurrentStatus)]()
 					{
-						CallbackObj->OnLobbyMemberStatusReceived.ExecuteIfBound(Data->TargetUserId, Data->LobbyId, static_cast<EEIK_ELobbyMemberStatus>(Data->CurrentStatus));
+						Delegate.ExecuteIfBound(TargetUserId, LobbyId, CurrentStatus);
 					});
 				}
-			});
+			}));
 		}
 	}
 	UE_LOG(LogEIK, Error, TEXT("EIK_Lobby_AddNotifyLobbyMemberStatusReceived: OnlineSubsystemEOS is not valid"));
@@ -1053,23 +1090,28 @@ FEIK_NotificationId UEIK_LobbySubsystem::EIK_Lobby_AddNotifyLobbyMemberStatusRec
 FEIK_NotificationId UEIK_LobbySubsystem::EIK_Lobby_AddNotifyLobbyMemberUpdateReceived(
 	FEIK_Lobby_OnLobbyMemberUpdateReceivedCallback Callback)
 {
-	OnLobbyMemberUpdateReceived = Callback;
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
 			EOS_Lobby_AddNotifyLobbyMemberUpdateReceivedOptions Options = {};
 			Options.ApiVersion = EOS_LOBBY_ADDNOTIFYLOBBYMEMBERUPDATERECEIVED_API_LATEST;
-			return EOS_Lobby_AddNotifyLobbyMemberUpdateReceived(EOSRef->SessionInterfacePtr->LobbyHandle, &Options, this, [](const EOS_Lobby_LobbyMemberUpdateReceivedCallbackInfo* Data)
+			PRAGMA_DISABLE_DEPRECATION_WARNINGS
+			OnLobbyMemberUpdateReceived = Callback;
+			PRAGMA_ENABLE_DEPRECATION_WARNINGS
+			TEIKNotification<FEIK_Lobby_OnLobbyMemberUpdateReceivedCallback>* Entry = LobbyMemberUpdateReceivedNotifications.Add(Callback);
+			return LobbyMemberUpdateReceivedNotifications.Bind(Entry, EOS_Lobby_AddNotifyLobbyMemberUpdateReceived(EOSRef->SessionInterfacePtr->LobbyHandle, &Options, Entry, [](const EOS_Lobby_LobbyMemberUpdateReceivedCallbackInfo* Data)
 			{
-				if (UEIK_LobbySubsystem* CallbackObj = static_cast<UEIK_LobbySubsystem*>(Data->ClientData))
+				TEIKNotification<FEIK_Lobby_OnLobbyMemberUpdateReceivedCallback>* Notification = static_cast<TEIKNotification<FEIK_Lobby_OnLobbyMemberUpdateReceivedCallback>*>(Data->ClientData);
+				if (Notification)
 				{
-					AsyncTask(ENamedThreads::GameThread, [CallbackObj, Data]()
+					// Data only lives for the duration of the callback, so take copies before hopping to the game thread
+					AsyncTask(ENamedThreads::GameThread, [Delegate = Notification->Delegate, TargetUserId = FEIK_ProductUserId(Data->TargetUserId), LobbyId = FEIK_LobbyId(Data->LobbyId)]()
 					{
-						CallbackObj->OnLobbyMemberUpdateReceived.ExecuteIfBound(Data->TargetUserId, Data->LobbyId);
+						Delegate.ExecuteIfBound(TargetUserId, LobbyId);
 					});
 				}
-			});
+			}));
 		}
 	}
 	UE_LOG(LogEIK, Error, TEXT("EIK_Lobby_AddNotifyLobbyMemberUpdateReceived: OnlineSubsystemEOS is not valid"));
@@ -1079,23 +1121,28 @@ FEIK_NotificationId UEIK_LobbySubsystem::EIK_Lobby_AddNotifyLobbyMemberUpdateRec
 FEIK_NotificationId UEIK_LobbySubsystem::EIK_Lobby_AddNotifyLobbyUpdateReceived(
 	FEIK_Lobby_OnLobbyUpdateReceivedCallback Callback)
 {
-	OnLobbyUpdateReceived = Callback;
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
 			EOS_Lobby_AddNotifyLobbyUpdateReceivedOptions Options = {};
 			Options.ApiVersion = EOS_LOBBY_ADDNOTIFYLOBBYUPDATERECEIVED_API_LATEST;
-			return EOS_Lobby_AddNotifyLobbyUpdateReceived(EOSRef->SessionInterfacePtr->LobbyHandle, &Options, this, [](const EOS_Lobby_LobbyUpdateReceivedCallbackInfo* Data)
+			PRAGMA_DISABLE_DEPRECATION_WARNINGS
+			OnLobbyUpdateReceived = Callback;
+			PRAGMA_ENABLE_DEPRECATION_WARNINGS
+			TEIKNotification<FEIK_Lobby_OnLobbyUpdateReceivedCallback>* Entry = LobbyUpdateReceivedNotifications.Add(Callback);
+			return LobbyUpdateReceivedNotifications.Bind(Entry, EOS_Lobby_AddNotifyLobbyUpdateReceived(EOSRef->SessionInterfacePtr->LobbyHandle, &Options, Entry, [](const EOS_Lobby_LobbyUpdateReceivedCallbackInfo* Data)
 			{
-				if (UEIK_LobbySubsystem* CallbackObj = static_cast<UEIK_LobbySubsystem*>(Data->ClientData))
+				TEIKNotification<FEIK_Lobby_OnLobbyUpdateReceivedCallback>* Notification = static_cast<TEIKNotification<FEIK_Lobby_OnLobbyUpdateReceivedCallback>*>(Data->ClientData);
+				if (Notification)
 				{
-					AsyncTask(ENamedThreads::GameThread, [CallbackObj, Data]()
+					// Data only lives for the duration of the callback, so take copies before hopping to the game thread
+					AsyncTask(ENamedThreads::GameThread, [Delegate = Notification->Delegate, LobbyId = FEIK_LobbyId(Data->LobbyId)]()
 					{
-						CallbackObj->OnLobbyUpdateReceived.ExecuteIfBound(Data->LobbyId);
+						Delegate.ExecuteIfBound(LobbyId);
 					});
 				}
-			});
+			}));
 		}
 	}
 	UE_LOG(LogEIK, Error, TEXT("EIK_Lobby_AddNotifyLobbyUpdateReceived: OnlineSubsystemEOS is not valid"));
@@ -1104,24 +1151,28 @@ FEIK_NotificationId UEIK_LobbySubsystem::EIK_Lobby_AddNotifyLobbyUpdateReceived(
 
 FEIK_NotificationId UEIK_LobbySubsystem::EIK_Lobby_AddNotifyRTCRoomConnectionChanged(FEIK_Lobby_OnRTCRoomConnectionChangedCallback Callback)
 {
-	OnRTCRoomConnectionChanged = Callback;
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
 			EOS_Lobby_AddNotifyRTCRoomConnectionChangedOptions Options = {};
 			Options.ApiVersion = EOS_LOBBY_ADDNOTIFYRTCROOMCONNECTIONCHANGED_API_LATEST;
-			return EOS_Lobby_AddNotifyRTCRoomConnectionChanged(EOSRef->SessionInterfacePtr->LobbyHandle, &Options, this, [](const EOS_Lobby_RTCRoomConnectionChangedCallbackInfo* Data)
+			PRAGMA_DISABLE_DEPRECATION_WARNINGS
+			OnRTCRoomConnectionChanged = Callback;
+			PRAGMA_ENABLE_DEPRECATION_WARNINGS
+			TEIKNotification<FEIK_Lobby_OnRTCRoomConnectionChangedCallback>* Entry = RTCRoomConnectionChangedNotifications.Add(Callback);
+			return RTCRoomConnectionChangedNotifications.Bind(Entry, EOS_Lobby_AddNotifyRTCRoomConnectionChanged(EOSRef->SessionInterfacePtr->LobbyHandle, &Options, Entry, [](const EOS_Lobby_RTCRoomConnectionChangedCallbackInfo* Data)
 			{
-				if (UEIK_LobbySubsystem* CallbackObj = static_cast<UEIK_LobbySubsystem*>(Data->ClientData))
+				TEIKNotification<FEIK_Lobby_OnRTCRoomConnectionChangedCallback>* Notification = static_cast<TEIKNotification<FEIK_Lobby_OnRTCRoomConnectionChangedCallback>*>(Data->ClientData);
+				if (Notification)
 				{
-					AsyncTask(ENamedThreads::GameThread, [CallbackObj, Data]()
+					// Data only lives for the duration of the callback, so take copies before hopping to the game thread
+					AsyncTask(ENamedThreads::GameThread, [Delegate = Notification->Delegate, LobbyId = FEIK_LobbyId(Data->LobbyId), LocalUserId = FEIK_ProductUserId(Data->LocalUserId), bIsConnected = Data->bIsConnected == EOS_TRUE, DisconnectReason = static_cast<EEIK_Result>(Data->DisconnectReason)]()
 					{
-						bool bResult = true;
-						CallbackObj->OnRTCRoomConnectionChanged.ExecuteIfBound(Data->LobbyId, Data->LocalUserId, bResult, static_cast<EEIK_Result>(Data->DisconnectReason));
+						Delegate.ExecuteIfBound(LobbyId, LocalUserId, bIsConnected, DisconnectReason);
 					});
 				}
-			});
+			}));
 		}
 	}
 	UE_LOG(LogEIK, Error, TEXT("EIK_Lobby_AddNotifyRTCRoomConnectionChanged: OnlineSubsystemEOS is not valid"));
@@ -1131,23 +1182,28 @@ FEIK_NotificationId UEIK_LobbySubsystem::EIK_Lobby_AddNotifyRTCRoomConnectionCha
 FEIK_NotificationId UEIK_LobbySubsystem::EIK_Lobby_AddNotifySendLobbyNativeInviteRequested(
 	FEIK_Lobby_OnSendLobbyNativeInviteCallback Callback)
 {
-	OnSendLobbyNativeInvite = Callback;
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
 			EOS_Lobby_AddNotifySendLobbyNativeInviteRequestedOptions Options = {};
 			Options.ApiVersion = EOS_LOBBY_ADDNOTIFYSENDLOBBYNATIVEINVITEREQUESTED_API_LATEST;
-			return EOS_Lobby_AddNotifySendLobbyNativeInviteRequested(EOSRef->SessionInterfacePtr->LobbyHandle, &Options, this, [](const EOS_Lobby_SendLobbyNativeInviteRequestedCallbackInfo* Data)
+			PRAGMA_DISABLE_DEPRECATION_WARNINGS
+			OnSendLobbyNativeInvite = Callback;
+			PRAGMA_ENABLE_DEPRECATION_WARNINGS
+			TEIKNotification<FEIK_Lobby_OnSendLobbyNativeInviteCallback>* Entry = SendLobbyNativeInviteRequestedNotifications.Add(Callback);
+			return SendLobbyNativeInviteRequestedNotifications.Bind(Entry, EOS_Lobby_AddNotifySendLobbyNativeInviteRequested(EOSRef->SessionInterfacePtr->LobbyHandle, &Options, Entry, [](const EOS_Lobby_SendLobbyNativeInviteRequestedCallbackInfo* Data)
 			{
-				if (UEIK_LobbySubsystem* CallbackObj = static_cast<UEIK_LobbySubsystem*>(Data->ClientData))
+				TEIKNotification<FEIK_Lobby_OnSendLobbyNativeInviteCallback>* Notification = static_cast<TEIKNotification<FEIK_Lobby_OnSendLobbyNativeInviteCallback>*>(Data->ClientData);
+				if (Notification)
 				{
-					AsyncTask(ENamedThreads::GameThread, [CallbackObj, Data]()
+					// Data only lives for the duration of the callback, so take copies before hopping to the game thread
+					AsyncTask(ENamedThreads::GameThread, [Delegate = Notification->Delegate, UiEventId = FEIK_UI_EventId(Data->UiEventId), LocalUserId = FEIK_ProductUserId(Data->LocalUserId), TargetNativeAccountType = FString(UTF8_TO_TCHAR(Data->TargetNativeAccountType)), TargetUserNativeAccountId = FString(UTF8_TO_TCHAR(Data->TargetUserNativeAccountId)), LobbyId = FEIK_LobbyId(Data->LobbyId)]()
 					{
-						CallbackObj->OnSendLobbyNativeInvite.ExecuteIfBound(Data->UiEventId, Data->LocalUserId, Data->TargetUserNativeAccountId, Data->TargetNativeAccountType, Data->LobbyId);
+						Delegate.ExecuteIfBound(UiEventId, LocalUserId, TargetNativeAccountType, TargetUserNativeAccountId, LobbyId);
 					});
 				}
-			});
+			}));
 		}
 	}
 	UE_LOG(LogEIK, Error, TEXT("EIK_Lobby_AddNotifySendLobbyNativeInviteRequested: OnlineSubsystemEOS is not valid"));
@@ -1156,110 +1212,335 @@ FEIK_NotificationId UEIK_LobbySubsystem::EIK_Lobby_AddNotifySendLobbyNativeInvit
 
 TEnumAsByte<EEIK_Result> UEIK_LobbySubsystem::EIK_Lobby_SetMemberData(FEIK_LobbyId LobbyId, FString Key, FString Value)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	return QueueLobbyAttributeWrite(LobbyId, Key, Value, true);
+}
+
+TEnumAsByte<EEIK_Result> UEIK_LobbySubsystem::EIK_Lobby_SetLobbyData(FEIK_LobbyId LobbyId, FString Key, FString Value)
+{
+	return QueueLobbyAttributeWrite(LobbyId, Key, Value, false);
+}
+
+EEIK_Result UEIK_LobbySubsystem::QueueLobbyAttributeWrite(const FEIK_LobbyId& LobbyId, const FString& Key, const FString& Value, bool bMemberAttribute, const FEIK_Lobby_OnAttributesWritten& OnComplete)
+{
+	if (LobbyId.Value.IsEmpty() || Key.IsEmpty())
 	{
-		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
-		{
-			// Get the local user ID
-			EOS_ProductUserId LocalUserIdEOS = EOSRef->UserManager->GetLocalProductUserId();
-			if (!LocalUserIdEOS)
-			{
-				UE_LOG(LogEIK, Error, TEXT("EIK_Lobby_SetMemberData: Failed to get local product user ID"));
-				return EEIK_Result::EOS_InvalidUser;
-			}
-			FEIK_ProductUserId LocalUserId(LocalUserIdEOS);
+		UE_LOG(LogEIK, Error, TEXT("QueueLobbyAttributeWrite: LobbyId and Key must not be empty"));
+		OnComplete.ExecuteIfBound(EEIK_Result::EOS_InvalidParameters);
+		return EEIK_Result::EOS_InvalidParameters;
+	}
 
-			// Step 1: Create lobby modification handle
-			FEIK_HLobbyModification ModificationHandle;
-			TEnumAsByte<EEIK_Result> ModResult = EIK_Lobby_UpdateLobbyModification(LocalUserId, LobbyId, ModificationHandle);
+	FLobbyAttributeWriter& Writer = LobbyAttributeWriters.FindOrAdd(LobbyId.Value);
+	if (!Writer.HasPendingWrites())
+	{
+		Writer.FirstQueuedSeconds = FPlatformTime::Seconds();
+	}
+	(bMemberAttribute ? Writer.MemberAttributes : Writer.LobbyAttributes).Add(Key, Value);
+	if (OnComplete.IsBound())
+	{
+		Writer.Callbacks.Add(OnComplete);
+	}
 
-			if (ModResult != EEIK_Result::EOS_Success)
-			{
-				UE_LOG(LogEIK, Error, TEXT("EIK_Lobby_SetMemberData: Failed to create lobby modification handle. Error: %d"), static_cast<int32>(ModResult.GetValue()));
-				return ModResult;
-			}
+	if (!AttributeWriterTickerHandle.IsValid())
+	{
+#if ENGINE_MAJOR_VERSION == 5
+		AttributeWriterTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UEIK_LobbySubsystem::TickAttributeWriters));
+#else
+		AttributeWriterTickerHandle = FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UEIK_LobbySubsystem::TickAttributeWriters));
+#endif
+	}
+	return EEIK_Result::EOS_Success;
+}
+
+void UEIK_LobbySubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+	const FEOSSettings Settings = UEIKSettings::GetSettings();
+	AttributeWriteCoalesceSeconds = FMath::Max(Settings.LobbyAttributeWriteCoalesceSeconds, 0.0f);
+	MinLobbyUpdateIntervalSeconds = FMath::Max(Settings.MinLobbyUpdateIntervalSeconds, 0.0f);
+}
+
+void UEIK_LobbySubsystem::Deinitialize()
+{
+	if (AttributeWriterTickerHandle.IsValid())
+	{
+#if ENGINE_MAJOR_VERSION == 5
+		FTSTicker::GetCoreTicker().RemoveTicker(AttributeWriterTickerHandle);
+#else
+		FTicker::GetCoreTicker().RemoveTicker(AttributeWriterTickerHandle);
+#endif
+		AttributeWriterTickerHandle.Reset();
+	}
 
-			// Step 2: Create attribute data
-			FEIK_Lobby_AttributeData AttributeData;
-			AttributeData.Key = Key;
-			AttributeData.ValueAsString = Value;
-			AttributeData.ValueType = EEIK_EAttributeType::EIK_AT_STRING;
+	TMap<FString, FLobbyAttributeWriter> Writers = MoveTemp(LobbyAttributeWriters);
+	LobbyAttributeWriters.Reset();
+	for (TPair<FString, FLobbyAttributeWriter>& Entry : Writers)
+	{
+		CompleteAttributeWrites(Entry.Value.Callbacks, EEIK_Result::EOS_Canceled);
+		CompleteAttributeWrites(Entry.Value.InFlightCallbacks, EEIK_Result::EOS_Canceled);
+	}
 
-			// Convert to EOS types
-			EOS_Lobby_AttributeData EOSAttributeData = {};
-			EOSAttributeData.ApiVersion = EOS_LOBBY_ATTRIBUTEDATA_API_LATEST;
-			EOSAttributeData.Key = TCHAR_TO_UTF8(*Key);
-			EOSAttributeData.Value.AsUtf8 = TCHAR_TO_UTF8(*Value);
-			EOSAttributeData.ValueType = EOS_ELobbyAttributeType::EOS_AT_STRING;
-			AttributeData.Ref = EOSAttributeData;
+	// The SDK would otherwise keep calling into entries that are destroyed along with the subsystem
+	for (const EOS_NotificationId NotificationId : JoinLobbyAcceptedNotifications.GetNotificationIds())
+	{
+		EIK_Lobby_RemoveNotifyJoinLobbyAccepted(NotificationId);
+	}
+	for (const EOS_NotificationId NotificationId : LeaveLobbyRequestedNotifications.GetNotificationIds())
+	{
+		EIK_Lobby_RemoveNotifyLeaveLobbyRequested(NotificationId);
+	}
+	for (const EOS_NotificationId NotificationId : LobbyInviteAcceptedNotifications.GetNotificationIds())
+	{
+		EIK_Lobby_RemoveNotifyLobbyInviteAccepted(NotificationId);
+	}
+	for (const EOS_NotificationId NotificationId : LobbyInviteReceivedNotifications.GetNotificationIds())
+	{
+		EIK_Lobby_RemoveNotifyLobbyInviteReceived(NotificationId);
+	}
+	for (const EOS_NotificationId NotificationId : LobbyInviteRejectedNotifications.GetNotificationIds())
+	{
+		EIK_Lobby_RemoveNotifyLobbyInviteRejected(NotificationId);
+	}
+	for (const EOS_NotificationId NotificationId : LobbyMemberStatusReceivedNotifications.GetNotificationIds())
+	{
+		EIK_Lobby_RemoveNotifyLobbyMemberStatusReceived(NotificationId);
+	}
+	for (const EOS_NotificationId NotificationId : LobbyMemberUpdateReceivedNotifications.GetNotificationIds())
+	{
+		EIK_Lobby_RemoveNotifyLobbyMemberUpdateReceived(NotificationId);
+	}
+	for (const EOS_NotificationId NotificationId : LobbyUpdateReceivedNotifications.GetNotificationIds())
+	{
+		EIK_Lobby_RemoveNotifyLobbyUpdateReceived(NotificationId);
+	}
+	for (const EOS_NotificationId NotificationId : RTCRoomConnectionChangedNotifications.GetNotificationIds())
+	{
+		EIK_Lobby_RemoveNotifyRTCRoomConnectionChanged(NotificationId);
+	}
+	for (const EOS_NotificationId NotificationId : SendLobbyNativeInviteRequestedNotifications.GetNotificationIds())
+	{
+		EIK_Lobby_RemoveNotifySendLobbyNativeInviteRequested(NotificationId);
+	}
 
-			// Step 3: Add member attribute to modification
-			TEnumAsByte<EEIK_Result> AddResult = EIK_LobbyModification_AddMemberAttribute(ModificationHandle, AttributeData, EEIK_ELobbyAttributeVisibility::EIK_LAV_Public);
+	Super::Deinitialize();
+}
 
-			if (AddResult != EEIK_Result::EOS_Success)
+bool UEIK_LobbySubsystem::TickAttributeWriters(float DeltaTime)
+{
+	const double NowSeconds = FPlatformTime::Seconds();
+	// Failed flushes are completed after the loop, their callbacks may queue more writes
+	TArray<TPair<TArray<FEIK_Lobby_OnAttributesWritten>, EEIK_Result>> FailedWrites;
+	for (auto It = LobbyAttributeWriters.CreateIterator(); It; ++It)
+	{
+		FLobbyAttributeWriter& Writer = It.Value();
+		if (Writer.bInFlight)
+		{
+			continue;
+		}
+		if (!Writer.HasPendingWrites())
+		{
+			It.RemoveCurrent();
+			continue;
+		}
+		if (NowSeconds >= Writer.FirstQueuedSeconds + AttributeWriteCoalesceSeconds && NowSeconds >= Writer.NextUpdateAllowedSeconds)
+		{
+			const EEIK_Result Result = FlushAttributeWriter(It.Key(), Writer);
+			if (Result != EEIK_Result::EOS_Success)
 			{
-				UE_LOG(LogEIK, Error, TEXT("EIK_Lobby_SetMemberData: Failed to add member attribute. Error: %d"), static_cast<int32>(AddResult.GetValue()));
-				EIK_LobbyModification_Release(ModificationHandle);
-				return AddResult;
+				FailedWrites.Emplace(MoveTemp(Writer.InFlightCallbacks), Result);
+				Writer.InFlightCallbacks.Reset();
+				Writer.InFlightMemberAttributes.Reset();
+				Writer.InFlightLobbyAttributes.Reset();
 			}
+		}
+	}
 
-			// Step 4: Apply the modification (synchronous - this will block)
-			EOS_Lobby_UpdateLobbyOptions Options = {};
-			Options.ApiVersion = EOS_LOBBY_UPDATELOBBY_API_LATEST;
-			Options.LobbyModificationHandle = *ModificationHandle.Ref;
+	for (TPair<TArray<FEIK_Lobby_OnAttributesWritten>, EEIK_Result>& FailedWrite : FailedWrites)
+	{
+		CompleteAttributeWrites(FailedWrite.Key, FailedWrite.Value);
+	}
 
-			// Use a simple blocking approach with a completion flag
-			struct FUpdateContext
-			{
-				bool bCompleted = false;
-				EOS_EResult Result = EOS_EResult::EOS_UnexpectedError;
-			};
+	if (LobbyAttributeWriters.Num() == 0)
+	{
+		AttributeWriterTickerHandle.Reset();
+		return false;
+	}
+	return true;
+}
 
-			FUpdateContext Context;
+EEIK_Result UEIK_LobbySubsystem::FlushAttributeWriter(const FString& LobbyId, FLobbyAttributeWriter& Writer)
+{
+	Writer.InFlightMemberAttributes = MoveTemp(Writer.MemberAttributes);
+	Writer.InFlightLobbyAttributes = MoveTemp(Writer.LobbyAttributes);
+	Writer.InFlightCallbacks = MoveTemp(Writer.Callbacks);
+	Writer.MemberAttributes.Reset();
+	Writer.LobbyAttributes.Reset();
+	Writer.Callbacks.Reset();
+	Writer.NextUpdateAllowedSeconds = FPlatformTime::Seconds() + MinLobbyUpdateIntervalSeconds;
 
-			EOS_Lobby_UpdateLobby(EOSRef->SessionInterfacePtr->LobbyHandle, &Options, &Context,
-				[](const EOS_Lobby_UpdateLobbyCallbackInfo* Data)
-				{
-					FUpdateContext* UpdateContext = static_cast<FUpdateContext*>(Data->ClientData);
-					UpdateContext->Result = Data->ResultCode;
-					UpdateContext->bCompleted = true;
-				});
+	EEIK_Result Result = EEIK_Result::EOS_NotFound;
+	FOnlineSubsystemEOS* EOSRef = FOnlineSubsystemEOS::GetDefaultInstance();
+	if (!EOSRef)
+	{
+		UE_LOG(LogEIK, Error, TEXT("FlushAttributeWriter: OnlineSubsystemEOS is not valid"));
+		return Result;
+	}
 
-			// Wait for completion (with timeout)
-			double StartTime = FPlatformTime::Seconds();
-			const double TimeoutSeconds = 10.0;
+	const EOS_ProductUserId LocalUserId = EOSRef->UserManager->GetLocalProductUserId();
+	if (!LocalUserId)
+	{
+		UE_LOG(LogEIK, Error, TEXT("FlushAttributeWriter: Failed to get local product user ID"));
+		return EEIK_Result::EOS_InvalidUser;
+	}
 
-			while (!Context.bCompleted && (FPlatformTime::Seconds() - StartTime) < TimeoutSeconds)
+	const FTCHARToUTF8 Utf8LobbyId(*LobbyId);
+	EOS_Lobby_UpdateLobbyModificationOptions ModificationOptions = {};
+	ModificationOptions.ApiVersion = EOS_LOBBY_UPDATELOBBYMODIFICATION_API_LATEST;
+	ModificationOptions.LocalUserId = LocalUserId;
+	ModificationOptions.LobbyId = Utf8LobbyId.Get();
+	EOS_HLobbyModification ModificationHandle = nullptr;
+	Result = static_cast<EEIK_Result>(EOS_Lobby_UpdateLobbyModification(EOSRef->SessionInterfacePtr->LobbyHandle, &ModificationOptions, &ModificationHandle));
+	if (Result != EEIK_Result::EOS_Success)
+	{
+		UE_LOG(LogEIK, Error, TEXT("FlushAttributeWriter: Failed to create lobby modification handle for lobby %s. Error: %d"), *LobbyId, static_cast<int32>(Result));
+		return Result;
+	}
+
+	auto AddAttributes = [&ModificationHandle, &Result](const TMap<FString, FString>& Attributes, bool bMemberAttribute)
+	{
+		for (const TPair<FString, FString>& Attribute : Attributes)
+		{
+			if (Result != EEIK_Result::EOS_Success)
+			{
+				return;
+			}
+			const FTCHARToUTF8 Utf8Key(*Attribute.Key);
+			const FTCHARToUTF8 Utf8Value(*Attribute.Value);
+			EOS_Lobby_AttributeData AttributeData = {};
+			AttributeData.ApiVersion = EOS_LOBBY_ATTRIBUTEDATA_API_LATEST;
+			AttributeData.Key = Utf8Key.Get();
+			AttributeData.Value.AsUtf8 = Utf8Value.Get();
+			AttributeData.ValueType = EOS_ELobbyAttributeType::EOS_AT_STRING;
+			if (bMemberAttribute)
+			{
+				EOS_LobbyModification_AddMemberAttributeOptions Options = {};
+				Options.ApiVersion = EOS_LOBBYMODIFICATION_ADDMEMBERATTRIBUTE_API_LATEST;
+				Options.Attribute = &AttributeData;
+				Options.Visibility = EOS_ELobbyAttributeVisibility::EOS_LAT_PUBLIC;
+				Result = static_cast<EEIK_Result>(EOS_LobbyModification_AddMemberAttribute(ModificationHandle, &Options));
+			}
+			else
+			{
+				EOS_LobbyModification_AddAttributeOptions Options = {};
+				Options.ApiVersion = EOS_LOBBYMODIFICATION_ADDATTRIBUTE_API_LATEST;
+				Options.Attribute = &AttributeData;
+				Options.Visibility = EOS_ELobbyAttributeVisibility::EOS_LAT_PUBLIC;
+				Result = static_cast<EEIK_Result>(EOS_LobbyModification_AddAttribute(ModificationHandle, &Options));
+			}
+			if (Result != EEIK_Result::EOS_Success)
 			{
-				FPlatformProcess::Sleep(0.01f);
+				UE_LOG(LogEIK, Error, TEXT("FlushAttributeWriter: Failed to add attribute %s. Error: %d"), *Attribute.Key, static_cast<int32>(Result));
 			}
+		}
+	};
+	AddAttributes(Writer.InFlightMemberAttributes, true);
+	AddAttributes(Writer.InFlightLobbyAttributes, false);
+	if (Result != EEIK_Result::EOS_Success)
+	{
+		EOS_LobbyModification_Release(ModificationHandle);
+		return Result;
+	}
 
-			// Cleanup
-			EIK_LobbyModification_Release(ModificationHandle);
+	struct FUpdateContext
+	{
+		TWeakObjectPtr<UEIK_LobbySubsystem> Subsystem;
+		FString LobbyId;
 
-			if (!Context.bCompleted)
+		static void Complete(void* ClientData, EOS_EResult ResultCode)
+		{
+			FUpdateContext* Context = static_cast<FUpdateContext*>(ClientData);
+			FEIKSDKActivity::RemovePendingRequest();
+			if (UEIK_LobbySubsystem* Subsystem = Context->Subsystem.Get())
 			{
-				UE_LOG(LogEIK, Error, TEXT("EIK_Lobby_SetMemberData: Update lobby timed out"));
-				return EEIK_Result::EOS_TimedOut;
+				Subsystem->OnAttributeWriteComplete(Context->LobbyId, static_cast<EEIK_Result>(ResultCode));
 			}
+			delete Context;
+		}
+	};
 
-			if (Context.Result != EOS_EResult::EOS_Success)
+	EOS_Lobby_UpdateLobbyOptions UpdateOptions = {};
+	UpdateOptions.ApiVersion = EOS_LOBBY_UPDATELOBBY_API_LATEST;
+	UpdateOptions.LobbyModificationHandle = ModificationHandle;
+	Writer.bInFlight = true;
+	FEIKSDKActivity::AddPendingRequest();
+	EOS_Lobby_UpdateLobby(EOSRef->SessionInterfacePtr->LobbyHandle, &UpdateOptions, new FUpdateContext{ this, LobbyId },
+		[](const EOS_Lobby_UpdateLobbyCallbackInfo* Data)
+		{
+			FUpdateContext::Complete(Data->ClientData, Data->ResultCode);
+		});
+	EOS_LobbyModification_Release(ModificationHandle);
+	return EEIK_Result::EOS_Success;
+}
+
+void UEIK_LobbySubsystem::OnAttributeWriteComplete(const FString& LobbyId, EEIK_Result Result)
+{
+	FLobbyAttributeWriter* Writer = LobbyAttributeWriters.Find(LobbyId);
+	if (!Writer)
+	{
+		return;
+	}
+	Writer->bInFlight = false;
+
+	if (Result == EEIK_Result::EOS_TooManyRequests)
+	{
+		// Rate limited, merge the update back under the newer writes and try again after a longer wait
+		UE_LOG(LogEIK, Warning, TEXT("OnAttributeWriteComplete: Lobby %s update was rate limited, retrying"), *LobbyId);
+		for (const TPair<FString, FString>& Attribute : Writer->InFlightMemberAttributes)
+		{
+			if (!Writer->MemberAttributes.Contains(Attribute.Key))
 			{
-				UE_LOG(LogEIK, Error, TEXT("EIK_Lobby_SetMemberData: Update lobby failed. Error: %d"), static_cast<int32>(Context.Result));
+				Writer->MemberAttributes.Add(Attribute.Key, Attribute.Value);
 			}
+		}
+		for (const TPair<FString, FString>& Attribute : Writer->InFlightLobbyAttributes)
+		{
+			if (!Writer->LobbyAttributes.Contains(Attribute.Key))
+			{
+				Writer->LobbyAttributes.Add(Attribute.Key, Attribute.Value);
+			}
+		}
+		Writer->Callbacks.Append(MoveTemp(Writer->InFlightCallbacks));
+		Writer->InFlightCallbacks.Reset();
+		Writer->FirstQueuedSeconds = 0.0;
+		Writer->NextUpdateAllowedSeconds = FPlatformTime::Seconds() + MinLobbyUpdateIntervalSeconds * 2.0;
+	}
+	Writer->InFlightMemberAttributes.Reset();
+	Writer->InFlightLobbyAttributes.Reset();
 
-			return static_cast<EEIK_Result>(Context.Result);
+	if (Result != EEIK_Result::EOS_TooManyRequests)
+	{
+		if (Result != EEIK_Result::EOS_Success)
+		{
+			UE_LOG(LogEIK, Error, TEXT("OnAttributeWriteComplete: Lobby %s update failed. Error: %d"), *LobbyId, static_cast<int32>(Result));
 		}
+		// Writer may not survive the callbacks queueing more writes
+		CompleteAttributeWrites(Writer->InFlightCallbacks, Result);
 	}
+}
 
-	UE_LOG(LogEIK, Error, TEXT("EIK_Lobby_SetMemberData: OnlineSubsystemEOS is not valid"));
-	return EEIK_Result::EOS_NotFound;
+void UEIK_LobbySubsystem::CompleteAttributeWrites(TArray<FEIK_Lobby_OnAttributesWritten>& Callbacks, EEIK_Result Result)
+{
+	TArray<FEIK_Lobby_OnAttributesWritten> CallbacksToFire = MoveTemp(Callbacks);
+	Callbacks.Reset();
+	for (const FEIK_Lobby_OnAttributesWritten& Callback : CallbacksToFire)
+	{
+		Callback.ExecuteIfBound(Result);
+	}
 }
 
 TEnumAsByte<EEIK_Result> UEIK_LobbySubsystem::EIK_Lobby_GetMemberData(FEIK_LobbyId LobbyId,
 	FEIK_ProductUserId TargetUserId, FString Key, FString& OutValue)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -3,7 +3,10 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Runtime/Launch/Resources/Version.h"
 #include "OnlineSubsystemEIK/SdkFunctions/EIK_SharedFunctionFile.h"
+#include "OnlineSubsystemEIK/SdkFunctions/EIK_NotificationRegistry.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "EIK_LobbySubsystem.generated.h"
 
@@ -17,6 +20,7 @@ DECLARE_DYNAMIC_DELEGATE_TwoParams(FEIK_Lobby_OnLobbyMemberUpdateReceivedCallbac
 DECLARE_DYNAMIC_DELEGATE_OneParam(FEIK_Lobby_OnLobbyUpdateReceivedCallback, const FEIK_LobbyId&, LobbyId);
 DECLARE_DYNAMIC_DELEGATE_FourParams(FEIK_Lobby_OnRTCRoomConnectionChangedCallback, const FEIK_LobbyId&, LobbyId, const FEIK_ProductUserId&, LocalUserId, bool, bIsConnected, const TEnumAsByte<EEIK_Result>&, DisconnectReason);
 DECLARE_DYNAMIC_DELEGATE_FiveParams(FEIK_Lobby_OnSendLobbyNativeInviteCallback, FEIK_UI_EventId, UiEventId, FEIK_ProductUserId, LocalUserId, const FString&, TargetNativeAccountType, const FString&, TargetUserNativeAccountId, const FEIK_LobbyId&, LobbyId);
+DECLARE_DELEGATE_OneParam(FEIK_Lobby_OnAttributesWritten, EEIK_Result /*Result*/);
 
 UCLASS(DisplayName="Lobby Interface", meta=(DisplayName="Lobby Interface"))
 class ONLINESUBSYSTEMEIK_API UEIK_LobbySubsystem : public UGameInstanceSubsystem
@@ -24,7 +28,6 @@ class ONLINESUBSYSTEMEIK_API UEIK_LobbySubsystem : public UGameInstanceSubsystem
 	GENERATED_BODY()
 
 public:
-	FEIK_Lobby_OnJoinLobbyAcceptedCallback OnJoinLobbyAccepted;
 	//Register to receive notifications about lobby "JOIN" performed by local user (when no invite) via the overlay.
 	UFUNCTION(BlueprintCallable, Category = "EOS Integration Kit | SDK Functions | Lobby Interface", DisplayName="EOS_Lobby_AddNotifyJoinLobbyAccepted")
 	FEIK_NotificationId EIK_Lobby_AddNotifyJoinLobbyAccepted(FEIK_Lobby_OnJoinLobbyAcceptedCallback Callback);
@@ -34,7 +37,6 @@ public:
 	void EIK_Lobby_RemoveNotifyJoinLobbyAccepted(FEIK_NotificationId InId);
 
 
-	FEIK_Lobby_OnLeaveLobbyRequestedCallback OnLeaveLobbyRequested;
 	//Register to receive notifications about leave lobby requests performed by the local user via the overlay. When user requests to leave the lobby in the social overlay, the SDK does not automatically leave the lobby, it is up to the game to perform any necessary cleanup and call the EOS_Lobby_LeaveLobby method using the lobbyId sent in the notification function.
 	UFUNCTION(BlueprintCallable, Category = "EOS Integration Kit | SDK Functions | Lobby Interface", DisplayName="EOS_Lobby_AddNotifyLeaveLobbyRequested")
 	FEIK_NotificationId EIK_Lobby_AddNotifyLeaveLobbyRequested(FEIK_Lobby_OnLeaveLobbyRequestedCallback Callback);
@@ -43,7 +45,6 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "EOS Integration Kit | SDK Functions | Lobby Interface", DisplayName="EOS_Lobby_RemoveNotifyLeaveLobbyRequested")
 	void EIK_Lobby_RemoveNotifyLeaveLobbyRequested(FEIK_NotificationId InId);
 	
-	FEIK_Lobby_OnLobbyInviteAcceptedCallback OnLobbyInviteAccepted;
 	//Register to receive notifications about lobby invites accepted by local user via the overlay.
 	UFUNCTION(BlueprintCallable, Category = "EOS Integration Kit | SDK Functions | Lobby Interface", DisplayName="EOS_Lobby_AddNotifyLobbyInviteAccepted")
 	FEIK_NotificationId EIK_Lobby_AddNotifyLobbyInviteAccepted(FEIK_Lobby_OnLobbyInviteAcceptedCallback Callback);
@@ -53,7 +54,6 @@ public:
 	void EIK_Lobby_RemoveNotifyLobbyInviteAccepted(FEIK_NotificationId InId);
 
 	
-	FEIK_Lobby_OnLobbyInviteReceivedCallback OnLobbyInviteReceived;
 	//Register to receive notifications about lobby invites sent to local users.
 	UFUNCTION(BlueprintCallable, Category = "EOS Integration Kit | SDK Functions | Lobby Interface", DisplayName="EOS_Lobby_AddNotifyLobbyInviteReceived")
 	FEIK_NotificationId EIK_Lobby_AddNotifyLobbyInviteReceived(FEIK_Lobby_OnLobbyInviteReceivedCallback Callback);
@@ -64,7 +64,6 @@ public:
 
 
 	
-	FEIK_Lobby_OnLobbyInviteRejectedCallback OnLobbyInviteRejected;
 	//Register to receive notifications about lobby invites rejected by local user.
 	UFUNCTION(BlueprintCallable, Category = "EOS Integration Kit | SDK Functions | Lobby Interface", DisplayName="EOS_Lobby_AddNotifyLobbyInviteRejected")
 	FEIK_NotificationId EIK_Lobby_AddNotifyLobbyInviteRejected(FEIK_Lobby_OnLobbyInviteRejectedCallback Callback);
@@ -75,7 +74,6 @@ public:
 
 	
 	
-	FEIK_Lobby_OnLobbyMemberStatusReceivedCallback OnLobbyMemberStatusReceived;
 	//Register to receive notifications about the changing status of lobby members.
 	UFUNCTION(BlueprintCallable, Category = "EOS Integration Kit | SDK Functions | Lobby Interface", DisplayName="EOS_Lobby_AddNotifyLobbyMemberStatusReceived")
 	FEIK_NotificationId EIK_Lobby_AddNotifyLobbyMemberStatusReceived(FEIK_Lobby_OnLobbyMemberStatusReceivedCallback Callback);
@@ -86,7 +84,6 @@ public:
 
 	
 
-	FEIK_Lobby_OnLobbyMemberUpdateReceivedCallback OnLobbyMemberUpdateReceived;
 	//Register to receive notifications when a lobby member updates the attributes associated with themselves inside the lobby.
 	UFUNCTION(BlueprintCallable, Category = "EOS Integration Kit | SDK Functions | Lobby Interface", DisplayName="EOS_Lobby_AddNotifyLobbyMemberUpdateReceived")
 	FEIK_NotificationId EIK_Lobby_AddNotifyLobbyMemberUpdateReceived(FEIK_Lobby_OnLobbyMemberUpdateReceivedCallback Callback);
@@ -97,7 +94,6 @@ public:
 
 	
 	
-	FEIK_Lobby_OnLobbyUpdateReceivedCallback OnLobbyUpdateReceived;
 	//Register to receive notifications when a lobby owner updates the attributes associated with the lobby.
 	UFUNCTION(BlueprintCallable, Category = "EOS Integration Kit | SDK Functions | Lobby Interface", DisplayName="EOS_Lobby_AddNotifyLobbyUpdateReceived")
 	FEIK_NotificationId EIK_Lobby_AddNotifyLobbyUpdateReceived(FEIK_Lobby_OnLobbyUpdateReceivedCallback Callback);
@@ -108,7 +104,6 @@ public:
 
 
 	
-	FEIK_Lobby_OnRTCRoomConnectionChangedCallback OnRTCRoomConnectionChanged;
 	//Register to receive notifications of when the RTC Room for a particular lobby has a connection status change. The RTC Room connection status is independent of the lobby connection status, however the lobby system will attempt to keep them consistent, automatically connecting to the RTC room after joining a lobby which has an associated RTC room and disconnecting from the RTC room when a lobby is left or disconnected. This notification is entirely informational and requires no action in response by the application. If the connected status is offline (bIsConnected is EOS_FALSE), the connection will automatically attempt to reconnect. The purpose of this notification is to allow applications to show the current connection status of the RTC room when the connection is not established. Unlike EOS_RTC_AddNotifyDisconnected, EOS_RTC_LeaveRoom should not be called when the RTC room is disconnected. This function will only succeed when called on a lobby the local user is currently a member of.
 	UFUNCTION(BlueprintCallable, Category = "EOS Integration Kit | SDK Functions | Lobby Interface", DisplayName="EOS_Lobby_AddNotifyRTCRoomConnectionChanged")
 	FEIK_NotificationId EIK_Lobby_AddNotifyRTCRoomConnectionChanged(FEIK_Lobby_OnRTCRoomConnectionChangedCallback Callback);
@@ -119,7 +114,6 @@ public:
 
 
 	
-	FEIK_Lobby_OnSendLobbyNativeInviteCallback OnSendLobbyNativeInvite;
 	//Register to receive notifications about a lobby "INVITE" performed by a local user via the overlay. This is only needed when a configured integrated platform has EOS_IPMF_DisableSDKManagedSessions set. The EOS SDK will then use the state of EOS_IPMF_PreferEOSIdentity and EOS_IPMF_PreferIntegratedIdentity to determine when the NotificationFn is called.
 	UFUNCTION(BlueprintCallable, Category = "EOS Integration Kit | SDK Functions | Lobby Interface", DisplayName="EOS_Lobby_AddNotifySendLobbyNativeInviteRequested")
 	FEIK_NotificationId EIK_Lobby_AddNotifySendLobbyNativeInviteRequested(FEIK_Lobby_OnSendLobbyNativeInviteCallback Callback);
@@ -289,11 +283,98 @@ public:
 
 	// Helper Functions for simplified lobby member data management
 
-	//Set lobby member data for the local user. This is a simplified synchronous wrapper that handles the modification internally. Note: This function will block while updating the lobby.
+	//Set lobby member data for the local user. The write is queued and merged with other writes to the same lobby into a single lobby update, returns EOS_Success once queued. Use Set EIK Member Data Async to know when it has been applied.
 	UFUNCTION(BlueprintCallable, Category = "EOS Integration Kit | SDK Functions | Lobby Interface", DisplayName="Set EIK Member Data")
 	TEnumAsByte<EEIK_Result> EIK_Lobby_SetMemberData(FEIK_LobbyId LobbyId, FString Key, FString Value);
 
+	//Set lobby data, only the lobby owner can do this. Queued and merged like Set EIK Member Data.
+	UFUNCTION(BlueprintCallable, Category = "EOS Integration Kit | SDK Functions | Lobby Interface", DisplayName="Set EIK Lobby Data")
+	TEnumAsByte<EEIK_Result> EIK_Lobby_SetLobbyData(FEIK_LobbyId LobbyId, FString Key, FString Value);
+
+	/**
+	 * Queues a string attribute write for the local user. Writes to the same lobby within AttributeWriteCoalesceSeconds
+	 * are merged (last value per key wins) into one EOS_Lobby_UpdateLobby, and at most one update per lobby is in flight.
+	 * OnComplete is called on the game thread with the result of the update the write ended up in.
+	 */
+	EEIK_Result QueueLobbyAttributeWrite(const FEIK_LobbyId& LobbyId, const FString& Key, const FString& Value, bool bMemberAttribute, const FEIK_Lobby_OnAttributesWritten& OnComplete = FEIK_Lobby_OnAttributesWritten());
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	//How long queued attribute writes wait for more writes to the same lobby before being sent, read from the EIK settings
+	float AttributeWriteCoalesceSeconds = 0.1f;
+
+	//Minimum time between two updates of the same lobby, keeps us under the lobby update rate limit, read from the EIK settings
+	float MinLobbyUpdateIntervalSeconds = 1.0f;
+
 	//Get lobby member data for any user in the lobby. Returns the value as a string.
 	UFUNCTION(BlueprintCallable, Category = "EOS Integration Kit | SDK Functions | Lobby Interface", DisplayName="Get EIK Member Data")
 	TEnumAsByte<EEIK_Result> EIK_Lobby_GetMemberData(FEIK_LobbyId LobbyId, FEIK_ProductUserId TargetUserId, FString Key, FString& OutValue);
+
+	//Deprecated, each holds the delegate of the most recent AddNotify call and is no longer invoked by the SDK callbacks
+	UE_DEPRECATED(5.5, "Write-only, AddNotify sets it to the last delegate passed but never invokes it. Keep the NotificationId returned by AddNotify instead")
+	FEIK_Lobby_OnJoinLobbyAcceptedCallback OnJoinLobbyAccepted;
+	UE_DEPRECATED(5.5, "Write-only, AddNotify sets it to the last delegate passed but never invokes it. Keep the NotificationId returned by AddNotify instead")
+	FEIK_Lobby_OnLeaveLobbyRequestedCallback OnLeaveLobbyRequested;
+	UE_DEPRECATED(5.5, "Write-only, AddNotify sets it to the last delegate passed but never invokes it. Keep the NotificationId returned by AddNotify instead")
+	FEIK_Lobby_OnLobbyInviteAcceptedCallback OnLobbyInviteAccepted;
+	UE_DEPRECATED(5.5, "Write-only, AddNotify sets it to the last delegate passed but never invokes it. Keep the NotificationId returned by AddNotify instead")
+	FEIK_Lobby_OnLobbyInviteReceivedCallback OnLobbyInviteReceived;
+	UE_DEPRECATED(5.5, "Write-only, AddNotify sets it to the last delegate passed but never invokes it. Keep the NotificationId returned by AddNotify instead")
+	FEIK_Lobby_OnLobbyInviteRejectedCallback OnLobbyInviteRejected;
+	UE_DEPRECATED(5.5, "Write-only, AddNotify sets it to the last delegate passed but never invokes it. Keep the NotificationId returned by AddNotify instead")
+	FEIK_Lobby_OnLobbyMemberStatusReceivedCallback OnLobbyMemberStatusReceived;
+	UE_DEPRECATED(5.5, "Write-only, AddNotify sets it to the last delegate passed but never invokes it. Keep the NotificationId returned by AddNotify instead")
+	FEIK_Lobby_OnLobbyMemberUpdateReceivedCallback OnLobbyMemberUpdateReceived;
+	UE_DEPRECATED(5.5, "Write-only, AddNotify sets it to the last delegate passed but never invokes it. Keep the NotificationId returned by AddNotify instead")
+	FEIK_Lobby_OnLobbyUpdateReceivedCallback OnLobbyUpdateReceived;
+	UE_DEPRECATED(5.5, "Write-only, AddNotify sets it to the last delegate passed but never invokes it. Keep the NotificationId returned by AddNotify instead")
+	FEIK_Lobby_OnRTCRoomConnectionChangedCallback OnRTCRoomConnectionChanged;
+	UE_DEPRECATED(5.5, "Write-only, AddNotify sets it to the last delegate passed but never invokes it. Keep the NotificationId returned by AddNotify instead")
+	FEIK_Lobby_OnSendLobbyNativeInviteCallback OnSendLobbyNativeInvite;
+
+private:
+	//One entry per AddNotify call, so any number of listeners can be subscribed to the same notification at once
+	TEIKNotificationRegistry<FEIK_Lobby_OnJoinLobbyAcceptedCallback> JoinLobbyAcceptedNotifications;
+	TEIKNotificationRegistry<FEIK_Lobby_OnLeaveLobbyRequestedCallback> LeaveLobbyRequestedNotifications;
+	TEIKNotificationRegistry<FEIK_Lobby_OnLobbyInviteAcceptedCallback> LobbyInviteAcceptedNotifications;
+	TEIKNotificationRegistry<FEIK_Lobby_OnLobbyInviteReceivedCallback> LobbyInviteReceivedNotifications;
+	TEIKNotificationRegistry<FEIK_Lobby_OnLobbyInviteRejectedCallback> LobbyInviteRejectedNotifications;
+	TEIKNotificationRegistry<FEIK_Lobby_OnLobbyMemberStatusReceivedCallback> LobbyMemberStatusReceivedNotifications;
+	TEIKNotificationRegistry<FEIK_Lobby_OnLobbyMemberUpdateReceivedCallback> LobbyMemberUpdateReceivedNotifications;
+	TEIKNotificationRegistry<FEIK_Lobby_OnLobbyUpdateReceivedCallback> LobbyUpdateReceivedNotifications;
+	TEIKNotificationRegistry<FEIK_Lobby_OnRTCRoomConnectionChangedCallback> RTCRoomConnectionChangedNotifications;
+	TEIKNotificationRegistry<FEIK_Lobby_OnSendLobbyNativeInviteCallback> SendLobbyNativeInviteRequestedNotifications;
+
+	struct FLobbyAttributeWriter
+	{
+		// Writes waiting for the next update
+		TMap<FString, FString> MemberAttributes;
+		TMap<FString, FString> LobbyAttributes;
+		TArray<FEIK_Lobby_OnAttributesWritten> Callbacks;
+		double FirstQueuedSeconds = 0.0;
+
+		// The update currently in flight, kept so it can be requeued if we got rate limited
+		TMap<FString, FString> InFlightMemberAttributes;
+		TMap<FString, FString> InFlightLobbyAttributes;
+		TArray<FEIK_Lobby_OnAttributesWritten> InFlightCallbacks;
+		bool bInFlight = false;
+
+		double NextUpdateAllowedSeconds = 0.0;
+
+		bool HasPendingWrites() const { return MemberAttributes.Num() > 0 || LobbyAttributes.Num() > 0; }
+	};
+
+	bool TickAttributeWriters(float DeltaTime);
+	EEIK_Result FlushAttributeWriter(const FString& LobbyId, FLobbyAttributeWriter& Writer);
+	void OnAttributeWriteComplete(const FString& LobbyId, EEIK_Result Result);
+	void CompleteAttributeWrites(TArray<FEIK_Lobby_OnAttributesWritten>& Callbacks, EEIK_Result Result);
+
+	/** Pending and in flight attribute writes, keyed by lobby id */
+	TMap<FString, FLobbyAttributeWriter> LobbyAttributeWriters;
+#if ENGINE_MAJOR_VERSION == 5
+	FTSTicker::FDelegateHandle AttributeWriterTickerHandle;
+#else
+	FDelegateHandle AttributeWriterTickerHandle;
+#endif
 };
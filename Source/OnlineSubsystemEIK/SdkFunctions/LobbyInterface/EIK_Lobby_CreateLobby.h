@@ -3,7 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "Kismet/BlueprintAsyncActionBase.h"
+#include "OnlineSubsystemEIK/SdkFunctions/EIK_SdkAsyncAction.h"
 #include "OnlineSubsystemEIK/SdkFunctions/EIK_SharedFunctionFile.h"
 #include "EIK_Lobby_CreateLobby.generated.h"
 
@@ -113,7 +113,7 @@ struct FEIK_Lobby_CreateLobbyOptions
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FEIK_Lobby_CreateLobbyComplete, const TEnumAsByte<EEIK_Result>&, Result, const FEIK_LobbyId&, LobbyId);
 
 UCLASS()
-class ONLINESUBSYSTEMEIK_API UEIK_Lobby_CreateLobby : public UBlueprintAsyncActionBase
+class ONLINESUBSYSTEMEIK_API UEIK_Lobby_CreateLobby : public UEIK_SdkAsyncAction
 {
 	GENERATED_BODY()
 
@@ -37,7 +37,7 @@ void UEIK_Lobby_DestroyLobby::OnDestroyLobbyComplete(const EOS_Lobby_DestroyLobb
 void UEIK_Lobby_DestroyLobby::Activate()
 {
 	Super::Activate();
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -3,13 +3,13 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "Kismet/BlueprintAsyncActionBase.h"
+#include "OnlineSubsystemEIK/SdkFunctions/EIK_SdkAsyncAction.h"
 #include "OnlineSubsystemEIK/SdkFunctions/EIK_SharedFunctionFile.h"
 #include "EIK_Lobby_DestroyLobby.generated.h"
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FEIK_Lobby_DestroyLobbyDelegate, const TEnumAsByte<EEIK_Result>&, Result, const FEIK_LobbyId&, LobbyId);
 UCLASS()
-class ONLINESUBSYSTEMEIK_API UEIK_Lobby_DestroyLobby : public UBlueprintAsyncActionBase
+class ONLINESUBSYSTEMEIK_API UEIK_Lobby_DestroyLobby : public UEIK_SdkAsyncAction
 {
 	GENERATED_BODY()
 
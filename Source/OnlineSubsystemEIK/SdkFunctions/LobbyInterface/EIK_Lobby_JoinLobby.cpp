@@ -35,7 +35,7 @@ void UEIK_Lobby_JoinLobby::OnJoinLobbyComplete(const EOS_Lobby_JoinLobbyCallback
 void UEIK_Lobby_JoinLobby::Activate()
 {
 	Super::Activate();
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
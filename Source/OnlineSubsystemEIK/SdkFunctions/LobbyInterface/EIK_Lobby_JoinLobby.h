@@ -3,7 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "Kismet/BlueprintAsyncActionBase.h"
+#include "OnlineSubsystemEIK/SdkFunctions/EIK_SdkAsyncAction.h"
 #include "OnlineSubsystemEIK/SdkFunctions/EIK_SharedFunctionFile.h"
 #include "EIK_Lobby_JoinLobby.generated.h"
 
@@ -54,7 +54,7 @@ struct FEIK_Lobby_JoinLobbyOptions
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FEIK_Lobby_JoinLobbyDelegate, const TEnumAsByte<EEIK_Result>&, Result, const FEIK_LobbyId&, LobbyId);
 
 UCLASS()
-class ONLINESUBSYSTEMEIK_API UEIK_Lobby_JoinLobby : public UBlueprintAsyncActionBase
+class ONLINESUBSYSTEMEIK_API UEIK_Lobby_JoinLobby : public UEIK_SdkAsyncAction
 {
 	GENERATED_BODY()
 
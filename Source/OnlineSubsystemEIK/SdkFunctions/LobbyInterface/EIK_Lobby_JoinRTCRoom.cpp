@@ -16,7 +16,7 @@ UEIK_Lobby_JoinRTCRoom* UEIK_Lobby_JoinRTCRoom::EIK_Lobby_JoinRTCRoom(FEIK_Lobby
 void UEIK_Lobby_JoinRTCRoom::Activate()
 {
 	Super::Activate();
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
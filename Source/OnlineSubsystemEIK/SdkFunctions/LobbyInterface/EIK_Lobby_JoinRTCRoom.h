@@ -3,7 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "Kismet/BlueprintAsyncActionBase.h"
+#include "OnlineSubsystemEIK/SdkFunctions/EIK_SdkAsyncAction.h"
 #include "OnlineSubsystemEIK/SdkFunctions/EIK_SharedFunctionFile.h"
 #include "eos_lobby_types.h"
 #include "EIK_Lobby_JoinRTCRoom.generated.h"
@@ -59,7 +59,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FEIK_Lobby_JoinRTCRoomDelegate, con
  * or leave voice chat while remaining in the lobby.
  */
 UCLASS()
-class ONLINESUBSYSTEMEIK_API UEIK_Lobby_JoinRTCRoom : public UBlueprintAsyncActionBase
+class ONLINESUBSYSTEMEIK_API UEIK_Lobby_JoinRTCRoom : public UEIK_SdkAsyncAction
 {
 	GENERATED_BODY()
 
@@ -3,7 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "Kismet/BlueprintAsyncActionBase.h"
+#include "OnlineSubsystemEIK/SdkFunctions/EIK_SdkAsyncAction.h"
 #include "OnlineSessionEOS.h"
 #include "OnlineSubsystemEOS.h"
 #include "Async/Async.h"
@@ -14,7 +14,7 @@
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FEIKLobbyKickMember, const TEnumAsByte<EEIK_Result>&, ResultCode, const FEIK_LobbyId&, LobbyId);
 
 UCLASS()
-class ONLINESUBSYSTEMEIK_API UEIK_Lobby_KickMember : public UBlueprintAsyncActionBase
+class ONLINESUBSYSTEMEIK_API UEIK_Lobby_KickMember : public UEIK_SdkAsyncAction
 {
 	GENERATED_BODY()
 
@@ -16,7 +16,7 @@ UEIK_Lobby_LeaveRTCRoom* UEIK_Lobby_LeaveRTCRoom::EIK_Lobby_LeaveRTCRoom(FEIK_Lo
 void UEIK_Lobby_LeaveRTCRoom::Activate()
 {
 	Super::Activate();
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -3,7 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "Kismet/BlueprintAsyncActionBase.h"
+#include "OnlineSubsystemEIK/SdkFunctions/EIK_SdkAsyncAction.h"
 #include "OnlineSubsystemEIK/SdkFunctions/EIK_SharedFunctionFile.h"
 #include "eos_lobby_types.h"
 #include "EIK_Lobby_LeaveRTCRoom.generated.h"
@@ -49,7 +49,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FEIK_Lobby_LeaveRTCRoomDelegate, co
  * You can leave the voice chat while remaining a member of the lobby.
  */
 UCLASS()
-class ONLINESUBSYSTEMEIK_API UEIK_Lobby_LeaveRTCRoom : public UBlueprintAsyncActionBase
+class ONLINESUBSYSTEMEIK_API UEIK_Lobby_LeaveRTCRoom : public UEIK_SdkAsyncAction
 {
 	GENERATED_BODY()
 
@@ -16,7 +16,7 @@ UEIK_Lobby_SendInvite* UEIK_Lobby_SendInvite::EIK_Lobby_SendInvite(FEIK_ProductU
 void UEIK_Lobby_SendInvite::Activate()
 {
 	Super::Activate();
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -0,0 +1,46 @@
+﻿// Copyright (c) 2023 Betide Studio. All Rights Reserved.
+
+
+#include "EIK_Lobby_SetDataAsync.h"
+#include "EIK_LobbySubsystem.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "Runtime/Launch/Resources/Version.h"
+
+UEIK_Lobby_SetDataAsync* UEIK_Lobby_SetDataAsync::EIK_Lobby_SetDataAsync(UObject* WorldContextObject, FEIK_LobbyId LobbyId, FString Key, FString Value, bool bLobbyAttribute)
+{
+	UEIK_Lobby_SetDataAsync* Node = NewObject<UEIK_Lobby_SetDataAsync>();
+	Node->Var_WorldContextObject = WorldContextObject;
+	Node->Var_LobbyId = LobbyId;
+	Node->Var_Key = Key;
+	Node->Var_Value = Value;
+	Node->Var_bLobbyAttribute = bLobbyAttribute;
+	return Node;
+}
+
+void UEIK_Lobby_SetDataAsync::Activate()
+{
+	Super::Activate();
+	const UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(Var_WorldContextObject.Get(), EGetWorldErrorMode::LogAndReturnNull) : nullptr;
+	UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+	if (UEIK_LobbySubsystem* LobbySubsystem = GameInstance ? GameInstance->GetSubsystem<UEIK_LobbySubsystem>() : nullptr)
+	{
+		LobbySubsystem->QueueLobbyAttributeWrite(Var_LobbyId, Var_Key, Var_Value, !Var_bLobbyAttribute,
+			FEIK_Lobby_OnAttributesWritten::CreateUObject(this, &UEIK_Lobby_SetDataAsync::OnWriteComplete));
+		return;
+	}
+	UE_LOG(LogEIK, Error, TEXT("Failed to set lobby data, the lobby subsystem is not valid."));
+	OnWriteComplete(EEIK_Result::EOS_NotFound);
+}
+
+void UEIK_Lobby_SetDataAsync::OnWriteComplete(EEIK_Result Result)
+{
+	OnCallback.Broadcast(Result, Var_LobbyId);
+	SetReadyToDestroy();
+#if ENGINE_MAJOR_VERSION == 5
+	MarkAsGarbage();
+#else
+	MarkPendingKill();
+#endif
+}
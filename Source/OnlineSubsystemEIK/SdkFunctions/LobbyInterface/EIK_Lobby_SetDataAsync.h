@@ -0,0 +1,33 @@
+﻿// Copyright (c) 2023 Betide Studio. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "OnlineSubsystemEIK/SdkFunctions/EIK_SdkAsyncAction.h"
+#include "OnlineSubsystemEIK/SdkFunctions/EIK_SharedFunctionFile.h"
+#include "EIK_Lobby_SetDataAsync.generated.h"
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FEIKLobbySetDataAsync, const TEnumAsByte<EEIK_Result>&, ResultCode, const FEIK_LobbyId&, LobbyId);
+UCLASS()
+class ONLINESUBSYSTEMEIK_API UEIK_Lobby_SetDataAsync : public UEIK_SdkAsyncAction
+{
+	GENERATED_BODY()
+
+public:
+
+	//Set lobby member data for the local user, or lobby data if bLobbyAttribute is set (lobby owner only). Writes to the same lobby are merged into a single lobby update, the callback fires once that update completes.
+	UFUNCTION(BlueprintCallable, Category = "EOS Integration Kit | SDK Functions | Lobby Interface", meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"), DisplayName="Set EIK Member Data Async")
+	static UEIK_Lobby_SetDataAsync* EIK_Lobby_SetDataAsync(UObject* WorldContextObject, FEIK_LobbyId LobbyId, FString Key, FString Value, bool bLobbyAttribute = false);
+
+	UPROPERTY(BlueprintAssignable)
+	FEIKLobbySetDataAsync OnCallback;
+private:
+	virtual void Activate() override;
+	void OnWriteComplete(EEIK_Result Result);
+
+	TWeakObjectPtr<UObject> Var_WorldContextObject;
+	FEIK_LobbyId Var_LobbyId;
+	FString Var_Key;
+	FString Var_Value;
+	bool Var_bLobbyAttribute = false;
+};
@@ -13,7 +13,7 @@ UEIK_Lobby_UpdateLobby* UEIK_Lobby_UpdateLobby::EIK_Lobby_UpdateLobby(FEIK_HLobb
 void UEIK_Lobby_UpdateLobby::Activate()
 {
 	Super::Activate();
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
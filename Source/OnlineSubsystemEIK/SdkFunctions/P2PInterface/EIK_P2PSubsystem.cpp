@@ -8,7 +8,7 @@
 
 const TEnumAsByte<EEIK_Result> UEIK_P2PSubsystem::EIK_P2P_AcceptConnection(FEIK_ProductUserId LocalUserId, FEIK_ProductUserId RemoteUserId, FEIK_P2P_SocketId SocketId)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -23,7 +23,7 @@ const TEnumAsByte<EEIK_Result> UEIK_P2PSubsystem::EIK_P2P_AcceptConnection(FEIK_
 			Options.RemoteUserId = RemoteUserId.GetValueAsEosType();
 			EOS_P2P_SocketId SocketIdData = SocketId.GetAsEosData();
 			Options.SocketId = &SocketIdData;
-			auto Result = EOS_P2P_AcceptConnection(EOSRef->SocketSubsystem->GetP2PHandle(), &Options);
+			auto Result = EOS_P2P_AcceptConnection(EOSRef->P2PHandle, &Options);
 			return static_cast<EEIK_Result>(Result);
 		}
 	}
@@ -33,7 +33,7 @@ const TEnumAsByte<EEIK_Result> UEIK_P2PSubsystem::EIK_P2P_AcceptConnection(FEIK_
 
 const FEIK_NotificationId UEIK_P2PSubsystem::EIK_P2P_AddNotifyIncomingPacketQueueFull(FEIK_ProductUserId LocalUserId, const FEIK_P2P_SocketId SocketId, const FEIK_OnIncomingPacketQueueFull& Callback)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -44,7 +44,7 @@ const FEIK_NotificationId UEIK_P2PSubsystem::EIK_P2P_AddNotifyIncomingPacketQueu
 			}
 			EOS_P2P_AddNotifyIncomingPacketQueueFullOptions Options = {};
 			Options.ApiVersion = EOS_P2P_ADDNOTIFYINCOMINGPACKETQUEUEFULL_API_LATEST;
-			EOS_P2P_AddNotifyIncomingPacketQueueFull(EOSRef->SocketSubsystem->GetP2PHandle(), &Options, this, [](const EOS_P2P_OnIncomingPacketQueueFullInfo* Data)
+			EOS_P2P_AddNotifyIncomingPacketQueueFull(EOSRef->P2PHandle, &Options, this, [](const EOS_P2P_OnIncomingPacketQueueFullInfo* Data)
 			{
 				if(UEIK_P2PSubsystem* Subsystem = static_cast<UEIK_P2PSubsystem*>(Data->ClientData))
 				{
@@ -61,7 +61,7 @@ const FEIK_NotificationId UEIK_P2PSubsystem::EIK_P2P_AddNotifyPeerConnectionClos
 	FEIK_ProductUserId LocalUserId, const FEIK_P2P_SocketId SocketId,
 	const FEIK_OnPeerConnectionClosed& Callback)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -72,7 +72,7 @@ const FEIK_NotificationId UEIK_P2PSubsystem::EIK_P2P_AddNotifyPeerConnectionClos
 			}
 			EOS_P2P_AddNotifyPeerConnectionClosedOptions Options = {};
 			Options.ApiVersion = EOS_P2P_ADDNOTIFYPEERCONNECTIONCLOSED_API_LATEST;
-			EOS_P2P_AddNotifyPeerConnectionClosed(EOSRef->SocketSubsystem->GetP2PHandle(), &Options, this, [](const EOS_P2P_OnRemoteConnectionClosedInfo* Data)
+			EOS_P2P_AddNotifyPeerConnectionClosed(EOSRef->P2PHandle, &Options, this, [](const EOS_P2P_OnRemoteConnectionClosedInfo* Data)
 			{
 				if(UEIK_P2PSubsystem* Subsystem = static_cast<UEIK_P2PSubsystem*>(Data->ClientData))
 				{
@@ -93,7 +93,7 @@ const FEIK_NotificationId UEIK_P2PSubsystem::EIK_P2P_AddNotifyPeerConnectionEsta
 	FEIK_ProductUserId LocalUserId, const FEIK_P2P_SocketId SocketId,
 	const FEIK_OnPeerConnectionEstablished& Callback)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -104,7 +104,7 @@ const FEIK_NotificationId UEIK_P2PSubsystem::EIK_P2P_AddNotifyPeerConnectionEsta
 			}
 			EOS_P2P_AddNotifyPeerConnectionEstablishedOptions Options = {};
 			Options.ApiVersion = EOS_P2P_ADDNOTIFYPEERCONNECTIONESTABLISHED_API_LATEST;
-			EOS_P2P_AddNotifyPeerConnectionEstablished(EOSRef->SocketSubsystem->GetP2PHandle(), &Options, this, [](const EOS_P2P_OnPeerConnectionEstablishedInfo* Data)
+			EOS_P2P_AddNotifyPeerConnectionEstablished(EOSRef->P2PHandle, &Options, this, [](const EOS_P2P_OnPeerConnectionEstablishedInfo* Data)
 			{
 				if(UEIK_P2PSubsystem* Subsystem = static_cast<UEIK_P2PSubsystem*>(Data->ClientData))
 				{
@@ -124,7 +124,7 @@ const FEIK_NotificationId UEIK_P2PSubsystem::EIK_P2P_AddNotifyPeerConnectionInte
 	FEIK_ProductUserId LocalUserId, const FEIK_P2P_SocketId SocketId,
 	const FEIK_OnPeerConnectionInterrupted& Callback)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -135,7 +135,7 @@ const FEIK_NotificationId UEIK_P2PSubsystem::EIK_P2P_AddNotifyPeerConnectionInte
 			}
 			EOS_P2P_AddNotifyPeerConnectionInterruptedOptions Options = {};
 			Options.ApiVersion = EOS_P2P_ADDNOTIFYPEERCONNECTIONINTERRUPTED_API_LATEST;
-			EOS_P2P_AddNotifyPeerConnectionInterrupted(EOSRef->SocketSubsystem->GetP2PHandle(), &Options, this, [](const EOS_P2P_OnPeerConnectionInterruptedInfo* Data)
+			EOS_P2P_AddNotifyPeerConnectionInterrupted(EOSRef->P2PHandle, &Options, this, [](const EOS_P2P_OnPeerConnectionInterruptedInfo* Data)
 			{
 				if(UEIK_P2PSubsystem* Subsystem = static_cast<UEIK_P2PSubsystem*>(Data->ClientData))
 				{
@@ -155,7 +155,7 @@ const FEIK_NotificationId UEIK_P2PSubsystem::EIK_P2P_AddNotifyPeerConnectionRequ
 	FEIK_ProductUserId LocalUserId, const FEIK_P2P_SocketId SocketId,
 	const FEIK_OnIncomingConnectionRequest& Callback)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -166,7 +166,7 @@ const FEIK_NotificationId UEIK_P2PSubsystem::EIK_P2P_AddNotifyPeerConnectionRequ
 			}
 			EOS_P2P_AddNotifyPeerConnectionRequestOptions Options = {};
 			Options.ApiVersion = EOS_P2P_ADDNOTIFYPEERCONNECTIONREQUEST_API_LATEST;
-			EOS_P2P_AddNotifyPeerConnectionRequest(EOSRef->SocketSubsystem->GetP2PHandle(), &Options, this, [](const EOS_P2P_OnIncomingConnectionRequestInfo* Data)
+			EOS_P2P_AddNotifyPeerConnectionRequest(EOSRef->P2PHandle, &Options, this, [](const EOS_P2P_OnIncomingConnectionRequestInfo* Data)
 			{
 				if(UEIK_P2PSubsystem* Subsystem = static_cast<UEIK_P2PSubsystem*>(Data->ClientData))
 				{
@@ -185,7 +185,7 @@ const FEIK_NotificationId UEIK_P2PSubsystem::EIK_P2P_AddNotifyPeerConnectionRequ
 const TEnumAsByte<EEIK_Result> UEIK_P2PSubsystem::EIK_P2P_ClearPacketQueue(FEIK_ProductUserId LocalUserId,
 	FEIK_ProductUserId RemoteUserId, FEIK_P2P_SocketId SocketId)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -200,7 +200,7 @@ const TEnumAsByte<EEIK_Result> UEIK_P2PSubsystem::EIK_P2P_ClearPacketQueue(FEIK_
 			Options.RemoteUserId = RemoteUserId.GetValueAsEosType();
 			EOS_P2P_SocketId SocketIdData = SocketId.GetAsEosData();
 			Options.SocketId = &SocketIdData;
-			auto Result = EOS_P2P_ClearPacketQueue(EOSRef->SocketSubsystem->GetP2PHandle(), &Options);
+			auto Result = EOS_P2P_ClearPacketQueue(EOSRef->P2PHandle, &Options);
 			return static_cast<EEIK_Result>(Result);
 		}
 	}
@@ -211,7 +211,7 @@ const TEnumAsByte<EEIK_Result> UEIK_P2PSubsystem::EIK_P2P_ClearPacketQueue(FEIK_
 const TEnumAsByte<EEIK_Result> UEIK_P2PSubsystem::EIK_P2P_CloseConnection(FEIK_ProductUserId LocalUserId,
 	FEIK_ProductUserId RemoteUserId, FEIK_P2P_SocketId SocketId)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -226,7 +226,7 @@ const TEnumAsByte<EEIK_Result> UEIK_P2PSubsystem::EIK_P2P_CloseConnection(FEIK_P
 			Options.RemoteUserId = RemoteUserId.GetValueAsEosType();
 			EOS_P2P_SocketId SocketIdData = SocketId.GetAsEosData();
 			Options.SocketId = &SocketIdData;
-			auto Result = EOS_P2P_CloseConnection(EOSRef->SocketSubsystem->GetP2PHandle(), &Options);
+			auto Result = EOS_P2P_CloseConnection(EOSRef->P2PHandle, &Options);
 			return static_cast<EEIK_Result>(Result);
 		}
 	}
@@ -237,7 +237,7 @@ const TEnumAsByte<EEIK_Result> UEIK_P2PSubsystem::EIK_P2P_CloseConnection(FEIK_P
 const TEnumAsByte<EEIK_Result> UEIK_P2PSubsystem::EIK_P2P_CloseConnections(FEIK_ProductUserId LocalUserId,
 	FEIK_P2P_SocketId SocketId)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -251,7 +251,7 @@ const TEnumAsByte<EEIK_Result> UEIK_P2PSubsystem::EIK_P2P_CloseConnections(FEIK_
 			Options.LocalUserId = LocalUserId.GetValueAsEosType();
 			EOS_P2P_SocketId SocketIdData = SocketId.GetAsEosData();
 			Options.SocketId = &SocketIdData;
-			auto Result = EOS_P2P_CloseConnections(EOSRef->SocketSubsystem->GetP2PHandle(), &Options);
+			auto Result = EOS_P2P_CloseConnections(EOSRef->P2PHandle, &Options);
 			return static_cast<EEIK_Result>(Result);
 		}
 	}
@@ -261,7 +261,7 @@ const TEnumAsByte<EEIK_Result> UEIK_P2PSubsystem::EIK_P2P_CloseConnections(FEIK_
 
 const TEnumAsByte<EEIK_Result> UEIK_P2PSubsystem::EIK_P2P_GetNATType(TEnumAsByte<EEIK_ENATType>& OutNATType)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -273,7 +273,7 @@ const TEnumAsByte<EEIK_Result> UEIK_P2PSubsystem::EIK_P2P_GetNATType(TEnumAsByte
 			EOS_P2P_GetNATTypeOptions Options = {};
 			Options.ApiVersion = EOS_P2P_GETNATTYPE_API_LATEST;
 			EOS_ENATType EosNATType;
-			auto Result = EOS_P2P_GetNATType(EOSRef->SocketSubsystem->GetP2PHandle(), &Options, &EosNATType);
+			auto Result = EOS_P2P_GetNATType(EOSRef->P2PHandle, &Options, &EosNATType);
 			OutNATType = static_cast<EEIK_ENATType>(EosNATType);
 			return static_cast<EEIK_Result>(Result);
 		}
@@ -285,7 +285,7 @@ const TEnumAsByte<EEIK_Result> UEIK_P2PSubsystem::EIK_P2P_GetNATType(TEnumAsByte
 const TEnumAsByte<EEIK_Result> UEIK_P2PSubsystem::EIK_P2P_GetNextReceivedPacketSize(
 	FEIK_ProductUserId LocalUserId, int32 Channel, int32& OutPacketSizeBytes)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -307,7 +307,7 @@ const TEnumAsByte<EEIK_Result> UEIK_P2PSubsystem::EIK_P2P_GetNextReceivedPacketS
 				Options.RequestedChannel = nullptr;
 			}
 			uint32 PacketSizeBytes;
-			auto Result = EOS_P2P_GetNextReceivedPacketSize(EOSRef->SocketSubsystem->GetP2PHandle(), &Options, &PacketSizeBytes);
+			auto Result = EOS_P2P_GetNextReceivedPacketSize(EOSRef->P2PHandle, &Options, &PacketSizeBytes);
 			OutPacketSizeBytes = PacketSizeBytes;
 			return static_cast<EEIK_Result>(Result);
 		}
@@ -319,7 +319,7 @@ const TEnumAsByte<EEIK_Result> UEIK_P2PSubsystem::EIK_P2P_GetNextReceivedPacketS
 const TEnumAsByte<EEIK_Result> UEIK_P2PSubsystem::EIK_P2P_GetPacketQueueInfo(
 	FEIK_P2P_PacketQueueInfo& OutPacketQueueInfo)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -331,7 +331,7 @@ const TEnumAsByte<EEIK_Result> UEIK_P2PSubsystem::EIK_P2P_GetPacketQueueInfo(
 			EOS_P2P_GetPacketQueueInfoOptions Options = {};
 			Options.ApiVersion = EOS_P2P_GETPACKETQUEUEINFO_API_LATEST;
 			EOS_P2P_PacketQueueInfo EosPacketQueueInfo;
-			auto Result = EOS_P2P_GetPacketQueueInfo(EOSRef->SocketSubsystem->GetP2PHandle(), &Options, &EosPacketQueueInfo);
+			auto Result = EOS_P2P_GetPacketQueueInfo(EOSRef->P2PHandle, &Options, &EosPacketQueueInfo);
 			OutPacketQueueInfo = EosPacketQueueInfo;
 			return static_cast<EEIK_Result>(Result);
 		}
@@ -343,7 +343,7 @@ const TEnumAsByte<EEIK_Result> UEIK_P2PSubsystem::EIK_P2P_GetPacketQueueInfo(
 const TEnumAsByte<EEIK_Result> UEIK_P2PSubsystem::EIK_P2P_GetPortRange(int32& OutPort,
 	int32& OutNumAdditionalPortsToTry)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -356,7 +356,7 @@ const TEnumAsByte<EEIK_Result> UEIK_P2PSubsystem::EIK_P2P_GetPortRange(int32& Ou
 			Options.ApiVersion = EOS_P2P_GETPORTRANGE_API_LATEST;
 			uint16_t TempOutPort;
 			uint16_t TempOutNumAdditionalPortsToTry;
-			auto Result = EOS_P2P_GetPortRange(EOSRef->SocketSubsystem->GetP2PHandle(), &Options, &TempOutPort, &TempOutNumAdditionalPortsToTry);
+			auto Result = EOS_P2P_GetPortRange(EOSRef->P2PHandle, &Options, &TempOutPort, &TempOutNumAdditionalPortsToTry);
 			OutPort = TempOutPort;
 			OutNumAdditionalPortsToTry = TempOutNumAdditionalPortsToTry;
 			return static_cast<EEIK_Result>(Result);
@@ -368,7 +368,7 @@ const TEnumAsByte<EEIK_Result> UEIK_P2PSubsystem::EIK_P2P_GetPortRange(int32& Ou
 
 const TEnumAsByte<EEIK_Result> UEIK_P2PSubsystem::EIK_P2P_GetRelayControl(TEnumAsByte<EEIK_ERelayControl>& OutControl)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -380,7 +380,7 @@ const TEnumAsByte<EEIK_Result> UEIK_P2PSubsystem::EIK_P2P_GetRelayControl(TEnumA
 			EOS_P2P_GetRelayControlOptions Options = {};
 			Options.ApiVersion = EOS_P2P_GETRELAYCONTROL_API_LATEST;
 			EOS_ERelayControl EosControl;
-			auto Result = EOS_P2P_GetRelayControl(EOSRef->SocketSubsystem->GetP2PHandle(), &Options, &EosControl);
+			auto Result = EOS_P2P_GetRelayControl(EOSRef->P2PHandle, &Options, &EosControl);
 			OutControl = static_cast<EEIK_ERelayControl>(EosControl);
 			return static_cast<EEIK_Result>(Result);
 		}
@@ -393,38 +393,47 @@ const TEnumAsByte<EEIK_Result> UEIK_P2PSubsystem::EIK_P2P_ReceivePacket(FEIK_Pro
 	int32 MaxDataSizeBytes, int32 RequestedChannel, FEIK_P2P_SocketId& OutSocketId, FEIK_ProductUserId& OutPeerId,
 	int32& OutChannel, TArray<uint8>& OutData, int32& OutBytesRead)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
-			OutData.SetNum(MaxDataSizeBytes);
 			if(!EOSRef->SocketSubsystem)
 			{
 				UE_LOG(LogEIK, Error, TEXT("UEIK_P2PSubsystem::EIK_P2P_ReceivePacket: Failed to get EOS Socket subsystem"));
 				return EEIK_Result::EOS_NotFound;
 			}
+			// No packet is ever larger than EOS_P2P_MAX_PACKET_SIZE, and the array keeps its storage when it is reused
+			MaxDataSizeBytes = FMath::Clamp(MaxDataSizeBytes, 0, EOS_P2P_MAX_PACKET_SIZE);
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 4
+			OutData.SetNumUninitialized(MaxDataSizeBytes, EAllowShrinking::No);
+#else
+			OutData.SetNumUninitialized(MaxDataSizeBytes, false);
+#endif
 			EOS_P2P_ReceivePacketOptions Options = {};
 			Options.ApiVersion = EOS_P2P_RECEIVEPACKET_API_LATEST;
 			Options.LocalUserId = LocalUserId.GetValueAsEosType();
 			Options.MaxDataSizeBytes = MaxDataSizeBytes;
-			if(RequestedChannel != -1)
-			{
-				uint8_t LocalChannel = static_cast<uint8_t>(RequestedChannel);
-				Options.RequestedChannel = &LocalChannel;
-			}
-			else
-			{
-				Options.RequestedChannel = nullptr;
-			}
+			uint8_t LocalChannel = static_cast<uint8_t>(RequestedChannel);
+			Options.RequestedChannel = RequestedChannel != -1 ? &LocalChannel : nullptr;
 			EOS_P2P_SocketId SocketId;
 			EOS_ProductUserId PeerId;
-			uint8_t Channel;
-			uint32 BytesRead;
-			auto Result = EOS_P2P_ReceivePacket(EOSRef->SocketSubsystem->GetP2PHandle(), &Options, &PeerId, &SocketId, &Channel, OutData.GetData(), &BytesRead);
+			uint8_t Channel = 0;
+			uint32 BytesRead = 0;
+			auto Result = EOS_P2P_ReceivePacket(EOSRef->P2PHandle, &Options, &PeerId, &SocketId, &Channel, OutData.GetData(), &BytesRead);
+			if (Result != EOS_EResult::EOS_Success)
+			{
+				OutData.Reset();
+				OutBytesRead = 0;
+				return static_cast<EEIK_Result>(Result);
+			}
 			OutSocketId = SocketId;
 			OutPeerId = PeerId;
 			OutChannel = Channel;
-			OutData.SetNum(BytesRead);
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 4
+			OutData.SetNum(BytesRead, EAllowShrinking::No);
+#else
+			OutData.SetNum(BytesRead, false);
+#endif
 			OutBytesRead = BytesRead;
 			return static_cast<EEIK_Result>(Result);
 		}
@@ -433,57 +442,223 @@ const TEnumAsByte<EEIK_Result> UEIK_P2PSubsystem::EIK_P2P_ReceivePacket(FEIK_Pro
 	return EEIK_Result::EOS_NotFound;
 }
 
+const TEnumAsByte<EEIK_Result> UEIK_P2PSubsystem::EIK_P2P_ReceivePackets(FEIK_ProductUserId LocalUserId,
+	int32 MaxPackets, int32 RequestedChannel, FEIK_P2P_PacketBatch& Batch, int32& OutNumPackets)
+{
+	Batch.Reset();
+	OutNumPackets = 0;
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
+	{
+		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
+		{
+			if(!EOSRef->SocketSubsystem)
+			{
+				UE_LOG(LogEIK, Error, TEXT("UEIK_P2PSubsystem::EIK_P2P_ReceivePackets: Failed to get EOS Socket subsystem"));
+				return EEIK_Result::EOS_NotFound;
+			}
+			EOS_P2P_ReceivePacketOptions Options = {};
+			Options.ApiVersion = EOS_P2P_RECEIVEPACKET_API_LATEST;
+			Options.LocalUserId = LocalUserId.GetValueAsEosType();
+			Options.MaxDataSizeBytes = EOS_P2P_MAX_PACKET_SIZE;
+			uint8_t LocalChannel = static_cast<uint8_t>(RequestedChannel);
+			Options.RequestedChannel = RequestedChannel != -1 ? &LocalChannel : nullptr;
+
+			// Receive straight into the batch, one max sized slot at a time, instead of asking for each packet's size first
+			EOS_EResult Result = EOS_EResult::EOS_Success;
+			while (Batch.Packets.Num() < MaxPackets)
+			{
+				const int32 Offset = Batch.Data.Num();
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 4
+				Batch.Data.SetNumUninitialized(Offset + EOS_P2P_MAX_PACKET_SIZE, EAllowShrinking::No);
+#else
+				Batch.Data.SetNumUninitialized(Offset + EOS_P2P_MAX_PACKET_SIZE, false);
+#endif
+
+				EOS_P2P_SocketId SocketId;
+				EOS_ProductUserId PeerId;
+				uint8_t Channel = 0;
+				uint32 BytesRead = 0;
+				Result = EOS_P2P_ReceivePacket(EOSRef->P2PHandle, &Options, &PeerId, &SocketId, &Channel, Batch.Data.GetData() + Offset, &BytesRead);
+				if (Result != EOS_EResult::EOS_Success)
+				{
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 4
+					Batch.Data.SetNum(Offset, EAllowShrinking::No);
+#else
+					Batch.Data.SetNum(Offset, false);
+#endif
+					break;
+				}
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 4
+				Batch.Data.SetNum(Offset + BytesRead, EAllowShrinking::No);
+#else
+				Batch.Data.SetNum(Offset + BytesRead, false);
+#endif
+
+				FEIK_P2P_ReceivedPacketInfo& Packet = Batch.Packets.AddDefaulted_GetRef();
+				Packet.Offset = Offset;
+				Packet.Size = BytesRead;
+				Packet.PeerId = PeerId;
+				Packet.SocketId = SocketId;
+				Packet.Channel = Channel;
+			}
+
+			OutNumPackets = Batch.Packets.Num();
+			// Running out of packets is the normal way for a batch to end
+			if (Result == EOS_EResult::EOS_NotFound && OutNumPackets > 0)
+			{
+				return EEIK_Result::EOS_Success;
+			}
+			return static_cast<EEIK_Result>(Result);
+		}
+	}
+	UE_LOG(LogEIK, Error, TEXT("UEIK_P2PSubsystem::EIK_P2P_ReceivePackets: Failed to get EOS subsystem"));
+	return EEIK_Result::EOS_NotFound;
+}
+
+bool UEIK_P2PSubsystem::EIK_P2P_GetPacketData(const FEIK_P2P_PacketBatch& Batch, int32 PacketIndex, TArray<uint8>& OutData)
+{
+	if (!Batch.Packets.IsValidIndex(PacketIndex))
+	{
+		OutData.Reset();
+		return false;
+	}
+	const TArrayView<const uint8> PacketData = Batch.GetPacketData(PacketIndex);
+	OutData.Reset(PacketData.Num());
+	OutData.Append(PacketData.GetData(), PacketData.Num());
+	return true;
+}
+
+void UEIK_P2PSubsystem::EIK_P2P_SwapBatchData(FEIK_P2P_PacketBatch& Batch, TArray<uint8>& Data)
+{
+	Swap(Batch.Data, Data);
+}
+
+FEIK_NotificationId UEIK_P2PSubsystem::EIK_P2P_AddNotifyPacketsAvailable(FEIK_ProductUserId LocalUserId, int32 RequestedChannel, const FEIK_OnPacketsAvailable& Callback)
+{
+	const int64 NotificationId = NextPacketsAvailableNotificationId++;
+	PacketsAvailableListeners.Add({ NotificationId, LocalUserId, RequestedChannel, Callback });
+	if (!PacketsAvailableTickerHandle.IsValid())
+	{
+#if ENGINE_MAJOR_VERSION == 5
+		PacketsAvailableTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UEIK_P2PSubsystem::TickPacketsAvailable));
+#else
+		PacketsAvailableTickerHandle = FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UEIK_P2PSubsystem::TickPacketsAvailable));
+#endif
+	}
+	return FEIK_NotificationId(NotificationId);
+}
+
+void UEIK_P2PSubsystem::EIK_P2P_RemoveNotifyPacketsAvailable(const FEIK_NotificationId& NotificationId)
+{
+	if (NotificationId.NotificationId != 0)
+	{
+		PacketsAvailableListeners.RemoveAll([&NotificationId](const FPacketsAvailableListener& Listener) { return Listener.NotificationId == NotificationId.NotificationId; });
+	}
+	else
+	{
+		PacketsAvailableListeners.Reset();
+	}
+
+	if (PacketsAvailableListeners.Num() == 0 && PacketsAvailableTickerHandle.IsValid())
+	{
+#if ENGINE_MAJOR_VERSION == 5
+		FTSTicker::GetCoreTicker().RemoveTicker(PacketsAvailableTickerHandle);
+#else
+		FTicker::GetCoreTicker().RemoveTicker(PacketsAvailableTickerHandle);
+#endif
+		PacketsAvailableTickerHandle.Reset();
+	}
+}
+
+void UEIK_P2PSubsystem::Deinitialize()
+{
+	EIK_P2P_RemoveNotifyPacketsAvailable(FEIK_NotificationId());
+	Super::Deinitialize();
+}
+
+bool UEIK_P2PSubsystem::TickPacketsAvailable(float DeltaTime)
+{
+	FOnlineSubsystemEOS* EOSRef = FOnlineSubsystemEOS::GetDefaultInstance();
+	if (!EOSRef || !EOSRef->P2PHandle || PacketsAvailableListeners.Num() == 0)
+	{
+		return true;
+	}
+
+	// A single size query per listener and frame, the receive itself is left to the callbacks. Handlers are collected
+	// first since they may add or remove listeners while we notify them
+	TArray<TPair<FPacketsAvailableListener, uint32>, TInlineAllocator<4>> ListenersToNotify;
+	for (FPacketsAvailableListener& Listener : PacketsAvailableListeners)
+	{
+		EOS_P2P_GetNextReceivedPacketSizeOptions Options = {};
+		Options.ApiVersion = EOS_P2P_GETNEXTRECEIVEDPACKETSIZE_API_LATEST;
+		Options.LocalUserId = Listener.LocalUserId.GetValueAsEosType();
+		uint8_t LocalChannel = static_cast<uint8_t>(Listener.Channel);
+		Options.RequestedChannel = Listener.Channel != -1 ? &LocalChannel : nullptr;
+		uint32 PacketSizeBytes = 0;
+		if (EOS_P2P_GetNextReceivedPacketSize(EOSRef->P2PHandle, &Options, &PacketSizeBytes) == EOS_EResult::EOS_Success)
+		{
+			ListenersToNotify.Emplace(Listener, PacketSizeBytes);
+		}
+	}
+
+	for (const TPair<FPacketsAvailableListener, uint32>& Notify : ListenersToNotify)
+	{
+		Notify.Key.Callback.ExecuteIfBound(Notify.Key.LocalUserId, Notify.Value);
+	}
+	return true;
+}
+
 void UEIK_P2PSubsystem::EIK_P2P_RemoveNotifyIncomingPacketQueueFull(const FEIK_NotificationId& NotificationId)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
-			EOS_P2P_RemoveNotifyIncomingPacketQueueFull(EOSRef->SocketSubsystem->GetP2PHandle(), NotificationId.NotificationId);
+			EOS_P2P_RemoveNotifyIncomingPacketQueueFull(EOSRef->P2PHandle, NotificationId.NotificationId);
 		}
 	}
 }
 
 void UEIK_P2PSubsystem::EIK_P2P_RemoveNotifyPeerConnectionClosed(const FEIK_NotificationId& NotificationId)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
-			EOS_P2P_RemoveNotifyPeerConnectionClosed(EOSRef->SocketSubsystem->GetP2PHandle(), NotificationId.NotificationId);
+			EOS_P2P_RemoveNotifyPeerConnectionClosed(EOSRef->P2PHandle, NotificationId.NotificationId);
 		}
 	}
 }
 
 void UEIK_P2PSubsystem::EIK_P2P_RemoveNotifyPeerConnectionEstablished(const FEIK_NotificationId& NotificationId)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
-			EOS_P2P_RemoveNotifyPeerConnectionEstablished(EOSRef->SocketSubsystem->GetP2PHandle(), NotificationId.NotificationId);
+			EOS_P2P_RemoveNotifyPeerConnectionEstablished(EOSRef->P2PHandle, NotificationId.NotificationId);
 		}
 	}
 }
 
 void UEIK_P2PSubsystem::EIK_P2P_RemoveNotifyPeerConnectionInterrupted(const FEIK_NotificationId& NotificationId)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
-			EOS_P2P_RemoveNotifyPeerConnectionInterrupted(EOSRef->SocketSubsystem->GetP2PHandle(), NotificationId.NotificationId);
+			EOS_P2P_RemoveNotifyPeerConnectionInterrupted(EOSRef->P2PHandle, NotificationId.NotificationId);
 		}
 	}
 }
 
 void UEIK_P2PSubsystem::EIK_P2P_RemoveNotifyPeerConnectionRequest(const FEIK_NotificationId& NotificationId)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
-			EOS_P2P_RemoveNotifyPeerConnectionRequest(EOSRef->SocketSubsystem->GetP2PHandle(), NotificationId.NotificationId);
+			EOS_P2P_RemoveNotifyPeerConnectionRequest(EOSRef->P2PHandle, NotificationId.NotificationId);
 		}
 	}
 }
@@ -493,7 +668,7 @@ const TEnumAsByte<EEIK_Result> UEIK_P2PSubsystem::EIK_P2P_SendPacket(FEIK_Produc
 	bool bAllowDelayedDelivery, bool bDisableAutoAcceptConnection,
 	const TEnumAsByte<EEIK_EPacketReliability>& Reliability)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -514,7 +689,7 @@ const TEnumAsByte<EEIK_Result> UEIK_P2PSubsystem::EIK_P2P_SendPacket(FEIK_Produc
 			Options.bAllowDelayedDelivery = bAllowDelayedDelivery;
 			Options.bDisableAutoAcceptConnection = bDisableAutoAcceptConnection;
 			Options.Reliability = static_cast<EOS_EPacketReliability>(Reliability.GetValue());
-			auto Result = EOS_P2P_SendPacket(EOSRef->SocketSubsystem->GetP2PHandle(), &Options);
+			auto Result = EOS_P2P_SendPacket(EOSRef->P2PHandle, &Options);
 			return static_cast<EEIK_Result>(Result);
 		}
 	}
@@ -525,7 +700,7 @@ const TEnumAsByte<EEIK_Result> UEIK_P2PSubsystem::EIK_P2P_SendPacket(FEIK_Produc
 const TEnumAsByte<EEIK_Result> UEIK_P2PSubsystem::EIK_P2P_SetPacketQueueSize(int64 IncomingPacketQueueMaxSizeBytes,
 	int64 OutgoingPacketQueueMaxSizeBytes)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -533,7 +708,7 @@ const TEnumAsByte<EEIK_Result> UEIK_P2PSubsystem::EIK_P2P_SetPacketQueueSize(int
 			Options.ApiVersion = EOS_P2P_SETPACKETQUEUESIZE_API_LATEST;
 			Options.IncomingPacketQueueMaxSizeBytes = IncomingPacketQueueMaxSizeBytes;
 			Options.OutgoingPacketQueueMaxSizeBytes = OutgoingPacketQueueMaxSizeBytes;
-			auto Result = EOS_P2P_SetPacketQueueSize(EOSRef->SocketSubsystem->GetP2PHandle(), &Options);
+			auto Result = EOS_P2P_SetPacketQueueSize(EOSRef->P2PHandle, &Options);
 			return static_cast<EEIK_Result>(Result);
 		}
 	}
@@ -543,7 +718,7 @@ const TEnumAsByte<EEIK_Result> UEIK_P2PSubsystem::EIK_P2P_SetPacketQueueSize(int
 
 const TEnumAsByte<EEIK_Result> UEIK_P2PSubsystem::EIK_P2P_SetPortRange(int32 Port, int32 MaxAdditionalPortsToTry)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -551,7 +726,7 @@ const TEnumAsByte<EEIK_Result> UEIK_P2PSubsystem::EIK_P2P_SetPortRange(int32 Por
 			Options.ApiVersion = EOS_P2P_SETPORTRANGE_API_LATEST;
 			Options.Port = static_cast<uint16_t>(Port);
 			Options.MaxAdditionalPortsToTry = static_cast<uint16_t>(MaxAdditionalPortsToTry);
-			auto Result = EOS_P2P_SetPortRange(EOSRef->SocketSubsystem->GetP2PHandle(), &Options);
+			auto Result = EOS_P2P_SetPortRange(EOSRef->P2PHandle, &Options);
 			return static_cast<EEIK_Result>(Result);
 		}
 	}
@@ -561,14 +736,14 @@ const TEnumAsByte<EEIK_Result> UEIK_P2PSubsystem::EIK_P2P_SetPortRange(int32 Por
 
 const TEnumAsByte<EEIK_Result> UEIK_P2PSubsystem::EIK_P2P_SetRelayControl(TEnumAsByte<EEIK_ERelayControl> Control)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
 			EOS_P2P_SetRelayControlOptions Options = {};
 			Options.ApiVersion = EOS_P2P_SETRELAYCONTROL_API_LATEST;
 			Options.RelayControl = static_cast<EOS_ERelayControl>(Control.GetValue());
-			auto Result = EOS_P2P_SetRelayControl(EOSRef->SocketSubsystem->GetP2PHandle(), &Options);
+			auto Result = EOS_P2P_SetRelayControl(EOSRef->P2PHandle, &Options);
 			return static_cast<EEIK_Result>(Result);
 		}
 	}
@@ -8,6 +8,7 @@
 #include "Runtime/Launch/Resources/Version.h"
 #include "eos_p2p_types.h"
 #include "Subsystems/GameInstanceSubsystem.h"
+#include "Containers/Ticker.h"
 #include "EIK_P2PSubsystem.generated.h"
 
 USTRUCT(BlueprintType)
@@ -51,11 +52,73 @@ struct FEIK_P2P_OnIncomingPacketQueueFullInfo
 	}
 };
 
+USTRUCT(BlueprintType)
+struct FEIK_P2P_ReceivedPacketInfo
+{
+	GENERATED_BODY()
+
+	//Offset in bytes of the packet's data in the batch's Data array
+	UPROPERTY(BlueprintReadOnly, Category = "EOS Integration Kit | SDK Functions | P2P Interface")
+	int32 Offset;
+
+	//Size in bytes of the packet's data
+	UPROPERTY(BlueprintReadOnly, Category = "EOS Integration Kit | SDK Functions | P2P Interface")
+	int32 Size;
+
+	//The Remote User who sent the packet
+	UPROPERTY(BlueprintReadOnly, Category = "EOS Integration Kit | SDK Functions | P2P Interface")
+	FEIK_ProductUserId PeerId;
+
+	//The Socket ID the packet was sent on
+	UPROPERTY(BlueprintReadOnly, Category = "EOS Integration Kit | SDK Functions | P2P Interface")
+	FEIK_P2P_SocketId SocketId;
+
+	//The channel the packet was sent on
+	UPROPERTY(BlueprintReadOnly, Category = "EOS Integration Kit | SDK Functions | P2P Interface")
+	int32 Channel;
+
+	FEIK_P2P_ReceivedPacketInfo(): Offset(0), Size(0), Channel(0)
+	{
+	}
+};
+
+/**
+ * Packets received by a single EIK_P2P_ReceivePackets call. The payloads are stored back to back in Data and
+ * described by Packets. Both arrays are reset but never shrunk between calls, so keeping one batch around and
+ * passing it to every receive avoids allocating once it has grown to the usual traffic.
+ */
+USTRUCT(BlueprintType)
+struct FEIK_P2P_PacketBatch
+{
+	GENERATED_BODY()
+
+	//Payload of every packet in the batch, use the packet's Offset and Size to find its bytes
+	UPROPERTY(BlueprintReadOnly, Category = "EOS Integration Kit | SDK Functions | P2P Interface")
+	TArray<uint8> Data;
+
+	//The packets in the order they were received
+	UPROPERTY(BlueprintReadOnly, Category = "EOS Integration Kit | SDK Functions | P2P Interface")
+	TArray<FEIK_P2P_ReceivedPacketInfo> Packets;
+
+	void Reset()
+	{
+		Data.Reset();
+		Packets.Reset();
+	}
+
+	TArrayView<const uint8> GetPacketData(int32 Index) const
+	{
+		const FEIK_P2P_ReceivedPacketInfo& Packet = Packets[Index];
+		return TArrayView<const uint8>(Data.GetData() + Packet.Offset, Packet.Size);
+	}
+};
+
 DECLARE_DYNAMIC_DELEGATE_OneParam(FEIK_OnIncomingPacketQueueFull, const FEIK_P2P_OnIncomingPacketQueueFullInfo&, Data);
 DECLARE_DYNAMIC_DELEGATE_FourParams(FEIK_OnPeerConnectionClosed, const FEIK_ProductUserId&, LocalUserId, const FEIK_ProductUserId&, RemoteUserId, const FEIK_P2P_SocketId&, SocketId, const TEnumAsByte<EEIK_EConnectionClosedReason>&, Reason);
 DECLARE_DYNAMIC_DELEGATE_FiveParams(FEIK_OnPeerConnectionEstablished, const FEIK_ProductUserId&, LocalUserId, const FEIK_ProductUserId&, RemoteUserId, const FEIK_P2P_SocketId&, SocketId, const TEnumAsByte<EEIK_EConnectionEstablishedType>&, ConnectionType, const TEnumAsByte<EEIK_ENetworkConnectionType>&, NetworkType);
 DECLARE_DYNAMIC_DELEGATE_ThreeParams(FEIK_OnPeerConnectionInterrupted, const FEIK_ProductUserId&, LocalUserId, const FEIK_ProductUserId&, RemoteUserId, const FEIK_P2P_SocketId&, SocketId);
 DECLARE_DYNAMIC_DELEGATE_ThreeParams(FEIK_OnIncomingConnectionRequest, const FEIK_ProductUserId&, LocalUserId, const FEIK_ProductUserId&, RemoteUserId, const FEIK_P2P_SocketId&, SocketId);
+DECLARE_DYNAMIC_DELEGATE_TwoParams(FEIK_OnPacketsAvailable, const FEIK_ProductUserId&, LocalUserId, int32, NextPacketSizeBytes);
 
 UCLASS()
 class ONLINESUBSYSTEMEIK_API UEIK_P2PSubsystem : public UGameInstanceSubsystem
@@ -129,6 +192,28 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "EOS Integration Kit | SDK Functions | P2P Interface", DisplayName="EOS_P2P_ReceivePacket")
 	static const TEnumAsByte<EEIK_Result> EIK_P2P_ReceivePacket(FEIK_ProductUserId LocalUserId, int32 MaxDataSizeBytes, int32 RequestedChannel, FEIK_P2P_SocketId& OutSocketId, FEIK_ProductUserId& OutPeerId, int32& OutChannel, TArray<uint8>& OutData, int32& OutBytesRead);
 
+	//Receive up to MaxPackets queued packets for the local user in one call. Batch is reset and refilled, keep the same batch around between calls so its storage is reused. RequestedChannel of -1 receives from every channel.
+	UFUNCTION(BlueprintCallable, Category = "EOS Integration Kit | SDK Functions | P2P Interface", DisplayName="Receive EIK P2P Packets")
+	static const TEnumAsByte<EEIK_Result> EIK_P2P_ReceivePackets(FEIK_ProductUserId LocalUserId, int32 MaxPackets, int32 RequestedChannel, UPARAM(ref) FEIK_P2P_PacketBatch& Batch, int32& OutNumPackets);
+
+	//Copy the data of one packet of a batch into its own array. Use Swap EIK P2P Batch Data to read a whole batch without copying.
+	UFUNCTION(BlueprintCallable, Category = "EOS Integration Kit | SDK Functions | P2P Interface", DisplayName="Get EIK P2P Packet Data")
+	static bool EIK_P2P_GetPacketData(const FEIK_P2P_PacketBatch& Batch, int32 PacketIndex, TArray<uint8>& OutData);
+
+	//Exchange the batch's payload with Data without copying, the packets' Offset and Size then index into Data. Passing the same Data array every time hands its storage back to the batch, so neither side allocates once grown.
+	UFUNCTION(BlueprintCallable, Category = "EOS Integration Kit | SDK Functions | P2P Interface", DisplayName="Swap EIK P2P Batch Data")
+	static void EIK_P2P_SwapBatchData(UPARAM(ref) FEIK_P2P_PacketBatch& Batch, UPARAM(ref) TArray<uint8>& Data);
+
+	//Listen for packets waiting to be received by the local user. The queue is checked once per frame and the callback fires every frame it is not empty, so drain it with Receive EIK P2P Packets from the callback. Any number of handlers can listen at once.
+	UFUNCTION(BlueprintCallable, Category = "EOS Integration Kit | SDK Functions | P2P Interface", DisplayName="Add EIK P2P Packets Available Notify")
+	FEIK_NotificationId EIK_P2P_AddNotifyPacketsAvailable(FEIK_ProductUserId LocalUserId, int32 RequestedChannel, const FEIK_OnPacketsAvailable& Callback);
+
+	//Stop a handler added with Add EIK P2P Packets Available Notify from listening. An unset NotificationId removes every handler.
+	UFUNCTION(BlueprintCallable, Category = "EOS Integration Kit | SDK Functions | P2P Interface", DisplayName="Remove EIK P2P Packets Available Notify")
+	void EIK_P2P_RemoveNotifyPacketsAvailable(const FEIK_NotificationId& NotificationId);
+
+	virtual void Deinitialize() override;
+
 	//Stop listening for full incoming packet queue events on a previously bound handler.
 	UFUNCTION(BlueprintCallable, Category = "EOS Integration Kit | SDK Functions | P2P Interface", DisplayName="EOS_P2P_RemoveNotifyIncomingPacketQueueFull")
 	static void EIK_P2P_RemoveNotifyIncomingPacketQueueFull(const FEIK_NotificationId& NotificationId);
@@ -164,4 +249,24 @@ public:
 	//Set how relay servers are to be used. This setting does not immediately apply to existing connections, but may apply to existing connections if the connection requires renegotiation.
 	UFUNCTION(BlueprintCallable, Category = "EOS Integration Kit | SDK Functions | P2P Interface", DisplayName="EOS_P2P_SetRelayControl")
 	static const TEnumAsByte<EEIK_Result> EIK_P2P_SetRelayControl(TEnumAsByte<EEIK_ERelayControl> Control);
+
+private:
+	bool TickPacketsAvailable(float DeltaTime);
+
+	struct FPacketsAvailableListener
+	{
+		int64 NotificationId;
+		FEIK_ProductUserId LocalUserId;
+		int32 Channel;
+		FEIK_OnPacketsAvailable Callback;
+	};
+
+	/** Handlers added with EIK_P2P_AddNotifyPacketsAvailable, the ticker runs while there are any */
+	TArray<FPacketsAvailableListener> PacketsAvailableListeners;
+	int64 NextPacketsAvailableNotificationId = 1;
+#if ENGINE_MAJOR_VERSION == 5
+	FTSTicker::FDelegateHandle PacketsAvailableTickerHandle;
+#else
+	FDelegateHandle PacketsAvailableTickerHandle;
+#endif
 };
@@ -15,13 +15,13 @@ UEIK_P2P_QueryNATType* UEIK_P2P_QueryNATType::EIK_P2P_QueryNATType()
 void UEIK_P2P_QueryNATType::Activate()
 {
 	Super::Activate();
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
 			EOS_P2P_QueryNATTypeOptions Options = {};
 			Options.ApiVersion = EOS_P2P_QUERYNATTYPE_API_LATEST;
-			EOS_P2P_QueryNATType(EOSRef->SocketSubsystem->GetP2PHandle(), &Options, this, &UEIK_P2P_QueryNATType::EOS_P2P_QueryNATType_Callback);
+			EOS_P2P_QueryNATType(EOSRef->P2PHandle, &Options, this, &UEIK_P2P_QueryNATType::EOS_P2P_QueryNATType_Callback);
 			return;
 		}
 	}
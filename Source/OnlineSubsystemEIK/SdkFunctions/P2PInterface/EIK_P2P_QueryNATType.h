@@ -3,14 +3,14 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "Kismet/BlueprintAsyncActionBase.h"
+#include "OnlineSubsystemEIK/SdkFunctions/EIK_SdkAsyncAction.h"
 #include "OnlineSubsystemEIK/SdkFunctions/EIK_SharedFunctionFile.h"
 #include "EIK_P2P_QueryNATType.generated.h"
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FEIK_P2P_QueryNATTypeDelegate, const TEnumAsByte<EEIK_Result>&, Result, const TEnumAsByte<EEIK_ENATType>&, NATType);
 
 UCLASS()
-class ONLINESUBSYSTEMEIK_API UEIK_P2P_QueryNATType : public UBlueprintAsyncActionBase
+class ONLINESUBSYSTEMEIK_API UEIK_P2P_QueryNATType : public UEIK_SdkAsyncAction
 {
 	GENERATED_BODY()
 
@@ -8,7 +8,7 @@
 
 TEnumAsByte<EEIK_Result> UEIK_PlayerDataStorageSubsystem::EIK_PlayerDataStorage_CopyFileMetadataAtIndex(FEIK_ProductUserId LocalUserId, int32 Index, FEIK_PlayerDataStorage_FileMetadata& OutMetadata)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -32,7 +32,7 @@ TEnumAsByte<EEIK_Result> UEIK_PlayerDataStorageSubsystem::EIK_PlayerDataStorage_
 TEnumAsByte<EEIK_Result> UEIK_PlayerDataStorageSubsystem::EIK_PlayerDataStorage_CopyFileMetadataByFilename(
 	FEIK_ProductUserId LocalUserId, FString Filename, FEIK_PlayerDataStorage_FileMetadata& OutMetadata)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -61,7 +61,7 @@ void UEIK_PlayerDataStorageSubsystem::EIK_PlayerDataStorage_FileMetadata_Release
 TEnumAsByte<EEIK_Result> UEIK_PlayerDataStorageSubsystem::EIK_PlayerDataStorage_GetFileMetadataCount(
 	FEIK_ProductUserId LocalUserId, int32& OutFileMetadataCount)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -81,7 +81,7 @@ TEnumAsByte<EEIK_Result> UEIK_PlayerDataStorageSubsystem::EIK_PlayerDataStorage_
 TEnumAsByte<EEIK_Result> UEIK_PlayerDataStorageSubsystem::EIK_PlayerDataStorageFileTransferRequest_GetFilename(
 	FEIK_HPlayerDataStorageFileTransferRequest TransferRequestHandle, FString& OutFilename)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -99,7 +99,7 @@ TEnumAsByte<EEIK_Result> UEIK_PlayerDataStorageSubsystem::EIK_PlayerDataStorageF
 TEnumAsByte<EEIK_Result> UEIK_PlayerDataStorageSubsystem::EIK_PlayerDataStorageFileTransferRequest_GetFileRequestState(
 	FEIK_HPlayerDataStorageFileTransferRequest TransferRequestHandle)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -17,7 +17,7 @@ UEIK_PlayerDataStorage_DeleteCache* UEIK_PlayerDataStorage_DeleteCache::EIK_Play
 void UEIK_PlayerDataStorage_DeleteCache::Activate()
 {
 	Super::Activate();
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
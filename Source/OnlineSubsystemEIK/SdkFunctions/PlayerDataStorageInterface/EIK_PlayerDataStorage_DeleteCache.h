@@ -3,13 +3,13 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "Kismet/BlueprintAsyncActionBase.h"
+#include "OnlineSubsystemEIK/SdkFunctions/EIK_SdkAsyncAction.h"
 #include "OnlineSubsystemEIK/SdkFunctions/EIK_SharedFunctionFile.h"
 #include "EIK_PlayerDataStorage_DeleteCache.generated.h"
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FEIK_PlayerDataStorage_DeleteCacheDelegate, const TEnumAsByte<EEIK_Result>&, Result, const FEIK_ProductUserId&, LocalUserId);
 UCLASS()
-class ONLINESUBSYSTEMEIK_API UEIK_PlayerDataStorage_DeleteCache : public UBlueprintAsyncActionBase
+class ONLINESUBSYSTEMEIK_API UEIK_PlayerDataStorage_DeleteCache : public UEIK_SdkAsyncAction
 {
 	GENERATED_BODY()
 
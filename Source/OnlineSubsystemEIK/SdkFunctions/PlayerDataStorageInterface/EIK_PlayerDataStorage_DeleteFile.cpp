@@ -17,7 +17,7 @@ UEIK_PlayerDataStorage_DeleteFile* UEIK_PlayerDataStorage_DeleteFile::EIK_Player
 void UEIK_PlayerDataStorage_DeleteFile::Activate()
 {
 	Super::Activate();
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -16,7 +16,7 @@ UEIK_PlayerDataStorage_DuplicateFile* UEIK_PlayerDataStorage_DuplicateFile::EIK_
 void UEIK_PlayerDataStorage_DuplicateFile::Activate()
 {
 	Super::Activate();
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -15,7 +15,7 @@ UEIK_PlayerDataStorage_QueryFile* UEIK_PlayerDataStorage_QueryFile::EIK_PlayerDa
 void UEIK_PlayerDataStorage_QueryFile::Activate()
 {
 	Super::Activate();
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
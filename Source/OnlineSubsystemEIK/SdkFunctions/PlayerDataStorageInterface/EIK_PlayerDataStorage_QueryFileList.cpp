@@ -14,7 +14,7 @@ UEIK_PlayerDataStorage_QueryFileList* UEIK_PlayerDataStorage_QueryFileList::EIK_
 void UEIK_PlayerDataStorage_QueryFileList::Activate()
 {
 	Super::Activate();
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
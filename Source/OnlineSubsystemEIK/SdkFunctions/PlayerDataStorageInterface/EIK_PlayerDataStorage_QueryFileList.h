@@ -3,7 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "Kismet/BlueprintAsyncActionBase.h"
+#include "OnlineSubsystemEIK/SdkFunctions/EIK_SdkAsyncAction.h"
 #include "OnlineSubsystemEIK/SdkFunctions/EIK_SharedFunctionFile.h"
 #include "OnlineSubsystemEOS.h"
 #include "Async/Async.h"
@@ -13,7 +13,7 @@
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FEIK_PlayerDataStorage_QueryFileListDelegate, const TEnumAsByte<EEIK_Result>&, Result, const FEIK_ProductUserId&, LocalUserId, int32, FileCount);
 
 UCLASS()
-class ONLINESUBSYSTEMEIK_API UEIK_PlayerDataStorage_QueryFileList : public UBlueprintAsyncActionBase
+class ONLINESUBSYSTEMEIK_API UEIK_PlayerDataStorage_QueryFileList : public UEIK_SdkAsyncAction
 {
 	GENERATED_BODY()
 
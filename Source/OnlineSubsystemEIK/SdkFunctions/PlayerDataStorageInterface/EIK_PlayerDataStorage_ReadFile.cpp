@@ -57,7 +57,7 @@ UEIK_PlayerDataStorage_ReadFile* UEIK_PlayerDataStorage_ReadFile::EIK_PlayerData
 void UEIK_PlayerDataStorage_ReadFile::Activate()
 {
 	Super::Activate();
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -3,7 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "Kismet/BlueprintAsyncActionBase.h"
+#include "OnlineSubsystemEIK/SdkFunctions/EIK_SdkAsyncAction.h"
 #include "OnlineSubsystemEIK/SdkFunctions/EIK_SharedFunctionFile.h"
 #include "OnlineSubsystemEOS.h"
 #include "Async/Async.h"
@@ -14,7 +14,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FEIK_PlayerDataStorage_ReadFileDele
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FEIK_PlayerDataStorage_OnReadFileDataCallback);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_FourParams(FEIK_PlayerDataStorage_OnFileTransferProgressCallback, const FEIK_ProductUserId&, LocalUserId, const FString&, Filename, int32, BytesTransferred, int32, TotalFileSizeBytes);
 UCLASS()
-class ONLINESUBSYSTEMEIK_API UEIK_PlayerDataStorage_ReadFile : public UBlueprintAsyncActionBase
+class ONLINESUBSYSTEMEIK_API UEIK_PlayerDataStorage_ReadFile : public UEIK_SdkAsyncAction
 {
 	GENERATED_BODY()
 
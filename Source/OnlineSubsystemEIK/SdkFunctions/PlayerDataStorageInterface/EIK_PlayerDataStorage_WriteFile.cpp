@@ -53,7 +53,7 @@ EOS_PlayerDataStorage_EWriteResult UEIK_PlayerDataStorage_WriteFile::EOS_PlayerD
 void UEIK_PlayerDataStorage_WriteFile::Activate()
 {
 	Super::Activate();
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -12,7 +12,7 @@ THIRD_PARTY_INCLUDES_END
 FEIK_NotificationId UEIK_PresenceSubsystem::EIK_Presence_AddNotifyJoinGameAccepted(const FEIK_Presence_JoinGameAcceptedCallbackInfo& Callback)
 {
 	JoinGameAcceptedCallbackInfo = Callback;
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -36,7 +36,7 @@ FEIK_NotificationId UEIK_PresenceSubsystem::EIK_Presence_AddNotifyOnPresenceChan
 	const FEIK_Presence_OnPresenceChangedCallbackInfo& Callback)
 {
 	PresenceChangedCallbackInfo = Callback;
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -58,7 +58,7 @@ FEIK_NotificationId UEIK_PresenceSubsystem::EIK_Presence_AddNotifyOnPresenceChan
 TEnumAsByte<EEIK_Result> UEIK_PresenceSubsystem::EIK_Presence_CopyPresence(FEIK_EpicAccountId LocalUserId,
 	FEIK_EpicAccountId TargetUserId, FEIK_Presence_Info& OutPresence)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -82,7 +82,7 @@ TEnumAsByte<EEIK_Result> UEIK_PresenceSubsystem::EIK_Presence_CopyPresence(FEIK_
 TEnumAsByte<EEIK_Result> UEIK_PresenceSubsystem::EIK_Presence_CreatePresenceModification(FEIK_EpicAccountId LocalUserId,
 	FEIK_HPresenceModification& OutPresenceModificationHandle)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -105,7 +105,7 @@ TEnumAsByte<EEIK_Result> UEIK_PresenceSubsystem::EIK_Presence_CreatePresenceModi
 TEnumAsByte<EEIK_Result> UEIK_PresenceSubsystem::EIK_Presence_GetJoinInfo(FEIK_EpicAccountId LocalUserId,
 	FEIK_EpicAccountId TargetUserId, FString& OutBuffer)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -126,7 +126,7 @@ TEnumAsByte<EEIK_Result> UEIK_PresenceSubsystem::EIK_Presence_GetJoinInfo(FEIK_E
 
 bool UEIK_PresenceSubsystem::EIK_Presence_HasPresence(FEIK_EpicAccountId LocalUserId, FEIK_EpicAccountId TargetUserId)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -154,7 +154,7 @@ void UEIK_PresenceSubsystem::EIK_Presence_Info_Release(const FEIK_Presence_Info&
 
 void UEIK_PresenceSubsystem::EIK_Presence_RemoveNotifyJoinGameAccepted(FEIK_NotificationId InId)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -165,7 +165,7 @@ void UEIK_PresenceSubsystem::EIK_Presence_RemoveNotifyJoinGameAccepted(FEIK_Noti
 
 void UEIK_PresenceSubsystem::EIK_Presence_RemoveNotifyOnPresenceChanged(FEIK_NotificationId InId)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -176,7 +176,7 @@ void UEIK_PresenceSubsystem::EIK_Presence_RemoveNotifyOnPresenceChanged(FEIK_Not
 
 TEnumAsByte<EEIK_Result> UEIK_PresenceSubsystem::EIK_PresenceModification_DeleteData(FEIK_HPresenceModification PresenceModificationHandle, const FEIK_PresenceModification_DataRecordId& Data, int32 Count)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -200,7 +200,7 @@ void UEIK_PresenceSubsystem::EIK_PresenceModification_Release(FEIK_HPresenceModi
 TEnumAsByte<EEIK_Result> UEIK_PresenceSubsystem::EIK_PresenceModification_SetData(
 	FEIK_HPresenceModification PresenceModificationHandle, const FEIK_Presence_DataRecord& Data, int32 Count)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -219,7 +219,7 @@ TEnumAsByte<EEIK_Result> UEIK_PresenceSubsystem::EIK_PresenceModification_SetDat
 TEnumAsByte<EEIK_Result> UEIK_PresenceSubsystem::EIK_PresenceModification_SetJoinInfo(
 	FEIK_HPresenceModification PresenceModificationHandle, const FString& JoinInfo)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -237,7 +237,7 @@ TEnumAsByte<EEIK_Result> UEIK_PresenceSubsystem::EIK_PresenceModification_SetJoi
 TEnumAsByte<EEIK_Result> UEIK_PresenceSubsystem::EIK_PresenceModification_SetRawRichText(
 	FEIK_HPresenceModification PresenceModificationHandle, const FString& RichText)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -255,7 +255,7 @@ TEnumAsByte<EEIK_Result> UEIK_PresenceSubsystem::EIK_PresenceModification_SetRaw
 TEnumAsByte<EEIK_Result> UEIK_PresenceSubsystem::EIK_PresenceModification_SetStatus(
 	FEIK_HPresenceModification PresenceModificationHandle, TEnumAsByte<EEIK_Presence_EStatus> Status)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
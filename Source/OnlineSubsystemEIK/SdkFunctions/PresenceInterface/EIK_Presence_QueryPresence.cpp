@@ -19,7 +19,7 @@ UEIK_Presence_QueryPresence* UEIK_Presence_QueryPresence::EIK_Presence_QueryPres
 void UEIK_Presence_QueryPresence::Activate()
 {
 	Super::Activate();
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
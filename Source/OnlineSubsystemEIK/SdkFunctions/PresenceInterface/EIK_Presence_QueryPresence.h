@@ -3,7 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "Kismet/BlueprintAsyncActionBase.h"
+#include "OnlineSubsystemEIK/SdkFunctions/EIK_SdkAsyncAction.h"
 #include "OnlineSubsystemEIK/SdkFunctions/EIK_SharedFunctionFile.h"
 #include "eos_presence.h"
 #include "OnlineSubsystemEOS.h"
@@ -12,7 +12,7 @@
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FEIK_Presence_QueryPresenceComplete, const FEIK_EpicAccountId&, LocalUserId, const FEIK_EpicAccountId&, TargetUserId, const TEnumAsByte<EEIK_Result>&, Result);
 
 UCLASS()
-class ONLINESUBSYSTEMEIK_API UEIK_Presence_QueryPresence : public UBlueprintAsyncActionBase
+class ONLINESUBSYSTEMEIK_API UEIK_Presence_QueryPresence : public UEIK_SdkAsyncAction
 {
 	GENERATED_BODY()
 
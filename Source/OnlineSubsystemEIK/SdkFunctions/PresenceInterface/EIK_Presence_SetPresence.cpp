@@ -18,7 +18,7 @@ UEIK_Presence_SetPresence* UEIK_Presence_SetPresence::EIK_Presence_SetPresence(F
 void UEIK_Presence_SetPresence::Activate()
 {
 	Super::Activate();
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -11,8 +11,7 @@
 FEIK_NotificationId UEIK_RTCSubsystem::EIK_RTC_AddNotifyDisconnected(FEIK_ProductUserId LocalUserId,
                                                                      const FString& RoomName, const FEIK_RTC_OnDisconnectedCallback& Callback)
 {
-	OnDisconnectedCallback = Callback;
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -20,14 +19,18 @@ FEIK_NotificationId UEIK_RTCSubsystem::EIK_RTC_AddNotifyDisconnected(FEIK_Produc
 			Options.ApiVersion = EOS_RTC_ADDNOTIFYDISCONNECTED_API_LATEST;
 			Options.LocalUserId = LocalUserId.GetValueAsEosType();
 			Options.RoomName = TCHAR_TO_ANSI(*RoomName);
-			return EOS_RTC_AddNotifyDisconnected(EOS_Platform_GetRTCInterface(EOSRef->EOSPlatformHandle->PlatformHandle), &Options, this, [](const EOS_RTC_DisconnectedCallbackInfo* Data)
+			PRAGMA_DISABLE_DEPRECATION_WARNINGS
+			OnDisconnectedCallback = Callback;
+			PRAGMA_ENABLE_DEPRECATION_WARNINGS
+			TEIKNotification<FEIK_RTC_OnDisconnectedCallback>* Entry = DisconnectedNotifications.Add(Callback, RoomName);
+			return DisconnectedNotifications.Bind(Entry, EOS_RTC_AddNotifyDisconnected(EOSRef->RTCHandle, &Options, Entry, [](const EOS_RTC_DisconnectedCallbackInfo* Data)
 			{
-				UEIK_RTCSubsystem* Subsystem = static_cast<UEIK_RTCSubsystem*>(Data->ClientData);
-				if (Subsystem)
+				TEIKNotification<FEIK_RTC_OnDisconnectedCallback>* Notification = static_cast<TEIKNotification<FEIK_RTC_OnDisconnectedCallback>*>(Data->ClientData);
+				if (Notification)
 				{
-					Subsystem->OnDisconnectedCallback.ExecuteIfBound(static_cast<EEIK_Result>(Data->ResultCode), Data->LocalUserId, UTF8_TO_TCHAR(Data->RoomName));
+					Notification->Delegate.ExecuteIfBound(static_cast<EEIK_Result>(Data->ResultCode), Data->LocalUserId, Notification->RoomName);
 				}
-			});
+			}));
 		}
 	}
 	return FEIK_NotificationId();
@@ -36,8 +39,7 @@ FEIK_NotificationId UEIK_RTCSubsystem::EIK_RTC_AddNotifyDisconnected(FEIK_Produc
 FEIK_NotificationId UEIK_RTCSubsystem::EIK_RTC_AddNotifyParticipantStatusChanged(FEIK_ProductUserId LocalUserId,
 	const FString& RoomName, const FEIK_RTC_OnParticipantStatusChangedCallback& Callback)
 {
-	OnParticipantStatusChangedCallback = Callback;
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -45,15 +47,19 @@ FEIK_NotificationId UEIK_RTCSubsystem::EIK_RTC_AddNotifyParticipantStatusChanged
 			Options.ApiVersion = EOS_RTC_ADDNOTIFYPARTICIPANTSTATUSCHANGED_API_LATEST;
 			Options.LocalUserId = LocalUserId.GetValueAsEosType();
 			Options.RoomName = TCHAR_TO_ANSI(*RoomName);
-			return EOS_RTC_AddNotifyParticipantStatusChanged(EOS_Platform_GetRTCInterface(EOSRef->EOSPlatformHandle->PlatformHandle), &Options, this, [](const EOS_RTC_ParticipantStatusChangedCallbackInfo* Data)
+			PRAGMA_DISABLE_DEPRECATION_WARNINGS
+			OnParticipantStatusChangedCallback = Callback;
+			PRAGMA_ENABLE_DEPRECATION_WARNINGS
+			TEIKNotification<FEIK_RTC_OnParticipantStatusChangedCallback>* Entry = ParticipantStatusChangedNotifications.Add(Callback, RoomName);
+			return ParticipantStatusChangedNotifications.Bind(Entry, EOS_RTC_AddNotifyParticipantStatusChanged(EOSRef->RTCHandle, &Options, Entry, [](const EOS_RTC_ParticipantStatusChangedCallbackInfo* Data)
 			{
-				UEIK_RTCSubsystem* Subsystem = static_cast<UEIK_RTCSubsystem*>(Data->ClientData);
-				if (Subsystem)
+				TEIKNotification<FEIK_RTC_OnParticipantStatusChangedCallback>* Notification = static_cast<TEIKNotification<FEIK_RTC_OnParticipantStatusChangedCallback>*>(Data->ClientData);
+				if (Notification)
 				{
 					FEIK_RTC_ParticipantStatusChangedCallbackInfo CallbackInfo(Data);
-					Subsystem->OnParticipantStatusChangedCallback.ExecuteIfBound(CallbackInfo);
+					Notification->Delegate.ExecuteIfBound(CallbackInfo);
 				}
-			});
+			}));
 		}
 	}
 	return FEIK_NotificationId();
@@ -62,8 +68,7 @@ FEIK_NotificationId UEIK_RTCSubsystem::EIK_RTC_AddNotifyParticipantStatusChanged
 FEIK_NotificationId UEIK_RTCSubsystem::EIK_RTC_AddNotifyRoomStatisticsUpdated(FEIK_ProductUserId LocalUserId,
 	const FString& RoomName, const FEIK_RTC_OnRoomStatisticsUpdatedCallback& Callback)
 {
-	OnRoomStatisticsUpdatedCallback = Callback;
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -71,14 +76,18 @@ FEIK_NotificationId UEIK_RTCSubsystem::EIK_RTC_AddNotifyRoomStatisticsUpdated(FE
 			Options.ApiVersion = EOS_RTC_ADDNOTIFYROOMSTATISTICSUPDATED_API_LATEST;
 			Options.LocalUserId = LocalUserId.GetValueAsEosType();
 			Options.RoomName = TCHAR_TO_ANSI(*RoomName);
-			return EOS_RTC_AddNotifyRoomStatisticsUpdated(EOS_Platform_GetRTCInterface(EOSRef->EOSPlatformHandle->PlatformHandle), &Options, this, [](const EOS_RTC_RoomStatisticsUpdatedInfo* Data)
+			PRAGMA_DISABLE_DEPRECATION_WARNINGS
+			OnRoomStatisticsUpdatedCallback = Callback;
+			PRAGMA_ENABLE_DEPRECATION_WARNINGS
+			TEIKNotification<FEIK_RTC_OnRoomStatisticsUpdatedCallback>* Entry = RoomStatisticsUpdatedNotifications.Add(Callback, RoomName);
+			return RoomStatisticsUpdatedNotifications.Bind(Entry, EOS_RTC_AddNotifyRoomStatisticsUpdated(EOSRef->RTCHandle, &Options, Entry, [](const EOS_RTC_RoomStatisticsUpdatedInfo* Data)
 			{
-				UEIK_RTCSubsystem* Subsystem = static_cast<UEIK_RTCSubsystem*>(Data->ClientData);
-				if (Subsystem)
+				TEIKNotification<FEIK_RTC_OnRoomStatisticsUpdatedCallback>* Notification = static_cast<TEIKNotification<FEIK_RTC_OnRoomStatisticsUpdatedCallback>*>(Data->ClientData);
+				if (Notification)
 				{
-					Subsystem->OnRoomStatisticsUpdatedCallback.ExecuteIfBound(Data->LocalUserId, UTF8_TO_TCHAR(Data->RoomName), UTF8_TO_TCHAR(Data->Statistic));
+					Notification->Delegate.ExecuteIfBound(Data->LocalUserId, Notification->RoomName, UTF8_TO_TCHAR(Data->Statistic));
 				}
-			});
+			}));
 		}
 	}
 	return FEIK_NotificationId();
@@ -88,7 +97,7 @@ void UEIK_RTCSubsystem::EIK_RTC_BlockParticipant(FEIK_ProductUserId LocalUserId,
 	FEIK_ProductUserId ParticipantId, bool bBlocked, const FEIK_RTC_OnBlockParticipantCallback& Callback)
 {
 	OnBlockParticipantCallback = Callback;
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -98,7 +107,7 @@ void UEIK_RTCSubsystem::EIK_RTC_BlockParticipant(FEIK_ProductUserId LocalUserId,
 			Options.RoomName = TCHAR_TO_ANSI(*RoomName);
 			Options.ParticipantId = ParticipantId.GetValueAsEosType();
 			Options.bBlocked = bBlocked;
-			EOS_RTC_BlockParticipant(EOS_Platform_GetRTCInterface(EOSRef->EOSPlatformHandle->PlatformHandle), &Options, this, [](const EOS_RTC_BlockParticipantCallbackInfo* Data)
+			EOS_RTC_BlockParticipant(EOSRef->RTCHandle, &Options, this, [](const EOS_RTC_BlockParticipantCallbackInfo* Data)
 			{
 				UEIK_RTCSubsystem* Subsystem = static_cast<UEIK_RTCSubsystem*>(Data->ClientData);
 				if (Subsystem)
@@ -116,7 +125,7 @@ void UEIK_RTCSubsystem::EIK_RTC_JoinRoom(FEIK_ProductUserId LocalUserId, const F
 	const FEIK_RTC_OnJoinRoomCallback& Callback)
 {
 	OnJoinRoomCallback = Callback;
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -130,7 +139,7 @@ void UEIK_RTCSubsystem::EIK_RTC_JoinRoom(FEIK_ProductUserId LocalUserId, const F
 			Options.Flags = bEnabledEcho ? EOS_RTC_JOINROOMFLAGS_ENABLE_ECHO : 0x0;
 			Options.bManualAudioInputEnabled = bManualAudioInputEnabled;
 			Options.bManualAudioOutputEnabled = bManualAudioOutputEnabled;
-			EOS_RTC_JoinRoom(EOS_Platform_GetRTCInterface(EOSRef->EOSPlatformHandle->PlatformHandle), &Options, this, [](const EOS_RTC_JoinRoomCallbackInfo* Data)
+			EOS_RTC_JoinRoom(EOSRef->RTCHandle, &Options, this, [](const EOS_RTC_JoinRoomCallbackInfo* Data)
 			{
 				UEIK_RTCSubsystem* Subsystem = static_cast<UEIK_RTCSubsystem*>(Data->ClientData);
 				if (Subsystem)
@@ -151,7 +160,7 @@ void UEIK_RTCSubsystem::EIK_RTC_LeaveRoom(FEIK_ProductUserId LocalUserId, const
 	const FEIK_RTC_OnLeaveRoomCallback& Callback)
 {
 	OnLeaveRoomCallback = Callback;
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -159,7 +168,7 @@ void UEIK_RTCSubsystem::EIK_RTC_LeaveRoom(FEIK_ProductUserId LocalUserId, const
 			Options.ApiVersion = EOS_RTC_LEAVEROOM_API_LATEST;
 			Options.LocalUserId = LocalUserId.GetValueAsEosType();
 			Options.RoomName = TCHAR_TO_ANSI(*RoomName);
-			EOS_RTC_LeaveRoom(EOS_Platform_GetRTCInterface(EOSRef->EOSPlatformHandle->PlatformHandle), &Options, this, [](const EOS_RTC_LeaveRoomCallbackInfo* Data)
+			EOS_RTC_LeaveRoom(EOSRef->RTCHandle, &Options, this, [](const EOS_RTC_LeaveRoomCallbackInfo* Data)
 			{
 				UEIK_RTCSubsystem* Subsystem = static_cast<UEIK_RTCSubsystem*>(Data->ClientData);
 				if (Subsystem)
@@ -173,41 +182,44 @@ void UEIK_RTCSubsystem::EIK_RTC_LeaveRoom(FEIK_ProductUserId LocalUserId, const
 
 void UEIK_RTCSubsystem::EIK_RTC_RemoveNotifyDisconnected(FEIK_NotificationId NotificationId)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
-			EOS_RTC_RemoveNotifyDisconnected(EOS_Platform_GetRTCInterface(EOSRef->EOSPlatformHandle->PlatformHandle), NotificationId.GetValueAsEosType());
+			EOS_RTC_RemoveNotifyDisconnected(EOSRef->RTCHandle, NotificationId.GetValueAsEosType());
 		}	
 	}
+	DisconnectedNotifications.Remove(NotificationId.GetValueAsEosType());
 }
 
 void UEIK_RTCSubsystem::EIK_RTC_RemoveNotifyParticipantStatusChanged(FEIK_NotificationId NotificationId)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
-			EOS_RTC_RemoveNotifyParticipantStatusChanged(EOS_Platform_GetRTCInterface(EOSRef->EOSPlatformHandle->PlatformHandle), NotificationId.GetValueAsEosType());
+			EOS_RTC_RemoveNotifyParticipantStatusChanged(EOSRef->RTCHandle, NotificationId.GetValueAsEosType());
 		}
 	}
+	ParticipantStatusChangedNotifications.Remove(NotificationId.GetValueAsEosType());
 }
 
 void UEIK_RTCSubsystem::EIK_RTC_RemoveNotifyRoomStatisticsUpdated(FEIK_NotificationId NotificationId)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
-			EOS_RTC_RemoveNotifyRoomStatisticsUpdated(EOS_Platform_GetRTCInterface(EOSRef->EOSPlatformHandle->PlatformHandle), NotificationId.GetValueAsEosType());
+			EOS_RTC_RemoveNotifyRoomStatisticsUpdated(EOSRef->RTCHandle, NotificationId.GetValueAsEosType());
 		}
 	}
+	RoomStatisticsUpdatedNotifications.Remove(NotificationId.GetValueAsEosType());
 }
 
 TEnumAsByte<EEIK_Result> UEIK_RTCSubsystem::EIK_RTC_SetRoomSetting(FEIK_ProductUserId LocalUserId,
 	const FString& RoomName, const FString& SettingName, const FString& SettingValue)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -217,7 +229,7 @@ TEnumAsByte<EEIK_Result> UEIK_RTCSubsystem::EIK_RTC_SetRoomSetting(FEIK_ProductU
 			Options.RoomName = TCHAR_TO_ANSI(*RoomName);
 			Options.SettingName = TCHAR_TO_ANSI(*SettingName);
 			Options.SettingValue = TCHAR_TO_ANSI(*SettingValue);
-			return static_cast<EEIK_Result>(EOS_RTC_SetRoomSetting(EOS_Platform_GetRTCInterface(EOSRef->EOSPlatformHandle->PlatformHandle), &Options));
+			return static_cast<EEIK_Result>(EOS_RTC_SetRoomSetting(EOSRef->RTCHandle, &Options));
 		}
 	}
 	UE_LOG(LogEIK, Error, TEXT("EIK_RTCSubsystem::EIK_RTC_SetRoomSetting: OnlineSubsystemEIK is not available"));
@@ -226,7 +238,7 @@ TEnumAsByte<EEIK_Result> UEIK_RTCSubsystem::EIK_RTC_SetRoomSetting(FEIK_ProductU
 
 TEnumAsByte<EEIK_Result> UEIK_RTCSubsystem::EIK_RTC_SetSetting(const FString& SettingName, const FString& SettingValue)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -234,7 +246,7 @@ TEnumAsByte<EEIK_Result> UEIK_RTCSubsystem::EIK_RTC_SetSetting(const FString& Se
 			Options.ApiVersion = EOS_RTC_SETSETTING_API_LATEST;
 			Options.SettingName = TCHAR_TO_ANSI(*SettingName);
 			Options.SettingValue = TCHAR_TO_ANSI(*SettingValue);
-			return static_cast<EEIK_Result>(EOS_RTC_SetSetting(EOS_Platform_GetRTCInterface(EOSRef->EOSPlatformHandle->PlatformHandle), &Options));
+			return static_cast<EEIK_Result>(EOS_RTC_SetSetting(EOSRef->RTCHandle, &Options));
 		}
 	}
 	UE_LOG(LogEIK, Error, TEXT("EIK_RTCSubsystem::EIK_RTC_SetSetting: OnlineSubsystemEIK is not available"));
@@ -244,7 +256,7 @@ TEnumAsByte<EEIK_Result> UEIK_RTCSubsystem::EIK_RTC_SetSetting(const FString& Se
 TEnumAsByte<EEIK_Result> UEIK_RTCSubsystem::EIK_RTCAdmin_CopyUserTokenByIndex(int32 UserTokenIndex, int32 QueryId,
 	FEIK_RTCAdmin_UserToken& OutUserToken)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -253,7 +265,7 @@ TEnumAsByte<EEIK_Result> UEIK_RTCSubsystem::EIK_RTCAdmin_CopyUserTokenByIndex(in
 			Options.UserTokenIndex = UserTokenIndex;
 			Options.QueryId = QueryId;
 			EOS_RTCAdmin_UserToken* OutUserTokenBasic;
-			TEnumAsByte<EEIK_Result> Result = static_cast<EEIK_Result>(EOS_RTCAdmin_CopyUserTokenByIndex(EOS_Platform_GetRTCAdminInterface(EOSRef->EOSPlatformHandle->PlatformHandle), &Options, &OutUserTokenBasic));
+			TEnumAsByte<EEIK_Result> Result = static_cast<EEIK_Result>(EOS_RTCAdmin_CopyUserTokenByIndex(EOSRef->RTCAdminHandle, &Options, &OutUserTokenBasic));
 			OutUserToken = *OutUserTokenBasic;
 			return Result;
 		}
@@ -265,7 +277,7 @@ TEnumAsByte<EEIK_Result> UEIK_RTCSubsystem::EIK_RTCAdmin_CopyUserTokenByIndex(in
 TEnumAsByte<EEIK_Result> UEIK_RTCSubsystem::EIK_RTCAdmin_CopyUserTokenByUserId(FEIK_ProductUserId UserId,
 	int32 QueryId, FEIK_RTCAdmin_UserToken& OutUserToken)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -274,7 +286,7 @@ TEnumAsByte<EEIK_Result> UEIK_RTCSubsystem::EIK_RTCAdmin_CopyUserTokenByUserId(F
 			Options.TargetUserId = UserId.GetValueAsEosType();
 			Options.QueryId = QueryId;
 			EOS_RTCAdmin_UserToken* OutUserTokenBasic;
-			TEnumAsByte<EEIK_Result> Result = static_cast<EEIK_Result>(EOS_RTCAdmin_CopyUserTokenByUserId(EOS_Platform_GetRTCAdminInterface(EOSRef->EOSPlatformHandle->PlatformHandle), &Options, &OutUserTokenBasic));
+			TEnumAsByte<EEIK_Result> Result = static_cast<EEIK_Result>(EOS_RTCAdmin_CopyUserTokenByUserId(EOSRef->RTCAdminHandle, &Options, &OutUserTokenBasic));
 			OutUserToken = *OutUserTokenBasic;
 			return Result;
 		}
@@ -287,7 +299,7 @@ void UEIK_RTCSubsystem::EIK_RTCAdmin_Kick(const FString& RoomName, FEIK_ProductU
 	const FEIK_RTCAdmin_OnKickCompleteCallback& Callback)
 {
 	OnKickCompleteCallback = Callback;
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -295,7 +307,7 @@ void UEIK_RTCSubsystem::EIK_RTCAdmin_Kick(const FString& RoomName, FEIK_ProductU
 			Options.ApiVersion = EOS_RTCADMIN_KICK_API_LATEST;
 			Options.RoomName = TCHAR_TO_ANSI(*RoomName);
 			Options.TargetUserId = TargetUserId.GetValueAsEosType();
-			EOS_RTCAdmin_Kick(EOS_Platform_GetRTCAdminInterface(EOSRef->EOSPlatformHandle->PlatformHandle), &Options, this, [](const EOS_RTCAdmin_KickCompleteCallbackInfo* Data)
+			EOS_RTCAdmin_Kick(EOSRef->RTCAdminHandle, &Options, this, [](const EOS_RTCAdmin_KickCompleteCallbackInfo* Data)
 			{
 				UEIK_RTCSubsystem* Subsystem = static_cast<UEIK_RTCSubsystem*>(Data->ClientData);
 				if (Subsystem)
@@ -312,7 +324,7 @@ TEnumAsByte<EEIK_Result> UEIK_RTCSubsystem::EIK_RTCAdmin_QueryJoinRoomToken(cons
 	TArray<FString>& TargetUserIpAddresses, const FEIK_RTCAdmin_OnQueryJoinRoomTokenCompleteCallback& Callback)
 {
 	OnQueryJoinRoomTokenCompleteCallback = Callback;
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -327,7 +339,7 @@ TEnumAsByte<EEIK_Result> UEIK_RTCSubsystem::EIK_RTCAdmin_QueryJoinRoomToken(cons
 			Options.LocalUserId = LocalUserId.GetValueAsEosType();
 			Options.TargetUserIdsCount = TargetUserIdsBasic.Num();
 			Options.TargetUserIds = TargetUserIdsBasic.GetData();
-			EOS_RTCAdmin_QueryJoinRoomToken(EOS_Platform_GetRTCAdminInterface(EOSRef->EOSPlatformHandle->PlatformHandle), &Options, this,[](const EOS_RTCAdmin_QueryJoinRoomTokenCompleteCallbackInfo* Data)
+			EOS_RTCAdmin_QueryJoinRoomToken(EOSRef->RTCAdminHandle, &Options, this,[](const EOS_RTCAdmin_QueryJoinRoomTokenCompleteCallbackInfo* Data)
 			{
 				if(UEIK_RTCSubsystem* Subsystem = static_cast<UEIK_RTCSubsystem*>(Data->ClientData))
 				{
@@ -344,8 +356,7 @@ TEnumAsByte<EEIK_Result> UEIK_RTCSubsystem::EIK_RTCAdmin_QueryJoinRoomToken(cons
 FEIK_NotificationId UEIK_RTCSubsystem::EIK_RTCAudio_AddNotifyAudioBeforeRender(FEIK_ProductUserId LocalUserId,
 	const FString& RoomName, bool bUnmixedAudio, const FEIK_RTCAudio_OnAudioBeforeRenderCallback& Callback)
 {
-	OnAudioBeforeRenderCallback = Callback;
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -354,14 +365,48 @@ FEIK_NotificationId UEIK_RTCSubsystem::EIK_RTCAudio_AddNotifyAudioBeforeRender(F
 			Options.LocalUserId = LocalUserId.GetValueAsEosType();
 			Options.RoomName = TCHAR_TO_ANSI(*RoomName);
 			Options.bUnmixedAudio = bUnmixedAudio;
-			return EOS_RTCAudio_AddNotifyAudioBeforeRender(EOS_RTC_GetAudioInterface(EOS_Platform_GetRTCInterface(EOSRef->EOSPlatformHandle->PlatformHandle)), &Options, this, [](const EOS_RTCAudio_AudioBeforeRenderCallbackInfo* Data)
+			PRAGMA_DISABLE_DEPRECATION_WARNINGS
+			OnAudioBeforeRenderCallback = Callback;
+			PRAGMA_ENABLE_DEPRECATION_WARNINGS
+			TEIKNotification<FEIK_RTCAudio_OnAudioBeforeRenderCallback>* Notification = AudioBeforeRenderNotifications.Add(Callback, RoomName);
+			return AudioBeforeRenderNotifications.Bind(Notification, EOS_RTCAudio_AddNotifyAudioBeforeRender(EOSRef->RTCAudioHandle, &Options, Notification, [](const EOS_RTCAudio_AudioBeforeRenderCallbackInfo* Data)
 			{
-				UEIK_RTCSubsystem* Subsystem = static_cast<UEIK_RTCSubsystem*>(Data->ClientData);
-				if (Subsystem)
+				TEIKNotification<FEIK_RTCAudio_OnAudioBeforeRenderCallback>* Notification = static_cast<TEIKNotification<FEIK_RTCAudio_OnAudioBeforeRenderCallback>*>(Data->ClientData);
+				// Only copy the buffer into a Blueprint struct when someone is listening
+				if (Notification && Notification->Delegate.IsBound() && Data->Buffer && Data->Buffer->Frames)
 				{
-					Subsystem->OnAudioBeforeRenderCallback.ExecuteIfBound(Data->LocalUserId, UTF8_TO_TCHAR(Data->RoomName), Data->Buffer, Data->ParticipantId);
+					Notification->Delegate.Execute(Data->LocalUserId, Notification->RoomName, Data->Buffer, Data->ParticipantId);
 				}
-			});
+			}));
+		}
+	}
+	return FEIK_NotificationId();
+}
+
+FEIK_NotificationId UEIK_RTCSubsystem::AddNotifyAudioBeforeRenderNative(EOS_ProductUserId LocalUserId,
+	const FString& RoomName, bool bUnmixedAudio, const FEIK_RTCAudio_OnAudioBeforeRenderNative& Callback)
+{
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
+	{
+		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
+		{
+			EOS_RTCAudio_AddNotifyAudioBeforeRenderOptions Options = { };
+			Options.ApiVersion = EOS_RTCAUDIO_ADDNOTIFYAUDIOBEFORERENDER_API_LATEST;
+			Options.LocalUserId = LocalUserId;
+			const FTCHARToUTF8 Utf8RoomName(*RoomName);
+			Options.RoomName = Utf8RoomName.Get();
+			Options.bUnmixedAudio = bUnmixedAudio;
+			TEIKNotification<FEIK_RTCAudio_OnAudioBeforeRenderNative>* Entry = AudioBeforeRenderNativeNotifications.Add(Callback, RoomName);
+			return AudioBeforeRenderNativeNotifications.Bind(Entry, EOS_RTCAudio_AddNotifyAudioBeforeRender(EOSRef->RTCAudioHandle, &Options, Entry, [](const EOS_RTCAudio_AudioBeforeRenderCallbackInfo* Data)
+			{
+				TEIKNotification<FEIK_RTCAudio_OnAudioBeforeRenderNative>* Notification = static_cast<TEIKNotification<FEIK_RTCAudio_OnAudioBeforeRenderNative>*>(Data->ClientData);
+				EOS_RTCAudio_AudioBuffer* Buffer = Data->Buffer;
+				if (Notification && Buffer && Buffer->Frames)
+				{
+					Notification->Delegate.ExecuteIfBound(Data->LocalUserId, *Notification->RoomName, Data->ParticipantId,
+						MakeArrayView(Buffer->Frames, Buffer->FramesCount * Buffer->Channels), Buffer->SampleRate, Buffer->Channels);
+				}
+			}));
 		}
 	}
 	return FEIK_NotificationId();
@@ -370,21 +415,24 @@ FEIK_NotificationId UEIK_RTCSubsystem::EIK_RTCAudio_AddNotifyAudioBeforeRender(F
 FEIK_NotificationId UEIK_RTCSubsystem::EIK_RTCAudio_AddNotifyAudioDevicesChanged(
 	const FEIK_RTCAudio_OnAudioDevicesChangedCallback& Callback)
 {
-	OnAudioDevicesChangedCallback = Callback;
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
 			EOS_RTCAudio_AddNotifyAudioDevicesChangedOptions Options = { };
 			Options.ApiVersion = EOS_RTCAUDIO_ADDNOTIFYAUDIODEVICESCHANGED_API_LATEST;
-			return EOS_RTCAudio_AddNotifyAudioDevicesChanged(EOS_RTC_GetAudioInterface(EOS_Platform_GetRTCInterface(EOSRef->EOSPlatformHandle->PlatformHandle)), &Options, this, [](const EOS_RTCAudio_AudioDevicesChangedCallbackInfo* Data)
+			PRAGMA_DISABLE_DEPRECATION_WARNINGS
+			OnAudioDevicesChangedCallback = Callback;
+			PRAGMA_ENABLE_DEPRECATION_WARNINGS
+			TEIKNotification<FEIK_RTCAudio_OnAudioDevicesChangedCallback>* Entry = AudioDevicesChangedNotifications.Add(Callback);
+			return AudioDevicesChangedNotifications.Bind(Entry, EOS_RTCAudio_AddNotifyAudioDevicesChanged(EOSRef->RTCAudioHandle, &Options, Entry, [](const EOS_RTCAudio_AudioDevicesChangedCallbackInfo* Data)
 			{
-				UEIK_RTCSubsystem* Subsystem = static_cast<UEIK_RTCSubsystem*>(Data->ClientData);
-				if (Subsystem)
+				TEIKNotification<FEIK_RTCAudio_OnAudioDevicesChangedCallback>* Notification = static_cast<TEIKNotification<FEIK_RTCAudio_OnAudioDevicesChangedCallback>*>(Data->ClientData);
+				if (Notification)
 				{
-					Subsystem->OnAudioDevicesChangedCallback.ExecuteIfBound();
+					Notification->Delegate.ExecuteIfBound();
 				}
-			});
+			}));
 		}
 	}
 	return FEIK_NotificationId();
@@ -393,8 +441,7 @@ FEIK_NotificationId UEIK_RTCSubsystem::EIK_RTCAudio_AddNotifyAudioDevicesChanged
 FEIK_NotificationId UEIK_RTCSubsystem::EIK_RTCAudio_AddNotifyAudioInputState(FEIK_ProductUserId LocalUserId,
 	const FString& RoomName, const FEIK_RTCAudio_OnAudioInputStateCallback& Callback)
 {
-	OnAudioInputStateCallback = Callback;
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -402,14 +449,18 @@ FEIK_NotificationId UEIK_RTCSubsystem::EIK_RTCAudio_AddNotifyAudioInputState(FEI
 			Options.ApiVersion = EOS_RTCAUDIO_ADDNOTIFYAUDIOINPUTSTATE_API_LATEST;
 			Options.LocalUserId = LocalUserId.GetValueAsEosType();
 			Options.RoomName = TCHAR_TO_ANSI(*RoomName);
-			return EOS_RTCAudio_AddNotifyAudioInputState(EOS_RTC_GetAudioInterface(EOS_Platform_GetRTCInterface(EOSRef->EOSPlatformHandle->PlatformHandle)), &Options, this, [](const EOS_RTCAudio_AudioInputStateCallbackInfo* Data)
+			PRAGMA_DISABLE_DEPRECATION_WARNINGS
+			OnAudioInputStateCallback = Callback;
+			PRAGMA_ENABLE_DEPRECATION_WARNINGS
+			TEIKNotification<FEIK_RTCAudio_OnAudioInputStateCallback>* Entry = AudioInputStateNotifications.Add(Callback, RoomName);
+			return AudioInputStateNotifications.Bind(Entry, EOS_RTCAudio_AddNotifyAudioInputState(EOSRef->RTCAudioHandle, &Options, Entry, [](const EOS_RTCAudio_AudioInputStateCallbackInfo* Data)
 			{
-				UEIK_RTCSubsystem* Subsystem = static_cast<UEIK_RTCSubsystem*>(Data->ClientData);
-				if (Subsystem)
+				TEIKNotification<FEIK_RTCAudio_OnAudioInputStateCallback>* Notification = static_cast<TEIKNotification<FEIK_RTCAudio_OnAudioInputStateCallback>*>(Data->ClientData);
+				if (Notification)
 				{
-					Subsystem->OnAudioInputStateCallback.ExecuteIfBound(Data->LocalUserId, UTF8_TO_TCHAR(Data->RoomName), static_cast<EEIK_ERTCAudioInputStatus>(Data->Status));
+					Notification->Delegate.ExecuteIfBound(Data->LocalUserId, Notification->RoomName, static_cast<EEIK_ERTCAudioInputStatus>(Data->Status));
 				}
-			});
+			}));
 		}
 	}
 	return FEIK_NotificationId();
@@ -418,8 +469,7 @@ FEIK_NotificationId UEIK_RTCSubsystem::EIK_RTCAudio_AddNotifyAudioInputState(FEI
 FEIK_NotificationId UEIK_RTCSubsystem::EIK_RTCAudio_AddNotifyAudioOutputState(FEIK_ProductUserId LocalUserId,
 	const FString& RoomName, const FEIK_RTCAudio_OnAudioOutputStateCallback& Callback)
 {
-	OnAudioOutputStateCallback = Callback;
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -427,14 +477,18 @@ FEIK_NotificationId UEIK_RTCSubsystem::EIK_RTCAudio_AddNotifyAudioOutputState(FE
 			Options.ApiVersion = EOS_RTCAUDIO_ADDNOTIFYAUDIOOUTPUTSTATE_API_LATEST;
 			Options.LocalUserId = LocalUserId.GetValueAsEosType();
 			Options.RoomName = TCHAR_TO_ANSI(*RoomName);
-			return EOS_RTCAudio_AddNotifyAudioOutputState(EOS_RTC_GetAudioInterface(EOS_Platform_GetRTCInterface(EOSRef->EOSPlatformHandle->PlatformHandle)), &Options, this, [](const EOS_RTCAudio_AudioOutputStateCallbackInfo* Data)
+			PRAGMA_DISABLE_DEPRECATION_WARNINGS
+			OnAudioOutputStateCallback = Callback;
+			PRAGMA_ENABLE_DEPRECATION_WARNINGS
+			TEIKNotification<FEIK_RTCAudio_OnAudioOutputStateCallback>* Entry = AudioOutputStateNotifications.Add(Callback, RoomName);
+			return AudioOutputStateNotifications.Bind(Entry, EOS_RTCAudio_AddNotifyAudioOutputState(EOSRef->RTCAudioHandle, &Options, Entry, [](const EOS_RTCAudio_AudioOutputStateCallbackInfo* Data)
 			{
-				UEIK_RTCSubsystem* Subsystem = static_cast<UEIK_RTCSubsystem*>(Data->ClientData);
-				if (Subsystem)
+				TEIKNotification<FEIK_RTCAudio_OnAudioOutputStateCallback>* Notification = static_cast<TEIKNotification<FEIK_RTCAudio_OnAudioOutputStateCallback>*>(Data->ClientData);
+				if (Notification)
 				{
-					Subsystem->OnAudioOutputStateCallback.ExecuteIfBound(Data->LocalUserId, UTF8_TO_TCHAR(Data->RoomName), static_cast<EEIK_ERTCAudioOutputStatus>(Data->Status));
+					Notification->Delegate.ExecuteIfBound(Data->LocalUserId, Notification->RoomName, static_cast<EEIK_ERTCAudioOutputStatus>(Data->Status));
 				}
-			});
+			}));
 		}
 	}
 	return FEIK_NotificationId();
@@ -443,8 +497,7 @@ FEIK_NotificationId UEIK_RTCSubsystem::EIK_RTCAudio_AddNotifyAudioOutputState(FE
 FEIK_NotificationId UEIK_RTCSubsystem::EIK_RTCAudio_AddNotifyParticipantUpdated(FEIK_ProductUserId LocalUserId,
 	const FString& RoomName, const FEIK_RTCAudio_OnParticipantUpdatedCallback& Callback)
 {
-	OnParticipantUpdatedCallback = Callback;
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -452,14 +505,18 @@ FEIK_NotificationId UEIK_RTCSubsystem::EIK_RTCAudio_AddNotifyParticipantUpdated(
 			Options.ApiVersion = EOS_RTCAUDIO_ADDNOTIFYPARTICIPANTUPDATED_API_LATEST;
 			Options.LocalUserId = LocalUserId.GetValueAsEosType();
 			Options.RoomName = TCHAR_TO_ANSI(*RoomName);
-			return EOS_RTCAudio_AddNotifyParticipantUpdated(EOS_RTC_GetAudioInterface(EOS_Platform_GetRTCInterface(EOSRef->EOSPlatformHandle->PlatformHandle)), &Options, this, [](const EOS_RTCAudio_ParticipantUpdatedCallbackInfo* Data)
+			PRAGMA_DISABLE_DEPRECATION_WARNINGS
+			OnParticipantUpdatedCallback = Callback;
+			PRAGMA_ENABLE_DEPRECATION_WARNINGS
+			TEIKNotification<FEIK_RTCAudio_OnParticipantUpdatedCallback>* Entry = AudioParticipantUpdatedNotifications.Add(Callback, RoomName);
+			return AudioParticipantUpdatedNotifications.Bind(Entry, EOS_RTCAudio_AddNotifyParticipantUpdated(EOSRef->RTCAudioHandle, &Options, Entry, [](const EOS_RTCAudio_ParticipantUpdatedCallbackInfo* Data)
 			{
-				UEIK_RTCSubsystem* Subsystem = static_cast<UEIK_RTCSubsystem*>(Data->ClientData);
-				if (Subsystem)
+				TEIKNotification<FEIK_RTCAudio_OnParticipantUpdatedCallback>* Notification = static_cast<TEIKNotification<FEIK_RTCAudio_OnParticipantUpdatedCallback>*>(Data->ClientData);
+				if (Notification)
 				{
-					Subsystem->OnParticipantUpdatedCallback.ExecuteIfBound(Data->LocalUserId, UTF8_TO_TCHAR(Data->RoomName), Data->ParticipantId,Data->bSpeaking ? true : false, static_cast<EEIK_ERTCAudioStatus>(Data->AudioStatus));
+					Notification->Delegate.ExecuteIfBound(Data->LocalUserId, Notification->RoomName, Data->ParticipantId,Data->bSpeaking ? true : false, static_cast<EEIK_ERTCAudioStatus>(Data->AudioStatus));
 				}
-			});
+			}));
 		}
 	}
 	return FEIK_NotificationId();
@@ -468,7 +525,7 @@ FEIK_NotificationId UEIK_RTCSubsystem::EIK_RTCAudio_AddNotifyParticipantUpdated(
 TEnumAsByte<EEIK_Result> UEIK_RTCSubsystem::EIK_RTCAudio_CopyInputDeviceInformationByIndex(int32 DeviceIndex,
 	FEIK_RTCAudio_InputDeviceInformation& OutDeviceInfo)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -476,7 +533,7 @@ TEnumAsByte<EEIK_Result> UEIK_RTCSubsystem::EIK_RTCAudio_CopyInputDeviceInformat
 			Options.ApiVersion = EOS_RTCAUDIO_COPYINPUTDEVICEINFORMATIONBYINDEX_API_LATEST;
 			Options.DeviceIndex = DeviceIndex;
 			EOS_RTCAudio_InputDeviceInformation* OutDeviceInfoBasic;
-			TEnumAsByte<EEIK_Result> Result = static_cast<EEIK_Result>(EOS_RTCAudio_CopyInputDeviceInformationByIndex(EOS_RTC_GetAudioInterface(EOS_Platform_GetRTCInterface(EOSRef->EOSPlatformHandle->PlatformHandle)), &Options, &OutDeviceInfoBasic));
+			TEnumAsByte<EEIK_Result> Result = static_cast<EEIK_Result>(EOS_RTCAudio_CopyInputDeviceInformationByIndex(EOSRef->RTCAudioHandle, &Options, &OutDeviceInfoBasic));
 			OutDeviceInfo = *OutDeviceInfoBasic;
 			return Result;
 		}
@@ -488,7 +545,7 @@ TEnumAsByte<EEIK_Result> UEIK_RTCSubsystem::EIK_RTCAudio_CopyInputDeviceInformat
 TEnumAsByte<EEIK_Result> UEIK_RTCSubsystem::EIK_RTCAudio_CopyOutputDeviceInformationByIndex(int32 DeviceIndex,
 	FEIK_RTCAudio_OutputDeviceInformation& OutDeviceInfo)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -496,7 +553,7 @@ TEnumAsByte<EEIK_Result> UEIK_RTCSubsystem::EIK_RTCAudio_CopyOutputDeviceInforma
 			Options.ApiVersion = EOS_RTCAUDIO_COPYOUTPUTDEVICEINFORMATIONBYINDEX_API_LATEST;
 			Options.DeviceIndex = DeviceIndex;
 			EOS_RTCAudio_OutputDeviceInformation* OutDeviceInfoBasic;
-			TEnumAsByte<EEIK_Result> Result = static_cast<EEIK_Result>(EOS_RTCAudio_CopyOutputDeviceInformationByIndex(EOS_RTC_GetAudioInterface(EOS_Platform_GetRTCInterface(EOSRef->EOSPlatformHandle->PlatformHandle)), &Options, &OutDeviceInfoBasic));
+			TEnumAsByte<EEIK_Result> Result = static_cast<EEIK_Result>(EOS_RTCAudio_CopyOutputDeviceInformationByIndex(EOSRef->RTCAudioHandle, &Options, &OutDeviceInfoBasic));
 			OutDeviceInfo = *OutDeviceInfoBasic;
 			return Result;
 		}
@@ -507,13 +564,13 @@ TEnumAsByte<EEIK_Result> UEIK_RTCSubsystem::EIK_RTCAudio_CopyOutputDeviceInforma
 
 int32 UEIK_RTCSubsystem::EIK_RTCAudio_GetInputDevicesCount()
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
 			EOS_RTCAudio_GetInputDevicesCountOptions Option = { };
 			Option.ApiVersion = EOS_RTCAUDIO_GETINPUTDEVICESCOUNT_API_LATEST;
-			return EOS_RTCAudio_GetInputDevicesCount(EOS_RTC_GetAudioInterface(EOS_Platform_GetRTCInterface(EOSRef->EOSPlatformHandle->PlatformHandle)), &Option);
+			return EOS_RTCAudio_GetInputDevicesCount(EOSRef->RTCAudioHandle, &Option);
 		}
 	}
 	UE_LOG(LogEIK, Error, TEXT("EIK_RTCSubsystem::EIK_RTCAudio_GetInputDevicesCount: OnlineSubsystemEIK is not available"));
@@ -522,13 +579,13 @@ int32 UEIK_RTCSubsystem::EIK_RTCAudio_GetInputDevicesCount()
 
 int32 UEIK_RTCSubsystem::EIK_RTCAudio_GetOutputDevicesCount()
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
 			EOS_RTCAudio_GetOutputDevicesCountOptions Option = { };
 			Option.ApiVersion = EOS_RTCAUDIO_GETOUTPUTDEVICESCOUNT_API_LATEST;
-			return EOS_RTCAudio_GetOutputDevicesCount(EOS_RTC_GetAudioInterface(EOS_Platform_GetRTCInterface(EOSRef->EOSPlatformHandle->PlatformHandle)), &Option);
+			return EOS_RTCAudio_GetOutputDevicesCount(EOSRef->RTCAudioHandle, &Option);
 		}
 	}
 	UE_LOG(LogEIK, Error, TEXT("EIK_RTCSubsystem::EIK_RTCAudio_GetOutputDevicesCount: OnlineSubsystemEIK is not available"));
@@ -537,7 +594,7 @@ int32 UEIK_RTCSubsystem::EIK_RTCAudio_GetOutputDevicesCount()
 
 void UEIK_RTCSubsystem::EIK_RTCAudio_InputDeviceInformation_Release(FEIK_RTCAudio_InputDeviceInformation& DeviceInfo)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -549,7 +606,7 @@ void UEIK_RTCSubsystem::EIK_RTCAudio_InputDeviceInformation_Release(FEIK_RTCAudi
 
 void UEIK_RTCSubsystem::EIK_RTCAudio_OutputDeviceInformation_Release(FEIK_RTCAudio_OutputDeviceInformation& DeviceInfo)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -562,13 +619,13 @@ void UEIK_RTCSubsystem::EIK_RTCAudio_OutputDeviceInformation_Release(FEIK_RTCAud
 void UEIK_RTCSubsystem::EIK_RTCAudio_QueryInputDevicesInformation(
 	const FEIK_RTCAudio_OnQueryInputDevicesInformationCallback& Callback)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
 			EOS_RTCAudio_QueryInputDevicesInformationOptions Options = { };
 			Options.ApiVersion = EOS_RTCAUDIO_QUERYINPUTDEVICESINFORMATION_API_LATEST;
-			EOS_RTCAudio_QueryInputDevicesInformation(EOS_RTC_GetAudioInterface(EOS_Platform_GetRTCInterface(EOSRef->EOSPlatformHandle->PlatformHandle)), &Options, this, [](const EOS_RTCAudio_OnQueryInputDevicesInformationCallbackInfo* Data)
+			EOS_RTCAudio_QueryInputDevicesInformation(EOSRef->RTCAudioHandle, &Options, this, [](const EOS_RTCAudio_OnQueryInputDevicesInformationCallbackInfo* Data)
 			{
 				UEIK_RTCSubsystem* Subsystem = static_cast<UEIK_RTCSubsystem*>(Data->ClientData);
 				if (Subsystem)
@@ -584,13 +641,13 @@ void UEIK_RTCSubsystem::EIK_RTCAudio_QueryOutputDevicesInformation(
 	const FEIK_RTCAudio_OnQueryOutputDevicesInformationCallback& Callback)
 {
 	OnQueryOutputDevicesInformationCallback = Callback;
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
 			EOS_RTCAudio_QueryOutputDevicesInformationOptions Options = { };
 			Options.ApiVersion = EOS_RTCAUDIO_QUERYOUTPUTDEVICESINFORMATION_API_LATEST;
-			EOS_RTCAudio_QueryOutputDevicesInformation(EOS_RTC_GetAudioInterface(EOS_Platform_GetRTCInterface(EOSRef->EOSPlatformHandle->PlatformHandle)), &Options, this, [](const EOS_RTCAudio_OnQueryOutputDevicesInformationCallbackInfo* Data)
+			EOS_RTCAudio_QueryOutputDevicesInformation(EOSRef->RTCAudioHandle, &Options, this, [](const EOS_RTCAudio_OnQueryOutputDevicesInformationCallbackInfo* Data)
 			{
 				UEIK_RTCSubsystem* Subsystem = static_cast<UEIK_RTCSubsystem*>(Data->ClientData);
 				if (Subsystem)
@@ -606,14 +663,14 @@ void UEIK_RTCSubsystem::EIK_RTCAudio_RegisterPlatformUser(const FString& Platfor
 	const FEIK_RTCAudio_OnRegisterPlatformUserCallback& Callback)
 {
 	OnRegisterPlatformUserCallback = Callback;
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
 			EOS_RTCAudio_RegisterPlatformUserOptions Options = { };
 			Options.ApiVersion = EOS_RTCAUDIO_REGISTERPLATFORMUSER_API_LATEST;
 			Options.PlatformUserId = TCHAR_TO_ANSI(*PlatformUserId);
-			EOS_RTCAudio_RegisterPlatformUser(EOS_RTC_GetAudioInterface(EOS_Platform_GetRTCInterface(EOSRef->EOSPlatformHandle->PlatformHandle)), &Options, this, [](const EOS_RTCAudio_OnRegisterPlatformUserCallbackInfo* Data)
+			EOS_RTCAudio_RegisterPlatformUser(EOSRef->RTCAudioHandle, &Options, this, [](const EOS_RTCAudio_OnRegisterPlatformUserCallbackInfo* Data)
 			{
 				UEIK_RTCSubsystem* Subsystem = static_cast<UEIK_RTCSubsystem*>(Data->ClientData);
 				if (Subsystem)
@@ -627,74 +684,86 @@ void UEIK_RTCSubsystem::EIK_RTCAudio_RegisterPlatformUser(const FString& Platfor
 
 void UEIK_RTCSubsystem::EIK_RTCAudio_RemoveNotifyAudioBeforeRender(FEIK_NotificationId NotificationId)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
-			EOS_RTCAudio_RemoveNotifyAudioBeforeRender(EOS_RTC_GetAudioInterface(EOS_Platform_GetRTCInterface(EOSRef->EOSPlatformHandle->PlatformHandle)), NotificationId.GetValueAsEosType());
+			EOS_RTCAudio_RemoveNotifyAudioBeforeRender(EOSRef->RTCAudioHandle, NotificationId.GetValueAsEosType());
 		}
 	}
+	AudioBeforeRenderNotifications.Remove(NotificationId.GetValueAsEosType());
+	AudioBeforeRenderNativeNotifications.Remove(NotificationId.GetValueAsEosType());
 }
 
 void UEIK_RTCSubsystem::EIK_RTCAudio_RemoveNotifyAudioBeforeSend(FEIK_NotificationId NotificationId)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
-			EOS_RTCAudio_RemoveNotifyAudioBeforeSend(EOS_RTC_GetAudioInterface(EOS_Platform_GetRTCInterface(EOSRef->EOSPlatformHandle->PlatformHandle)), NotificationId.GetValueAsEosType());
+			EOS_RTCAudio_RemoveNotifyAudioBeforeSend(EOSRef->RTCAudioHandle, NotificationId.GetValueAsEosType());
 		}
 	}
 }
 
 void UEIK_RTCSubsystem::EIK_RTCAudio_RemoveNotifyAudioDevicesChanged(FEIK_NotificationId NotificationId)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
-			EOS_RTCAudio_RemoveNotifyAudioDevicesChanged(EOS_RTC_GetAudioInterface(EOS_Platform_GetRTCInterface(EOSRef->EOSPlatformHandle->PlatformHandle)), NotificationId.GetValueAsEosType());
+			EOS_RTCAudio_RemoveNotifyAudioDevicesChanged(EOSRef->RTCAudioHandle, NotificationId.GetValueAsEosType());
 		}
 	}
+	AudioDevicesChangedNotifications.Remove(NotificationId.GetValueAsEosType());
 }
 
 void UEIK_RTCSubsystem::EIK_RTCAudio_RemoveNotifyAudioInputState(FEIK_NotificationId NotificationId)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
-			EOS_RTCAudio_RemoveNotifyAudioInputState(EOS_RTC_GetAudioInterface(EOS_Platform_GetRTCInterface(EOSRef->EOSPlatformHandle->PlatformHandle)), NotificationId.GetValueAsEosType());
+			EOS_RTCAudio_RemoveNotifyAudioInputState(EOSRef->RTCAudioHandle, NotificationId.GetValueAsEosType());
 		}
 	}
+	AudioInputStateNotifications.Remove(NotificationId.GetValueAsEosType());
 }
 
 void UEIK_RTCSubsystem::EIK_RTCAudio_RemoveNotifyAudioOutputState(FEIK_NotificationId NotificationId)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
-			EOS_RTCAudio_RemoveNotifyAudioOutputState(EOS_RTC_GetAudioInterface(EOS_Platform_GetRTCInterface(EOSRef->EOSPlatformHandle->PlatformHandle)), NotificationId.GetValueAsEosType());
+			EOS_RTCAudio_RemoveNotifyAudioOutputState(EOSRef->RTCAudioHandle, NotificationId.GetValueAsEosType());
 		}
 	}
+	AudioOutputStateNotifications.Remove(NotificationId.GetValueAsEosType());
 }
 
 void UEIK_RTCSubsystem::EIK_RTCAudio_RemoveNotifyParticipantUpdated(FEIK_NotificationId NotificationId)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
-			EOS_RTCAudio_RemoveNotifyParticipantUpdated(EOS_RTC_GetAudioInterface(EOS_Platform_GetRTCInterface(EOSRef->EOSPlatformHandle->PlatformHandle)), NotificationId.GetValueAsEosType());
+			EOS_RTCAudio_RemoveNotifyParticipantUpdated(EOSRef->RTCAudioHandle, NotificationId.GetValueAsEosType());
 		}
 	}
+	AudioParticipantUpdatedNotifications.Remove(NotificationId.GetValueAsEosType());
 }
 
 TEnumAsByte<EEIK_Result> UEIK_RTCSubsystem::EIK_RTCAudio_SendAudio(FEIK_ProductUserId LocalUserId,
 	const FString& RoomName, const FEIK_RTCAudio_AudioBuffer& AudioBuffer)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	// The SDK reads FramesCount * NumChannels samples, so a shorter Data array would be read past its end
+	if (AudioBuffer.FramesCount < 0 || AudioBuffer.NumChannels <= 0 || (int64)AudioBuffer.FramesCount * AudioBuffer.NumChannels != AudioBuffer.Data.Num())
+	{
+		UE_LOG(LogEIK, Error, TEXT("EIK_RTCAudioSubsystem::EIK_RTCAudio_SendAudio: %d samples don't match %d frames of %d channels"), AudioBuffer.Data.Num(), AudioBuffer.FramesCount, AudioBuffer.NumChannels);
+		return EEIK_Result::EOS_InvalidParameters;
+	}
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{	
@@ -702,20 +771,53 @@ TEnumAsByte<EEIK_Result> UEIK_RTCSubsystem::EIK_RTCAudio_SendAudio(FEIK_ProductU
 			Options.ApiVersion = EOS_RTCAUDIO_SENDAUDIO_API_LATEST;
 			Options.LocalUserId = LocalUserId.GetValueAsEosType();
 			Options.RoomName = TCHAR_TO_ANSI(*RoomName);
-			EOS_RTCAudio_AudioBuffer OptionsBuffer = AudioBuffer.GetValueAsEosType();
+			EOS_RTCAudio_AudioBuffer OptionsBuffer = AudioBuffer.GetValueAsEosType(SendAudioFrames);
 			Options.Buffer = &OptionsBuffer;
-			return static_cast<EEIK_Result>(EOS_RTCAudio_SendAudio(EOS_RTC_GetAudioInterface(EOS_Platform_GetRTCInterface(EOSRef->EOSPlatformHandle->PlatformHandle)), &Options));
+			return static_cast<EEIK_Result>(EOS_RTCAudio_SendAudio(EOSRef->RTCAudioHandle, &Options));
 		}
 	}
 	UE_LOG(LogEIK, Error, TEXT("EIK_RTCAudioSubsystem::EIK_RTCAudio_SendAudio: OnlineSubsystemEIK is not available"));
 	return EEIK_Result::EOS_NotFound;
 }
 
+TEnumAsByte<EEIK_Result> UEIK_RTCSubsystem::SendAudioNative(EOS_ProductUserId LocalUserId, const FString& RoomName,
+	TArrayView<const int16> Frames, int32 SampleRate, int32 NumChannels)
+{
+	if (NumChannels <= 0 || Frames.Num() % NumChannels != 0)
+	{
+		UE_LOG(LogEIK, Error, TEXT("EIK_RTCAudioSubsystem::SendAudioNative: %d samples can't be split into %d channels"), Frames.Num(), NumChannels);
+		return EEIK_Result::EOS_InvalidParameters;
+	}
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
+	{
+		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
+		{
+			// The SDK only reads from the buffer during the call, so it can point straight at the caller's frames
+			EOS_RTCAudio_AudioBuffer Buffer = { };
+			Buffer.ApiVersion = EOS_RTCAUDIO_AUDIOBUFFER_API_LATEST;
+			Buffer.Frames = const_cast<int16*>(Frames.GetData());
+			Buffer.FramesCount = Frames.Num() / NumChannels;
+			Buffer.SampleRate = SampleRate;
+			Buffer.Channels = NumChannels;
+
+			const FTCHARToUTF8 Utf8RoomName(*RoomName);
+			EOS_RTCAudio_SendAudioOptions Options = { };
+			Options.ApiVersion = EOS_RTCAUDIO_SENDAUDIO_API_LATEST;
+			Options.LocalUserId = LocalUserId;
+			Options.RoomName = Utf8RoomName.Get();
+			Options.Buffer = &Buffer;
+			return static_cast<EEIK_Result>(EOS_RTCAudio_SendAudio(EOSRef->RTCAudioHandle, &Options));
+		}
+	}
+	UE_LOG(LogEIK, Error, TEXT("EIK_RTCAudioSubsystem::SendAudioNative: OnlineSubsystemEIK is not available"));
+	return EEIK_Result::EOS_NotFound;
+}
+
 void UEIK_RTCSubsystem::EIK_RTCAudio_SetInputDeviceSettings(FEIK_ProductUserId LocalUserId,
 	const FString& RealDeviceId, bool bPlatformAEC, const FEIK_RTCAudio_OnSetInputDeviceSettingsCallback& Callback)
 {
 	OnSetInputDeviceSettingsCallback = Callback;
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{	
@@ -724,7 +826,7 @@ void UEIK_RTCSubsystem::EIK_RTCAudio_SetInputDeviceSettings(FEIK_ProductUserId L
 			Options.LocalUserId = LocalUserId.GetValueAsEosType();
 			Options.RealDeviceId = TCHAR_TO_ANSI(*RealDeviceId);
 			Options.bPlatformAEC = bPlatformAEC;
-			EOS_RTCAudio_SetInputDeviceSettings(EOS_RTC_GetAudioInterface(EOS_Platform_GetRTCInterface(EOSRef->EOSPlatformHandle->PlatformHandle)), &Options, this, [](const EOS_RTCAudio_OnSetInputDeviceSettingsCallbackInfo* Data)
+			EOS_RTCAudio_SetInputDeviceSettings(EOSRef->RTCAudioHandle, &Options, this, [](const EOS_RTCAudio_OnSetInputDeviceSettingsCallbackInfo* Data)
 			{
 				UEIK_RTCSubsystem* Subsystem = static_cast<UEIK_RTCSubsystem*>(Data->ClientData);
 				if (Subsystem)
@@ -740,7 +842,7 @@ void UEIK_RTCSubsystem::EIK_RTCAudio_SetOutputDeviceSettings(FEIK_ProductUserId
 	const FString& RealDeviceId, const FEIK_RTCAudio_OnSetOutputDeviceSettingsCallback& Callback)
 {
 	OnSetOutputDeviceSettingsCallback = Callback;
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{	
@@ -748,7 +850,7 @@ void UEIK_RTCSubsystem::EIK_RTCAudio_SetOutputDeviceSettings(FEIK_ProductUserId
 			Options.ApiVersion = EOS_RTCAUDIO_SETOUTPUTDEVICESETTINGS_API_LATEST;
 			Options.LocalUserId = LocalUserId.GetValueAsEosType();
 			Options.RealDeviceId = TCHAR_TO_ANSI(*RealDeviceId);
-			EOS_RTCAudio_SetOutputDeviceSettings(EOS_RTC_GetAudioInterface(EOS_Platform_GetRTCInterface(EOSRef->EOSPlatformHandle->PlatformHandle)), &Options, this, [](const EOS_RTCAudio_OnSetOutputDeviceSettingsCallbackInfo* Data)
+			EOS_RTCAudio_SetOutputDeviceSettings(EOSRef->RTCAudioHandle, &Options, this, [](const EOS_RTCAudio_OnSetOutputDeviceSettingsCallbackInfo* Data)
 			{
 				UEIK_RTCSubsystem* Subsystem = static_cast<UEIK_RTCSubsystem*>(Data->ClientData);
 				if (Subsystem)
@@ -764,14 +866,14 @@ void UEIK_RTCSubsystem::EIK_RTCAudio_UnregisterPlatformUser(const FString& Platf
 	const FEIK_RTCAudio_OnUnregisterPlatformUserCallback& Callback)
 {
 	OnUnregisterPlatformUserCallback = Callback;
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{	
 			EOS_RTCAudio_UnregisterPlatformUserOptions Options = { };
 			Options.ApiVersion = EOS_RTCAUDIO_UNREGISTERPLATFORMUSER_API_LATEST;
 			Options.PlatformUserId = TCHAR_TO_ANSI(*PlatformUserId);
-			EOS_RTCAudio_UnregisterPlatformUser(EOS_RTC_GetAudioInterface(EOS_Platform_GetRTCInterface(EOSRef->EOSPlatformHandle->PlatformHandle)), &Options, this, [](const EOS_RTCAudio_OnUnregisterPlatformUserCallbackInfo* Data)
+			EOS_RTCAudio_UnregisterPlatformUser(EOSRef->RTCAudioHandle, &Options, this, [](const EOS_RTCAudio_OnUnregisterPlatformUserCallbackInfo* Data)
 			{
 				UEIK_RTCSubsystem* Subsystem = static_cast<UEIK_RTCSubsystem*>(Data->ClientData);
 				if (Subsystem)
@@ -788,7 +890,7 @@ void UEIK_RTCSubsystem::EIK_RTCAudio_UpdateParticipantVolume(FEIK_ProductUserId
 	const FEIK_RTCAudio_OnUpdateParticipantVolumeCallback& Callback)
 {
 	OnUpdateParticipantVolumeCallback = Callback;
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{	
@@ -798,7 +900,7 @@ void UEIK_RTCSubsystem::EIK_RTCAudio_UpdateParticipantVolume(FEIK_ProductUserId
 			Options.RoomName = TCHAR_TO_ANSI(*RoomName);
 			Options.ParticipantId = ParticipantId.GetValueAsEosType();
 			Options.Volume = Volume;
-			EOS_RTCAudio_UpdateParticipantVolume(EOS_RTC_GetAudioInterface(EOS_Platform_GetRTCInterface(EOSRef->EOSPlatformHandle->PlatformHandle)), &Options, this, [](const EOS_RTCAudio_UpdateParticipantVolumeCallbackInfo* Data)
+			EOS_RTCAudio_UpdateParticipantVolume(EOSRef->RTCAudioHandle, &Options, this, [](const EOS_RTCAudio_UpdateParticipantVolumeCallbackInfo* Data)
 			{
 				UEIK_RTCSubsystem* Subsystem = static_cast<UEIK_RTCSubsystem*>(Data->ClientData);
 				if (Subsystem)
@@ -814,7 +916,7 @@ void UEIK_RTCSubsystem::EIK_RTCAudio_UpdateReceiving(FEIK_ProductUserId LocalUse
 	const FEIK_RTCAudio_OnUpdateReceivingCallback& Callback)
 {
 	OnUpdateReceivingCallback = Callback;
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{	
@@ -824,7 +926,7 @@ void UEIK_RTCSubsystem::EIK_RTCAudio_UpdateReceiving(FEIK_ProductUserId LocalUse
 			Options.RoomName = TCHAR_TO_ANSI(*RoomName);
 			Options.ParticipantId = ParticipantId.GetValueAsEosType();
 			Options.bAudioEnabled = bAudioEnabled;
-			EOS_RTCAudio_UpdateReceiving(EOS_RTC_GetAudioInterface(EOS_Platform_GetRTCInterface(EOSRef->EOSPlatformHandle->PlatformHandle)), &Options, this, [](const EOS_RTCAudio_UpdateReceivingCallbackInfo* Data)
+			EOS_RTCAudio_UpdateReceiving(EOSRef->RTCAudioHandle, &Options, this, [](const EOS_RTCAudio_UpdateReceivingCallbackInfo* Data)
 			{
 				UEIK_RTCSubsystem* Subsystem = static_cast<UEIK_RTCSubsystem*>(Data->ClientData);
 				if (Subsystem)
@@ -841,7 +943,7 @@ void UEIK_RTCSubsystem::EIK_RTCAudio_UpdateReceivingVolume(FEIK_ProductUserId Lo
 	const FString& RoomName, float Volume, const FEIK_RTCAudio_OnUpdateReceivingVolumeCallback& Callback)
 {
 	OnUpdateReceivingVolumeCallback = Callback;
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{	
@@ -850,7 +952,7 @@ void UEIK_RTCSubsystem::EIK_RTCAudio_UpdateReceivingVolume(FEIK_ProductUserId Lo
 			Options.LocalUserId = LocalUserId.GetValueAsEosType();
 			Options.RoomName = TCHAR_TO_ANSI(*RoomName);
 			Options.Volume = Volume;
-			EOS_RTCAudio_UpdateReceivingVolume(EOS_RTC_GetAudioInterface(EOS_Platform_GetRTCInterface(EOSRef->EOSPlatformHandle->PlatformHandle)), &Options, this, [](const EOS_RTCAudio_UpdateReceivingVolumeCallbackInfo* Data)
+			EOS_RTCAudio_UpdateReceivingVolume(EOSRef->RTCAudioHandle, &Options, this, [](const EOS_RTCAudio_UpdateReceivingVolumeCallbackInfo* Data)
 			{
 				UEIK_RTCSubsystem* Subsystem = static_cast<UEIK_RTCSubsystem*>(Data->ClientData);
 				if (Subsystem)
@@ -866,7 +968,7 @@ void UEIK_RTCSubsystem::EIK_RTCAudio_UpdateSending(FEIK_ProductUserId LocalUserI
 	TEnumAsByte<EEIK_ERTCAudioStatus> AudioStatus, const FEIK_RTCAudio_OnUpdateSendingCallback& Callback)
 {
 	OnUpdateSendingCallback = Callback;
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{	
@@ -875,7 +977,7 @@ void UEIK_RTCSubsystem::EIK_RTCAudio_UpdateSending(FEIK_ProductUserId LocalUserI
 			Options.LocalUserId = LocalUserId.GetValueAsEosType();
 			Options.RoomName = TCHAR_TO_ANSI(*RoomName);
 			Options.AudioStatus = static_cast<EOS_ERTCAudioStatus>(AudioStatus.GetValue());
-			EOS_RTCAudio_UpdateSending(EOS_RTC_GetAudioInterface(EOS_Platform_GetRTCInterface(EOSRef->EOSPlatformHandle->PlatformHandle)), &Options, this, [](const EOS_RTCAudio_UpdateSendingCallbackInfo* Data)
+			EOS_RTCAudio_UpdateSending(EOSRef->RTCAudioHandle, &Options, this, [](const EOS_RTCAudio_UpdateSendingCallbackInfo* Data)
 			{
 				UEIK_RTCSubsystem* Subsystem = static_cast<UEIK_RTCSubsystem*>(Data->ClientData);
 				if (Subsystem)
@@ -891,7 +993,7 @@ void UEIK_RTCSubsystem::EIK_RTCAudio_UpdateSendingVolume(FEIK_ProductUserId Loca
 	float Volume, const FEIK_RTCAudio_OnUpdateSendingVolumeCallback& Callback)
 {
 	OnUpdateSendingVolumeCallback = Callback;
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{	
@@ -900,7 +1002,7 @@ void UEIK_RTCSubsystem::EIK_RTCAudio_UpdateSendingVolume(FEIK_ProductUserId Loca
 			Options.LocalUserId = LocalUserId.GetValueAsEosType();
 			Options.RoomName = TCHAR_TO_ANSI(*RoomName);
 			Options.Volume = Volume;
-			EOS_RTCAudio_UpdateSendingVolume(EOS_RTC_GetAudioInterface(EOS_Platform_GetRTCInterface(EOSRef->EOSPlatformHandle->PlatformHandle)), &Options, this, [](const EOS_RTCAudio_UpdateSendingVolumeCallbackInfo* Data)
+			EOS_RTCAudio_UpdateSendingVolume(EOSRef->RTCAudioHandle, &Options, this, [](const EOS_RTCAudio_UpdateSendingVolumeCallbackInfo* Data)
 			{
 				UEIK_RTCSubsystem* Subsystem = static_cast<UEIK_RTCSubsystem*>(Data->ClientData);
 				if (Subsystem)
@@ -915,8 +1017,7 @@ void UEIK_RTCSubsystem::EIK_RTCAudio_UpdateSendingVolume(FEIK_ProductUserId Loca
 FEIK_NotificationId UEIK_RTCSubsystem::EIK_RTCData_AddNotifyDataReceived(FEIK_ProductUserId LocalUserId,
 	const FString& RoomName, const FEIK_RTCData_OnDataReceivedCallback& Callback)
 {
-	OnDataReceivedCallback = Callback;
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -924,17 +1025,26 @@ FEIK_NotificationId UEIK_RTCSubsystem::EIK_RTCData_AddNotifyDataReceived(FEIK_Pr
 			Options.ApiVersion = EOS_RTCDATA_ADDNOTIFYDATARECEIVED_API_LATEST;
 			Options.LocalUserId = LocalUserId.GetValueAsEosType();
 			Options.RoomName = TCHAR_TO_ANSI(*RoomName);
-			return EOS_RTCData_AddNotifyDataReceived(EOS_RTC_GetDataInterface(EOS_Platform_GetRTCInterface(EOSRef->EOSPlatformHandle->PlatformHandle)), &Options, this, [](const EOS_RTCData_DataReceivedCallbackInfo* Data)
+			PRAGMA_DISABLE_DEPRECATION_WARNINGS
+			OnDataReceivedCallback = Callback;
+			PRAGMA_ENABLE_DEPRECATION_WARNINGS
+			TEIKNotification<FEIK_RTCData_OnDataReceivedCallback>* Notification = DataReceivedNotifications.Add(Callback, RoomName);
+			return DataReceivedNotifications.Bind(Notification, EOS_RTCData_AddNotifyDataReceived(EOS_RTC_GetDataInterface(EOSRef->RTCHandle), &Options, Notification, [](const EOS_RTCData_DataReceivedCallbackInfo* Data)
 			{
-				UEIK_RTCSubsystem* Subsystem = static_cast<UEIK_RTCSubsystem*>(Data->ClientData);
-				if (Subsystem)
+				TEIKNotification<FEIK_RTCData_OnDataReceivedCallback>* Notification = static_cast<TEIKNotification<FEIK_RTCData_OnDataReceivedCallback>*>(Data->ClientData);
+				if (Notification)
 				{
-					TArray<uint8> DataStr;
-					DataStr.SetNumUninitialized(Data->DataLengthBytes);
-					FMemory::Memcpy(DataStr.GetData(), Data->Data, Data->DataLengthBytes);
-					Subsystem->OnDataReceivedCallback.ExecuteIfBound(Data->LocalUserId, UTF8_TO_TCHAR(Data->RoomName), DataStr, Data->ParticipantId);
+					// Reuse the subscription's buffer, so a steady stream of packets stops allocating once it has grown
+					TArray<uint8>& Payload = Notification->PayloadBuffer;
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 4
+					Payload.SetNumUninitialized(Data->DataLengthBytes, EAllowShrinking::No);
+#else
+					Payload.SetNumUninitialized(Data->DataLengthBytes, false);
+#endif
+					FMemory::Memcpy(Payload.GetData(), Data->Data, Data->DataLengthBytes);
+					Notification->Delegate.ExecuteIfBound(Data->LocalUserId, Notification->RoomName, Payload, Data->ParticipantId);
 				}
-			});
+			}));
 		}
 	}
 	UE_LOG(LogEIK, Error, TEXT("EIK_RTCSubsystem::EIK_RTCData_AddNotifyDataReceived: OnlineSubsystemEIK is not available"));
@@ -944,8 +1054,7 @@ FEIK_NotificationId UEIK_RTCSubsystem::EIK_RTCData_AddNotifyDataReceived(FEIK_Pr
 FEIK_NotificationId UEIK_RTCSubsystem::EIK_RTCData_AddNotifyParticipantUpdated(FEIK_ProductUserId LocalUserId,
 	const FString& RoomName, const FEIK_RTCData_OnParticipantUpdatedCallback& Callback)
 {
-	OnData_ParticipantUpdatedCallback = Callback;
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -953,15 +1062,19 @@ FEIK_NotificationId UEIK_RTCSubsystem::EIK_RTCData_AddNotifyParticipantUpdated(F
 			Options.ApiVersion = EOS_RTCDATA_ADDNOTIFYPARTICIPANTUPDATED_API_LATEST;
 			Options.LocalUserId = LocalUserId.GetValueAsEosType();
 			Options.RoomName = TCHAR_TO_ANSI(*RoomName);
-			return EOS_RTCData_AddNotifyParticipantUpdated(EOS_RTC_GetDataInterface(EOS_Platform_GetRTCInterface(EOSRef->EOSPlatformHandle->PlatformHandle)), &Options, this, [](const EOS_RTCData_ParticipantUpdatedCallbackInfo* Data)
+			PRAGMA_DISABLE_DEPRECATION_WARNINGS
+			OnData_ParticipantUpdatedCallback = Callback;
+			PRAGMA_ENABLE_DEPRECATION_WARNINGS
+			TEIKNotification<FEIK_RTCData_OnParticipantUpdatedCallback>* Entry = DataParticipantUpdatedNotifications.Add(Callback, RoomName);
+			return DataParticipantUpdatedNotifications.Bind(Entry, EOS_RTCData_AddNotifyParticipantUpdated(EOS_RTC_GetDataInterface(EOSRef->RTCHandle), &Options, Entry, [](const EOS_RTCData_ParticipantUpdatedCallbackInfo* Data)
 			{
-				UEIK_RTCSubsystem* Subsystem = static_cast<UEIK_RTCSubsystem*>(Data->ClientData);
-				if (Subsystem)
+				TEIKNotification<FEIK_RTCData_OnParticipantUpdatedCallback>* Notification = static_cast<TEIKNotification<FEIK_RTCData_OnParticipantUpdatedCallback>*>(Data->ClientData);
+				if (Notification)
 				{
-					Subsystem->OnData_ParticipantUpdatedCallback.ExecuteIfBound(Data->LocalUserId, UTF8_TO_TCHAR(Data->RoomName), Data->ParticipantId, static_cast<EEIK_ERTCDataStatus>(Data->DataStatus));
+					Notification->Delegate.ExecuteIfBound(Data->LocalUserId, Notification->RoomName, Data->ParticipantId, static_cast<EEIK_ERTCDataStatus>(Data->DataStatus));
 					
 				}
-			});
+			}));
 		}
 	}
 	UE_LOG(LogEIK, Error, TEXT("EIK_RTCSubsystem::EIK_RTCData_AddNotifyParticipantUpdated: OnlineSubsystemEIK is not available"));
@@ -970,24 +1083,26 @@ FEIK_NotificationId UEIK_RTCSubsystem::EIK_RTCData_AddNotifyParticipantUpdated(F
 
 void UEIK_RTCSubsystem::EIK_RTCData_RemoveNotifyDataReceived(FEIK_NotificationId NotificationId)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
-			EOS_RTCData_RemoveNotifyDataReceived(EOS_RTC_GetDataInterface(EOS_Platform_GetRTCInterface(EOSRef->EOSPlatformHandle->PlatformHandle)), NotificationId.GetValueAsEosType());
+			EOS_RTCData_RemoveNotifyDataReceived(EOS_RTC_GetDataInterface(EOSRef->RTCHandle), NotificationId.GetValueAsEosType());
 		}
 	}
+	DataReceivedNotifications.Remove(NotificationId.GetValueAsEosType());
 }
 
 void UEIK_RTCSubsystem::EIK_RTCData_RemoveNotifyParticipantUpdated(FEIK_NotificationId NotificationId)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
-			EOS_RTCData_RemoveNotifyParticipantUpdated(EOS_RTC_GetDataInterface(EOS_Platform_GetRTCInterface(EOSRef->EOSPlatformHandle->PlatformHandle)), NotificationId.GetValueAsEosType());
+			EOS_RTCData_RemoveNotifyParticipantUpdated(EOS_RTC_GetDataInterface(EOSRef->RTCHandle), NotificationId.GetValueAsEosType());
 		}
 	}
+	DataParticipantUpdatedNotifications.Remove(NotificationId.GetValueAsEosType());
 }
 
 TEnumAsByte<EEIK_Result> UEIK_RTCSubsystem::EIK_RTCData_SendData(FEIK_ProductUserId LocalUserId,
@@ -998,7 +1113,7 @@ TEnumAsByte<EEIK_Result> UEIK_RTCSubsystem::EIK_RTCData_SendData(FEIK_ProductUse
 		UE_LOG(LogEIK, Error, TEXT("EIK_RTCSubsystem::EIK_RTCData_SendData: Data is empty"));
 		return EEIK_Result::EOS_InvalidParameters;
 	}
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{	
@@ -1008,7 +1123,7 @@ TEnumAsByte<EEIK_Result> UEIK_RTCSubsystem::EIK_RTCData_SendData(FEIK_ProductUse
 			Options.RoomName = TCHAR_TO_ANSI(*RoomName);
 			Options.Data = Data.GetData();
 			Options.DataLengthBytes = Data.Num();
-			return static_cast<EEIK_Result>(EOS_RTCData_SendData(EOS_RTC_GetDataInterface(EOS_Platform_GetRTCInterface(EOSRef->EOSPlatformHandle->PlatformHandle)), &Options));
+			return static_cast<EEIK_Result>(EOS_RTCData_SendData(EOS_RTC_GetDataInterface(EOSRef->RTCHandle), &Options));
 		}
 	}
 	UE_LOG(LogEIK, Error, TEXT("EIK_RTCSubsystem::EIK_RTCData_SendData: OnlineSubsystemEIK is not available"));
@@ -1019,7 +1134,7 @@ void UEIK_RTCSubsystem::EIK_RTCData_UpdateReceiving(FEIK_ProductUserId LocalUser
 	FEIK_ProductUserId ParticipantId, bool bDataEnabled, const FEIK_RTCData_OnUpdateReceivingCallback& Callback)
 {
 	OnData_UpdateReceivingCallback = Callback;
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -1029,7 +1144,7 @@ void UEIK_RTCSubsystem::EIK_RTCData_UpdateReceiving(FEIK_ProductUserId LocalUser
 			Options.RoomName = TCHAR_TO_ANSI(*RoomName);
 			Options.ParticipantId = ParticipantId.GetValueAsEosType();
 			Options.bDataEnabled = bDataEnabled;
-			EOS_RTCData_UpdateReceiving(EOS_RTC_GetDataInterface(EOS_Platform_GetRTCInterface(EOSRef->EOSPlatformHandle->PlatformHandle)), &Options, this, [](const EOS_RTCData_UpdateReceivingCallbackInfo* Data)
+			EOS_RTCData_UpdateReceiving(EOS_RTC_GetDataInterface(EOSRef->RTCHandle), &Options, this, [](const EOS_RTCData_UpdateReceivingCallbackInfo* Data)
 			{
 				UEIK_RTCSubsystem* Subsystem = static_cast<UEIK_RTCSubsystem*>(Data->ClientData);
 				if (Subsystem)
@@ -1045,7 +1160,7 @@ void UEIK_RTCSubsystem::EIK_RTCData_UpdateSending(FEIK_ProductUserId LocalUserId
 	bool bDataEnabled, const FEIK_RTCData_OnUpdateSendingCallback& Callback)
 {
 	OnData_UpdateSendingCallback = Callback;
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -1054,7 +1169,7 @@ void UEIK_RTCSubsystem::EIK_RTCData_UpdateSending(FEIK_ProductUserId LocalUserId
 			Options.LocalUserId = LocalUserId.GetValueAsEosType();
 			Options.RoomName = TCHAR_TO_ANSI(*RoomName);
 			Options.bDataEnabled = bDataEnabled;
-			EOS_RTCData_UpdateSending(EOS_RTC_GetDataInterface(EOS_Platform_GetRTCInterface(EOSRef->EOSPlatformHandle->PlatformHandle)), &Options, this, [](const EOS_RTCData_UpdateSendingCallbackInfo* Data)
+			EOS_RTCData_UpdateSending(EOS_RTC_GetDataInterface(EOSRef->RTCHandle), &Options, this, [](const EOS_RTCData_UpdateSendingCallbackInfo* Data)
 			{
 				UEIK_RTCSubsystem* Subsystem = static_cast<UEIK_RTCSubsystem*>(Data->ClientData);
 				if (Subsystem)
@@ -1065,3 +1180,71 @@ void UEIK_RTCSubsystem::EIK_RTCData_UpdateSending(FEIK_ProductUserId LocalUserId
 		}
 	}
 }
+
+void UEIK_RTCSubsystem::EIK_RTC_RemoveRoomNotifications(const FString& RoomName)
+{
+	if (RoomName.IsEmpty())
+	{
+		return;
+	}
+	RemoveNotifications(FName(*RoomName));
+}
+
+void UEIK_RTCSubsystem::Deinitialize()
+{
+	// The SDK would otherwise keep calling into entries that are destroyed along with the subsystem
+	RemoveNotifications(NAME_None);
+	Super::Deinitialize();
+}
+
+void UEIK_RTCSubsystem::RemoveNotifications(FName RoomHandle)
+{
+	for (const EOS_NotificationId NotificationId : DisconnectedNotifications.GetNotificationIds(RoomHandle))
+	{
+		EIK_RTC_RemoveNotifyDisconnected(NotificationId);
+	}
+	for (const EOS_NotificationId NotificationId : ParticipantStatusChangedNotifications.GetNotificationIds(RoomHandle))
+	{
+		EIK_RTC_RemoveNotifyParticipantStatusChanged(NotificationId);
+	}
+	for (const EOS_NotificationId NotificationId : RoomStatisticsUpdatedNotifications.GetNotificationIds(RoomHandle))
+	{
+		EIK_RTC_RemoveNotifyRoomStatisticsUpdated(NotificationId);
+	}
+	for (const EOS_NotificationId NotificationId : AudioBeforeRenderNotifications.GetNotificationIds(RoomHandle))
+	{
+		EIK_RTCAudio_RemoveNotifyAudioBeforeRender(NotificationId);
+	}
+	for (const EOS_NotificationId NotificationId : AudioBeforeRenderNativeNotifications.GetNotificationIds(RoomHandle))
+	{
+		EIK_RTCAudio_RemoveNotifyAudioBeforeRender(NotificationId);
+	}
+	if (RoomHandle.IsNone())
+	{
+		// Device changes aren't tied to a room, so they're only removed along with everything else
+		for (const EOS_NotificationId NotificationId : AudioDevicesChangedNotifications.GetNotificationIds())
+		{
+			EIK_RTCAudio_RemoveNotifyAudioDevicesChanged(NotificationId);
+		}
+	}
+	for (const EOS_NotificationId NotificationId : AudioInputStateNotifications.GetNotificationIds(RoomHandle))
+	{
+		EIK_RTCAudio_RemoveNotifyAudioInputState(NotificationId);
+	}
+	for (const EOS_NotificationId NotificationId : AudioOutputStateNotifications.GetNotificationIds(RoomHandle))
+	{
+		EIK_RTCAudio_RemoveNotifyAudioOutputState(NotificationId);
+	}
+	for (const EOS_NotificationId NotificationId : AudioParticipantUpdatedNotifications.GetNotificationIds(RoomHandle))
+	{
+		EIK_RTCAudio_RemoveNotifyParticipantUpdated(NotificationId);
+	}
+	for (const EOS_NotificationId NotificationId : DataReceivedNotifications.GetNotificationIds(RoomHandle))
+	{
+		EIK_RTCData_RemoveNotifyDataReceived(NotificationId);
+	}
+	for (const EOS_NotificationId NotificationId : DataParticipantUpdatedNotifications.GetNotificationIds(RoomHandle))
+	{
+		EIK_RTCData_RemoveNotifyParticipantUpdated(NotificationId);
+	}
+}
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "OnlineSubsystemEIK/SdkFunctions/EIK_SharedFunctionFile.h"
+#include "OnlineSubsystemEIK/SdkFunctions/EIK_NotificationRegistry.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 
 THIRD_PARTY_INCLUDES_START
@@ -65,6 +66,8 @@ DECLARE_DYNAMIC_DELEGATE_ThreeParams(FEIK_RTC_OnLeaveRoomCallback, const TEnumAs
 DECLARE_DYNAMIC_DELEGATE_OneParam(FEIK_RTCAdmin_OnKickCompleteCallback, const TEnumAsByte<EEIK_Result>, ResultCode);
 DECLARE_DYNAMIC_DELEGATE_FourParams(FEIK_RTCAdmin_OnQueryJoinRoomTokenCompleteCallback, const TEnumAsByte<EEIK_Result>, ResultCode, const FString&, RoomName, const FEIK_ProductUserId&, LocalUserId, const TArray<FEIK_RTCAdmin_UserToken>&, UserTokens);
 DECLARE_DYNAMIC_DELEGATE_FourParams(FEIK_RTCAudio_OnAudioBeforeRenderCallback, const FEIK_ProductUserId&, LocalUserId, const FString&, RoomName, const FEIK_RTCAudio_AudioBuffer&, AudioBuffer, const FEIK_ProductUserId&, ParticipantId);
+//Native counterpart of FEIK_RTCAudio_OnAudioBeforeRenderCallback. Frames is a view into the SDK's buffer, only valid during the call, and may be modified in place.
+DECLARE_DELEGATE_SixParams(FEIK_RTCAudio_OnAudioBeforeRenderNative, EOS_ProductUserId /*LocalUserId*/, const TCHAR* /*RoomName*/, EOS_ProductUserId /*ParticipantId*/, TArrayView<int16> /*Frames*/, int32 /*SampleRate*/, int32 /*NumChannels*/);
 DECLARE_DYNAMIC_DELEGATE(FEIK_RTCAudio_OnAudioDevicesChangedCallback);
 DECLARE_DYNAMIC_DELEGATE_ThreeParams(FEIK_RTCAudio_OnAudioInputStateCallback, const FEIK_ProductUserId&, LocalUserId, const FString&, RoomName, const TEnumAsByte<EEIK_ERTCAudioInputStatus>&, AudioInputState);
 DECLARE_DYNAMIC_DELEGATE_ThreeParams(FEIK_RTCAudio_OnAudioOutputStateCallback, const FEIK_ProductUserId&, LocalUserId, const FString&, RoomName, const TEnumAsByte<EEIK_ERTCAudioOutputStatus>&, AudioOutputState);
@@ -91,17 +94,14 @@ class ONLINESUBSYSTEMEIK_API UEIK_RTCSubsystem : public UGameInstanceSubsystem
 
 public:
 	
-	FEIK_RTC_OnDisconnectedCallback OnDisconnectedCallback;
 	//Register to receive notifications when disconnected from the room. If the returned NotificationId is valid, you must call EOS_RTC_RemoveNotifyDisconnected when you no longer wish to have your CompletionDelegate called. This function will always return EOS_INVALID_NOTIFICATIONID when used with lobby RTC room. To be notified of the connection status of a Lobby-managed RTC room, use the EOS_Lobby_AddNotifyRTCRoomConnectionChanged function instead.
 	UFUNCTION(BlueprintCallable, Category = "EOS Integration Kit | SDK Functions | RTC Interface", DisplayName="EOS_RTC_AddNotifyDisconnected")
 	FEIK_NotificationId EIK_RTC_AddNotifyDisconnected(FEIK_ProductUserId LocalUserId, const FString& RoomName, const FEIK_RTC_OnDisconnectedCallback& Callback);
 
-	FEIK_RTC_OnParticipantStatusChangedCallback OnParticipantStatusChangedCallback;
 	//Register to receive notifications when a participant's status changes (e.g: join or leave the room), or when the participant is added or removed from an applicable block list (e.g: Epic block list and/or current platform's block list). If the returned NotificationId is valid, you must call EOS_RTC_RemoveNotifyParticipantStatusChanged when you no longer wish to have your CompletionDelegate called. If you register to this notification before joining a room, you will receive a notification for every member already in the room when you join said room. This allows you to know who is already in the room when you join. To be used effectively with a Lobby-managed RTC room, this should be registered during the EOS_Lobby_CreateLobby or EOS_Lobby_JoinLobby completion callbacks when the ResultCode is EOS_Success. If this notification is registered after that point, it is possible to miss notifications for already-existing room participants. You can use this notification to detect internal automatic RTC blocks due to block lists. When a participant joins a room and while the system resolves the block list status of said participant, the participant is set to blocked and you'll receive a notification with ParticipantStatus set to EOS_RTCPS_Joined and bParticipantInBlocklist set to true. Once the block list status is resolved, if the player is not in any applicable block list(s), it is then unblocked and a new notification is sent with ParticipantStatus set to EOS_RTCPS_Joined and bParticipantInBlocklist set to false.
 	UFUNCTION(BlueprintCallable, Category = "EOS Integration Kit | SDK Functions | RTC Interface", DisplayName="EOS_RTC_AddNotifyParticipantStatusChanged")
 	FEIK_NotificationId EIK_RTC_AddNotifyParticipantStatusChanged(FEIK_ProductUserId LocalUserId, const FString& RoomName, const FEIK_RTC_OnParticipantStatusChangedCallback& Callback);
 	
-	FEIK_RTC_OnRoomStatisticsUpdatedCallback OnRoomStatisticsUpdatedCallback;
 	//Register to receive notifications to receiving periodical statistics update. If the returned NotificationId is valid, you must call EOS_RTC_RemoveNotifyRoomStatisticsUpdated when you no longer wish to have your StatisticsUpdateHandler called.
 	UFUNCTION(BlueprintCallable, Category = "EOS Integration Kit | SDK Functions | RTC Interface", DisplayName="EOS_RTC_AddNotifyRoomStatisticsUpdated")
 	FEIK_NotificationId EIK_RTC_AddNotifyRoomStatisticsUpdated(FEIK_ProductUserId LocalUserId, const FString& RoomName, const FEIK_RTC_OnRoomStatisticsUpdatedCallback& Callback);
@@ -159,12 +159,13 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "EOS Integration Kit | SDK Functions | RTC Interface", DisplayName="EOS_RTCAdmin_QueryJoinRoomToken")
 	TEnumAsByte<EEIK_Result> EIK_RTCAdmin_QueryJoinRoomToken(const FString& RoomName, FEIK_ProductUserId LocalUserId, const TArray<FEIK_ProductUserId>& TargetUserIds, TArray<FString>& TargetUserIpAddresses, const FEIK_RTCAdmin_OnQueryJoinRoomTokenCompleteCallback& Callback);
 
-	FEIK_RTCAudio_OnAudioBeforeRenderCallback OnAudioBeforeRenderCallback;
 	//Register to receive notifications with remote audio buffers before they are rendered. This gives you access to the audio data received, allowing for example the implementation of custom filters/effects. If the returned NotificationId is valid, you must call EOS_RTCAudio_RemoveNotifyAudioBeforeRender when you no longer wish to have your CompletionDelegate called.
 	UFUNCTION(BlueprintCallable, Category = "EOS Integration Kit | SDK Functions | RTC Interface", DisplayName="EOS_RTCAudio_AddNotifyAudioBeforeRender")
 	FEIK_NotificationId EIK_RTCAudio_AddNotifyAudioBeforeRender(FEIK_ProductUserId LocalUserId, const FString& RoomName, bool bUnmixedAudio, const FEIK_RTCAudio_OnAudioBeforeRenderCallback& Callback);
 
-	FEIK_RTCAudio_OnAudioDevicesChangedCallback OnAudioDevicesChangedCallback;
+	//Native version of EIK_RTCAudio_AddNotifyAudioBeforeRender. The callback gets the SDK's int16 frames directly instead of a copy widened to int32, and is called on the audio thread.
+	FEIK_NotificationId AddNotifyAudioBeforeRenderNative(EOS_ProductUserId LocalUserId, const FString& RoomName, bool bUnmixedAudio, const FEIK_RTCAudio_OnAudioBeforeRenderNative& Callback);
+
 	/*
 	*Register to receive notifications when an audio device is added or removed to the system. If the returned NotificationId is valid, you must call EOS_RTCAudio_RemoveNotifyAudioDevicesChanged when you no longer wish to have your CompletionDelegate called. The library will try to use user selected audio device while following these rules:
 
@@ -179,17 +180,14 @@ public:
 	FEIK_NotificationId EIK_RTCAudio_AddNotifyAudioDevicesChanged(const FEIK_RTCAudio_OnAudioDevicesChangedCallback& Callback);
 
 
-	FEIK_RTCAudio_OnAudioInputStateCallback OnAudioInputStateCallback;
 	//Register to receive notifications when audio input state changed. If the returned NotificationId is valid, you must call EOS_RTCAudio_RemoveNotifyAudioInputState when you no longer wish to have your CompletionDelegate called.
 	UFUNCTION(BlueprintCallable, Category = "EOS Integration Kit | SDK Functions | RTC Interface", DisplayName="EOS_RTCAudio_AddNotifyAudioInputState")
 	FEIK_NotificationId EIK_RTCAudio_AddNotifyAudioInputState(FEIK_ProductUserId LocalUserId, const FString& RoomName, const FEIK_RTCAudio_OnAudioInputStateCallback& Callback);
 
-	FEIK_RTCAudio_OnAudioOutputStateCallback OnAudioOutputStateCallback;
 	//Register to receive notifications when audio output state changed. If the returned NotificationId is valid, you must call EOS_RTCAudio_RemoveNotifyAudioOutputState when you no longer wish to have your CompletionDelegate called.
 	UFUNCTION(BlueprintCallable, Category = "EOS Integration Kit | SDK Functions | RTC Interface", DisplayName="EOS_RTCAudio_AddNotifyAudioOutputState")
 	FEIK_NotificationId EIK_RTCAudio_AddNotifyAudioOutputState(FEIK_ProductUserId LocalUserId, const FString& RoomName, const FEIK_RTCAudio_OnAudioOutputStateCallback& Callback);
 
-	FEIK_RTCAudio_OnParticipantUpdatedCallback OnParticipantUpdatedCallback;
 	//Register to receive notifications when a room participant audio status is updated (f.e when mute state changes or speaking flag changes). The notification is raised when the participant's audio status is updated. In order not to miss any participant status changes, applications need to add the notification before joining a room. If the returned NotificationId is valid, you must call EOS_RTCAudio_RemoveNotifyParticipantUpdated when you no longer wish to have your CompletionDelegate called.
 	UFUNCTION(BlueprintCallable, Category = "EOS Integration Kit | SDK Functions | RTC Interface", DisplayName="EOS_RTCAudio_AddNotifyParticipantUpdated")
 	FEIK_NotificationId EIK_RTCAudio_AddNotifyParticipantUpdated(FEIK_ProductUserId LocalUserId, const FString& RoomName, const FEIK_RTCAudio_OnParticipantUpdatedCallback& Callback);
@@ -261,6 +259,9 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "EOS Integration Kit | SDK Functions | RTC Interface", DisplayName="EOS_RTCAudio_SendAudio")
 	TEnumAsByte<EEIK_Result> EIK_RTCAudio_SendAudio(FEIK_ProductUserId LocalUserId, const FString& RoomName, const FEIK_RTCAudio_AudioBuffer& AudioBuffer);
 
+	//Native version of EIK_RTCAudio_SendAudio. Frames holds interleaved int16 samples and is passed to the SDK as is, without any copy or allocation. Like the other SDK calls it has to be made on the game thread.
+	TEnumAsByte<EEIK_Result> SendAudioNative(EOS_ProductUserId LocalUserId, const FString& RoomName, TArrayView<const int16> Frames, int32 SampleRate, int32 NumChannels);
+
 	FEIK_RTCAudio_OnSetInputDeviceSettingsCallback OnSetInputDeviceSettingsCallback;
 	//Use this function to set audio input device settings, such as the active input device, or platform AEC.
 	UFUNCTION(BlueprintCallable, Category = "EOS Integration Kit | SDK Functions | RTC Interface", DisplayName="EOS_RTCAudio_SetInputDeviceSettings")
@@ -302,12 +303,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "EOS Integration Kit | SDK Functions | RTC Interface", DisplayName="EOS_RTCAudio_UpdateSendingVolume")
 	void EIK_RTCAudio_UpdateSendingVolume(FEIK_ProductUserId LocalUserId, const FString& RoomName, float Volume, const FEIK_RTCAudio_OnUpdateSendingVolumeCallback& Callback);
 
-	FEIK_RTCData_OnDataReceivedCallback OnDataReceivedCallback;
 	//Register to receive notifications with remote data packet received. If the returned NotificationId is valid, you must call EOS_RTCData_RemoveNotifyDataReceived when you no longer wish to have your CompletionDelegate called.
 	UFUNCTION(BlueprintCallable, Category = "EOS Integration Kit | SDK Functions | RTC Interface", DisplayName="EOS_RTCData_AddNotifyDataReceived")
 	FEIK_NotificationId EIK_RTCData_AddNotifyDataReceived(FEIK_ProductUserId LocalUserId, const FString& RoomName, const FEIK_RTCData_OnDataReceivedCallback& Callback);
 
-	FEIK_RTCData_OnParticipantUpdatedCallback OnData_ParticipantUpdatedCallback;
 	//Register to receive notifications when a room participant data status is updated (f.e when connection state changes). The notification is raised when the participant's data status is updated. In order not to miss any participant status changes, applications need to add the notification before joining a room. If the returned NotificationId is valid, you must call EOS_RTCData_RemoveNotifyParticipantUpdated when you no longer wish to have your CompletionDelegate called.
 	UFUNCTION(BlueprintCallable, Category = "EOS Integration Kit | SDK Functions | RTC Interface", DisplayName="EOS_RTCData_AddNotifyParticipantUpdated")
 	FEIK_NotificationId EIK_RTCData_AddNotifyParticipantUpdated(FEIK_ProductUserId LocalUserId, const FString& RoomName, const FEIK_RTCData_OnParticipantUpdatedCallback& Callback);
@@ -333,4 +332,54 @@ public:
 	//Use this function to tweak outgoing data options for a room.
 	UFUNCTION(BlueprintCallable, Category = "EOS Integration Kit | SDK Functions | RTC Interface", DisplayName="EOS_RTCData_UpdateSending")
 	void EIK_RTCData_UpdateSending(FEIK_ProductUserId LocalUserId, const FString& RoomName, bool bDataEnabled, const FEIK_RTCData_OnUpdateSendingCallback& Callback);
+
+	//Removes every notification registered through this subsystem for the given room, call it when leaving the room instead of removing each notification by hand.
+	UFUNCTION(BlueprintCallable, Category = "EOS Integration Kit | SDK Functions | RTC Interface", DisplayName="EOS_RTC_RemoveRoomNotifications")
+	void EIK_RTC_RemoveRoomNotifications(const FString& RoomName);
+
+	virtual void Deinitialize() override;
+
+private:
+	//Removes the notifications for RoomHandle, or every notification if it's NAME_None
+	void RemoveNotifications(FName RoomHandle);
+
+public:
+	//Deprecated, each holds the delegate of the most recent AddNotify call and is no longer invoked by the SDK callbacks
+	UE_DEPRECATED(5.5, "Write-only, AddNotify sets it to the last delegate passed but never invokes it. Keep the NotificationId returned by AddNotify instead")
+	FEIK_RTC_OnDisconnectedCallback OnDisconnectedCallback;
+	UE_DEPRECATED(5.5, "Write-only, AddNotify sets it to the last delegate passed but never invokes it. Keep the NotificationId returned by AddNotify instead")
+	FEIK_RTC_OnParticipantStatusChangedCallback OnParticipantStatusChangedCallback;
+	UE_DEPRECATED(5.5, "Write-only, AddNotify sets it to the last delegate passed but never invokes it. Keep the NotificationId returned by AddNotify instead")
+	FEIK_RTC_OnRoomStatisticsUpdatedCallback OnRoomStatisticsUpdatedCallback;
+	UE_DEPRECATED(5.5, "Write-only, AddNotify sets it to the last delegate passed but never invokes it. Keep the NotificationId returned by AddNotify instead")
+	FEIK_RTCAudio_OnAudioBeforeRenderCallback OnAudioBeforeRenderCallback;
+	UE_DEPRECATED(5.5, "Write-only, AddNotify sets it to the last delegate passed but never invokes it. Keep the NotificationId returned by AddNotify instead")
+	FEIK_RTCAudio_OnAudioDevicesChangedCallback OnAudioDevicesChangedCallback;
+	UE_DEPRECATED(5.5, "Write-only, AddNotify sets it to the last delegate passed but never invokes it. Keep the NotificationId returned by AddNotify instead")
+	FEIK_RTCAudio_OnAudioInputStateCallback OnAudioInputStateCallback;
+	UE_DEPRECATED(5.5, "Write-only, AddNotify sets it to the last delegate passed but never invokes it. Keep the NotificationId returned by AddNotify instead")
+	FEIK_RTCAudio_OnAudioOutputStateCallback OnAudioOutputStateCallback;
+	UE_DEPRECATED(5.5, "Write-only, AddNotify sets it to the last delegate passed but never invokes it. Keep the NotificationId returned by AddNotify instead")
+	FEIK_RTCAudio_OnParticipantUpdatedCallback OnParticipantUpdatedCallback;
+	UE_DEPRECATED(5.5, "Write-only, AddNotify sets it to the last delegate passed but never invokes it. Keep the NotificationId returned by AddNotify instead")
+	FEIK_RTCData_OnDataReceivedCallback OnDataReceivedCallback;
+	UE_DEPRECATED(5.5, "Write-only, AddNotify sets it to the last delegate passed but never invokes it. Keep the NotificationId returned by AddNotify instead")
+	FEIK_RTCData_OnParticipantUpdatedCallback OnData_ParticipantUpdatedCallback;
+
+private:
+	//One entry per AddNotify call, so several rooms and listeners can be subscribed to the same notification at once
+	TEIKNotificationRegistry<FEIK_RTC_OnDisconnectedCallback> DisconnectedNotifications;
+	TEIKNotificationRegistry<FEIK_RTC_OnParticipantStatusChangedCallback> ParticipantStatusChangedNotifications;
+	TEIKNotificationRegistry<FEIK_RTC_OnRoomStatisticsUpdatedCallback> RoomStatisticsUpdatedNotifications;
+	TEIKNotificationRegistry<FEIK_RTCAudio_OnAudioBeforeRenderCallback> AudioBeforeRenderNotifications;
+	TEIKNotificationRegistry<FEIK_RTCAudio_OnAudioBeforeRenderNative> AudioBeforeRenderNativeNotifications;
+	TEIKNotificationRegistry<FEIK_RTCAudio_OnAudioDevicesChangedCallback> AudioDevicesChangedNotifications;
+	TEIKNotificationRegistry<FEIK_RTCAudio_OnAudioInputStateCallback> AudioInputStateNotifications;
+	TEIKNotificationRegistry<FEIK_RTCAudio_OnAudioOutputStateCallback> AudioOutputStateNotifications;
+	TEIKNotificationRegistry<FEIK_RTCAudio_OnParticipantUpdatedCallback> AudioParticipantUpdatedNotifications;
+	TEIKNotificationRegistry<FEIK_RTCData_OnDataReceivedCallback> DataReceivedNotifications;
+	TEIKNotificationRegistry<FEIK_RTCData_OnParticipantUpdatedCallback> DataParticipantUpdatedNotifications;
+
+	//Reused by EIK_RTCAudio_SendAudio to narrow Blueprint buffers back to int16, so sending a frame doesn't allocate once it has grown
+	TArray<int16> SendAudioFrames;
 };
@@ -8,7 +8,7 @@
 TEnumAsByte<EEIK_Result> UEIK_SanctionsSubsystem::EIK_Sanctions_CopyPlayerSanctionByIndex(
 	FEIK_ProductUserId LocalUserId, int32 Index, FEIK_Sanctions_PlayerSanction& OutSanction)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -32,7 +32,7 @@ TEnumAsByte<EEIK_Result> UEIK_SanctionsSubsystem::EIK_Sanctions_CopyPlayerSancti
 
 int32 UEIK_SanctionsSubsystem::EIK_Sanctions_GetPlayerSanctionCount(FEIK_ProductUserId LocalUserId)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
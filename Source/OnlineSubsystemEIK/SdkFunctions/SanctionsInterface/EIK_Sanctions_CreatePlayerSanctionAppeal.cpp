@@ -18,7 +18,7 @@ UEIK_Sanctions_CreatePlayerSanctionAppeal* UEIK_Sanctions_CreatePlayerSanctionAp
 void UEIK_Sanctions_CreatePlayerSanctionAppeal::Activate()
 {
 	Super::Activate();
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -3,7 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "Kismet/BlueprintAsyncActionBase.h"
+#include "OnlineSubsystemEIK/SdkFunctions/EIK_SdkAsyncAction.h"
 #include "OnlineSubsystemEIK/SdkFunctions/EIK_SharedFunctionFile.h"
 #include "eos_sanctions.h"
 #include "eos_sanctions_types.h"
@@ -13,7 +13,7 @@
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FEIK_Sanctions_CreatePlayerSanctionAppealComplete, const FEIK_ProductUserId&, LocalUserId, const TEnumAsByte<EEIK_Result>&, Result);
 
 UCLASS()
-class ONLINESUBSYSTEMEIK_API UEIK_Sanctions_CreatePlayerSanctionAppeal : public UBlueprintAsyncActionBase
+class ONLINESUBSYSTEMEIK_API UEIK_Sanctions_CreatePlayerSanctionAppeal : public UEIK_SdkAsyncAction
 {
 	GENERATED_BODY()
 
@@ -18,7 +18,7 @@ EIK_Sanctions_QueryActivePlayerSanctions(FEIK_ProductUserId LocalUserId, FEIK_Pr
 void UEIK_Sanctions_QueryActivePlayerSanctions::Activate()
 {
 	Super::Activate();
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -3,7 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "Kismet/BlueprintAsyncActionBase.h"
+#include "OnlineSubsystemEIK/SdkFunctions/EIK_SdkAsyncAction.h"
 #include "OnlineSubsystemEIK/SdkFunctions/EIK_SharedFunctionFile.h"
 #include "eos_sanctions.h"
 #include "eos_sanctions_types.h"
@@ -13,7 +13,7 @@
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FEIK_Sanctions_QueryActivePlayerSanctionsComplete, const FEIK_ProductUserId&, LocalUserId, const FEIK_ProductUserId&, TargetUserId, const TEnumAsByte<EEIK_Result>&, Result);
 
 UCLASS()
-class ONLINESUBSYSTEMEIK_API UEIK_Sanctions_QueryActivePlayerSanctions : public UBlueprintAsyncActionBase
+class ONLINESUBSYSTEMEIK_API UEIK_Sanctions_QueryActivePlayerSanctions : public UEIK_SdkAsyncAction
 {
 	GENERATED_BODY()
 
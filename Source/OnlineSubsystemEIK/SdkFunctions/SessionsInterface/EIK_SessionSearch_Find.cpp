@@ -17,7 +17,7 @@ UEIK_SessionSearch_Find* UEIK_SessionSearch_Find::EIK_SessionSearch_Find(FEIK_HS
 void UEIK_SessionSearch_Find::Activate()
 {
 	Super::Activate();
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
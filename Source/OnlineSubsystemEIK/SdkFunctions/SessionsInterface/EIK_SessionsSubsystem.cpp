@@ -13,7 +13,7 @@ TEnumAsByte<EEIK_Result> UEIK_SessionsSubsystem::EIK_ActiveSession_CopyInfo(FEIK
 		UE_LOG(LogEIK, Error, TEXT("UEIK_SessionsSubsystem: Invalid Handle."));
 		return EEIK_Result::EOS_NotFound;
 	}
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -41,7 +41,7 @@ FEIK_ProductUserId UEIK_SessionsSubsystem::EIK_ActiveSession_GetRegisteredPlayer
 		UE_LOG(LogEIK, Error, TEXT("UEIK_SessionsSubsystem: Invalid Handle."));
 		return FEIK_ProductUserId{ nullptr };
 	}
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -73,7 +73,7 @@ TEnumAsByte<EEIK_Result> UEIK_SessionsSubsystem::EIK_SessionDetails_CopyInfo(FEI
 		UE_LOG(LogEIK, Error, TEXT("UEIK_SessionsSubsystem: Invalid Handle."));
 		return EEIK_Result::EOS_NotFound;
 	}
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -101,7 +101,7 @@ TEnumAsByte<EEIK_Result> UEIK_SessionsSubsystem::EIK_SessionDetails_CopySessionA
 		UE_LOG(LogEIK, Error, TEXT("UEIK_SessionsSubsystem: Invalid Handle."));
 		return EEIK_Result::EOS_NotFound;
 	}
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -130,7 +130,7 @@ TEnumAsByte<EEIK_Result> UEIK_SessionsSubsystem::EIK_SessionDetails_CopySessionA
 		UE_LOG(LogEIK, Error, TEXT("UEIK_SessionsSubsystem: Invalid Handle."));
 		return EEIK_Result::EOS_NotFound;
 	}
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -158,7 +158,7 @@ int32 UEIK_SessionsSubsystem::EIK_SessionDetails_GetSessionAttributeCount(FEIK_H
 		UE_LOG(LogEIK, Error, TEXT("UEIK_SessionsSubsystem: Invalid Handle."));
 		return EEIK_Result::EOS_NotFound;
 	}
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -179,7 +179,7 @@ TEnumAsByte<EEIK_Result> UEIK_SessionsSubsystem::EIK_SessionModification_AddAttr
 		UE_LOG(LogEIK, Error, TEXT("UEIK_SessionsSubsystem: Invalid Handle."));
 		return EEIK_Result::EOS_NotFound;
 	}
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -213,7 +213,7 @@ TEnumAsByte<EEIK_Result> UEIK_SessionsSubsystem::EIK_SessionModification_RemoveA
 		UE_LOG(LogEIK, Error, TEXT("UEIK_SessionsSubsystem: Invalid Handle."));
 		return EEIK_Result::EOS_NotFound;
 	}
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -235,7 +235,7 @@ TEnumAsByte<EEIK_Result> UEIK_SessionsSubsystem::EIK_SessionModification_SetAllo
 		UE_LOG(LogEIK, Error, TEXT("UEIK_SessionsSubsystem: Invalid Handle."));
 		return EEIK_Result::EOS_NotFound;
 	}
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -263,7 +263,7 @@ TEnumAsByte<EEIK_Result> UEIK_SessionsSubsystem::EIK_SessionModification_SetBuck
 		UE_LOG(LogEIK, Error, TEXT("UEIK_SessionsSubsystem: Invalid Handle."));
 		return EEIK_Result::EOS_NotFound;
 	}
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -285,7 +285,7 @@ TEnumAsByte<EEIK_Result> UEIK_SessionsSubsystem::EIK_SessionModification_SetHost
 		UE_LOG(LogEIK, Error, TEXT("UEIK_SessionsSubsystem: Invalid Handle."));
 		return EEIK_Result::EOS_NotFound;
 	}
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -307,7 +307,7 @@ TEnumAsByte<EEIK_Result> UEIK_SessionsSubsystem::EIK_SessionModification_SetInvi
 		UE_LOG(LogEIK, Error, TEXT("UEIK_SessionsSubsystem: Invalid Handle."));
 		return EEIK_Result::EOS_NotFound;
 	}
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -329,7 +329,7 @@ TEnumAsByte<EEIK_Result> UEIK_SessionsSubsystem::EIK_SessionModification_SetJoin
 		UE_LOG(LogEIK, Error, TEXT("UEIK_SessionsSubsystem: Invalid Handle."));
 		return EEIK_Result::EOS_NotFound;
 	}
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -351,7 +351,7 @@ TEnumAsByte<EEIK_Result> UEIK_SessionsSubsystem::EIK_SessionModification_SetMaxP
 		UE_LOG(LogEIK, Error, TEXT("UEIK_SessionsSubsystem: Invalid Handle."));
 		return EEIK_Result::EOS_NotFound;
 	}
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -374,7 +374,7 @@ TEnumAsByte<EEIK_Result> UEIK_SessionsSubsystem::EIK_SessionModification_SetPerm
 		return EEIK_Result::EOS_NotFound;
 	}
 	EOS_EOnlineSessionPermissionLevel LocalPermissionLevel = static_cast<EOS_EOnlineSessionPermissionLevel>(PermissionLevel.GetValue());
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -391,7 +391,7 @@ TEnumAsByte<EEIK_Result> UEIK_SessionsSubsystem::EIK_SessionModification_SetPerm
 FEIK_NotificationId UEIK_SessionsSubsystem::EIK_Sessions_AddNotifyJoinSessionAccepted(
 	const FEIK_Sessions_OnJoinSessionAcceptedCallback& Callback)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -417,7 +417,7 @@ FEIK_NotificationId UEIK_SessionsSubsystem::EIK_Sessions_AddNotifyJoinSessionAcc
 FEIK_NotificationId UEIK_SessionsSubsystem::EIK_Sessions_AddNotifyLeaveSessionRequested(
 	const FEIK_Sessions_OnLeaveSessionRequestedCallback& Callback)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -444,7 +444,7 @@ FEIK_NotificationId UEIK_SessionsSubsystem::EIK_Sessions_AddNotifyLeaveSessionRe
 FEIK_NotificationId UEIK_SessionsSubsystem::EIK_Sessions_AddNotifySendSessionNativeInviteRequested(
 	const FEIK_Sessions_OnSendSessionInviteCallback& Callback)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -471,7 +471,7 @@ FEIK_NotificationId UEIK_SessionsSubsystem::EIK_Sessions_AddNotifySendSessionNat
 FEIK_NotificationId UEIK_SessionsSubsystem::EIK_Sessions_AddNotifySessionInviteAccepted(
 	const FEIK_Sessions_OnSessionInviteAcceptedCallback& Callback)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -498,7 +498,7 @@ FEIK_NotificationId UEIK_SessionsSubsystem::EIK_Sessions_AddNotifySessionInviteA
 FEIK_NotificationId UEIK_SessionsSubsystem::EIK_Sessions_AddNotifySessionInviteReceived(
 	const FEIK_Sessions_OnSessionInviteReceivedCallback& Callback)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -525,7 +525,7 @@ FEIK_NotificationId UEIK_SessionsSubsystem::EIK_Sessions_AddNotifySessionInviteR
 FEIK_NotificationId UEIK_SessionsSubsystem::EIK_Sessions_AddNotifySessionInviteRejected(
 	const FEIK_Sessions_OnSessionInviteRejectedCallback& Callback)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -552,7 +552,7 @@ FEIK_NotificationId UEIK_SessionsSubsystem::EIK_Sessions_AddNotifySessionInviteR
 TEnumAsByte<EEIK_Result> UEIK_SessionsSubsystem::EIK_Sessions_CopyActiveSessionHandle(FString SessionName,
 	FEIK_HActiveSession& OutActiveSessionHandle)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -580,7 +580,7 @@ TEnumAsByte<EEIK_Result> UEIK_SessionsSubsystem::EIK_Sessions_CopyActiveSessionH
 TEnumAsByte<EEIK_Result> UEIK_SessionsSubsystem::EIK_Sessions_CopySessionHandleByInviteId(FString InviteId,
 	FEIK_HSessionDetails& OutSessionHandle)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -608,7 +608,7 @@ TEnumAsByte<EEIK_Result> UEIK_SessionsSubsystem::EIK_Sessions_CopySessionHandleB
 TEnumAsByte<EEIK_Result> UEIK_SessionsSubsystem::EIK_Sessions_CopySessionHandleByUiEventId(FEIK_UI_EventId UiEventId,
 	FEIK_HSessionDetails& OutSessionHandle)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -636,7 +636,7 @@ TEnumAsByte<EEIK_Result> UEIK_SessionsSubsystem::EIK_Sessions_CopySessionHandleB
 TEnumAsByte<EEIK_Result> UEIK_SessionsSubsystem::EIK_Sessions_CopySessionHandleForPresence(
 	FEIK_ProductUserId LocalUserId, FEIK_HSessionDetails& OutSessionHandle)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -664,7 +664,7 @@ TEnumAsByte<EEIK_Result> UEIK_SessionsSubsystem::EIK_Sessions_CopySessionHandleF
 TEnumAsByte<EEIK_Result> UEIK_SessionsSubsystem::EIK_Sessions_CreateSessionModification(
 	FEIK_Sessions_CreateSessionModificationOptions Options, FEIK_HSessionModification& OutSessionModificationHandle)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -690,7 +690,7 @@ TEnumAsByte<EEIK_Result> UEIK_SessionsSubsystem::EIK_Sessions_CreateSessionModif
 TEnumAsByte<EEIK_Result> UEIK_SessionsSubsystem::EIK_Sessions_CreateSessionSearch(int32 MaxSearchResults,
 	FEIK_HSessionSearch& OutSessionSearchHandle)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -717,7 +717,7 @@ TEnumAsByte<EEIK_Result> UEIK_SessionsSubsystem::EIK_Sessions_CreateSessionSearc
 
 void UEIK_SessionsSubsystem::EIK_Sessions_DumpSessionState(FString SessionName)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -737,7 +737,7 @@ void UEIK_SessionsSubsystem::EIK_Sessions_DumpSessionState(FString SessionName)
 
 int32 UEIK_SessionsSubsystem::EIK_Sessions_GetInviteCount(FEIK_ProductUserId LocalUserId)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -758,7 +758,7 @@ int32 UEIK_SessionsSubsystem::EIK_Sessions_GetInviteCount(FEIK_ProductUserId Loc
 
 FString UEIK_SessionsSubsystem::EIK_Sessions_GetInviteIdByIndex(FEIK_ProductUserId LocalUserId, int32 Index)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -784,7 +784,7 @@ FString UEIK_SessionsSubsystem::EIK_Sessions_GetInviteIdByIndex(FEIK_ProductUser
 TEnumAsByte<EEIK_Result> UEIK_SessionsSubsystem::EIK_Sessions_IsUserInSession(FEIK_ProductUserId TargetUserId,
 	FString SessionName)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -806,7 +806,7 @@ TEnumAsByte<EEIK_Result> UEIK_SessionsSubsystem::EIK_Sessions_IsUserInSession(FE
 
 void UEIK_SessionsSubsystem::EIK_Sessions_RemoveNotifyJoinSessionAccepted(FEIK_NotificationId InId)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -817,7 +817,7 @@ void UEIK_SessionsSubsystem::EIK_Sessions_RemoveNotifyJoinSessionAccepted(FEIK_N
 
 void UEIK_SessionsSubsystem::EIK_Sessions_RemoveNotifyLeaveSessionRequested(FEIK_NotificationId InId)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -828,7 +828,7 @@ void UEIK_SessionsSubsystem::EIK_Sessions_RemoveNotifyLeaveSessionRequested(FEIK
 
 void UEIK_SessionsSubsystem::EIK_Sessions_RemoveNotifySendSessionNativeInviteRequested(FEIK_NotificationId InId)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -839,7 +839,7 @@ void UEIK_SessionsSubsystem::EIK_Sessions_RemoveNotifySendSessionNativeInviteReq
 
 void UEIK_SessionsSubsystem::EIK_Sessions_RemoveNotifySessionInviteAccepted(FEIK_NotificationId InId)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -850,7 +850,7 @@ void UEIK_SessionsSubsystem::EIK_Sessions_RemoveNotifySessionInviteAccepted(FEIK
 
 void UEIK_SessionsSubsystem::EIK_Sessions_RemoveNotifySessionInviteReceived(FEIK_NotificationId InId)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -861,7 +861,7 @@ void UEIK_SessionsSubsystem::EIK_Sessions_RemoveNotifySessionInviteReceived(FEIK
 
 void UEIK_SessionsSubsystem::EIK_Sessions_RemoveNotifySessionInviteRejected(FEIK_NotificationId InId)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -873,7 +873,7 @@ void UEIK_SessionsSubsystem::EIK_Sessions_RemoveNotifySessionInviteRejected(FEIK
 TEnumAsByte<EEIK_Result> UEIK_SessionsSubsystem::EIK_Sessions_UpdateSessionModification(FString SessionName,
 	FEIK_HSessionModification& OutSessionModificationHandle)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -901,7 +901,7 @@ TEnumAsByte<EEIK_Result> UEIK_SessionsSubsystem::EIK_Sessions_UpdateSessionModif
 TEnumAsByte<EEIK_Result> UEIK_SessionsSubsystem::EIK_SessionSearch_CopySearchResultByIndex(FEIK_HSessionSearch Handle,
 	int32 SessionIndex, FEIK_HSessionDetails& OutSessionHandle)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -928,7 +928,7 @@ TEnumAsByte<EEIK_Result> UEIK_SessionsSubsystem::EIK_SessionSearch_CopySearchRes
 
 int32 UEIK_SessionsSubsystem::EIK_SessionSearch_GetSearchResultCount(FEIK_HSessionSearch Handle)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -947,7 +947,7 @@ int32 UEIK_SessionsSubsystem::EIK_SessionSearch_GetSearchResultCount(FEIK_HSessi
 
 void UEIK_SessionsSubsystem::EIK_SessionSearch_Release(FEIK_HSessionSearch Handle)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -964,7 +964,7 @@ void UEIK_SessionsSubsystem::EIK_SessionSearch_Release(FEIK_HSessionSearch Handl
 TEnumAsByte<EEIK_Result> UEIK_SessionsSubsystem::EIK_SessionSearch_RemoveParameter(FEIK_HSessionSearch Handle,
 	const FString& Key, const TEnumAsByte<EEIK_EComparisonOp>& ComparisonOp)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -987,7 +987,7 @@ TEnumAsByte<EEIK_Result> UEIK_SessionsSubsystem::EIK_SessionSearch_RemoveParamet
 TEnumAsByte<EEIK_Result> UEIK_SessionsSubsystem::EIK_SessionSearch_SetMaxResults(FEIK_HSessionSearch Handle,
 	int32 MaxSearchResults)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -1009,7 +1009,7 @@ TEnumAsByte<EEIK_Result> UEIK_SessionsSubsystem::EIK_SessionSearch_SetMaxResults
 TEnumAsByte<EEIK_Result> UEIK_SessionsSubsystem::EIK_SessionSearch_SetParameter(FEIK_HSessionSearch Handle,
 	FEIK_Sessions_AttributeData Parameter, const TEnumAsByte<EEIK_EComparisonOp>& ComparisonOp)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -1033,7 +1033,7 @@ TEnumAsByte<EEIK_Result> UEIK_SessionsSubsystem::EIK_SessionSearch_SetParameter(
 TEnumAsByte<EEIK_Result> UEIK_SessionsSubsystem::EIK_SessionSearch_SetSessionId(FEIK_HSessionSearch Handle,
 	const FString& SessionId)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -1055,7 +1055,7 @@ TEnumAsByte<EEIK_Result> UEIK_SessionsSubsystem::EIK_SessionSearch_SetSessionId(
 TEnumAsByte<EEIK_Result> UEIK_SessionsSubsystem::EIK_SessionSearch_SetTargetUserId(FEIK_HSessionSearch Handle,
 	FEIK_ProductUserId TargetUserId)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
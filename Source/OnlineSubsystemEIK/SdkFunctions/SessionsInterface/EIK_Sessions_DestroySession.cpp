@@ -15,7 +15,7 @@ UEIK_Sessions_DestroySession* UEIK_Sessions_DestroySession::EIK_Sessions_Destroy
 void UEIK_Sessions_DestroySession::Activate()
 {
 	Super::Activate();
-	if(	IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if(	IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -15,7 +15,7 @@ UEIK_Sessions_EndSession* UEIK_Sessions_EndSession::EIK_Sessions_EndSession(FStr
 void UEIK_Sessions_EndSession::Activate()
 {
 	Super::Activate();
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
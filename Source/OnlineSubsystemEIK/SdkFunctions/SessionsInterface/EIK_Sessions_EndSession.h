@@ -3,7 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "Kismet/BlueprintAsyncActionBase.h"
+#include "OnlineSubsystemEIK/SdkFunctions/EIK_SdkAsyncAction.h"
 #include "OnlineSubsystemEIK/SdkFunctions/ConnectInterface/EIK_ConnectSubsystem.h"
 #include "OnlineSubsystemEOS.h"
 #include "OnlineSubsystemEIK/SdkFunctions/EIK_SharedFunctionFile.h"
@@ -16,7 +16,7 @@ THIRD_PARTY_INCLUDES_END
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FEIK_OnEndSessionCallback, const TEnumAsByte<EEIK_Result>&, ResultCode);
 
 UCLASS()
-class ONLINESUBSYSTEMEIK_API UEIK_Sessions_EndSession : public UBlueprintAsyncActionBase
+class ONLINESUBSYSTEMEIK_API UEIK_Sessions_EndSession : public UEIK_SdkAsyncAction
 {
 	GENERATED_BODY()
 
@@ -19,7 +19,7 @@ UEIK_Sessions_JoinSession* UEIK_Sessions_JoinSession::EIK_Sessions_JoinSession(F
 void UEIK_Sessions_JoinSession::Activate()
 {
 	Super::Activate();
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
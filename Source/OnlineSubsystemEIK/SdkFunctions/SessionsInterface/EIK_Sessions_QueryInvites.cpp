@@ -13,7 +13,7 @@ UEIK_Sessions_QueryInvites* UEIK_Sessions_QueryInvites::EIK_Sessions_QueryInvite
 void UEIK_Sessions_QueryInvites::Activate()
 {
 	Super::Activate();
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -3,7 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "Kismet/BlueprintAsyncActionBase.h"
+#include "OnlineSubsystemEIK/SdkFunctions/EIK_SdkAsyncAction.h"
 #include "OnlineSubsystemEIK/SdkFunctions/ConnectInterface/EIK_ConnectSubsystem.h"
 #include "OnlineSubsystemEOS.h"
 #include "Runtime/Launch/Resources/Version.h"
@@ -18,7 +18,7 @@ THIRD_PARTY_INCLUDES_END
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FEIK_OnQueryInvitesCallback, const TEnumAsByte<EEIK_Result>&, ResultCode, const FEIK_ProductUserId&, LocalUserId);
 
 UCLASS()
-class ONLINESUBSYSTEMEIK_API UEIK_Sessions_QueryInvites : public UBlueprintAsyncActionBase
+class ONLINESUBSYSTEMEIK_API UEIK_Sessions_QueryInvites : public UEIK_SdkAsyncAction
 {
 	GENERATED_BODY()
 
@@ -17,7 +17,7 @@ UEIK_Sessions_RegisterPlayers* UEIK_Sessions_RegisterPlayers::EIK_Sessions_Regis
 void UEIK_Sessions_RegisterPlayers::Activate()
 {
 	Super::Activate();
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
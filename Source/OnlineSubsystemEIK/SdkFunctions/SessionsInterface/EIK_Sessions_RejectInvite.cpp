@@ -17,7 +17,7 @@ UEIK_Sessions_RejectInvite* UEIK_Sessions_RejectInvite::EIK_Sessions_RejectInvit
 void UEIK_Sessions_RejectInvite::Activate()
 {
 	Super::Activate();
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
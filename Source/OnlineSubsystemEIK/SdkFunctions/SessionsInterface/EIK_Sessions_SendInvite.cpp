@@ -18,7 +18,7 @@ UEIK_Sessions_SendInvite* UEIK_Sessions_SendInvite::EIK_Sessions_SendInvite(FStr
 void UEIK_Sessions_SendInvite::Activate()
 {
 	Super::Activate();
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
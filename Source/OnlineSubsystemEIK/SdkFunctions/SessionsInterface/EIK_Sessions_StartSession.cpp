@@ -15,7 +15,7 @@ UEIK_Sessions_StartSession* UEIK_Sessions_StartSession::EIK_Sessions_StartSessio
 void UEIK_Sessions_StartSession::Activate()
 {
 	Super::Activate();
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
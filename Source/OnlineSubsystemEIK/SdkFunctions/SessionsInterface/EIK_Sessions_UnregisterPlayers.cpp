@@ -17,7 +17,7 @@ UEIK_Sessions_UnregisterPlayers* UEIK_Sessions_UnregisterPlayers::EIK_Sessions_U
 void UEIK_Sessions_UnregisterPlayers::Activate()
 {
 	Super::Activate();
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -16,7 +16,7 @@ UEIK_Sessions_UpdateSession* UEIK_Sessions_UpdateSession::EIK_Sessions_UpdateSes
 void UEIK_Sessions_UpdateSession::Activate()
 {
 	Super::Activate();
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -8,7 +8,7 @@
 TEnumAsByte<EEIK_Result> UEIK_StatsSubsystem::EIK_Stats_CopyStatByIndex(FEIK_ProductUserId TargetUserId,
                                                                         int32 StatIndex, FEIK_Stats_Stat& OutStat)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -33,7 +33,7 @@ TEnumAsByte<EEIK_Result> UEIK_StatsSubsystem::EIK_Stats_CopyStatByIndex(FEIK_Pro
 TEnumAsByte<EEIK_Result> UEIK_StatsSubsystem::EIK_Stats_CopyStatByName(FEIK_ProductUserId TargetUserId,
 	const FString& Name, FEIK_Stats_Stat& OutStat)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -57,7 +57,7 @@ TEnumAsByte<EEIK_Result> UEIK_StatsSubsystem::EIK_Stats_CopyStatByName(FEIK_Prod
 
 int32 UEIK_StatsSubsystem::EIK_Stats_GetStatsCount(FEIK_ProductUserId TargetUserId)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -19,7 +19,7 @@ UEIK_Stats_IngestStat* UEIK_Stats_IngestStat::EIK_Stats_IngestStat(FEIK_ProductU
 void UEIK_Stats_IngestStat::Activate()
 {
 	Super::Activate();
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
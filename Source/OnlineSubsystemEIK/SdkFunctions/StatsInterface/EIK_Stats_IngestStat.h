@@ -3,7 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "Kismet/BlueprintAsyncActionBase.h"
+#include "OnlineSubsystemEIK/SdkFunctions/EIK_SdkAsyncAction.h"
 #include "OnlineSubsystemEOS.h"
 #include "OnlineSubsystemEIK/SdkFunctions/EIK_SharedFunctionFile.h"
 THIRD_PARTY_INCLUDES_START
@@ -42,7 +42,7 @@ struct FEIK_Stats_IngestData
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FEIK_OnStatsIngestStatComplete, const FEIK_ProductUserId&, LocalUserId, const TEnumAsByte<EEIK_Result>&, ResultCode, const FEIK_ProductUserId&, TargetUserId);
 
 UCLASS()
-class ONLINESUBSYSTEMEIK_API UEIK_Stats_IngestStat : public UBlueprintAsyncActionBase
+class ONLINESUBSYSTEMEIK_API UEIK_Stats_IngestStat : public UEIK_SdkAsyncAction
 {
 	GENERATED_BODY()
 
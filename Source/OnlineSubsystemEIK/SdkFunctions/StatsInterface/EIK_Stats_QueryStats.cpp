@@ -38,7 +38,7 @@ void UEIK_Stats_QueryStats::Internal_OnStatsQueryStatsComplete(const EOS_Stats_O
 void UEIK_Stats_QueryStats::Activate()
 {
 	Super::Activate();
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
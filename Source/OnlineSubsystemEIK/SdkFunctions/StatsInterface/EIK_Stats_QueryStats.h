@@ -3,7 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "Kismet/BlueprintAsyncActionBase.h"
+#include "OnlineSubsystemEIK/SdkFunctions/EIK_SdkAsyncAction.h"
 #include "OnlineSubsystemEOS.h"
 #include "OnlineSubsystemEIK/SdkFunctions/EIK_SharedFunctionFile.h"
 THIRD_PARTY_INCLUDES_START
@@ -15,7 +15,7 @@ THIRD_PARTY_INCLUDES_END
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FEIK_OnStatsQueryStatsComplete, const FEIK_ProductUserId&, LocalUserId, const TEnumAsByte<EEIK_Result>&, ResultCode, const FEIK_ProductUserId&, TargetUserId);
 
 UCLASS()
-class ONLINESUBSYSTEMEIK_API UEIK_Stats_QueryStats : public UBlueprintAsyncActionBase
+class ONLINESUBSYSTEMEIK_API UEIK_Stats_QueryStats : public UEIK_SdkAsyncAction
 {
 	GENERATED_BODY()
 
@@ -7,7 +7,7 @@
 
 TEnumAsByte<EEIK_Result> UEIK_UiSubsystem::EIK_UI_AcknowledgeEventId(const FEIK_UI_EventId& UiEventId, const TEnumAsByte<EEIK_Result>& Result)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -25,7 +25,7 @@ TEnumAsByte<EEIK_Result> UEIK_UiSubsystem::EIK_UI_AcknowledgeEventId(const FEIK_
 
 FEIK_NotificationId UEIK_UiSubsystem::EIK_UI_AddNotifyDisplaySettingsUpdated(FEIK_OnDisplaySettingsUpdated Callback)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -50,7 +50,7 @@ FEIK_NotificationId UEIK_UiSubsystem::EIK_UI_AddNotifyDisplaySettingsUpdated(FEI
 
 FEIK_NotificationId UEIK_UiSubsystem::EIK_UI_AddNotifyMemoryMonitor(FEIK_OnMemoryMonitor Callback)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -73,7 +73,7 @@ FEIK_NotificationId UEIK_UiSubsystem::EIK_UI_AddNotifyMemoryMonitor(FEIK_OnMemor
 
 bool UEIK_UiSubsystem::EIK_UI_GetFriendsExclusiveInput(FEIK_EpicAccountId LocalUserId)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -90,7 +90,7 @@ bool UEIK_UiSubsystem::EIK_UI_GetFriendsExclusiveInput(FEIK_EpicAccountId LocalU
 
 bool UEIK_UiSubsystem::EIK_UI_GetFriendsVisible(FEIK_EpicAccountId LocalUserId)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -107,7 +107,7 @@ bool UEIK_UiSubsystem::EIK_UI_GetFriendsVisible(FEIK_EpicAccountId LocalUserId)
 
 TEnumAsByte<EEIK_UI_ENotificationLocation> UEIK_UiSubsystem::EIK_UI_GetNotificationLocationPreference()
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -121,7 +121,7 @@ TEnumAsByte<EEIK_UI_ENotificationLocation> UEIK_UiSubsystem::EIK_UI_GetNotificat
 
 TEnumAsByte<EEIK_Result> UEIK_UiSubsystem::EIK_UI_PauseSocialOverlay(bool bIsPaused)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -138,7 +138,7 @@ TEnumAsByte<EEIK_Result> UEIK_UiSubsystem::EIK_UI_PauseSocialOverlay(bool bIsPau
 
 void UEIK_UiSubsystem::EIK_UI_RemoveNotifyDisplaySettingsUpdated(FEIK_NotificationId NotificationId)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -150,7 +150,7 @@ void UEIK_UiSubsystem::EIK_UI_RemoveNotifyDisplaySettingsUpdated(FEIK_Notificati
 void UEIK_UiSubsystem::EIK_UI_RemoveNotifyMemoryMonitor(FEIK_NotificationId NotificationId)
 {
 	{
-		if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+		if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 		{
 			if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 			{
@@ -163,7 +163,7 @@ void UEIK_UiSubsystem::EIK_UI_RemoveNotifyMemoryMonitor(FEIK_NotificationId Noti
 TEnumAsByte<EEIK_Result> UEIK_UiSubsystem::EIK_UI_SetDisplayPreference(
 	const EEIK_UI_ENotificationLocation& DisplayPreference)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -9,7 +9,7 @@
 TEnumAsByte<EEIK_Result> UEIK_UserInfoSubsystem::EIK_UserInfo_CopyBestDisplayName(FEIK_EpicAccountId LocalUserId,
                                                               FEIK_EpicAccountId TargetUserId, FEIK_UserInfo_BestDisplayName& OutBestDisplayName)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -35,7 +35,7 @@ TEnumAsByte<EEIK_Result> UEIK_UserInfoSubsystem::EIK_UserInfo_CopyBestDisplayNam
 	FEIK_EpicAccountId LocalUserId, FEIK_EpicAccountId TargetUserId, const int32& Platform,
 	FEIK_UserInfo_BestDisplayName& OutBestDisplayName)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -62,7 +62,7 @@ TEnumAsByte<EEIK_Result> UEIK_UserInfoSubsystem::EIK_UserInfo_CopyExternalUserIn
 	FEIK_EpicAccountId LocalUserId, FEIK_EpicAccountId TargetUserId, FString AccountId,
 	FEIK_UserInfo_ExternalUserInfo& OutExternalUserInfo)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -89,7 +89,7 @@ TEnumAsByte<EEIK_Result> UEIK_UserInfoSubsystem::EIK_UserInfo_CopyExternalUserIn
 	FEIK_EpicAccountId LocalUserId, FEIK_EpicAccountId TargetUserId,
 	const TEnumAsByte<EEIK_EExternalAccountType>& AccountType, FEIK_UserInfo_ExternalUserInfo& OutExternalUserInfo)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -116,7 +116,7 @@ TEnumAsByte<EEIK_Result> UEIK_UserInfoSubsystem::EIK_UserInfo_CopyExternalUserIn
 	FEIK_EpicAccountId LocalUserId, FEIK_EpicAccountId TargetUserId, const int32& Index,
 	FEIK_UserInfo_ExternalUserInfo& OutExternalUserInfo)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -142,7 +142,7 @@ TEnumAsByte<EEIK_Result> UEIK_UserInfoSubsystem::EIK_UserInfo_CopyExternalUserIn
 TEnumAsByte<EEIK_Result> UEIK_UserInfoSubsystem::EIK_UserInfo_CopyUserInfo(FEIK_EpicAccountId LocalUserId,
 	FEIK_EpicAccountId TargetUserId, FEIK_UserInfo& OutUserInfo)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -167,7 +167,7 @@ TEnumAsByte<EEIK_Result> UEIK_UserInfoSubsystem::EIK_UserInfo_CopyUserInfo(FEIK_
 int32 UEIK_UserInfoSubsystem::EIK_UserInfo_GetExternalUserInfoCount(FEIK_EpicAccountId LocalUserId,
 	FEIK_EpicAccountId TargetUserId)
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -184,7 +184,7 @@ int32 UEIK_UserInfoSubsystem::EIK_UserInfo_GetExternalUserInfoCount(FEIK_EpicAcc
 
 int32 UEIK_UserInfoSubsystem::EIK_UserInfo_GetLocalPlatformType()
 {
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
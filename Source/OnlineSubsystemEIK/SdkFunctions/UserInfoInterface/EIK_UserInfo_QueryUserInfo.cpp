@@ -18,7 +18,7 @@ UEIK_UserInfo_QueryUserInfo* UEIK_UserInfo_QueryUserInfo::EIK_UserInfo_QueryUser
 void UEIK_UserInfo_QueryUserInfo::Activate()
 {
 	Super::Activate();
-	if(	IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if(	IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -18,7 +18,7 @@ EIK_UserInfo_QueryUserInfoByDisplayName(const FEIK_EpicAccountId& LocalUserId, c
 void UEIK_UserInfo_QueryUserInfoByDisplayName::Activate()
 {
 	Super::Activate();
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
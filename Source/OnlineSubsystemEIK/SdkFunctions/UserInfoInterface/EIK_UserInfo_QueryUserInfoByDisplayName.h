@@ -3,7 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "Kismet/BlueprintAsyncActionBase.h"
+#include "OnlineSubsystemEIK/SdkFunctions/EIK_SdkAsyncAction.h"
 #include "OnlineSubsystemEIK/SdkFunctions/EIK_SharedFunctionFile.h"
 #include "OnlineSubsystemEOS.h"
 #include "eos_userinfo.h"
@@ -12,7 +12,7 @@
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_FourParams(FEIK_OnQueryUserInfoByDisplayNameCallback, const TEnumAsByte<EEIK_Result>&, ResultCode, const FEIK_EpicAccountId&, LocalUserId, const FEIK_EpicAccountId&, TargetUserId, const FString&, DisplayName);
 
 UCLASS()
-class ONLINESUBSYSTEMEIK_API UEIK_UserInfo_QueryUserInfoByDisplayName : public UBlueprintAsyncActionBase
+class ONLINESUBSYSTEMEIK_API UEIK_UserInfo_QueryUserInfoByDisplayName : public UEIK_SdkAsyncAction
 {
 	GENERATED_BODY()
 
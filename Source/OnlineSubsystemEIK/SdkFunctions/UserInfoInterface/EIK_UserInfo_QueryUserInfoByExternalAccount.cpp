@@ -21,7 +21,7 @@ EIK_UserInfo_QueryUserInfoByExternalAccount(const FEIK_EpicAccountId& LocalUserI
 void UEIK_UserInfo_QueryUserInfoByExternalAccount::Activate()
 {
 	Super::Activate();
-	if (IOnlineSubsystem* OnlineSub = IOnlineSubsystem::Get("EIK"))
+	if (IOnlineSubsystem* OnlineSub = FOnlineSubsystemEOS::GetDefaultInstance())
 	{
 		if (FOnlineSubsystemEOS* EOSRef = static_cast<FOnlineSubsystemEOS*>(OnlineSub))
 		{
@@ -3,14 +3,14 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "Kismet/BlueprintAsyncActionBase.h"
+#include "OnlineSubsystemEIK/SdkFunctions/EIK_SdkAsyncAction.h"
 #include "OnlineSubsystemEIK/SdkFunctions/EIK_SharedFunctionFile.h"
 #include "EIK_UserInfo_QueryUserInfoByExternalAccount.generated.h"
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_FiveParams(FEIK_OnQueryUserInfoByExternalAccountCallback, const TEnumAsByte<EEIK_Result>&, ResultCode, const FEIK_EpicAccountId&, LocalUserId, const FEIK_EpicAccountId&, TargetUserId, const TEnumAsByte<EEIK_EExternalAccountType>&, ExternalAccountType, const FString&, ExternalAccountId);
 
 UCLASS()
-class ONLINESUBSYSTEMEIK_API UEIK_UserInfo_QueryUserInfoByExternalAccount : public UBlueprintAsyncActionBase
+class ONLINESUBSYSTEMEIK_API UEIK_UserInfo_QueryUserInfoByExternalAccount : public UEIK_SdkAsyncAction
 {
 	GENERATED_BODY()
 
@@ -5,6 +5,7 @@
 #include "OnlineSubsystemUtils.h"
 #include "OnlineSubsystem.h"
 #include "OnlineSubsystemEOS.h"
+#include "EIKSettings.h"
 #include "Engine/LocalPlayer.h"
 #include "Runtime/Core/Public/Misc/CommandLine.h"
 #include "Engine/GameInstance.h"
@@ -780,8 +781,9 @@ void UEIK_Subsystem::SetPlayerData(const FBP_WriteFile_Callback& Result, FString
 					if(const IOnlineUserCloudPtr CloudPointerRef = SubsystemRef->GetUserCloudInterface())
 					{
 						const TSharedPtr<const FUniqueNetId> UserIDRef = IdentityPointerRef->GetUniquePlayerId(0).ToSharedRef();
+						// Compression happens on a worker thread inside the user cloud, and GetPlayerData decompresses transparently
 						CloudPointerRef->OnWriteUserFileCompleteDelegates.AddUObject(this, &UEIK_Subsystem::OnWriteFileComplete);
-						CloudPointerRef->WriteUserFile(*UserIDRef,FileName,LocalArray);
+						CloudPointerRef->WriteUserFile(*UserIDRef,FileName,LocalArray,GetDefault<UEIKSettings>()->bCompressPlayerData);
 					}
 					else
 					{
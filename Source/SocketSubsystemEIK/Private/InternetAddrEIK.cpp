@@ -16,36 +16,99 @@ inline uint8 PortToChannel(int32 InPort)
 	return InPort > 255 ? InPort % 256 : FMath::Clamp(InPort, 0, 255);
 }
 
+/** splitmix64 finalizer, cheap and good enough to spread pointer values over all 64 bits */
+inline uint64 MixAddressHash(uint64 Hash, uint64 Value)
+{
+	Hash ^= Value + 0x9E3779B97F4A7C15ull + (Hash << 6) + (Hash >> 2);
+	Hash = (Hash ^ (Hash >> 30)) * 0xBF58476D1CE4E5B9ull;
+	Hash = (Hash ^ (Hash >> 27)) * 0x94D049BB133111EBull;
+	return Hash ^ (Hash >> 31);
+}
+
 FInternetAddrEOS::FInternetAddrEOS()
 	: LocalUserId(nullptr)
 	, RemoteUserId(nullptr)
+	, SocketNameId(0)
 	, Channel(0)
+	, AddressHash(0)
 {
 	SocketName[0] = '\0';
+	UpdateAddressHash();
 }
 
 FInternetAddrEOS::FInternetAddrEOS(const FString& InRemoteUserId, const FString& InSocketName, const int32 InChannel)
 	: LocalUserId(nullptr)
 	, RemoteUserId(nullptr)
+	, SocketNameId(0)
+	, Channel(PortToChannel(InChannel))
+	, AddressHash(0)
 {
 #if WITH_EOS_SDK
 	RemoteUserId = EOS_ProductUserId_FromString(TCHAR_TO_UTF8(*InRemoteUserId));
 #endif
-	FCStringAnsi::Strcpy(SocketName, TCHAR_TO_UTF8(*InSocketName));
-	Channel = PortToChannel(InChannel);
+	SetSocketName(InSocketName);
 }
 
 #if WITH_EOS_SDK
 FInternetAddrEOS::FInternetAddrEOS(const EOS_ProductUserId InRemoteUserId, const FString& InSocketName, const int32 InChannel)
 	: LocalUserId(nullptr)
 	, RemoteUserId(InRemoteUserId)
-	, Channel(InChannel)
+	, SocketNameId(0)
+	, Channel(PortToChannel(InChannel))
+	, AddressHash(0)
 {
-	FCStringAnsi::Strcpy(SocketName, TCHAR_TO_UTF8(*InSocketName));
-	Channel = PortToChannel(InChannel);
+	SetSocketName(InSocketName);
 }
 #endif
 
+uint32 FInternetAddrEOS::InternSocketName(const char* InSocketName)
+{
+	if (InSocketName == nullptr || InSocketName[0] == '\0')
+	{
+		return 0;
+	}
+
+	static FCriticalSection InternLock;
+	// FString keys hash and compare case-insensitively, which matches how socket names were always compared
+	static TMap<FString, uint32> InternedNames;
+
+	const FString Name(UTF8_TO_TCHAR(InSocketName));
+
+	FScopeLock ScopeLock(&InternLock);
+	if (const uint32* ExistingId = InternedNames.Find(Name))
+	{
+		return *ExistingId;
+	}
+	return InternedNames.Add(Name, InternedNames.Num() + 1);
+}
+
+void FInternetAddrEOS::SetSocketName(const char* InSocketName)
+{
+	FCStringAnsi::Strncpy(SocketName, InSocketName, EOS_SOCKET_NAME_SIZE);
+	SocketNameId = InternSocketName(SocketName);
+	UpdateAddressHash();
+}
+
+void FInternetAddrEOS::SetSocketName(const char* InSocketName, const FInternetAddrEOS& KnownAddress)
+{
+	if (InSocketName == nullptr || FCStringAnsi::Strncmp(InSocketName, KnownAddress.SocketName, EOS_SOCKET_NAME_SIZE) != 0)
+	{
+		SetSocketName(InSocketName);
+		return;
+	}
+
+	FMemory::Memcpy(SocketName, KnownAddress.SocketName, EOS_SOCKET_NAME_SIZE);
+	SocketNameId = KnownAddress.SocketNameId;
+	UpdateAddressHash();
+}
+
+void FInternetAddrEOS::UpdateAddressHash()
+{
+	uint64 Hash = MixAddressHash(0, uint64(UPTRINT(LocalUserId)));
+	Hash = MixAddressHash(Hash, uint64(UPTRINT(RemoteUserId)));
+	AddressHash = MixAddressHash(Hash, (uint64(SocketNameId) << 8) | Channel);
+}
+
 void FInternetAddrEOS::SetIp(uint32)
 {
 	UE_LOG(LogSocketSubsystemEOS, Warning, TEXT("Calls to FInternetAddrEOS::SetIp are not valid"));
@@ -60,7 +123,7 @@ void FInternetAddrEOS::SetIp(const TCHAR* InAddr, bool& bIsValid)
 		return;
 	}
 
-	Channel = 0;
+	SetChannel(0);
 
 	TArray<FString> UrlParts;
 	FString FullAddress = InAddr;
@@ -75,7 +138,8 @@ void FInternetAddrEOS::SetIp(const TCHAR* InAddr, bool& bIsValid)
 		return;
 	}
 #if WITH_EOS_SDK
-	RemoteUserId = EOS_ProductUserId_FromString(TCHAR_TO_UTF8(*UrlParts[1]));
+	// Assign through the setter so the hash matches the fields even when the rest of the url is rejected
+	SetRemoteUserId(EOS_ProductUserId_FromString(TCHAR_TO_UTF8(*UrlParts[1])));
 	if (EOS_ProductUserId_IsValid(RemoteUserId) == EOS_FALSE)
 #endif
 	{
@@ -88,7 +152,7 @@ void FInternetAddrEOS::SetIp(const TCHAR* InAddr, bool& bIsValid)
 	SetSocketName(UrlParts[2]);
 	if (UrlParts.Num() == 4)
 	{
-		Channel = FCString::Atoi(*UrlParts[3]);
+		SetChannel(PortToChannel(FCString::Atoi(*UrlParts[3])));
 	}
 	bIsValid = true;
 }
@@ -102,7 +166,7 @@ void FInternetAddrEOS::GetIp(uint32& OutAddr) const
 
 void FInternetAddrEOS::SetPort(int32 InPort)
 {
-	Channel = PortToChannel(InPort);
+	SetChannel(PortToChannel(InPort));
 }
 
 int32 FInternetAddrEOS::GetPort() const
@@ -170,11 +234,7 @@ FString FInternetAddrEOS::ToString(bool bAppendPort) const
 
 uint32 FInternetAddrEOS::GetTypeHash() const
 {
-#if ENGINE_MAJOR_VERSION ==5 && ENGINE_MINOR_VERSION >= 2
-	return HashCombine(HashCombine(HashCombine(GetTypeHashHelper((void*)LocalUserId), GetTypeHashHelper((void*)RemoteUserId)), GetTypeHashHelper(FAnsiStringView(SocketName, EOS_SOCKET_NAME_SIZE))), Channel);
-#else 
-	return HashCombine(HashCombine(HashCombine(::GetTypeHash((void*)LocalUserId), ::GetTypeHash((void*)RemoteUserId)), ::GetTypeHash(FAnsiStringView(SocketName, EOS_SOCKET_NAME_SIZE))), Channel);
-#endif
+	return uint32(AddressHash ^ (AddressHash >> 32));
 }
 
 bool FInternetAddrEOS::IsValid() const
@@ -126,6 +126,8 @@ bool UNetDriverEIKBase::InitBase(bool bInitAsClient, FNetworkNotify* InNotify, c
 	}
 
 	static_cast<FSocketEOS*>(GetSocket())->SetLocalAddress(*EOSLocalAddress);
+	static_cast<FSocketEOS*>(GetSocket())->SetReceiveBatchSize(ReceiveBatchSize);
+	static_cast<FSocketEOS*>(GetSocket())->SetCoalesceSends(bCoalesceSends);
 
 	LocalAddr = LocalAddress;
 
@@ -327,6 +329,20 @@ int UNetDriverEIKBase::GetClientPort()
 	return 49152;
 }
 
+void UNetDriverEIKBase::TickFlush(float DeltaSeconds)
+{
+	Super::TickFlush(DeltaSeconds);
+
+	// Everything the connections sent this tick is queued on the socket when coalescing
+	if (!bIsPassthrough && bCoalesceSends)
+	{
+		if (FSocketEOS* const EOSSocket = static_cast<FSocketEOS*>(GetSocket()))
+		{
+			EOSSocket->FlushPendingSends();
+		}
+	}
+}
+
 bool UNetDriverEIKBase::IsBeaconDriver() const
 {
 	if (!GEngine) return false;
@@ -54,6 +54,39 @@ void NpLog(const TCHAR* Msg)
 #include "Windows/HideWindowsPlatformTypes.h"
 #endif
 
+#if WITH_EOS_SDK
+namespace
+{
+	/**
+	 * Coalesced datagrams start with this marker, followed by packets prefixed with their 16 bit length. A datagram
+	 * holding only the marker announces that the sender understands coalesced datagrams. UE never ends a packet on a
+	 * zero byte, so the announcement can't be mistaken for a packet and builds without coalescing drop it.
+	 */
+	const uint8 CoalescedDatagramMarker[] = { 'E', 'I', 'K', 0 };
+	constexpr int32 CoalescedDatagramMarkerSize = 4;
+
+	/** How often and how many times coalescing is announced to a peer that hasn't answered */
+	constexpr double CoalescingAnnouncementIntervalSeconds = 1.0;
+	constexpr int32 MaxCoalescingAnnouncements = 5;
+
+	/** A datagram is coalesced if it starts with the marker and its frames add up to exactly its size */
+	bool IsCoalescedDatagram(const uint8* Data, int32 Size)
+	{
+		if (Size < CoalescedDatagramMarkerSize || FMemory::Memcmp(Data, CoalescedDatagramMarker, CoalescedDatagramMarkerSize) != 0)
+		{
+			return false;
+		}
+
+		int32 Offset = CoalescedDatagramMarkerSize;
+		while (Offset + int32(sizeof(uint16)) <= Size)
+		{
+			Offset += sizeof(uint16) + (int32(Data[Offset]) | (int32(Data[Offset + 1]) << 8));
+		}
+		return Offset == Size;
+	}
+}
+#endif
+
 FSocketEOS::FSocketEOS(FSocketSubsystemEIK& InSocketSubsystem, const FString& InSocketDescription)
 	: FSocket(ESocketType::SOCKTYPE_Datagram, InSocketDescription, NAME_None)
 	, SocketSubsystem(InSocketSubsystem)
@@ -63,9 +96,17 @@ FSocketEOS::FSocketEOS(FSocketSubsystemEIK& InSocketSubsystem, const FString& In
 	, ConnectNotifyId(EOS_INVALID_NOTIFICATIONID)
 	, ClosedNotifyCallback(nullptr)
 	, ClosedNotifyId(EOS_INVALID_NOTIFICATIONID)
+	, bCoalesceSends(false)
+	, ReceivedPacketsReadIndex(0)
+	, ReceivedPacketsNum(0)
+	, LastDrainFrame(0)
+	, bLastDrainExhausted(false)
 #endif
 {
 	CallbackAliveTracker = MakeShared<FCallbackBase>();
+#if WITH_EOS_SDK
+	UnbatchedPacket.Data.SetNumUninitialized(EOS_P2P_MAX_PACKET_SIZE);
+#endif
 }
 
 FSocketEOS::~FSocketEOS()
@@ -91,6 +132,11 @@ bool FSocketEOS::Close()
 	check(IsInGameThread() && "p2p does not support multithreading");
 
 #if WITH_EOS_SDK
+	// Let anything still queued go out before the connections are closed
+	FlushPendingSends();
+	PendingSends.Empty();
+	CoalescingPeers.Empty();
+
 	if (ConnectNotifyId != EOS_INVALID_NOTIFICATIONID)
 	{
 		EOS_P2P_RemoveNotifyPeerConnectionRequest(SocketSubsystem.GetP2PHandle(), ConnectNotifyId);
@@ -122,6 +168,15 @@ bool FSocketEOS::Close()
 
 		ClosedRemotes.Empty();
 	}
+
+	// Anything still buffered belongs to connections we just closed
+	ReceivedPacketsReadIndex = 0;
+	ReceivedPacketsNum = 0;
+	UnbatchedPacket.Size = 0;
+	UnbatchedPacket.ReadOffset = 0;
+	UnbatchedPacket.bCoalesced = false;
+	UnbatchedPacket.SourceAddress = nullptr;
+	SourceAddressCache.Empty();
 #endif
 	return true;
 }
@@ -220,9 +275,10 @@ bool FSocketEOS::Listen(int32)
 
 		if (Info->LocalUserId == LocalAddress.GetLocalUserId() && FCStringAnsi::Stricmp(Info->SocketId->SocketName, LocalAddress.GetSocketName()) == 0)
 		{
-			// In case they disconnected and then reconnected, remove them from our closed list
-			FInternetAddrEOS RemoteAddress(Info->RemoteUserId, Info->SocketId->SocketName, LocalAddress.GetChannel());
-			RemoteAddress.SetLocalUserId(LocalAddress.GetLocalUserId());
+			// In case they disconnected and then reconnected, remove them from our closed list.
+			// The socket name matched ours above, so start from our address instead of re-interning it
+			FInternetAddrEOS RemoteAddress = LocalAddress;
+			RemoteAddress.SetRemoteUserId(Info->RemoteUserId);
 			ClosedRemotes.Remove(RemoteAddress);
 
 			EOS_P2P_SocketId SocketId = { };
@@ -276,6 +332,28 @@ bool FSocketEOS::HasPendingData(uint32& PendingDataSize)
 	PendingDataSize = 0;
 
 #if WITH_EOS_SDK
+	if (ReceivedPackets.Num() > 0)
+	{
+		const uint8* PacketData = nullptr;
+		int32 PacketSize = 0;
+		const FInternetAddrEOS* PacketSource = nullptr;
+		if (!PeekReceivedPacket(PacketData, PacketSize, PacketSource))
+		{
+			return false;
+		}
+		PendingDataSize = PacketSize;
+		return true;
+	}
+
+	// The rest of a coalesced datagram received on the per-packet path
+	const uint8* FrameData = nullptr;
+	int32 FrameSize = 0;
+	if (PeekFrame(UnbatchedPacket, FrameData, FrameSize))
+	{
+		PendingDataSize = FrameSize;
+		return true;
+	}
+
 	EOS_P2P_GetNextReceivedPacketSizeOptions Options = { };
 	Options.ApiVersion = EOS_P2P_GETNEXTRECEIVEDPACKETSIZE_API_LATEST;
 	Options.LocalUserId = LocalAddress.GetLocalUserId();
@@ -384,30 +462,25 @@ bool FSocketEOS::SendTo(const uint8* Data, int32 Count, int32& OutBytesSent, con
 
 #if WITH_EOS_SDK
 	// Need to handle closures if we are a client and the server closes down on us
-	RegisterClosedNotification();
-
-	EOS_P2P_SocketId SocketId = { };
-	SocketId.ApiVersion = EOS_P2P_SOCKETID_API_LATEST;
-	FCStringAnsi::Strcpy(SocketId.SocketName, DestinationAddress.GetSocketName());
+	if (ClosedNotifyId == EOS_INVALID_NOTIFICATIONID)
+	{
+		RegisterClosedNotification();
+	}
 
-	EOS_P2P_SendPacketOptions Options = { };
-	Options.ApiVersion = EOS_P2P_SENDPACKET_API_LATEST;
-	Options.LocalUserId = LocalAddress.GetLocalUserId();
-	Options.RemoteUserId = DestinationAddress.GetRemoteUserId();
-	Options.SocketId = &SocketId;
-	Options.bAllowDelayedDelivery = EOS_TRUE;
-	Options.Reliability = EOS_EPacketReliability::EOS_PR_UnreliableUnordered;
-	Options.Channel = DestinationAddress.GetChannel();
-	Options.DataLengthBytes = Count;
-	Options.Data = Data;
-	EOS_EResult Result = EOS_P2P_SendPacket(SocketSubsystem.GetP2PHandle(), &Options);
-	NP_LOG(TEXT("[%s] - EOS_P2P_SendPacket() to (%s) result code = (%s)\r\n"), GetLogPrefix(), *Destination.ToString(true), ANSI_TO_TCHAR(EOS_EResult_ToString(Result)));
-	if (Result != EOS_EResult::EOS_Success)
+	if (bCoalesceSends)
 	{
-		UE_LOG(LogSocketSubsystemEOS, Error, TEXT("Unable to send data to (%s) result code = (%s)"), *Destination.ToString(true), ANSI_TO_TCHAR(EOS_EResult_ToString(Result)));
+		FCoalescingPeer& Peer = CoalescingPeers.FindOrAdd(DestinationAddress);
+		if (Peer.bAcceptsCoalesced)
+		{
+			return QueueCoalescedSend(DestinationAddress, Data, Count, OutBytesSent);
+		}
 
-		// @todo joeg - map EOS codes to UE4's
-		SocketSubsystem.SetLastSocketError(ESocketErrors::SE_EINVAL);
+		// Until the peer shows it can split coalesced datagrams, packets go out as they are
+		AnnounceCoalescing(DestinationAddress, Peer);
+	}
+
+	if (!SendDatagram(DestinationAddress, Data, Count))
+	{
 		return false;
 	}
 	OutBytesSent = Count;
@@ -448,41 +521,123 @@ bool FSocketEOS::RecvFrom(uint8* Data, int32 BufferSize, int32& BytesRead, FInte
 	}
 
 #if WITH_EOS_SDK
+	if (ReceivedPackets.Num() > 0)
+	{
+		const uint8* PacketData = nullptr;
+		int32 PacketSize = 0;
+		const FInternetAddrEOS* PacketSource = nullptr;
+		if (!PeekReceivedPacket(PacketData, PacketSize, PacketSource))
+		{
+			// No data to read
+			SocketSubsystem.SetLastSocketError(ESocketErrors::SE_EWOULDBLOCK);
+			return false;
+		}
+
+		ConsumeReceivedPacket(PacketSize);
+		if (PacketSize > BufferSize)
+		{
+			UE_LOG(LogSocketSubsystemEOS, Error, TEXT("Unable to receive data, packet of size (%d) does not fit buffer of size (%d)"), PacketSize, BufferSize);
+
+			SocketSubsystem.SetLastSocketError(ESocketErrors::SE_EMSGSIZE);
+			return false;
+		}
+
+		FMemory::Memcpy(Data, PacketData, PacketSize);
+		BytesRead = PacketSize;
+		static_cast<FInternetAddrEOS&>(Source) = *PacketSource;
+
+		NP_LOG(TEXT("[%s] - Batched receive of size (%d) from (%s)\r\n"), GetLogPrefix(), BytesRead, *PacketSource->ToString(true));
+		return true;
+	}
+
+	// The rest of a coalesced datagram received on the per-packet path
+	if (ReadUnbatchedFrame(Data, BufferSize, BytesRead, Source))
+	{
+		return true;
+	}
+
 	EOS_P2P_ReceivePacketOptions Options = { };
 	Options.ApiVersion = EOS_P2P_RECEIVEPACKET_API_LATEST;
 	Options.LocalUserId = LocalAddress.GetLocalUserId();
-	Options.MaxDataSizeBytes = BufferSize;
 	uint8 Channel = LocalAddress.GetChannel();
 	Options.RequestedChannel = &Channel;
 
-	EOS_ProductUserId RemoteUserId = nullptr;
-	EOS_P2P_SocketId SocketId;
-	
-	EOS_EResult Result = EOS_P2P_ReceivePacket(SocketSubsystem.GetP2PHandle(), &Options, &RemoteUserId, &SocketId, &Channel, Data, (uint32*)&BytesRead);
-	NP_LOG(TEXT("[%s] - EOS_P2P_ReceivePacket() for user (%s) and channel (%d) with result code = (%s)\r\n"), GetLogPrefix(), *MakeStringFromProductUserId(LocalAddress.GetLocalUserId()), Channel, ANSI_TO_TCHAR(EOS_EResult_ToString(Result)));
-	if (Result == EOS_EResult::EOS_NotFound)
-	{
-		// No data to read
-		SocketSubsystem.SetLastSocketError(ESocketErrors::SE_EWOULDBLOCK);
-		return false;
-	}
-	else if (Result != EOS_EResult::EOS_Success)
+	// A coalesced datagram can be larger than a single packet, so small buffers receive into our own first
+	const bool bReceiveDirectly = BufferSize >= EOS_P2P_MAX_PACKET_SIZE;
+	uint8* const ReceiveBuffer = bReceiveDirectly ? Data : UnbatchedPacket.Data.GetData();
+	Options.MaxDataSizeBytes = bReceiveDirectly ? BufferSize : EOS_P2P_MAX_PACKET_SIZE;
+
+	for (;;)
 	{
-		UE_LOG(LogSocketSubsystemEOS, Error, TEXT("Unable to receive data result code = (%s)"), ANSI_TO_TCHAR(EOS_EResult_ToString(Result)));
+		EOS_ProductUserId RemoteUserId = nullptr;
+		EOS_P2P_SocketId SocketId;
+		Channel = LocalAddress.GetChannel();
 
-		// @todo joeg - map EOS codes to UE4's
-		SocketSubsystem.SetLastSocketError(ESocketErrors::SE_EINVAL);
-		return false;
-	}
+		EOS_EResult Result = EOS_P2P_ReceivePacket(SocketSubsystem.GetP2PHandle(), &Options, &RemoteUserId, &SocketId, &Channel, ReceiveBuffer, (uint32*)&BytesRead);
+		NP_LOG(TEXT("[%s] - EOS_P2P_ReceivePacket() for user (%s) and channel (%d) with result code = (%s)\r\n"), GetLogPrefix(), *MakeStringFromProductUserId(LocalAddress.GetLocalUserId()), Channel, ANSI_TO_TCHAR(EOS_EResult_ToString(Result)));
+		if (Result == EOS_EResult::EOS_NotFound)
+		{
+			// No data to read
+			BytesRead = 0;
+			SocketSubsystem.SetLastSocketError(ESocketErrors::SE_EWOULDBLOCK);
+			return false;
+		}
+		else if (Result != EOS_EResult::EOS_Success)
+		{
+			UE_LOG(LogSocketSubsystemEOS, Error, TEXT("Unable to receive data result code = (%s)"), ANSI_TO_TCHAR(EOS_EResult_ToString(Result)));
 
-	FInternetAddrEOS& SourceAddress = static_cast<FInternetAddrEOS&>(Source);
-	SourceAddress.SetLocalUserId(LocalAddress.GetLocalUserId());
-	SourceAddress.SetRemoteUserId(RemoteUserId);
-	SourceAddress.SetSocketName(SocketId.SocketName);
-	SourceAddress.SetChannel(Channel);
+			// @todo joeg - map EOS codes to UE4's
+			BytesRead = 0;
+			SocketSubsystem.SetLastSocketError(ESocketErrors::SE_EINVAL);
+			return false;
+		}
+		FEIKSDKActivity::Notify();
 
-	NP_LOG(TEXT("[%s] - EOS_P2P_ReceivePacket() of size (%d) from (%s)\r\n"), GetLogPrefix(), BytesRead, *SourceAddress.ToString(true));
-	return true;
+		if (IsCoalescedDatagram(ReceiveBuffer, BytesRead))
+		{
+			// Split it from our own buffer, Data only has room for one of its packets at a time
+			const FInternetAddrEOS& PacketSource = GetCachedSourceAddress(RemoteUserId, SocketId.SocketName, Channel);
+			OnCoalescedDatagramReceived(PacketSource, BytesRead);
+			if (bReceiveDirectly)
+			{
+				FMemory::Memcpy(UnbatchedPacket.Data.GetData(), Data, BytesRead);
+			}
+			UnbatchedPacket.Size = BytesRead;
+			UnbatchedPacket.ReadOffset = CoalescedDatagramMarkerSize;
+			UnbatchedPacket.bCoalesced = true;
+			UnbatchedPacket.SourceAddress = &PacketSource;
+
+			BytesRead = 0;
+			if (ReadUnbatchedFrame(Data, BufferSize, BytesRead, Source))
+			{
+				return true;
+			}
+			// Only an announcement, look for the next packet
+			continue;
+		}
+
+		if (!bReceiveDirectly)
+		{
+			if (BytesRead > BufferSize)
+			{
+				UE_LOG(LogSocketSubsystemEOS, Error, TEXT("Unable to receive data, packet of size (%d) does not fit buffer of size (%d)"), BytesRead, BufferSize);
+
+				BytesRead = 0;
+				SocketSubsystem.SetLastSocketError(ESocketErrors::SE_EMSGSIZE);
+				return false;
+			}
+			FMemory::Memcpy(Data, ReceiveBuffer, BytesRead);
+		}
+
+		FInternetAddrEOS& SourceAddress = static_cast<FInternetAddrEOS&>(Source);
+		SourceAddress.SetLocalUserId(LocalAddress.GetLocalUserId());
+		SourceAddress.SetRemoteUserId(RemoteUserId);
+		SourceAddress.SetSocketName(SocketId.SocketName, LocalAddress);
+		SourceAddress.SetChannel(Channel);
+
+		NP_LOG(TEXT("[%s] - EOS_P2P_ReceivePacket() of size (%d) from (%s)\r\n"), GetLogPrefix(), BytesRead, *SourceAddress.ToString(true));
+		return true;
+	}
 #else
 	return false;
 #endif
@@ -621,6 +776,14 @@ bool FSocketEOS::Close(const FInternetAddrEOS& RemoteAddress)
 	}
 
 #if WITH_EOS_SDK
+	// Let anything still queued for them go out before the connection goes away
+	if (TArray<uint8>* Datagram = PendingSends.Find(RemoteAddress))
+	{
+		FlushPendingSends(RemoteAddress, *Datagram);
+		PendingSends.Remove(RemoteAddress);
+	}
+	CoalescingPeers.Remove(RemoteAddress);
+
 	// So we don't reopen a connection by sending to it
 	ClosedRemotes.Add(RemoteAddress);
 
@@ -676,11 +839,331 @@ void FSocketEOS::RegisterClosedNotification()
 	ClosedNotifyCallback->CallbackLambda = [this](const EOS_P2P_OnRemoteConnectionClosedInfo* Info)
 	{
 		// Add this connection to the list of closed ones
-		FInternetAddrEOS RemoteAddress(Info->RemoteUserId, Info->SocketId->SocketName, LocalAddress.GetChannel());
-		RemoteAddress.SetLocalUserId(LocalAddress.GetLocalUserId());
+		FInternetAddrEOS RemoteAddress = LocalAddress;
+		RemoteAddress.SetRemoteUserId(Info->RemoteUserId);
+		if (FCStringAnsi::Strcmp(Info->SocketId->SocketName, LocalAddress.GetSocketName()) != 0)
+		{
+			RemoteAddress.SetSocketName(Info->SocketId->SocketName);
+		}
 		ClosedRemotes.Add(RemoteAddress);
 		NP_LOG(TEXT("[%s] - Close connection received for remote address (%s)\r\n"), GetLogPrefix(), *RemoteAddress.ToString(true));
 	};
 	ClosedNotifyId = EOS_P2P_AddNotifyPeerConnectionClosed(SocketSubsystem.GetP2PHandle(), &Options, ClosedNotifyCallback, ClosedNotifyCallback->GetCallbackPtr());
 #endif
 }
+
+void FSocketEOS::SetCoalesceSends(bool bInCoalesceSends)
+{
+	check(IsInGameThread() && "p2p does not support multithreading");
+
+#if WITH_EOS_SDK
+	if (bCoalesceSends && !bInCoalesceSends)
+	{
+		FlushPendingSends();
+	}
+	bCoalesceSends = bInCoalesceSends;
+#endif
+}
+
+void FSocketEOS::FlushPendingSends()
+{
+	check(IsInGameThread() && "p2p does not support multithreading");
+
+#if WITH_EOS_SDK
+	for (TPair<FInternetAddrEOS, TArray<uint8>>& Pair : PendingSends)
+	{
+		FlushPendingSends(Pair.Key, Pair.Value);
+	}
+#endif
+}
+
+void FSocketEOS::SetReceiveBatchSize(int32 NumSlots)
+{
+	check(IsInGameThread() && "p2p does not support multithreading");
+
+#if WITH_EOS_SDK
+	NumSlots = FMath::Max(NumSlots, 0);
+
+	ReceivedPackets.SetNum(NumSlots);
+	for (FReceivedPacket& Packet : ReceivedPackets)
+	{
+		Packet.Data.SetNumUninitialized(EOS_P2P_MAX_PACKET_SIZE);
+		Packet.Size = 0;
+		Packet.ReadOffset = 0;
+		Packet.bCoalesced = false;
+		Packet.SourceAddress = nullptr;
+	}
+	ReceivedPacketsReadIndex = 0;
+	ReceivedPacketsNum = 0;
+	bLastDrainExhausted = false;
+
+	UE_LOG(LogSocketSubsystemEOS, Verbose, TEXT("Socket (%s) using %s receive with (%d) packet slots"), *LocalAddress.ToString(true), NumSlots > 0 ? TEXT("batched") : TEXT("per-packet"), NumSlots);
+#endif
+}
+
+#if WITH_EOS_SDK
+bool FSocketEOS::SendDatagram(const FInternetAddrEOS& Destination, const uint8* Data, int32 Count)
+{
+	EOS_P2P_SocketId SocketId = { };
+	SocketId.ApiVersion = EOS_P2P_SOCKETID_API_LATEST;
+	FCStringAnsi::Strcpy(SocketId.SocketName, Destination.GetSocketName());
+
+	EOS_P2P_SendPacketOptions Options = { };
+	Options.ApiVersion = EOS_P2P_SENDPACKET_API_LATEST;
+	Options.LocalUserId = LocalAddress.GetLocalUserId();
+	Options.RemoteUserId = Destination.GetRemoteUserId();
+	Options.SocketId = &SocketId;
+	Options.bAllowDelayedDelivery = EOS_TRUE;
+	Options.Reliability = EOS_EPacketReliability::EOS_PR_UnreliableUnordered;
+	Options.Channel = Destination.GetChannel();
+	Options.DataLengthBytes = Count;
+	Options.Data = Data;
+	EOS_EResult Result = EOS_P2P_SendPacket(SocketSubsystem.GetP2PHandle(), &Options);
+	NP_LOG(TEXT("[%s] - EOS_P2P_SendPacket() to (%s) result code = (%s)\r\n"), GetLogPrefix(), *Destination.ToString(true), ANSI_TO_TCHAR(EOS_EResult_ToString(Result)));
+	if (Result != EOS_EResult::EOS_Success)
+	{
+		UE_LOG(LogSocketSubsystemEOS, Error, TEXT("Unable to send data to (%s) result code = (%s)"), *Destination.ToString(true), ANSI_TO_TCHAR(EOS_EResult_ToString(Result)));
+
+		// @todo joeg - map EOS codes to UE4's
+		SocketSubsystem.SetLastSocketError(ESocketErrors::SE_EINVAL);
+		return false;
+	}
+	FEIKSDKActivity::Notify();
+	return true;
+}
+
+bool FSocketEOS::QueueCoalescedSend(const FInternetAddrEOS& Destination, const uint8* Data, int32 Count, int32& OutBytesSent)
+{
+	// Each packet is prefixed with its 16 bit length so the receiver can split the datagram again
+	const int32 FramedCount = Count + sizeof(uint16);
+	if (CoalescedDatagramMarkerSize + FramedCount > EOS_P2P_MAX_PACKET_SIZE)
+	{
+		UE_LOG(LogSocketSubsystemEOS, Warning, TEXT("Unable to send data, framed data over maximum size. Amount=[%d/%d] DestinationAddress = (%s)"), CoalescedDatagramMarkerSize + FramedCount, EOS_P2P_MAX_PACKET_SIZE, *Destination.ToString(true));
+
+		SocketSubsystem.SetLastSocketError(ESocketErrors::SE_EMSGSIZE);
+		return false;
+	}
+
+	TArray<uint8>& Datagram = PendingSends.FindOrAdd(Destination);
+	if (Datagram.Num() + FramedCount > EOS_P2P_MAX_PACKET_SIZE)
+	{
+		const bool bSent = SendDatagram(Destination, Datagram.GetData(), Datagram.Num());
+		Datagram.Reset();
+		if (!bSent)
+		{
+			return false;
+		}
+	}
+
+	if (Datagram.Num() == 0)
+	{
+		Datagram.Reserve(EOS_P2P_MAX_PACKET_SIZE);
+		Datagram.Append(CoalescedDatagramMarker, CoalescedDatagramMarkerSize);
+	}
+	Datagram.Add(uint8(Count & 0xFF));
+	Datagram.Add(uint8(Count >> 8));
+	Datagram.Append(Data, Count);
+
+	OutBytesSent = Count;
+	return true;
+}
+
+void FSocketEOS::FlushPendingSends(const FInternetAddrEOS& Destination, TArray<uint8>& Datagram)
+{
+	if (Datagram.Num() > CoalescedDatagramMarkerSize)
+	{
+		SendDatagram(Destination, Datagram.GetData(), Datagram.Num());
+	}
+	Datagram.Reset();
+}
+
+void FSocketEOS::AnnounceCoalescing(const FInternetAddrEOS& Destination, FCoalescingPeer& Peer)
+{
+	const double NowSeconds = FPlatformTime::Seconds();
+	if (Peer.NumAnnouncements >= MaxCoalescingAnnouncements || NowSeconds - Peer.LastAnnouncementSeconds < CoalescingAnnouncementIntervalSeconds)
+	{
+		return;
+	}
+
+	++Peer.NumAnnouncements;
+	Peer.LastAnnouncementSeconds = NowSeconds;
+	SendDatagram(Destination, CoalescedDatagramMarker, CoalescedDatagramMarkerSize);
+}
+
+void FSocketEOS::OnCoalescedDatagramReceived(const FInternetAddrEOS& Source, int32 Size)
+{
+	FCoalescingPeer& Peer = CoalescingPeers.FindOrAdd(Source);
+	Peer.bAcceptsCoalesced = true;
+
+	// Answer an announcement once, so a peer that coalesces learns we can split its datagrams even if we don't coalesce
+	if (Size == CoalescedDatagramMarkerSize && Peer.NumAnnouncements == 0)
+	{
+		Peer.NumAnnouncements = MaxCoalescingAnnouncements;
+		SendDatagram(Source, CoalescedDatagramMarker, CoalescedDatagramMarkerSize);
+	}
+}
+
+bool FSocketEOS::PeekFrame(const FReceivedPacket& Packet, const uint8*& OutData, int32& OutSize) const
+{
+	if (!Packet.bCoalesced || Packet.ReadOffset + int32(sizeof(uint16)) > Packet.Size)
+	{
+		return false;
+	}
+
+	// IsCoalescedDatagram already checked the frames fit the datagram
+	const uint8* Frame = Packet.Data.GetData() + Packet.ReadOffset;
+	OutData = Frame + sizeof(uint16);
+	OutSize = int32(Frame[0]) | (int32(Frame[1]) << 8);
+	return true;
+}
+
+bool FSocketEOS::ReadUnbatchedFrame(uint8* Data, int32 BufferSize, int32& BytesRead, FInternetAddr& Source)
+{
+	const uint8* FrameData = nullptr;
+	int32 FrameSize = 0;
+	while (PeekFrame(UnbatchedPacket, FrameData, FrameSize))
+	{
+		UnbatchedPacket.ReadOffset += sizeof(uint16) + FrameSize;
+		if (FrameSize > BufferSize)
+		{
+			UE_LOG(LogSocketSubsystemEOS, Error, TEXT("Unable to receive data, packet of size (%d) does not fit buffer of size (%d)"), FrameSize, BufferSize);
+			continue;
+		}
+
+		FMemory::Memcpy(Data, FrameData, FrameSize);
+		BytesRead = FrameSize;
+		static_cast<FInternetAddrEOS&>(Source) = *UnbatchedPacket.SourceAddress;
+		return true;
+	}
+	return false;
+}
+
+bool FSocketEOS::PeekReceivedPacket(const uint8*& OutData, int32& OutSize, const FInternetAddrEOS*& OutSource)
+{
+	while (DrainReceivedPackets())
+	{
+		FReceivedPacket& Packet = ReceivedPackets[ReceivedPacketsReadIndex];
+		OutSource = Packet.SourceAddress;
+
+		if (!Packet.bCoalesced)
+		{
+			OutData = Packet.Data.GetData();
+			OutSize = Packet.Size;
+			return true;
+		}
+
+		if (PeekFrame(Packet, OutData, OutSize))
+		{
+			return true;
+		}
+
+		// This datagram is used up, or was only an announcement, move on to the next one
+		++ReceivedPacketsReadIndex;
+	}
+	return false;
+}
+
+void FSocketEOS::ConsumeReceivedPacket(int32 Size)
+{
+	FReceivedPacket& Packet = ReceivedPackets[ReceivedPacketsReadIndex];
+	if (Packet.bCoalesced)
+	{
+		Packet.ReadOffset += sizeof(uint16) + Size;
+		if (Packet.ReadOffset < Packet.Size)
+		{
+			return;
+		}
+	}
+	++ReceivedPacketsReadIndex;
+}
+
+bool FSocketEOS::DrainReceivedPackets()
+{
+	if (ReceivedPacketsReadIndex < ReceivedPacketsNum)
+	{
+		return true;
+	}
+
+	// Everything the SDK had for us this frame has already been handed out
+	if (LastDrainFrame == GFrameCounter && bLastDrainExhausted)
+	{
+		return false;
+	}
+
+	ReceivedPacketsReadIndex = 0;
+	ReceivedPacketsNum = 0;
+	LastDrainFrame = GFrameCounter;
+	bLastDrainExhausted = false;
+
+	uint8 RequestedChannel = LocalAddress.GetChannel();
+
+	EOS_P2P_ReceivePacketOptions Options = { };
+	Options.ApiVersion = EOS_P2P_RECEIVEPACKET_API_LATEST;
+	Options.LocalUserId = LocalAddress.GetLocalUserId();
+	Options.MaxDataSizeBytes = EOS_P2P_MAX_PACKET_SIZE;
+	Options.RequestedChannel = &RequestedChannel;
+
+	const EOS_HP2P P2PHandle = SocketSubsystem.GetP2PHandle();
+	while (ReceivedPacketsNum < ReceivedPackets.Num())
+	{
+		FReceivedPacket& Packet = ReceivedPackets[ReceivedPacketsNum];
+
+		EOS_ProductUserId RemoteUserId = nullptr;
+		EOS_P2P_SocketId SocketId;
+		uint8 Channel = RequestedChannel;
+		uint32 BytesRead = 0;
+
+		EOS_EResult Result = EOS_P2P_ReceivePacket(P2PHandle, &Options, &RemoteUserId, &SocketId, &Channel, Packet.Data.GetData(), &BytesRead);
+		if (Result == EOS_EResult::EOS_NotFound)
+		{
+			bLastDrainExhausted = true;
+			break;
+		}
+		else if (Result != EOS_EResult::EOS_Success)
+		{
+			UE_LOG(LogSocketSubsystemEOS, Error, TEXT("Unable to receive data result code = (%s)"), ANSI_TO_TCHAR(EOS_EResult_ToString(Result)));
+
+			// Hand out what we already have and retry on the next frame
+			bLastDrainExhausted = true;
+			break;
+		}
+
+		Packet.Size = BytesRead;
+		Packet.SourceAddress = &GetCachedSourceAddress(RemoteUserId, SocketId.SocketName, Channel);
+		Packet.bCoalesced = IsCoalescedDatagram(Packet.Data.GetData(), BytesRead);
+		Packet.ReadOffset = Packet.bCoalesced ? CoalescedDatagramMarkerSize : 0;
+		if (Packet.bCoalesced)
+		{
+			OnCoalescedDatagramReceived(*Packet.SourceAddress, BytesRead);
+		}
+		++ReceivedPacketsNum;
+	}
+
+	NP_LOG(TEXT("[%s] - Drained (%d) packets for user (%s) and channel (%d)\r\n"), GetLogPrefix(), ReceivedPacketsNum, *MakeStringFromProductUserId(LocalAddress.GetLocalUserId()), RequestedChannel);
+	if (ReceivedPacketsNum > 0)
+	{
+		FEIKSDKActivity::Notify();
+		return true;
+	}
+	return false;
+}
+
+const FInternetAddrEOS& FSocketEOS::GetCachedSourceAddress(EOS_ProductUserId RemoteUserId, const char* InSocketName, uint8 InChannel)
+{
+	TUniquePtr<FInternetAddrEOS>& CachedAddress = SourceAddressCache.FindOrAdd(RemoteUserId);
+	if (!CachedAddress.IsValid())
+	{
+		CachedAddress = MakeUnique<FInternetAddrEOS>();
+		CachedAddress->SetLocalUserId(LocalAddress.GetLocalUserId());
+		CachedAddress->SetRemoteUserId(RemoteUserId);
+		CachedAddress->SetSocketName(InSocketName, LocalAddress);
+		CachedAddress->SetChannel(InChannel);
+	}
+	else if (CachedAddress->GetChannel() != InChannel || FCStringAnsi::Strcmp(CachedAddress->GetSocketName(), InSocketName) != 0)
+	{
+		CachedAddress->SetSocketName(InSocketName, LocalAddress);
+		CachedAddress->SetChannel(InChannel);
+	}
+	return *CachedAddress;
+}
+#endif
@@ -252,7 +252,7 @@ bool FSocketSubsystemEIK::BindChannel(const FInternetAddrEOS& Address)
 
 	const uint8 Channel = Address.GetChannel();
 
-	FChannelSet& ExistingBoundPorts = BoundAddresses.FindOrAdd(Address.GetSocketName());
+	FChannelSet& ExistingBoundPorts = BoundAddresses.FindOrAdd(Address.GetSocketNameId());
 	if (ExistingBoundPorts.Contains(Channel))
 	{
 		SetLastSocketError(ESocketErrors::SE_EADDRINUSE);
@@ -271,11 +271,11 @@ bool FSocketSubsystemEIK::UnbindChannel(const FInternetAddrEOS& Address)
 		return false;
 	}
 
-	const FString SocketName = Address.GetSocketName();
+	const uint32 SocketNameId = Address.GetSocketNameId();
 	const uint8 Channel = Address.GetChannel();
 
 	// Find our sessions collection of ports
-	FChannelSet* ExistingBoundPorts = BoundAddresses.Find(SocketName);
+	FChannelSet* ExistingBoundPorts = BoundAddresses.Find(SocketNameId);
 	if (!ExistingBoundPorts)
 	{
 		SetLastSocketError(ESocketErrors::SE_ENOTSOCK);
@@ -292,7 +292,7 @@ bool FSocketSubsystemEIK::UnbindChannel(const FInternetAddrEOS& Address)
 	// Remove any empty sets
 	if (ExistingBoundPorts->Num() == 0)
 	{
-		BoundAddresses.Remove(SocketName);
+		BoundAddresses.Remove(SocketNameId);
 		ExistingBoundPorts = nullptr;
 	}
 
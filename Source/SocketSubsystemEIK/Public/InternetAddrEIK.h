@@ -49,19 +49,21 @@ public:
 	{
 		LocalUserId = Other.LocalUserId;
 		RemoteUserId = Other.RemoteUserId;
-		FCStringAnsi::Strcpy(SocketName, Other.SocketName);
+		FMemory::Memcpy(SocketName, Other.SocketName, EOS_SOCKET_NAME_SIZE);
+		SocketNameId = Other.SocketNameId;
 		Channel = Other.Channel;
+		AddressHash = Other.AddressHash;
 		return *this;
 	}
 	
+	/** Socket names are interned case-insensitively, so this never touches the name itself */
 	FORCEINLINE friend bool operator==(const FInternetAddrEOS& A, const FInternetAddrEOS& B)
 	{
-		return A.Channel == B.Channel
-#if WITH_EOS_SDK
+		return A.AddressHash == B.AddressHash
+			&& A.Channel == B.Channel
+			&& A.SocketNameId == B.SocketNameId
 			&& A.LocalUserId == B.LocalUserId
-			&& A.RemoteUserId == B.RemoteUserId
-#endif
-			&& FCStringAnsi::Stricmp(A.GetSocketName(), B.GetSocketName()) == 0;
+			&& A.RemoteUserId == B.RemoteUserId;
 	}
 
 	FORCEINLINE friend bool operator!=(const FInternetAddrEOS& A, const FInternetAddrEOS& B)
@@ -76,23 +78,19 @@ public:
 
 	friend bool operator<(const FInternetAddrEOS& Left, const FInternetAddrEOS& Right)
 	{
-#if WITH_EOS_SDK
-		if (Left.GetLocalUserId() < Right.GetLocalUserId())
+		if (Left.LocalUserId != Right.LocalUserId)
 		{
-			return true;
+			return Left.LocalUserId < Right.LocalUserId;
 		}
-		else if (Left.GetRemoteUserId() < Right.GetRemoteUserId())
+		if (Left.RemoteUserId != Right.RemoteUserId)
 		{
-			return true;
+			return Left.RemoteUserId < Right.RemoteUserId;
 		}
-		else
-#endif
-		if (FCStringAnsi::Stricmp(Left.GetSocketName(), Right.GetSocketName()) < 0)
+		if (Left.SocketNameId != Right.SocketNameId)
 		{
-			return true;
+			return Left.SocketNameId < Right.SocketNameId;
 		}
-
-		return Left.GetChannel() < Right.GetChannel();
+		return Left.Channel < Right.Channel;
 	}
 
 #if WITH_EOS_SDK
@@ -104,11 +102,13 @@ public:
 	void SetLocalUserId(EOS_ProductUserId InLocalUserId)
 	{
 		LocalUserId = InLocalUserId;
+		UpdateAddressHash();
 	}
 
 	void SetRemoteUserId(EOS_ProductUserId InRemoteUserId)
 	{
 		RemoteUserId = InRemoteUserId;
+		UpdateAddressHash();
 	}
 
 	EOS_ProductUserId GetRemoteUserId() const
@@ -124,11 +124,13 @@ public:
 	void SetLocalUserId(void* InLocalUserId)
 	{
 		LocalUserId = InLocalUserId;
+		UpdateAddressHash();
 	}
 
 	void SetRemoteUserId(void* InRemoteUserId)
 	{
 		RemoteUserId = InRemoteUserId;
+		UpdateAddressHash();
 	}
 
 	void* GetRemoteUserId() const
@@ -144,12 +146,21 @@ public:
 
 	void SetSocketName(const FString& InSocketName)
 	{
-		FCStringAnsi::Strncpy(SocketName, TCHAR_TO_UTF8(*InSocketName), EOS_SOCKET_NAME_SIZE);
+		SetSocketName(TCHAR_TO_UTF8(*InSocketName));
 	}
 
-	void SetSocketName(const char* InSocketName)
+	void SetSocketName(const char* InSocketName);
+
+	/**
+	 * Sets a socket name received from the SDK, reusing KnownAddress's interned id when the name matches it
+	 * so the receive path doesn't intern per packet. Names are interned once when sockets are bound.
+	 */
+	void SetSocketName(const char* InSocketName, const FInternetAddrEOS& KnownAddress);
+
+	/** Id the socket name was interned to, equal ids mean the names match case-insensitively */
+	uint32 GetSocketNameId() const
 	{
-		FCStringAnsi::Strncpy(SocketName, InSocketName, EOS_SOCKET_NAME_SIZE);
+		return SocketNameId;
 	}
 
 	uint8 GetChannel() const
@@ -160,9 +171,24 @@ public:
 	void SetChannel(uint8 InChannel)
 	{
 		Channel = InChannel;
+		UpdateAddressHash();
+	}
+
+	/** 64 bit hash over (local user, remote user, socket name id, channel), kept up to date by the setters */
+	uint64 GetAddressHash() const
+	{
+		return AddressHash;
 	}
 
+	/**
+	 * Interns a socket name, returning the same id for names that only differ by case.
+	 * The empty name is always id 0.
+	 */
+	static uint32 InternSocketName(const char* InSocketName);
+
 private:
+	void UpdateAddressHash();
+
 #if WITH_EOS_SDK
 	EOS_ProductUserId LocalUserId;
 	EOS_ProductUserId RemoteUserId;
@@ -171,7 +197,9 @@ private:
 	void* RemoteUserId;
 #endif
 	char SocketName[EOS_SOCKET_NAME_SIZE];
+	uint32 SocketNameId;
 	uint8 Channel;
+	uint64 AddressHash;
 
 	friend class SocketSubsystemEOS;
 };
@@ -25,6 +25,7 @@ public:
 	virtual ISocketSubsystem* GetSocketSubsystem() override;
 	virtual void Shutdown() override;
 	virtual int GetClientPort() override;
+	virtual void TickFlush(float DeltaSeconds) override;
 	bool IsBeaconDriver() const;
 //~ End UNetDriver Interface
 
@@ -39,4 +40,18 @@ public:
 #endif */
 	UPROPERTY(Config)
 	bool bIsUsingP2PSockets = true;
+
+	/**
+	 * Number of packet slots the P2P socket drains the SDK receive queue into once per frame.
+	 * 0 keeps the per-packet receive path. Each slot holds EOS_P2P_MAX_PACKET_SIZE bytes.
+	 */
+	UPROPERTY(Config)
+	int32 ReceiveBatchSize = 0;
+
+	/**
+	 * Queue outgoing packets per remote peer and send them as coalesced datagrams at the end of the tick.
+	 * Peers are only sent coalesced datagrams once they have shown they understand them, so mixed settings still connect.
+	 */
+	UPROPERTY(Config)
+	bool bCoalesceSends = false;
 };
@@ -71,15 +71,127 @@ public:
 
 	bool Close(const FInternetAddrEOS& RemoteAddress);
 
-	bool WasClosed(const FInternetAddrEOS& RemoteAddress)
+	bool WasClosed(const FInternetAddrEOS& RemoteAddress) const
 	{
-		int32 Index = -1;
-		return ClosedRemotes.Find(RemoteAddress, Index);
+		return ClosedRemotes.Contains(RemoteAddress);
 	}
 
 	void RegisterClosedNotification();
 
+	/**
+	 * Switches the socket to batched receive. Everything queued on our channel is drained into a
+	 * reusable set of preallocated packet slots once per frame, and HasPendingData/RecvFrom are served from it.
+	 *
+	 * @param NumSlots number of packet slots to preallocate, 0 restores the per-packet receive path
+	 */
+	void SetReceiveBatchSize(int32 NumSlots);
+
+	/**
+	 * Queues outgoing packets per remote address and sends them as coalesced datagrams from FlushPendingSends.
+	 * Coalesced datagrams are marked so every receiver recognises them whatever its own setting. Packets to a peer
+	 * are only coalesced once it has shown it understands them, until then they are sent as they are and the peer
+	 * is told we coalesce, so peers with coalescing off and builds without it keep working.
+	 */
+	void SetCoalesceSends(bool bInCoalesceSends);
+
+	/** Sends everything queued by SetCoalesceSends, expected once at the end of the net driver tick */
+	void FlushPendingSends();
+
 private:
+#if WITH_EOS_SDK
+	/** Sends one unreliable datagram to Destination without any queueing */
+	bool SendDatagram(const FInternetAddrEOS& Destination, const uint8* Data, int32 Count);
+
+	/** Appends a length-framed packet to the datagram being built for Destination */
+	bool QueueCoalescedSend(const FInternetAddrEOS& Destination, const uint8* Data, int32 Count, int32& OutBytesSent);
+
+	/** Sends and empties the queued datagram for a single remote address */
+	void FlushPendingSends(const FInternetAddrEOS& Destination, TArray<uint8>& Datagram);
+
+	/** What we know about a remote's support for coalesced datagrams */
+	struct FCoalescingPeer
+	{
+		/** Set once the peer sent us a coalesced datagram or an announcement */
+		bool bAcceptsCoalesced = false;
+		int32 NumAnnouncements = 0;
+		double LastAnnouncementSeconds = 0.0;
+	};
+
+	/** Tells a peer we understand coalesced datagrams, throttled and given up after a few tries */
+	void AnnounceCoalescing(const FInternetAddrEOS& Destination, FCoalescingPeer& Peer);
+
+	/** Records that Source understands coalesced datagrams, and answers its announcement */
+	void OnCoalescedDatagramReceived(const FInternetAddrEOS& Source, int32 Size);
+
+	/** Whether SendTo queues into PendingSends for peers that accept coalesced datagrams */
+	bool bCoalesceSends;
+
+	/** Datagrams waiting for FlushPendingSends, keyed by destination */
+	TMap<FInternetAddrEOS, TArray<uint8>> PendingSends;
+
+	/** Coalescing state of the remotes we sent to or received coalesced datagrams from */
+	TMap<FInternetAddrEOS, FCoalescingPeer> CoalescingPeers;
+
+	/** A packet drained from the SDK that has not been handed to RecvFrom yet */
+	struct FReceivedPacket
+	{
+		/** Preallocated to EOS_P2P_MAX_PACKET_SIZE and reused across drains */
+		TArray<uint8> Data;
+		int32 Size = 0;
+		/** Whether this is a coalesced datagram that is handed out one framed packet at a time */
+		bool bCoalesced = false;
+		/** Offset of the next framed packet of a coalesced datagram */
+		int32 ReadOffset = 0;
+		/** Points into SourceAddressCache, which is only cleared when the socket is closed */
+		const FInternetAddrEOS* SourceAddress = nullptr;
+	};
+
+	/** Finds the next framed packet of a coalesced datagram */
+	bool PeekFrame(const FReceivedPacket& Packet, const uint8*& OutData, int32& OutSize) const;
+
+	/** Hands out the next framed packet of a coalesced datagram received on the per-packet path */
+	bool ReadUnbatchedFrame(uint8* Data, int32 BufferSize, int32& BytesRead, FInternetAddr& Source);
+
+	/** Finds the next packet to hand out, splitting coalesced datagrams into their framed packets */
+	bool PeekReceivedPacket(const uint8*& OutData, int32& OutSize, const FInternetAddrEOS*& OutSource);
+
+	/** Advances past the packet returned by PeekReceivedPacket */
+	void ConsumeReceivedPacket(int32 Size);
+
+	/**
+	 * Pulls every packet queued on our channel into ReceivedPackets. Only drains once per frame unless
+	 * the previous drain stopped because all slots were in use.
+	 *
+	 * @return true if there is at least one packet waiting in ReceivedPackets
+	 */
+	bool DrainReceivedPackets();
+
+	/** Returns the cached source address for a remote user, refreshing it if the socket name changed */
+	const FInternetAddrEOS& GetCachedSourceAddress(EOS_ProductUserId RemoteUserId, const char* InSocketName, uint8 InChannel);
+
+	/** Preallocated packet slots used by the batched receive path, empty when it is disabled */
+	TArray<FReceivedPacket> ReceivedPackets;
+
+	/** Coalesced datagram being split on the per-packet receive path */
+	FReceivedPacket UnbatchedPacket;
+
+	/** Index of the next packet in ReceivedPackets to hand out */
+	int32 ReceivedPacketsReadIndex;
+
+	/** Number of valid packets in ReceivedPackets from the last drain */
+	int32 ReceivedPacketsNum;
+
+	/** Frame the last drain ran on */
+	uint64 LastDrainFrame;
+
+	/** Whether the last drain emptied the SDK queue, as opposed to running out of slots */
+	bool bLastDrainExhausted;
+
+	/** Source addresses of remote users we received from, so they are not rebuilt per packet */
+	TMap<EOS_ProductUserId, TUniquePtr<FInternetAddrEOS>> SourceAddressCache;
+#endif
+
+
 	/** Used to track our aliveness and make it possible to use the callback interface */
 	TSharedPtr<FCallbackBase> CallbackAliveTracker;
 
@@ -92,7 +204,8 @@ private:
 	/** Are we currently listening? */
 	bool bIsListening;
 
-	TArray<FInternetAddrEOS> ClosedRemotes;
+	/** Remotes we closed or that closed on us, hashed on the precomputed address hash */
+	TSet<FInternetAddrEOS> ClosedRemotes;
 
 #if WITH_EOS_SDK
 #if ENGINE_MAJOR_VERSION == 5
@@ -104,8 +104,8 @@ private:
 	/** All sockets allocated by this subsystem */
 	TArray<TUniquePtr<FSocketEOS>> TrackedSockets;
 
-	/** All bound socket addresses */
-	TMap<FString, FChannelSet> BoundAddresses;
+	/** All bound socket addresses, keyed by interned socket name id */
+	TMap<uint32, FChannelSet> BoundAddresses;
 
 	/** The last error we received */
 	ESocketErrors LastSocketError;